@@ -0,0 +1,296 @@
+/*
+ * Builds libsecp256k1 with its internal sha256 (used for rfc6979 nonces, anti-exfil/s2c
+ * commitments, tagged hashes etc.) routed through mbedtls - ie. the same backend wally
+ * itself uses - so it can make use of the hardware sha engine.
+ *
+ * This file is compiled in place of upstream/src/secp256k1/src/secp256k1.c (which it includes).
+ *
+ * NOTE: the esp32 sha engine can only start from the standard sha256 initial state, and
+ * cannot be loaded with an arbitrary midstate.  Hashes which callers seed with a precomputed
+ * midstate (ie. the BIP340-style tagged hashes) therefore continue to use the upstream
+ * software implementation.  Other hashes are staged in a small buffer and hashed in one shot
+ * when finalized, so the hw engine is only held for the duration of that single call (and is
+ * never left locked if secp256k1 abandons a hash part-way through).
+ * Messages too large to stage also fall back to software.
+ */
+#include <mbedtls/sha256.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+// Pull in the upstream software sha256/hmac/rfc6979 implementations under private names
+#define secp256k1_sha256 secp256k1_sha256_sw
+#define secp256k1_sha256_initialize secp256k1_sha256_sw_initialize
+#define secp256k1_sha256_initialize_tagged secp256k1_sha256_sw_initialize_tagged
+#define secp256k1_sha256_write secp256k1_sha256_sw_write
+#define secp256k1_sha256_finalize secp256k1_sha256_sw_finalize
+#define secp256k1_sha256_clear secp256k1_sha256_sw_clear
+#define secp256k1_hmac_sha256 secp256k1_hmac_sha256_sw
+#define secp256k1_hmac_sha256_initialize secp256k1_hmac_sha256_sw_initialize
+#define secp256k1_hmac_sha256_write secp256k1_hmac_sha256_sw_write
+#define secp256k1_hmac_sha256_finalize secp256k1_hmac_sha256_sw_finalize
+#define secp256k1_hmac_sha256_clear secp256k1_hmac_sha256_sw_clear
+#define secp256k1_rfc6979_hmac_sha256 secp256k1_rfc6979_hmac_sha256_sw
+#define secp256k1_rfc6979_hmac_sha256_initialize secp256k1_rfc6979_hmac_sha256_sw_initialize
+#define secp256k1_rfc6979_hmac_sha256_generate secp256k1_rfc6979_hmac_sha256_sw_generate
+#define secp256k1_rfc6979_hmac_sha256_finalize secp256k1_rfc6979_hmac_sha256_sw_finalize
+#define secp256k1_rfc6979_hmac_sha256_clear secp256k1_rfc6979_hmac_sha256_sw_clear
+
+#include "hash_impl.h"
+
+#undef secp256k1_sha256
+#undef secp256k1_sha256_initialize
+#undef secp256k1_sha256_initialize_tagged
+#undef secp256k1_sha256_write
+#undef secp256k1_sha256_finalize
+#undef secp256k1_sha256_clear
+#undef secp256k1_hmac_sha256
+#undef secp256k1_hmac_sha256_initialize
+#undef secp256k1_hmac_sha256_write
+#undef secp256k1_hmac_sha256_finalize
+#undef secp256k1_hmac_sha256_clear
+#undef secp256k1_rfc6979_hmac_sha256
+#undef secp256k1_rfc6979_hmac_sha256_initialize
+#undef secp256k1_rfc6979_hmac_sha256_generate
+#undef secp256k1_rfc6979_hmac_sha256_finalize
+#undef secp256k1_rfc6979_hmac_sha256_clear
+
+// Largest message staged for one-shot hashing - covers the rfc6979 hmac inner hash
+// (64-byte key block, V, separator byte, then key32 || msg32 || ndata32 || algo16)
+#define SECP256K1_SHA256_ONESHOT_MAX 224
+
+typedef enum { SHA256_MODE_PENDING, SHA256_MODE_ONESHOT, SHA256_MODE_SOFTWARE } secp256k1_sha256_mode;
+
+typedef struct {
+    // Exposed as upstream, as some callers set a precomputed midstate directly
+    uint32_t s[8];
+    uint64_t bytes;
+
+    secp256k1_sha256_mode mode;
+    size_t msg_len;
+    unsigned char msg[SECP256K1_SHA256_ONESHOT_MAX];
+    secp256k1_sha256_sw sw;
+} secp256k1_sha256;
+
+typedef struct {
+    secp256k1_sha256 inner;
+    unsigned char outer_key[64]; // outer hash deferred until finalize, so only one hash active
+} secp256k1_hmac_sha256;
+
+typedef struct {
+    unsigned char v[32];
+    unsigned char k[32];
+    int retry;
+} secp256k1_rfc6979_hmac_sha256;
+
+static void secp256k1_sha256_memclear(void* ptr, const size_t len)
+{
+    volatile unsigned char* p = ptr;
+    for (size_t i = 0; i < len; ++i) {
+        p[i] = 0;
+    }
+}
+
+static void secp256k1_sha256_initialize(secp256k1_sha256* hash)
+{
+    secp256k1_sha256_sw_initialize(&hash->sw);
+    memcpy(hash->s, hash->sw.s, sizeof(hash->s));
+    hash->bytes = 0;
+    hash->mode = SHA256_MODE_PENDING;
+    hash->msg_len = 0;
+}
+
+// Decide how to hash on first use - any midstate set by the caller must use software
+static void secp256k1_sha256_select_mode(secp256k1_sha256* hash)
+{
+    if (hash->mode != SHA256_MODE_PENDING) {
+        return;
+    }
+
+    if (hash->bytes) {
+        memcpy(hash->sw.s, hash->s, sizeof(hash->s));
+        hash->sw.bytes = hash->bytes;
+        hash->mode = SHA256_MODE_SOFTWARE;
+    } else {
+        hash->mode = SHA256_MODE_ONESHOT;
+    }
+}
+
+// Move any staged data into the software hasher and continue from there
+static void secp256k1_sha256_to_software(secp256k1_sha256* hash)
+{
+    if (hash->mode == SHA256_MODE_ONESHOT) {
+        secp256k1_sha256_sw_write(&hash->sw, hash->msg, hash->msg_len);
+        secp256k1_sha256_memclear(hash->msg, hash->msg_len);
+        hash->msg_len = 0;
+        hash->mode = SHA256_MODE_SOFTWARE;
+    }
+}
+
+static void secp256k1_sha256_write(secp256k1_sha256* hash, const unsigned char* data, size_t len)
+{
+    secp256k1_sha256_select_mode(hash);
+
+    if (hash->mode == SHA256_MODE_ONESHOT) {
+        if (len <= sizeof(hash->msg) - hash->msg_len) {
+            memcpy(hash->msg + hash->msg_len, data, len);
+            hash->msg_len += len;
+            return;
+        }
+        secp256k1_sha256_to_software(hash);
+    }
+    secp256k1_sha256_sw_write(&hash->sw, data, len);
+}
+
+static void secp256k1_sha256_finalize(secp256k1_sha256* hash, unsigned char* out32)
+{
+    secp256k1_sha256_select_mode(hash);
+
+    if (hash->mode == SHA256_MODE_ONESHOT) {
+        const int ret = mbedtls_sha256(hash->msg, hash->msg_len, out32, 0);
+        if (!ret) {
+            secp256k1_sha256_memclear(hash->msg, hash->msg_len);
+            hash->msg_len = 0;
+            return;
+        }
+        secp256k1_sha256_to_software(hash);
+    }
+    secp256k1_sha256_sw_finalize(&hash->sw, out32);
+}
+
+static void secp256k1_sha256_clear(secp256k1_sha256* hash) { secp256k1_sha256_memclear(hash, sizeof(*hash)); }
+
+static void secp256k1_sha256_initialize_tagged(secp256k1_sha256* hash, const unsigned char* tag, size_t taglen)
+{
+    unsigned char buf[32];
+    secp256k1_sha256_initialize(hash);
+    secp256k1_sha256_write(hash, tag, taglen);
+    secp256k1_sha256_finalize(hash, buf);
+
+    secp256k1_sha256_initialize(hash);
+    secp256k1_sha256_write(hash, buf, 32);
+    secp256k1_sha256_write(hash, buf, 32);
+}
+
+static void secp256k1_hmac_sha256_initialize(secp256k1_hmac_sha256* hash, const unsigned char* key, size_t keylen)
+{
+    unsigned char rkey[64];
+    if (keylen <= sizeof(rkey)) {
+        memcpy(rkey, key, keylen);
+        memset(rkey + keylen, 0, sizeof(rkey) - keylen);
+    } else {
+        secp256k1_sha256 sha256;
+        secp256k1_sha256_initialize(&sha256);
+        secp256k1_sha256_write(&sha256, key, keylen);
+        secp256k1_sha256_finalize(&sha256, rkey);
+        memset(rkey + 32, 0, 32);
+    }
+
+    for (size_t n = 0; n < sizeof(rkey); ++n) {
+        hash->outer_key[n] = rkey[n] ^ 0x5c;
+        rkey[n] ^= 0x36;
+    }
+
+    secp256k1_sha256_initialize(&hash->inner);
+    secp256k1_sha256_write(&hash->inner, rkey, sizeof(rkey));
+    secp256k1_sha256_memclear(rkey, sizeof(rkey));
+}
+
+static void secp256k1_hmac_sha256_write(secp256k1_hmac_sha256* hash, const unsigned char* data, size_t size)
+{
+    secp256k1_sha256_write(&hash->inner, data, size);
+}
+
+static void secp256k1_hmac_sha256_finalize(secp256k1_hmac_sha256* hash, unsigned char* out32)
+{
+    unsigned char temp[32];
+    secp256k1_sha256_finalize(&hash->inner, temp);
+
+    secp256k1_sha256 outer;
+    secp256k1_sha256_initialize(&outer);
+    secp256k1_sha256_write(&outer, hash->outer_key, sizeof(hash->outer_key));
+    secp256k1_sha256_write(&outer, temp, sizeof(temp));
+    secp256k1_sha256_finalize(&outer, out32);
+
+    secp256k1_sha256_memclear(temp, sizeof(temp));
+    secp256k1_sha256_memclear(hash->outer_key, sizeof(hash->outer_key));
+}
+
+static void secp256k1_hmac_sha256_clear(secp256k1_hmac_sha256* hash) { secp256k1_sha256_memclear(hash, sizeof(*hash)); }
+
+static void secp256k1_rfc6979_hmac_sha256_initialize(
+    secp256k1_rfc6979_hmac_sha256* rng, const unsigned char* key, size_t keylen)
+{
+    secp256k1_hmac_sha256 hmac;
+    static const unsigned char zero[1] = { 0x00 };
+    static const unsigned char one[1] = { 0x01 };
+
+    memset(rng->v, 0x01, 32); /* RFC6979 3.2.b. */
+    memset(rng->k, 0x00, 32); /* RFC6979 3.2.c. */
+
+    /* RFC6979 3.2.d. */
+    secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+    secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+    secp256k1_hmac_sha256_write(&hmac, zero, 1);
+    secp256k1_hmac_sha256_write(&hmac, key, keylen);
+    secp256k1_hmac_sha256_finalize(&hmac, rng->k);
+    secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+    secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+    secp256k1_hmac_sha256_finalize(&hmac, rng->v);
+
+    /* RFC6979 3.2.f. */
+    secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+    secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+    secp256k1_hmac_sha256_write(&hmac, one, 1);
+    secp256k1_hmac_sha256_write(&hmac, key, keylen);
+    secp256k1_hmac_sha256_finalize(&hmac, rng->k);
+    secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+    secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+    secp256k1_hmac_sha256_finalize(&hmac, rng->v);
+    rng->retry = 0;
+}
+
+static void secp256k1_rfc6979_hmac_sha256_generate(
+    secp256k1_rfc6979_hmac_sha256* rng, unsigned char* out, size_t outlen)
+{
+    /* RFC6979 3.2.h. */
+    static const unsigned char zero[1] = { 0x00 };
+    if (rng->retry) {
+        secp256k1_hmac_sha256 hmac;
+        secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+        secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+        secp256k1_hmac_sha256_write(&hmac, zero, 1);
+        secp256k1_hmac_sha256_finalize(&hmac, rng->k);
+        secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+        secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+        secp256k1_hmac_sha256_finalize(&hmac, rng->v);
+    }
+
+    while (outlen > 0) {
+        secp256k1_hmac_sha256 hmac;
+        const size_t now = outlen > 32 ? 32 : outlen;
+        secp256k1_hmac_sha256_initialize(&hmac, rng->k, 32);
+        secp256k1_hmac_sha256_write(&hmac, rng->v, 32);
+        secp256k1_hmac_sha256_finalize(&hmac, rng->v);
+        memcpy(out, rng->v, now);
+        out += now;
+        outlen -= now;
+    }
+
+    rng->retry = 1;
+}
+
+static void secp256k1_rfc6979_hmac_sha256_finalize(secp256k1_rfc6979_hmac_sha256* rng)
+{
+    secp256k1_sha256_memclear(rng->k, sizeof(rng->k));
+    secp256k1_sha256_memclear(rng->v, sizeof(rng->v));
+    rng->retry = 0;
+}
+
+static void secp256k1_rfc6979_hmac_sha256_clear(secp256k1_rfc6979_hmac_sha256* rng)
+{
+    secp256k1_sha256_memclear(rng, sizeof(*rng));
+}
+
+// Now build libsecp256k1 itself - its own includes of hash.h/hash_impl.h are no-ops
+#include "secp256k1.c"
@@ -0,0 +1,150 @@
+/*
+ * Host-side check of the display transfer-layer pixel formats (tft_pixfmt.h).
+ *
+ * Takes color_t values as the renderer hands them to the transfer layer (rgb565 picture
+ * pixels via the same _16_TO_x conversion TFT_picture() uses, greyscale levels, arbitrary
+ * 24-bit colors), sends them through tft_pack_pixels() and tft_pixel_bytes() for both
+ * interface pixel formats, decodes the bytes into an emulated controller frame memory and
+ * checks the two agree at 16-bit precision (ie. only the low bit of the 6-bit red and blue
+ * channels can differ).
+ *
+ * This does not run the drawing routines in tft.c (they need esp-idf), so it does not
+ * compare rendered frames - only that the 16-bit transfer of a given color matches the
+ * 18-bit one.
+ *
+ * Build and run from the repo root:
+ *   cc -O2 -Wall -I components/tft -o /tmp/transfer_pixfmt_check components/tft/host_test/transfer_pixfmt_check.c
+ *   /tmp/transfer_pixfmt_check
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "tft_pixfmt.h"
+
+// 18-bit pixel as held in display memory
+typedef struct {
+	uint8_t r, g, b;
+} gram_pixel_t;
+
+static int failures = 0;
+
+// Decode the bytes sent to the display into frame memory, as the controller does
+static uint32_t gram_write(const uint8_t pixfmt, const uint8_t *data, const uint32_t nbytes, gram_pixel_t *gram)
+{
+	uint32_t npixels = 0;
+	if (pixfmt == DISP_PIXFMT_RGB565) {
+		for (uint32_t i = 0; i + 1 < nbytes; i += 2, npixels++) {
+			const uint8_t r5 = data[i] >> 3;
+			const uint8_t g6 = ((data[i] & 0x07) << 3) | (data[i + 1] >> 5);
+			const uint8_t b5 = data[i + 1] & 0x1F;
+			gram[npixels].r = (r5 << 1) | (r5 >> 4);
+			gram[npixels].g = g6;
+			gram[npixels].b = (b5 << 1) | (b5 >> 4);
+		}
+	} else {
+		for (uint32_t i = 0; i + 2 < nbytes; i += 3, npixels++) {
+			gram[npixels].r = data[i] >> 2;
+			gram[npixels].g = data[i + 1] >> 2;
+			gram[npixels].b = data[i + 2] >> 2;
+		}
+	}
+	return npixels;
+}
+
+// Send a line of colors through both pipelines and compare the resulting frame memory
+static uint32_t compare_line(const char *name, const color_t *colors, const uint32_t len)
+{
+	color_t *line = malloc(len * sizeof(color_t));
+	uint8_t *bytes = malloc(len * 3);
+	gram_pixel_t *gram666 = malloc(len * sizeof(gram_pixel_t));
+	gram_pixel_t *gram565 = malloc(len * sizeof(gram_pixel_t));
+	uint32_t lsb_diffs = 0;
+
+	// 18-bit: sent as-is (as the dma path does)
+	memcpy(line, colors, len * sizeof(color_t));
+	uint32_t nbytes = tft_pack_pixels(DISP_PIXFMT_RGB666, line, len);
+	if (nbytes != len * 3 || gram_write(DISP_PIXFMT_RGB666, (const uint8_t *)line, nbytes, gram666) != len) {
+		printf("%s: bad 18-bit transfer length\n", name);
+		++failures;
+	}
+
+	// 16-bit: packed in place (as the dma path does)
+	memcpy(line, colors, len * sizeof(color_t));
+	nbytes = tft_pack_pixels(DISP_PIXFMT_RGB565, line, len);
+	if (nbytes != len * 2 || gram_write(DISP_PIXFMT_RGB565, (const uint8_t *)line, nbytes, gram565) != len) {
+		printf("%s: bad 16-bit transfer length\n", name);
+		++failures;
+	}
+
+	// 16-bit: pixel by pixel (as the direct-send and single pixel paths do)
+	uint32_t direct_bytes = 0;
+	for (uint32_t n = 0; n < len; n++) {
+		direct_bytes += tft_pixel_bytes(DISP_PIXFMT_RGB565, colors[n], bytes + direct_bytes);
+	}
+	if (direct_bytes != nbytes || memcmp(bytes, line, nbytes)) {
+		printf("%s: direct and dma 16-bit transfers differ\n", name);
+		++failures;
+	}
+
+	for (uint32_t n = 0; n < len; n++) {
+		const gram_pixel_t *p18 = gram666 + n;
+		const gram_pixel_t *p16 = gram565 + n;
+		if (p18->g != p16->g || (p18->r >> 1) != (p16->r >> 1) || (p18->b >> 1) != (p16->b >> 1)) {
+			printf("%s: pixel %u (%02x,%02x,%02x) differs: 18-bit (%02x,%02x,%02x) 16-bit (%02x,%02x,%02x)\n", name,
+				n, colors[n].r, colors[n].g, colors[n].b, p18->r, p18->g, p18->b, p16->r, p16->g, p16->b);
+			++failures;
+			break;
+		}
+		if (p18->r != p16->r || p18->b != p16->b) {
+			++lsb_diffs;
+		}
+	}
+
+	free(gram565);
+	free(gram666);
+	free(bytes);
+	free(line);
+	return lsb_diffs;
+}
+
+int main(void)
+{
+	// Every rgb565 picture pixel (splash, logos, icons), converted as TFT_picture() does
+	color_t *colors = malloc(65536 * sizeof(color_t));
+	for (uint32_t v = 0; v < 65536; v++) {
+		colors[v].r = _16_TO_R(v);
+		colors[v].g = _16_TO_G(v);
+		colors[v].b = _16_TO_B(v);
+	}
+	uint32_t diffs = compare_line("rgb565 pictures", colors, 65536);
+	printf("rgb565 pictures: 65536 pixels, %u differ in red/blue lsb only\n", diffs);
+
+	// Every grayscale (camera preview) pixel
+	for (uint32_t v = 0; v < 256; v++) {
+		colors[v].r = colors[v].g = colors[v].b = 0xFF - v;
+	}
+	diffs = compare_line("grayscale", colors, 256);
+	printf("grayscale: 256 pixels, %u differ in red/blue lsb only\n", diffs);
+
+	// Odd line lengths, to check the in-place packing and partial words
+	for (uint32_t len = 1; len < 64; len += 2) {
+		compare_line("odd length", colors, len);
+	}
+
+	// Arbitrary 24-bit colors (gui colors and fills are unrestricted)
+	srand(565);
+	for (uint32_t v = 0; v < 65536; v++) {
+		colors[v].r = rand() & 0xFF;
+		colors[v].g = rand() & 0xFF;
+		colors[v].b = rand() & 0xFF;
+	}
+	diffs = compare_line("24-bit", colors, 65536);
+	printf("24-bit: 65536 pixels, %u differ in red/blue lsb only\n", diffs);
+
+	free(colors);
+
+	printf(failures ? "FAILED\n" : "PASSED\n");
+	return failures ? 1 : 0;
+}
@@ -2940,9 +2940,61 @@ int TFT_icon(const Icon *imgbuf, int x, int y, color_t color, dispWin_t area, co
     return 0;
 }
 
-#define _16_TO_R(x) (0xFF - ((x >> 8) & 0b11111000))
-#define _16_TO_G(x) (0xFF - ((x >> 3) & 0b11111100))
-#define _16_TO_B(x) (0xFF - ((x << 3) & 0b11111111))
+// Streaming decoder state for PICTURE_ENCODING_PALETTE_RLE data (see tools/mkpicture.py)
+// Runs may span lines, so the state is held across calls to rle_decode_line().
+typedef struct {
+    const uint8_t *next;
+    const uint8_t *end;
+    color_t palette[256];
+    uint32_t palette_len;
+    uint32_t run_remaining;
+    color_t colour;
+} rle_decoder_t;
+
+static void rle_decoder_init(rle_decoder_t *dec, const Picture *imgbuf) {
+    assert(imgbuf->data_len > 1);
+    const uint8_t *data = imgbuf->data_8;
+
+    dec->palette_len = data[0] + 1;
+    assert(imgbuf->data_len > 1 + 2 * dec->palette_len);
+    for (uint32_t i = 0; i < dec->palette_len; i++) {
+        const uint16_t rgb565 = data[1 + 2 * i] | (data[2 + 2 * i] << 8);
+        dec->palette[i].r = _16_TO_R(rgb565);
+        dec->palette[i].g = _16_TO_G(rgb565);
+        dec->palette[i].b = _16_TO_B(rgb565);
+    }
+
+    dec->next = data + 1 + 2 * dec->palette_len;
+    dec->end = data + imgbuf->data_len;
+    dec->run_remaining = 0;
+}
+
+// Decode the next 'width' pixels, writing the first 'draw_width' into the line buffer
+static void rle_decode_line(rle_decoder_t *dec, color_t *line, uint32_t width, uint32_t draw_width) {
+    uint32_t loop_x = 0;
+    while (loop_x < width) {
+        if (!dec->run_remaining) {
+            assert(dec->next + 1 < dec->end);
+            uint32_t run = *dec->next++;
+            if (run & 0x80) {
+                assert(dec->next + 1 < dec->end);
+                run = (((run & 0x7f) << 8) | *dec->next++) + 128;
+            }
+            const uint8_t index = *dec->next++;
+            assert(index < dec->palette_len);
+            dec->run_remaining = run + 1;
+            dec->colour = dec->palette[index];
+        }
+
+        const uint32_t len = min(dec->run_remaining, width - loop_x);
+        const uint32_t end_x = min(loop_x + len, draw_width);
+        for (uint32_t i = loop_x; i < end_x; i++) {
+            line[i] = dec->colour;
+        }
+        loop_x += len;
+        dec->run_remaining -= len;
+    }
+}
 
 int TFT_picture(const Picture *imgbuf, int x, int y, dispWin_t area) {
     assert(imgbuf);
@@ -2971,6 +3023,26 @@ int TFT_picture(const Picture *imgbuf, int x, int y, dispWin_t area) {
 
     color_t *color_line = heap_caps_malloc(draw_width*3, MALLOC_CAP_DMA);
     assert(color_line);
+
+    if (imgbuf->encoding == PICTURE_ENCODING_PALETTE_RLE) {
+        // Decode straight into the dma line buffer as each line is sent
+        assert(imgbuf->bytes_per_pixel == 2);
+        rle_decoder_t *dec = malloc(sizeof(rle_decoder_t));
+        assert(dec);
+        rle_decoder_init(dec, imgbuf);
+        disp_select();
+
+        for (uint32_t loop_y = 0; loop_y < draw_height; loop_y++) {
+            rle_decode_line(dec, color_line, width, draw_width);
+            send_data(x, y + loop_y, x + draw_width, y + loop_y + 1, draw_width, color_line);
+        }
+        free(dec);
+        free(color_line);
+        disp_deselect();
+
+        return 0;
+    }
+
     disp_select();
 
     for (uint32_t loop_y = 0; loop_y < draw_height; loop_y++) {
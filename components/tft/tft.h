@@ -34,6 +34,10 @@ typedef struct {
     uint32_t *data;
 } Icon;
 
+// Picture data encodings
+#define PICTURE_ENCODING_RAW            0   // width * height * bytes_per_pixel
+#define PICTURE_ENCODING_PALETTE_RLE    1   // rgb565 palette + run-lengths (see tools/mkpicture.py)
+
 typedef struct {
     uint32_t width, height;
     uint32_t bytes_per_pixel;
@@ -42,6 +46,9 @@ typedef struct {
         uint16_t *data;
         uint8_t *data_8;
     };
+
+    uint32_t encoding;      // PICTURE_ENCODING_RAW if not set
+    uint32_t data_len;      // length of encoded data (unused if raw)
 } Picture;
 
 //==========================================================================================
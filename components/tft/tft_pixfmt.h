@@ -0,0 +1,66 @@
+/*
+ *
+ * PIXEL FORMAT CONVERSION FOR DISPLAY TRANSFERS
+ * (no esp-idf dependencies, so can also be built on the host - see host_test/)
+ *
+*/
+
+#ifndef _TFT_PIXFMT_H_
+#define _TFT_PIXFMT_H_
+
+#include <stdint.h>
+
+// ==== Interface pixel formats (TFT_CMD_PIXFMT argument) ====
+#define DISP_PIXFMT_RGB666	0x66	// 18-bit, 3 bytes per pixel: r, g, b (top 6 bits of each used)
+#define DISP_PIXFMT_RGB565	0x55	// 16-bit, 2 bytes per pixel: rrrrrggg gggbbbbb
+
+// 24-bit color type structure
+typedef struct __attribute__((__packed__)) {
+	uint8_t r;
+	uint8_t g;
+	uint8_t b;
+} color_t ;
+
+// Convert rgb565 picture data (stored inverted) to color_t, as used by TFT_picture()
+#define _16_TO_R(x) (0xFF - ((x >> 8) & 0b11111000))
+#define _16_TO_G(x) (0xFF - ((x >> 3) & 0b11111100))
+#define _16_TO_B(x) (0xFF - ((x << 3) & 0b11111111))
+
+// Number of bytes sent per pixel in the given format
+static inline uint32_t tft_pixfmt_bytes(const uint8_t pixfmt)
+{
+	return (pixfmt == DISP_PIXFMT_RGB565) ? 2 : 3;
+}
+
+// Write the bytes sent for one pixel, returns the number of bytes written
+static inline uint32_t tft_pixel_bytes(const uint8_t pixfmt, const color_t color, uint8_t *out)
+{
+	if (pixfmt == DISP_PIXFMT_RGB565) {
+		out[0] = (color.r & 0xF8) | (color.g >> 5);
+		out[1] = ((color.g << 3) & 0xE0) | (color.b >> 3);
+		return 2;
+	}
+	out[0] = color.r;
+	out[1] = color.g;
+	out[2] = color.b;
+	return 3;
+}
+
+// Convert 'len' colors in place into the bytes sent to the display.
+// The packed data is never longer than the colors, so can be written front to back.
+// Returns the number of bytes to send.
+static inline uint32_t tft_pack_pixels(const uint8_t pixfmt, color_t *colors, const uint32_t len)
+{
+	if (pixfmt != DISP_PIXFMT_RGB565) {
+		return len * 3;
+	}
+
+	uint8_t *out = (uint8_t *)colors;
+	for (uint32_t n = 0; n < len; n++) {
+		const color_t color = colors[n];
+		out += tft_pixel_bytes(pixfmt, color, out);
+	}
+	return len * 2;
+}
+
+#endif
@@ -263,15 +263,13 @@ void IRAM_ATTR drawPixel(int16_t x, int16_t y, color_t color, uint8_t sel)
 	disp_spi->host->hw->cmd.usr = 1;		// Start transfer
 	while (disp_spi->host->hw->cmd.usr);	// Wait for SPI bus ready
 
-	wd = (uint32_t)_color.r;
-	wd |= (uint32_t)_color.g << 8;
-	wd |= (uint32_t)_color.b << 16;
+	const uint32_t nbytes = tft_pixel_bytes(DISP_PIXFMT, _color, (uint8_t *)&wd);
 
     // Set DC to 1 (data mode);
 	gpio_set_level(PIN_NUM_DC, 1);
 
 	disp_spi->host->hw->data_buf[0] = wd;
-	disp_spi->host->hw->mosi_dlen.usr_mosi_dbitlen = 23;
+	disp_spi->host->hw->mosi_dlen.usr_mosi_dbitlen = (nbytes * 8) - 1;
 	disp_spi->host->hw->cmd.usr = 1;		// Start transfer
 	while (disp_spi->host->hw->cmd.usr);	// Wait for SPI bus ready
 
@@ -305,6 +303,7 @@ static void IRAM_ATTR _direct_send(color_t *color, uint32_t len, uint8_t rep)
 	int idx = 0;
 	int bits = 0;
 	int wbits = 0;
+	uint8_t pixel[3];
 
     taskDISABLE_INTERRUPTS();
 	color_t _color = color[0];
@@ -317,33 +316,26 @@ static void IRAM_ATTR _direct_send(color_t *color, uint32_t len, uint8_t rep)
 			else _color = color[cidx];
 		}
 
-		wd |= (uint32_t)_color.r << wbits;
-		wbits += 8;
-		if (wbits == 32) {
-			bits += wbits;
-			wbits = 0;
-			disp_spi->host->hw->data_buf[idx++] = wd;
-			wd = 0;
-		}
-		wd |= (uint32_t)_color.g << wbits;
-		wbits += 8;
-		if (wbits == 32) {
-			bits += wbits;
-			wbits = 0;
-			disp_spi->host->hw->data_buf[idx++] = wd;
-			wd = 0;
-		}
-		wd |= (uint32_t)_color.b << wbits;
-		wbits += 8;
-		if (wbits == 32) {
-			bits += wbits;
-			wbits = 0;
-			disp_spi->host->hw->data_buf[idx++] = wd;
-			wd = 0;
+		// ** Add the pixel's bytes in the display's pixel format **
+		const uint32_t nbytes = tft_pixel_bytes(DISP_PIXFMT, _color, pixel);
+		for (uint32_t i = 0; i < nbytes; i++) {
+			wd |= (uint32_t)pixel[i] << wbits;
+			wbits += 8;
+			if (wbits == 32) {
+				bits += wbits;
+				wbits = 0;
+				disp_spi->host->hw->data_buf[idx++] = wd;
+				wd = 0;
+			}
 		}
     	len--;					// Decrement colors counter
         if (rep == 0) cidx++;	// if not repeating color, increment color buffer index
     }
+	if (wbits) {
+		// ** Include any final partial word **
+		bits += wbits;
+		disp_spi->host->hw->data_buf[idx] = wd;
+	}
 	if (bits) {
 		while (disp_spi->host->hw->cmd.usr);						// Wait for SPI bus ready
 		disp_spi->host->hw->mosi_dlen.usr_mosi_dbitlen = bits-1;	// set number of bits to be sent
@@ -373,7 +365,7 @@ static void IRAM_ATTR _TFT_pushColorRep(color_t *color, uint32_t len, uint8_t re
 
 	gpio_set_level(PIN_NUM_DC, 1);								// Set DC to 1 (data mode);
 
-	if ((len*24) <= 512) {
+	if ((len * DISP_BYTES_PER_PIXEL * 8) <= 512) {
 
 		_direct_send(color, len, rep);
 
@@ -387,7 +379,9 @@ static void IRAM_ATTR _TFT_pushColorRep(color_t *color, uint32_t len, uint8_t re
 			}
 	    }
 
-	    _dma_send((uint8_t *)color, len*3);
+		// ** Convert to the display's pixel format, in place
+	    const uint32_t nbytes = tft_pack_pixels(DISP_PIXFMT, color, len);
+	    _dma_send((uint8_t *)color, nbytes);
 	}
 	else {
 		// ==== Repeat color, more than 512 bits total ====
@@ -406,26 +400,27 @@ static void IRAM_ATTR _TFT_pushColorRep(color_t *color, uint32_t len, uint8_t re
 		*/
 
 		buf_colors = ((len > (_width*2)) ? (_width*2) : len);
-		buf_bytes = buf_colors * 3;
+		buf_bytes = buf_colors * DISP_BYTES_PER_PIXEL;
 
-		// Prepare color buffer of maximum 2 color lines
-		trans_cline = heap_caps_malloc(buf_bytes, MALLOC_CAP_DMA);
+		// Prepare color buffer of maximum 2 color lines (packed in place, so sized for color_t)
+		trans_cline = heap_caps_malloc(buf_colors * sizeof(color_t), MALLOC_CAP_DMA);
 		if (trans_cline == NULL) return;
 
 		// Prepare fill color
 		if (gray_scale) _color = color2gs(color[0]);
 		else _color = color[0];
 
-		// Fill color buffer with fill color
+		// Fill color buffer with fill color, in the display's pixel format
 		for (uint32_t i=0; i<buf_colors; i++) {
 			trans_cline[i] = _color;
 		}
+		tft_pack_pixels(DISP_PIXFMT, trans_cline, buf_colors);
 
 		// Send 'len' colors
 		to_send = len;
 		while (to_send > 0) {
 			wait_trans_finish(0);
-			_dma_send((uint8_t *)trans_cline, ((to_send > buf_colors) ? buf_bytes : (to_send*3)));
+			_dma_send((uint8_t *)trans_cline, ((to_send > buf_colors) ? buf_bytes : (to_send * DISP_BYTES_PER_PIXEL)));
 			to_send -= buf_colors;
 		}
 	}
@@ -688,17 +683,19 @@ uint32_t find_rd_speed()
 
 	color_t *rdline = (color_t *)(line_rdbuf+1);
 
-	// Fill test line with colors
+	// Test line color
 	color = (color_t){0xEC,0xA8,0x74};
-	for (int x=0; x<_width; x++) {
-		color_line[x] = color;
-	}
 
 	// Find maximum read spi clock
 	for (uint32_t speed=2000000; speed<=cur_speed; speed += 1000000) {
 		change_speed = spi_lobo_set_speed(disp_spi, speed);
 		if (change_speed == 0) goto exit;
 
+		// Fill test line with colors (send_data() packs the line in place)
+		for (int x=0; x<_width; x++) {
+			color_line[x] = color;
+		}
+
 		memset(line_rdbuf, 0, _width*sizeof(color_t)+1);
 
 		if (disp_select()) goto exit;
@@ -713,9 +710,11 @@ uint32_t find_rd_speed()
 		line_check = 0;
 		if (ret == ESP_OK) {
 			for (int y=0; y<_width; y++) {
-				if ((color_line[y].r & 0xFC) != (rdline[y].r & 0xFC)) line_check = 1;
-				else if ((color_line[y].g & 0xFC) != (rdline[y].g & 0xFC)) line_check = 1;
-				else if ((color_line[y].b & 0xFC) != (rdline[y].b & 0xFC)) line_check =  1;
+				// Only compare the bits held in the display's pixel format
+				const uint8_t rb_mask = (DISP_PIXFMT == DISP_PIXFMT_RGB565) ? 0xF8 : 0xFC;
+				if ((color.r & rb_mask) != (rdline[y].r & rb_mask)) line_check = 1;
+				else if ((color.g & 0xFC) != (rdline[y].g & 0xFC)) line_check = 1;
+				else if ((color.b & rb_mask) != (rdline[y].b & rb_mask)) line_check =  1;
 				if (line_check) break;
 			}
 		}
@@ -8,6 +8,7 @@
 #define _TFTSPI_H_
 
 #include "tftspi.h"
+#include "tft_pixfmt.h"
 #include "spi_master_lobo.h"
 #include "sdkconfig.h"
 #include "stmpe610.h"
@@ -49,6 +50,14 @@
 #define TFT_INVERT_ROTATION2        CONFIG_DISP_INVERT_ROTATION2
 #define TFT_RGB_BGR                 CONFIG_DISP_RGB_BGR
 
+// Interface pixel format used for all transfers
+#ifdef CONFIG_DISP_COLOR_RGB565
+#define DISP_PIXFMT                 DISP_PIXFMT_RGB565
+#else
+#define DISP_PIXFMT                 DISP_COLOR_BITS_24
+#endif
+#define DISP_BYTES_PER_PIXEL        tft_pixfmt_bytes(DISP_PIXFMT)
+
 // Hard code no-touch, we don't read any input anyways
 #define USE_TOUCH	TOUCH_TYPE_NONE
 
@@ -95,13 +104,6 @@ extern spi_lobo_device_handle_t ts_spi;
 
 // ##############################################################
 
-// 24-bit color type structure
-typedef struct __attribute__((__packed__)) {
-//typedef struct {
-	uint8_t r;
-	uint8_t g;
-	uint8_t b;
-} color_t ;
 
 // ==== Display commands constants ====
 #define TFT_INVOFF     0x20
@@ -231,7 +233,7 @@ static const uint8_t ST7789V_init[] = {
   TFT_CMD_GMCTRP1, 14, 0xD0, 0x00, 0x05, 0x0E, 0x15, 0x0D, 0x37, 0x43, 0x47, 0x09, 0x15, 0x12, 0x16, 0x19,
   TFT_CMD_GMCTRN1, 14, 0xD0, 0x00, 0x05, 0x0D, 0x0C, 0x06, 0x2D, 0x44, 0x40, 0x0E, 0x1C, 0x18, 0x16, 0x19,
   TFT_MADCTL, 1, (MADCTL_MX | TFT_RGB_BGR),			// Memory Access Control (orientation)
-  TFT_CMD_PIXFMT, 1, DISP_COLOR_BITS_24,            // *** INTERFACE PIXEL FORMAT: 0x66 -> 18 bit; 0x55 -> 16 bit
+  TFT_CMD_PIXFMT, 1, DISP_PIXFMT,                   // *** INTERFACE PIXEL FORMAT: 0x66 -> 18 bit; 0x55 -> 16 bit
   TFT_CMD_SLPOUT, TFT_CMD_DELAY, 120,				//  Sleep out,	//  120 ms delay
   TFT_DISPON, TFT_CMD_DELAY, 120,
 };
@@ -260,7 +262,7 @@ static const uint8_t ILI9341_init[] = {
   TFT_MADCTL, 1,									// Memory Access Control (orientation)
   (MADCTL_MX | TFT_RGB_BGR),
   // *** INTERFACE PIXEL FORMAT: 0x66 -> 18 bit; 0x55 -> 16 bit
-  TFT_CMD_PIXFMT, 1, DISP_COLOR_BITS_24,
+  TFT_CMD_PIXFMT, 1, DISP_PIXFMT,
 #ifdef CONFIG_DISP_INVERT_COLORS
   TFT_INVONN, 0,
 #else
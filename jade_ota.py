@@ -4,12 +4,13 @@ import os
 import sys
 import time
 import json
+import random
 import hashlib
 import logging
 import argparse
 import subprocess
 
-from jadepy import JadeAPI
+from jadepy import JadeAPI, JadeError
 from tools import fwtools
 
 TEST_MNEMONIC = 'fish inner face ginger orchard permit useful method fence \
@@ -123,7 +124,7 @@ def download_file(hw_target, write_compressed, release):
             fwtools.write(fwhash, cmpfilename + ".hash", text=True)
 
     # Return
-    return fwdata['fwsize'], fwdata.get('patch_size'), fwhash, fwcmp
+    return fwdata['fwsize'], fwdata.get('patch_size'), fwdata.get('patch_filter'), fwhash, fwcmp
 
 
 # Download compressed firmware file from Firmware Server using GDK
@@ -172,7 +173,7 @@ def download_file_gdk(hw_target, write_compressed, release):
             fwtools.write(fwhash, cmpfilename + ".hash", text=True)
 
     # Return
-    return fwdata['fwsize'], fwdata.get('patch_size'), fwhash, fwcmp
+    return fwdata['fwsize'], fwdata.get('patch_size'), fwdata.get('patch_filter'), fwhash, fwcmp
 
 
 # Use a local uncompressed full firmware file - can deduce the compressed firmware
@@ -201,7 +202,7 @@ def get_local_uncompressed_fwfile(fwfilename, write_compressed):
         logger.info('Writing compressed firmware file')
         fwtools.write(fwcmp, cmpfilename)
 
-    return fwlen, None, fwhash, fwcmp
+    return fwlen, None, None, fwhash, fwcmp
 
 
 # Use a local firmware file - the compressed firmware file.
@@ -222,9 +223,10 @@ def get_local_compressed_fwfile(fwfilename):
     # Use fwtools to parse the filename and deduce whether this is
     # a full firmware file or a firmware delta/patch.
     fwtype, fwinfo, fwinfo2 = fwtools.parse_compressed_filename(fwfilename)
-    assert (fwtype == fwtools.FWFILE_TYPE_PATCH) == (fwinfo2 is not None)
+    assert (fwtype in fwtools.PATCH_FILTERS) == (fwinfo2 is not None)
+    patchfilter = fwtools.PATCH_FILTERS.get(fwtype)
 
-    return fwinfo.fwsize, fwinfo2.fwsize if fwinfo2 else None, fwhash, fwcmp
+    return fwinfo.fwsize, fwinfo2.fwsize if fwinfo2 else None, patchfilter, fwhash, fwcmp
 
 
 # Returns whether we have ble and the id of the jade
@@ -235,11 +237,28 @@ def get_bleid(jade):
     return has_radio, id
 
 
+# Raised from the progress callback to abandon an upload partway through
+class InjectedFault(Exception):
+    pass
+
+
+def get_ota_checkpoint(jade):
+    # The first message sent after an upload is abandoned is consumed by that upload,
+    # and receives its error reply - so retry.
+    try:
+        return jade.get_ota_checkpoint()
+    except JadeError as e:
+        logger.info(f'Retrying get_ota_checkpoint() after error: {e}')
+        return jade.get_ota_checkpoint()
+
+
 # Takes the compressed firmware data to upload, the expected length of the
 # final (uncompressed) firmware, the length of the uncompressed diff/patch
-# (if this is a patch to apply to the current running firmware), and whether
-# to apply the test mnemonic rather than using normal pinserver authentication.
-def ota(jade, fwcompressed, fwlength, fwhash, patchlen=None, pushmnemonic=False):
+# (if this is a patch to apply to the current running firmware) and the filter
+# the patch was created with (if any), and whether to apply the test mnemonic
+# rather than using normal pinserver authentication.
+def ota(jade, fwcompressed, fwlength, fwhash, patchlen=None, patchfilter=None,
+        pushmnemonic=False, faults=0):
     info = jade.get_version_info()
     logger.info(f'Running OTA on: {info}')
     has_pin = info['JADE_HAS_PIN']
@@ -249,6 +268,10 @@ def ota(jade, fwcompressed, fwlength, fwhash, patchlen=None, pushmnemonic=False)
     chunksize = int(info['JADE_OTA_MAX_CHUNK'])
     assert chunksize > 0
 
+    if patchfilter is not None:
+        filters = info.get('JADE_OTA_DELTA_FILTERS', '').split(',')
+        assert patchfilter in filters, f'Patch filter {patchfilter} not supported: {filters}'
+
     # Can set the mnemonic in debug, to ensure OTA is allowed
     if pushmnemonic:
         ret = jade.set_mnemonic(TEST_MNEMONIC)
@@ -283,10 +306,48 @@ def ota(jade, fwcompressed, fwlength, fwhash, patchlen=None, pushmnemonic=False)
         last_time = current_time
         last_written = written
 
-    result = jade.ota_update(fwcompressed, fwlength, chunksize, fwhash,
-                             patchlen=patchlen, cb=_log_progress)
+        # Abandon the upload if injecting a fault at this point
+        if abandon_at is not None and written >= abandon_at:
+            raise InjectedFault(f'Abandoning upload at {written}b of {compressed_size}b')
+
+    # If injecting faults, abandon the upload at random points, reconnect, and resume the
+    # upload of the remaining final image from any checkpoint persisted by the hw.
+    assert not faults or (patchlen is None and fwhash is not None), 'Can only resume full fw'
+    firmware = fwtools.decompress(fwcompressed) if faults else None
+    abandon_at = random.randrange(len(fwcompressed)) if faults else None
+
+    try:
+        result = jade.ota_update(fwcompressed, fwlength, chunksize, fwhash,
+                                 patchlen=patchlen, patchfilter=patchfilter, cb=_log_progress)
+    except InjectedFault as e:
+        result = None
+        while result is None:
+            logger.info(e)
+            jade.disconnect()
+            jade.connect()
+            faults -= 1
+
+            checkpoint = get_ota_checkpoint(jade)
+            logger.info(f'OTA checkpoint: {checkpoint}')
+            offset = checkpoint['offset'] if checkpoint else 0
+            assert checkpoint is None or checkpoint['fwhash'] == fwhash
+
+            # Compressed size of the remainder, for choosing any subsequent fault
+            cmplen = len(fwtools.compress(firmware[offset:]))
+            abandon_at = random.randrange(cmplen) if faults else None
+            last_written = 0
+            try:
+                if checkpoint:
+                    result = jade.ota_resume(firmware, chunksize, fwhash, offset, cb=_log_progress)
+                else:
+                    result = jade.ota_update(fwcompressed, fwlength, chunksize, fwhash,
+                                             cb=_log_progress)
+            except InjectedFault as e_next:
+                e = e_next
     assert result is True
 
+    # Time from the last chunk being ack'd to the 'ota_complete' reply - ie. image finalisation
+    logger.info(f'ota_complete latency in secs: {time.time() - last_time}')
     logger.info(f'Total ota time in secs: {time.time() - start_time}')
 
     # Pause to allow for post-ota reboot
@@ -386,6 +447,13 @@ if __name__ == '__main__':
                         dest='pushmnemonic',
                         help='Sets a test mnemonic - only works with debug build of Jade',
                         default=False)
+    parser.add_argument('--inject-faults',
+                        action='store',
+                        dest='faults',
+                        type=int,
+                        help='Abandon the upload this many times at random points, reconnecting '
+                             'and resuming it each time - only for full firmware uploads',
+                        default=0)
     parser.add_argument('--log',
                         action='store',
                         dest='loglevel',
@@ -426,18 +494,20 @@ if __name__ == '__main__':
 
     # Get the file to OTA
     if args.downloadfw:
-        fwlen, patchlen, fwhash, fwcmp = download_file(args.hwtarget, args.writecompressed,
-                                                       args.release)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = download_file(args.hwtarget,
+                                                                    args.writecompressed,
+                                                                    args.release)
     elif args.downloadgdk:
-        fwlen, patchlen, fwhash, fwcmp = download_file_gdk(args.hwtarget, args.writecompressed,
-                                                           args.release)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = download_file_gdk(args.hwtarget,
+                                                                        args.writecompressed,
+                                                                        args.release)
     elif args.fwfile:
         assert not args.writecompressed
-        fwlen, patchlen, fwhash, fwcmp = get_local_compressed_fwfile(args.fwfile)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = get_local_compressed_fwfile(args.fwfile)
     else:
         # Default case, as 'uncompressed fw file' has a default value if not passed explicitly
-        fwlen, patchlen, fwhash, fwcmp = get_local_uncompressed_fwfile(args.fwfile_uncompressed,
-                                                                       args.writecompressed)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = get_local_uncompressed_fwfile(
+            args.fwfile_uncompressed, args.writecompressed)
 
     if fwcmp is None:
         logger.error('No firmware available')
@@ -465,7 +535,8 @@ if __name__ == '__main__':
         if not args.skipserial:
             logger.info(f'Jade OTA over serial')
             with JadeAPI.create_serial(device=args.serialport) as jade:
-                has_radio, bleid = ota(jade, fwcmp, fwlen, fwhash, patchlen, args.pushmnemonic)
+                has_radio, bleid = ota(jade, fwcmp, fwlen, fwhash, patchlen, patchfilter,
+                                       args.pushmnemonic, args.faults)
 
         if not args.skipble:
             if has_radio and bleid is None and args.bleidfromserial:
@@ -476,7 +547,8 @@ if __name__ == '__main__':
             if has_radio:
                 logger.info(f'Jade OTA over BLE {bleid}')
                 with JadeAPI.create_ble(serial_number=bleid) as jade:
-                    ota(jade, fwcmp, fwlen, fwhash, patchlen, args.pushmnemonic)
+                    ota(jade, fwcmp, fwlen, fwhash, patchlen, patchfilter, args.pushmnemonic,
+                        args.faults)
             else:
                 msg = 'Skipping BLE tests - not enabled on the hardware'
                 logger.warning(msg)
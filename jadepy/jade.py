@@ -1,4 +1,5 @@
 import cbor
+import zlib
 import hashlib
 import json
 import time
@@ -84,7 +85,9 @@ try:
         Returns
         -------
         dict
-            with single key 'body', whose value is the json returned from the call
+            with single key 'body', whose value is the json returned from the call, or None
+            if the server does not have the requested single round-trip pinserver endpoint
+            (which is relayed to Jade as an empty reply, so it falls back to the handshake)
 
         """
         logger.debug('_http_request: {}'.format(params))
@@ -100,6 +103,12 @@ try:
 
         logger.debug("http_request received reply: {}".format(f.text))
 
+        if f.status_code in (404, 405) and url.endswith('_oneshot'):
+            # Server without the single round-trip endpoint - it has not processed the pin attempt,
+            # so relay an empty reply and Jade falls back to the two-step handshake.
+            logger.warning("http error {} : {} - endpoint not available".format(f.status_code, url))
+            return {'body': None}
+
         if f.status_code != 200:
             logger.error("http error {} : {}".format(f.status_code, f.text))
             raise ValueError(f.status_code)
@@ -384,6 +393,25 @@ class JadeAPI:
         params = {'epoch': epoch if epoch is not None else int(time.time())}
         return self._jadeRpc('set_epoch', params)
 
+    def set_max_reply_size(self, max_reply_size):
+        """
+        RPC call to negotiate the maximum size of reply messages for this connection.
+        Larger replies mean fewer 'get_extended_data' round-trips when fetching large results
+        (eg. a signed psbt).  Jade grants at most the size requested, bounded by its free memory
+        (and never less than its default).  Passing 0 restores the default.
+
+        Parameters
+        ----------
+        max_reply_size : int
+            The maximum reply size requested, in bytes.
+
+        Returns
+        -------
+        int
+            The maximum reply size granted, in bytes.
+        """
+        return self._jadeRpc('set_max_reply_size', {'max_reply_size': max_reply_size})
+
     def logout(self):
         """
         RPC call to logout of any wallet loaded on the Jade unit.
@@ -397,7 +425,8 @@ class JadeAPI:
         """
         return self._jadeRpc('logout')
 
-    def ota_update(self, fwcmp, fwlen, chunksize, fwhash=None, patchlen=None, cb=None):
+    def ota_update(self, fwcmp, fwlen, chunksize, fwhash=None, patchlen=None, cb=None,
+                   patchfilter=None):
         """
         RPC call to attempt to update the unit's firmware.
 
@@ -430,6 +459,10 @@ class JadeAPI:
             If passed, this function is invoked each time a fw chunk is successfully uploaded and
             ack'd by the hw, to notify of upload progress.
             Defaults to None, and nothing is called to report upload progress.
+        patchfilter: str, optional
+            If the patch was created between filtered firmware images, the name of the filter.
+            Must be listed in the version info data, under the key 'JADE_OTA_DELTA_FILTERS'.
+            Defaults to None, implying a plain patch between the firmware images.
 
         Returns
         -------
@@ -456,6 +489,8 @@ class JadeAPI:
         if patchlen is not None:
             ota_method = 'ota_delta'
             params['patchsize'] = patchlen
+            if patchfilter is not None:
+                params['patchfilter'] = patchfilter
 
         result = self._jadeRpc(ota_method, params)
         assert result is True
@@ -476,6 +511,78 @@ class JadeAPI:
         # All binary data uploaded
         return self._jadeRpc('ota_complete')
 
+    def get_ota_checkpoint(self):
+        """
+        RPC call to fetch the progress persisted for an interrupted firmware upload, if any.
+        NOTE: the first call after an upload was abandoned may instead receive the error reply of
+        the interrupted upload - in which case the call should simply be retried.
+
+        Returns
+        -------
+        dict or None
+            None if there is no upload which can be resumed, otherwise:
+            'fwhash' : 32-bytes - the sha256 hash of the final firmware image being uploaded
+            'fwsize' : int - the size of the final firmware image
+            'offset' : int - the number of bytes of the final image safely written to the device
+        """
+        return self._jadeRpc('get_ota_checkpoint')
+
+    def ota_resume(self, firmware, chunksize, fwhash, offset, cb=None):
+        """
+        RPC call to resume an interrupted firmware upload from a checkpoint.
+        See get_ota_checkpoint().
+        The remainder of the final firmware image is compressed and uploaded - this is also how an
+        interrupted delta update is resumed.
+
+        Parameters
+        ----------
+        firmware : bytes
+            The full uncompressed final firmware image.
+        chunksize : int
+            The size of the chunks used to upload the compressed firmware, as for ota_update().
+        fwhash: 32-bytes
+            The sha256 hash of the full uncompressed final firmware image.
+            Must match the checkpoint.
+        offset : int
+            The checkpoint offset from which to resume the upload.
+        cb : function, optional
+            Callback function accepting two integers - the amount of compressed firmware sent thus
+            far, and the total length of the compressed firmware to send.
+            Defaults to None, and nothing is called to report upload progress.
+
+        Returns
+        -------
+        bool
+            True if no errors were reported - on next restart the hw unit will attempt to boot the
+            new firmware.
+        """
+        fwcmp = zlib.compress(firmware[offset:], 9)
+        cmplen = len(fwcmp)
+
+        params = {'fwsize': len(firmware),
+                  'cmpsize': cmplen,
+                  'fwhash': fwhash,
+                  'offset': offset}
+
+        result = self._jadeRpc('ota_resume', params, long_timeout=True)
+        assert result is True
+
+        # Write binary chunks
+        written = 0
+        while written < cmplen:
+            remaining = cmplen - written
+            length = min(remaining, chunksize)
+            chunk = bytes(fwcmp[written:written + length])
+            result = self._jadeRpc('ota_data', chunk)
+            assert result is True
+            written += length
+
+            if (cb):
+                cb(written, cmplen)
+
+        # All binary data uploaded
+        return self._jadeRpc('ota_complete')
+
     def run_remote_selfcheck(self):
         """
         RPC call to run in-built tests.
@@ -489,6 +596,66 @@ class JadeAPI:
         """
         return self._jadeRpc('debug_selfcheck', long_timeout=True)
 
+    def run_iram_benchmark(self):
+        """
+        RPC call to time the hot crypto, qr and rendering routines (candidates for IRAM placement),
+        with the flash cache warm and cold.
+        NOTE: Only available in a DEBUG build of the firmware.
+
+        Returns
+        -------
+        dict
+            Per routine: dict with 'warm_cycles' and 'cold_cycles' - cpu cycles taken
+        """
+        return self._jadeRpc('debug_iram_benchmark', long_timeout=True)
+
+    def get_stack_usage(self):
+        """
+        RPC call to fetch the stack usage measured while handling messages so far.
+        NOTE: Only available in a DEBUG build of the firmware.
+
+        Returns
+        -------
+        dict
+            'tasks' : dict of task name to dict with 'stack_size' and 'min_free' - the task stack
+            size and lowest free-stack high-water-mark seen, both in bytes - and 'peak_method', the
+            message being handled when that high-water-mark was recorded.
+            'methods' : dict of message method to the peak main task stack used handling it (bytes)
+        """
+        return self._jadeRpc('debug_get_stack_usage')
+
+    def get_signing_latency(self):
+        """
+        RPC call to fetch the time taken from the user's final confirmation to the last signature.
+        NOTE: Only available in a DEBUG build of the firmware.
+
+        Returns
+        -------
+        dict
+            'count' : int - the number of transactions/psbts signed since boot
+            'last_ms' : int - the latency of the most recent signing, in milliseconds
+            'max_ms' : int - the greatest latency seen since boot, in milliseconds
+        """
+        return self._jadeRpc('debug_get_signing_latency')
+
+    def set_sha_load(self, enabled):
+        """
+        RPC call to start/stop a task on the hw continually hashing, as a competing load for the
+        hw sha engine (eg. to benchmark signing while the gui/camera are busy).
+        NOTE: Only available in a DEBUG build of the firmware.
+
+        Parameters
+        ----------
+        enabled : bool
+            Whether the competing hash load should run
+
+        Returns
+        -------
+        bool
+            True on success.
+        """
+        return self._jadeRpc('debug_set_sha_load', {'enabled': enabled})
+
     def capture_image_data(self, check_qr=False):
         """
         RPC call to capture raw image data from the camera.
@@ -510,7 +677,7 @@ class JadeAPI:
         params = {'check_qr': check_qr}
         return self._jadeRpc('debug_capture_image_data', params)
 
-    def scan_qr(self, image):
+    def scan_qr(self, image, width=None):
         """
         RPC call to scan a passed image and return any data extracted from any qr image.
         Exercises the camera image capture, but ignores result and uses passed image instead.
@@ -522,12 +689,19 @@ class JadeAPI:
         image : bytes
             The image data (as obtained from capture_image_data() above).
 
+        width : int, optional
+            The width of a higher resolution (4:3) image of the camera's field of view.  Such an
+            image is replayed as the camera would capture it, including any zooming-in on a dense
+            qr code.  Defaults to the camera frame size.
+
         Returns
         -------
         bytes
             String or byte data obtained from the image (via qr code)
         """
         params = {'image': image}
+        if width is not None:
+            params['width'] = width
         return self._jadeRpc('debug_scan_qr', params)
 
     def clean_reset(self):
@@ -542,6 +716,24 @@ class JadeAPI:
         """
         return self._jadeRpc('debug_clean_reset')
 
+    def set_fast_ui(self, enabled):
+        """
+        RPC call to enable/disable 'fast ui' mode, where user confirmations are automatically
+        given immediately rather than after the usual short delay (eg. for test harnesses).
+        NOTE: Only available in a DEBUG 'unattended ci' build of the firmware.
+
+        Parameters
+        ----------
+        enabled : bool
+            Whether to collapse the automatic-confirmation delays
+
+        Returns
+        -------
+        bool
+            True on success.
+        """
+        return self._jadeRpc('debug_set_fast_ui', {'enabled': enabled})
+
     def set_mnemonic(self, mnemonic, passphrase=None, temporary_wallet=False):
         """
         RPC call to set the wallet mnemonic (in RAM only - flash storage is untouched).
@@ -647,7 +839,7 @@ class JadeAPI:
                   'reset_certificate': reset_certificate}
         return self._jadeRpc('update_pinserver', params)
 
-    def auth_user(self, network, http_request_fn=None, epoch=None):
+    def auth_user(self, network, http_request_fn=None, epoch=None, wallet=None):
         """
         RPC call to authenticate the user on the hw device, for using with the network provided.
 
@@ -667,6 +859,10 @@ class JadeAPI:
         epoch : int, optional
             Current epoch value, in seconds.  Defaults to int(time.time()) value.
 
+        wallet : str, optional
+            The name of the persisted wallet to unlock (see get_wallets()).  Defaults to the main
+            wallet.
+
         Returns
         -------
         bool
@@ -675,10 +871,79 @@ class JadeAPI:
             False if the PIN entered was incorrect.
         """
         params = {'network': network, 'epoch': epoch if epoch is not None else int(time.time())}
+        if wallet is not None:
+            params['wallet'] = wallet
         return self._jadeRpc('auth_user', params,
                              http_request_fn=http_request_fn,
                              long_timeout=True)
 
+    def get_wallets(self):
+        """
+        RPC call to list the wallets persisted on the hw - the 'main' wallet and any other named
+        wallets added with add_wallet().
+
+        Returns
+        -------
+        dict
+            'active' - the name of the wallet currently in use
+            'wallets' - list of the names of all persisted wallets
+        """
+        return self._jadeRpc('get_wallets')
+
+    def select_wallet(self, name):
+        """
+        RPC call to switch to another persisted wallet.  The user must confirm on the hw.
+        No pinserver interaction is required.
+
+        Parameters
+        ----------
+        name : str
+            The name of the wallet to switch to
+
+        Returns
+        -------
+        bool
+            True if the named wallet is now in use
+        """
+        params = {'name': name}
+        return self._jadeRpc('select_wallet', params, long_timeout=True)
+
+    def add_wallet(self, name):
+        """
+        RPC call to add another named wallet, sharing the PIN of the main wallet.
+        The user enters the recovery phrase (and any passphrase) on the hw.
+
+        Parameters
+        ----------
+        name : str
+            The name for the new wallet
+
+        Returns
+        -------
+        bool
+            True if the wallet was persisted, and is now in use
+        """
+        params = {'name': name}
+        return self._jadeRpc('add_wallet', params, long_timeout=True)
+
+    def erase_wallet(self, name):
+        """
+        RPC call to erase a named wallet, and its multisig registrations and OTP records.
+        The user must confirm on the hw.  The main and active wallets cannot be erased.
+
+        Parameters
+        ----------
+        name : str
+            The name of the wallet to erase
+
+        Returns
+        -------
+        bool
+            True if the wallet was erased
+        """
+        params = {'name': name}
+        return self._jadeRpc('erase_wallet', params, long_timeout=True)
+
     def register_otp(self, otp_name, otp_uri):
         """
         RPC call to register a new OTP record on the hw device.
@@ -745,6 +1010,7 @@ class JadeAPI:
     def get_registered_multisigs(self):
         """
         RPC call to fetch brief summaries of any multisig wallets registered to this signer.
+        NOTE: Fetches the registrations a page at a time (see get_registered_multisigs_page()).
 
         Returns
         -------
@@ -757,7 +1023,37 @@ class JadeAPI:
                 num_signers - total number of signatories, M
                 master_blinding_key - 32-bytes, any liquid master blinding key for this wallet
         """
-        return self._jadeRpc('get_registered_multisigs')
+        multisigs = {}
+        page, num_pages = 0, 1
+        while page < num_pages:
+            reply = self.get_registered_multisigs_page(page)
+            if 'num_pages' not in reply or not isinstance(reply.get('multisigs'), dict):
+                # Older firmware does not support paging, and returns all registrations
+                return reply
+            multisigs.update(reply['multisigs'])
+            num_pages = reply['num_pages']
+            page += 1
+        return multisigs
+
+    def get_registered_multisigs_page(self, page):
+        """
+        RPC call to fetch brief summaries of one page of the multisig wallets registered.
+
+        Parameters
+        ----------
+        page : int
+            Index of the page of registrations to fetch
+
+        Returns
+        -------
+        dict
+            page - int, the page index requested
+            num_pages - int, the total number of pages of registrations
+            multisigs - dict, as for get_registered_multisigs(), for the registrations in this page
+                        which are valid for this signer
+        """
+        params = {'page': page}
+        return self._jadeRpc('get_registered_multisigs', params)
 
     def register_multisig(self, network, multisig_name, variant, sorted_keys, threshold, signers,
                           master_blinding_key=None):
@@ -1474,6 +1770,40 @@ class JadeAPI:
         # Send inputs and receive signatures
         return self._send_tx_inputs(base_id, inputs, use_ae_signatures)
 
+    def _get_extended_data_result(self, request):
+        """
+        Helper to read the replies to a request whose result may be split over multiple messages.
+        NOTE: we send 'get_extended_data' messages to request more 'chunks' of the reply data.
+
+        Parameters
+        ----------
+        request : dict
+            The request already sent to Jade
+
+        Returns
+        -------
+        bytearray
+            The complete result data, concatenated from all the replies
+        """
+        result = bytearray()
+        while True:
+            reply = self.jade.read_response()
+            self.jade.validate_reply(request, reply)
+            result.extend(self._get_result_or_raise_error(reply))
+
+            if 'seqnum' not in reply or reply['seqnum'] == reply['seqlen']:
+                break
+
+            newid = str(random.randint(100000, 999999))
+            params = {'origid': request['id'],
+                      'orig': request['method'],
+                      'seqnum': reply['seqnum'] + 1,
+                      'seqlen': reply['seqlen']}
+            request_more = self.jade.build_request(newid, 'get_extended_data', params)
+            self.jade.write_request(request_more)
+
+        return result
+
     def sign_psbt(self, network, psbt):
         """
         RPC call to sign a passed psbt as required
@@ -1498,25 +1828,33 @@ class JadeAPI:
         self.jade.write_request(request)
 
         # Read replies until we have them all, collate data and return.
-        # NOTE: we send 'get_extended_data' messages to request more 'chunks' of the reply data.
-        psbt_out = bytearray()
-        while True:
-            reply = self.jade.read_response()
-            self.jade.validate_reply(request, reply)
-            psbt_out.extend(self._get_result_or_raise_error(reply))
+        return self._get_extended_data_result(request)
 
-            if 'seqnum' not in reply or reply['seqnum'] == reply['seqlen']:
-                break
+    def sign_psbts(self, network, psbts):
+        """
+        RPC call to sign a batch of passed psbts as required, after a single review on the hw
 
-            newid = str(random.randint(100000, 999999))
-            params = {'origid': msgid,
-                      'orig': 'sign_psbt',
-                      'seqnum': reply['seqnum'] + 1,
-                      'seqlen': reply['seqlen']}
-            request = self.jade.build_request(newid, 'get_extended_data', params)
-            self.jade.write_request(request)
+        Parameters
+        ----------
+        network : str
+            Network to which the txns should apply - eg. 'mainnet', 'testnet', etc.
+
+        psbts : [bytes]
+            The psbts formatted as bytes
+
+        Returns
+        -------
+        [bytes]
+            The psbts, in the same order, updated with any signatures required from the hw signer
+        """
+        # Send PSBTs message
+        params = {'network': network, 'psbts': psbts}
+        msgid = str(random.randint(100000, 999999))
+        request = self.jade.build_request(msgid, 'sign_psbts', params)
+        self.jade.write_request(request)
 
-        return psbt_out
+        # Read replies until we have them all, then decode the collated cbor array of psbts
+        return cbor.loads(self._get_extended_data_result(request))
 
 
 class JadeInterface:
@@ -1,6 +1,5 @@
 import logging
 import asyncio
-import aioitertools
 import collections
 import subprocess
 import platform
@@ -28,17 +27,33 @@ class JadeBleImpl:
     IO_SERVICE_UUID = '6e400001-b5a3-f393-e0a9-e50e24dcca9e'
     IO_TX_CHAR_UUID = '6e400002-b5a3-f393-e0a9-e50e24dcca9e'
     IO_RX_CHAR_UUID = '6e400003-b5a3-f393-e0a9-e50e24dcca9e'
+    IO_CREDIT_CHAR_UUID = '6e400004-b5a3-f393-e0a9-e50e24dcca9e'
     BLE_MAX_WRITE_SIZE = 517 - 8
 
+    # If we run out of write credit and no more is returned in this time, re-sync the
+    # credit count with a single write-with-response (eg. if a credit notification was lost)
+    CREDIT_TIMEOUT = 1.0
+
     def __init__(self, device_name, serial_number, scan_timeout, loop=None):
         self.device_name = device_name
         self.serial_number = serial_number
         self.scan_timeout = max(1, scan_timeout)
-        self.inputstream = None
+        self.inbufs = None
+        self.inbuf = bytearray()
+        self.input_event = None
         self.write_task = None
         self.client = None
         self.rx_char_handle = None
 
+        # Write-without-response flow control - the device advertises a window of writes that may
+        # be outstanding, and notifies the running count of writes it has processed.
+        # (If the device does not support this, all writes are made with response.)
+        self.credit_char_handle = None
+        self.credit_window = 0
+        self.writes_sent = 0
+        self.writes_processed = 0
+        self.credit_event = None
+
         if not loop:
             loop = asyncio.get_event_loop()
         self.loop = loop
@@ -51,25 +66,11 @@ class JadeBleImpl:
     async def _connect_impl(self):
         assert self.client is None
 
-        # Input received, buffered awaiting external read
-        inbufs = collections.deque()
-
-        # Async stream of those items for reading
-        async def _input_stream():
-            # Poll for new input all the time client exists
-            while self.client is not None:
-                while inbufs:
-                    buf = inbufs.popleft()
-                    for b in buf:
-                        yield b
-
-                # No data, yield to event loop awaiting arrival of more data
-                await asyncio.sleep(0.01)
-
-            # Stream drained and client connection no longer exists
-            self.inputstream = None
-
-        self.inputstream = _input_stream()
+        # Input notifications received, buffered awaiting external read
+        self.inbufs = collections.deque()
+        self.inbuf = bytearray()
+        self.input_event = asyncio.Event()
+        self.credit_event = asyncio.Event()
 
         # Scan for expected ble device
         # Match device-name only if no serial number provided
@@ -121,7 +122,9 @@ class JadeBleImpl:
                     raise
 
         # Peruse services and characteristics
-        # Get the 'handle' of the receiving charactersitic
+        # Get the 'handle' of the receiving charactersitic, and of any credit characteristic
+        self.credit_char_handle = None
+        self.credit_window = 0
         for service in client.services:
             for char in service.characteristics:
                 if char.uuid == JadeBleImpl.IO_RX_CHAR_UUID:
@@ -129,7 +132,12 @@ class JadeBleImpl:
                     self.rx_char_handle = char.handle
 
                 if 'read' in char.properties:
-                    await client.read_gatt_char(char.uuid)
+                    value = await client.read_gatt_char(char.uuid)
+                    if char.uuid == JadeBleImpl.IO_CREDIT_CHAR_UUID and len(value) >= 2:
+                        self.credit_char_handle = char.handle
+                        self.credit_window = int.from_bytes(value[:2], 'little')
+                        logger.debug('Found credit characteristic - window: {}'.format(
+                            self.credit_window))
 
                 for descriptor in char.descriptors:
                     await client.read_gatt_descriptor(descriptor.handle)
@@ -137,19 +145,35 @@ class JadeBleImpl:
         # Attach handler to be notified of new data on the receiving characteristic
         def _notification_handler(char_handle, data):
             assert char_handle == self.rx_char_handle
-            inbufs.append(data)
+            self.inbufs.append(data)
+            self.input_event.set()
 
         assert self.rx_char_handle
         await client.start_notify(self.rx_char_handle,
                                   _notification_handler)
 
+        # Attach handler to be notified of writes processed, if supported
+        def _credit_handler(char_handle, data):
+            assert char_handle == self.credit_char_handle
+            processed = int.from_bytes(data[:4], 'little')
+            self.writes_processed = max(self.writes_processed, processed)
+            self.credit_event.set()
+
+        self.writes_sent = 0
+        self.writes_processed = 0
+        if self.credit_char_handle and self.credit_window > 0:
+            await client.start_notify(self.credit_char_handle, _credit_handler)
+            logger.info('Writing without response, credit window: {}'.format(self.credit_window))
+
         # Attach handler called when disconnected
         def _disconnection_handler(client):
 
-            # Set the client to None - that will cause the receive
-            # generator to terminate and not wait forever for data.
+            # Set the client to None and wake any reader - that will cause the
+            # read to return and not wait forever for data.
             assert client == self.client
             self.client = None
+            self.input_event.set()
+            self.credit_event.set()
 
             # Also cancel any running task trying to write data,
             # as otherwise that hangs forever too ...
@@ -171,6 +195,8 @@ class JadeBleImpl:
                 # Stop listening for incoming data
                 if self.rx_char_handle:
                     await self.client.stop_notify(self.rx_char_handle)
+                if self.credit_char_handle and self.credit_window > 0:
+                    await self.client.stop_notify(self.credit_char_handle)
 
                 # Disconnect underlying client - this should trigger the _disconnection_handler()
                 # above to run before this returns from the 'await'
@@ -180,14 +206,36 @@ class JadeBleImpl:
             # if the client has already internally disconnected ...
             logger.warn("Exception when disconnecting ble: {}".format(err))
 
-        # Set the client to None in any case - that will cause the receive
-        # generator to terminate and not wait forever for data.
+        # Set the client to None in any case - that will cause any read
+        # to return and not wait forever for data.
         self.rx_char_handle = None
+        self.credit_char_handle = None
         self.client = None
+        if self.input_event:
+            self.input_event.set()
 
     def disconnect(self):
         return self._run(self._disconnect_impl())
 
+    # Wait for credit to write without response - returns False if the device does not support
+    # it, or if no credit is returned in time, in which case the caller should write with response.
+    async def _await_write_credit(self):
+        if not self.credit_window:
+            return False
+
+        while self.writes_sent - self.writes_processed >= self.credit_window:
+            self.credit_event.clear()
+            try:
+                await asyncio.wait_for(self.credit_event.wait(), JadeBleImpl.CREDIT_TIMEOUT)
+            except asyncio.TimeoutError:
+                logger.warn("No write credit returned - re-syncing with write-with-response")
+                return False
+
+            if self.client is None:
+                return False
+
+        return True
+
     async def _write_impl(self, bytes_):
         assert self.client is not None
         assert self.write_task is None
@@ -204,10 +252,16 @@ class JadeBleImpl:
                     remaining = towrite - written
                     length = min(remaining, JadeBleImpl.BLE_MAX_WRITE_SIZE)
                     ulimit = written + length
+                    response = not await self._await_write_credit()
                     await self.client.write_gatt_char(
                                     JadeBleImpl.IO_TX_CHAR_UUID,
                                     bytearray(bytes_[written:ulimit]),
-                                    response=True)
+                                    response=response)
+                    self.writes_sent += 1
+
+                    # A write response implies all prior writes have been processed
+                    if response:
+                        self.writes_processed = self.writes_sent
 
                     written = ulimit
 
@@ -228,9 +282,24 @@ class JadeBleImpl:
         return self._run(self._write_impl(bytes_))
 
     async def _read_impl(self, n):
-        assert self.inputstream is not None
-        return bytes([b async for b in
-                     aioitertools.islice(self.inputstream, n)])
+        assert self.input_event is not None
+
+        # Consume whole notifications until we have enough data, or the client disconnects
+        while len(self.inbuf) < n:
+            if self.inbufs:
+                self.inbuf.extend(self.inbufs.popleft())
+                continue
+
+            if self.client is None:
+                break
+
+            # No data, yield to event loop awaiting arrival of more data
+            self.input_event.clear()
+            await self.input_event.wait()
+
+        read = bytes(self.inbuf[:n])
+        del self.inbuf[:n]
+        return read
 
     def read(self, n):
         return self._run(self._read_impl(n))
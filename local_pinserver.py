@@ -0,0 +1,194 @@
+#!/usr/bin/env python
+
+import os
+import json
+import hmac
+import logging
+import argparse
+import wallycore as wally
+
+from http.server import BaseHTTPRequestHandler, HTTPServer
+
+# Local reference pinserver for tests, supporting both the two-step handshake
+# protocol and the single round-trip ('oneshot') variant.
+#
+# Two-step:
+#   start_handshake   -> {ske, sig[, oneshot]}  (ephemeral server key, signed by static key)
+#   set_pin / get_pin    {ske, cke, encrypted_data, hmac_encrypted_data} -> {encrypted_key, hmac}
+#
+# Single round-trip (offered to clients via 'oneshot' in the start_handshake reply):
+#   set_pin_oneshot / get_pin_oneshot
+#                        {cke, encrypted_data, hmac_encrypted_data} -> {encrypted_key, hmac}
+#   As above, but the client's ephemeral key is used with the server's static key directly.
+#   As there is no per-request server key, each cke is only accepted once (to prevent replays).
+#
+# Run as an http server with eg:
+#   python local_pinserver.py --port 8096
+# and point Jade at it with set_jade_pinserver.py (with the matching server_public_key.pub).
+
+logger = logging.getLogger('jade-pinserver')
+
+SERVER_PRIVATE_KEY_FILE = 'server_private_key.key'
+
+PIN_SECRET_LEN = wally.HMAC_SHA256_LEN
+ENTROPY_LEN = wally.HMAC_SHA256_LEN
+MAX_ATTEMPTS = 3
+
+
+def _derive_keys(privkey, pubkey):
+    # encrypt-request, hmac-request, encrypt-reply, hmac-reply - as in pinclient.c
+    shared_secret = wally.ecdh(pubkey, privkey)
+    return [wally.hmac_sha256(shared_secret, bytes([i])) for i in range(4)]
+
+
+def _aes_encrypt(key, plaintext):
+    iv = os.urandom(wally.AES_BLOCK_LEN)
+    return iv + wally.aes_cbc(key, iv, plaintext, wally.AES_FLAG_ENCRYPT)
+
+
+def _aes_decrypt(key, encrypted):
+    iv, payload = encrypted[:wally.AES_BLOCK_LEN], encrypted[wally.AES_BLOCK_LEN:]
+    return wally.aes_cbc(key, iv, payload, wally.AES_FLAG_DECRYPT)
+
+
+class LocalPinServer:
+    def __init__(self, private_key_file=SERVER_PRIVATE_KEY_FILE, offer_oneshot=True):
+        with open(private_key_file, 'rb') as f:
+            self.static_privkey = f.read()
+        self.static_pubkey = wally.ec_public_key_from_private_key(self.static_privkey)
+        self.offer_oneshot = offer_oneshot
+
+        self.ephemeral_keys = {}  # ske -> private key, for the two-step handshake
+        self.used_ckes = set()  # oneshot replay protection
+        self.pins = {}  # pin pubkey -> pin secret, aes key, failed attempts
+
+    # Pin database - set a new pin, or fetch the aes key for an existing one
+    def _set_pin(self, pin_pubkey, pin_secret):
+        aes_key = os.urandom(32)
+        self.pins[pin_pubkey] = {'pin_secret': pin_secret, 'aes_key': aes_key, 'attempts': 0}
+        return aes_key
+
+    def _get_pin(self, pin_pubkey, pin_secret):
+        record = self.pins.get(pin_pubkey)
+        if record and hmac.compare_digest(record['pin_secret'], pin_secret):
+            record['attempts'] = 0
+            return record['aes_key']
+
+        if record:
+            record['attempts'] += 1
+            if record['attempts'] >= MAX_ATTEMPTS:
+                del self.pins[pin_pubkey]
+
+        # Bad pin - return a random key
+        return os.urandom(32)
+
+    # Decrypt and verify the client payload, call the pin database, and encrypt the reply
+    def _call_with_payload(self, keys, cke, encrypted_data, hmac_encrypted_data, set_pin):
+        encrypt_key, hmac_key, reply_key, reply_hmac_key = keys
+
+        expected_hmac = wally.hmac_sha256(hmac_key, cke + encrypted_data)
+        if not hmac.compare_digest(expected_hmac, hmac_encrypted_data):
+            raise ValueError('Invalid hmac')
+
+        payload = _aes_decrypt(encrypt_key, encrypted_data)
+        pin_secret = payload[:PIN_SECRET_LEN]
+        entropy = payload[PIN_SECRET_LEN:PIN_SECRET_LEN + ENTROPY_LEN]
+        sig = payload[PIN_SECRET_LEN + ENTROPY_LEN:]
+
+        # The client signs with its pin key, which identifies the pin record
+        msghash = wally.sha256(cke + pin_secret + entropy)
+        pin_pubkey = bytes(wally.ec_sig_to_public_key(msghash, sig))
+
+        aes_key = (self._set_pin if set_pin else self._get_pin)(pin_pubkey, pin_secret)
+        encrypted = _aes_encrypt(reply_key, aes_key)
+        return encrypted, wally.hmac_sha256(reply_hmac_key, encrypted)
+
+    # Two-step protocol
+    def start_handshake(self):
+        privkey = os.urandom(wally.EC_PRIVATE_KEY_LEN)
+        ske = bytes(wally.ec_public_key_from_private_key(privkey))
+        sig = wally.ec_sig_from_bytes(self.static_privkey, wally.sha256(ske), wally.EC_FLAG_ECDSA)
+        self.ephemeral_keys[ske] = privkey
+        return ske, sig
+
+    def complete_handshake(self, ske, cke, encrypted_data, hmac_encrypted_data, set_pin):
+        privkey = self.ephemeral_keys.pop(bytes(ske))  # one use only
+        keys = _derive_keys(privkey, cke)
+        return self._call_with_payload(keys, cke, encrypted_data, hmac_encrypted_data, set_pin)
+
+    # Single round-trip protocol
+    def oneshot(self, cke, encrypted_data, hmac_encrypted_data, set_pin):
+        if not self.offer_oneshot:
+            raise ValueError('Single round-trip protocol not supported')
+
+        cke = bytes(cke)
+        if cke in self.used_ckes:
+            raise ValueError('Client key reused')
+        self.used_ckes.add(cke)
+
+        keys = _derive_keys(self.static_privkey, cke)
+        return self._call_with_payload(keys, cke, encrypted_data, hmac_encrypted_data, set_pin)
+
+    # Handle a json document posted to the given endpoint, returns the json reply
+    def handle(self, document, data):
+        h2b = wally.hex_to_bytes
+        b2h = wally.hex_from_bytes
+
+        if document == 'start_handshake':
+            ske, sig = self.start_handshake()
+            reply = {'ske': b2h(ske), 'sig': b2h(sig)}
+            if self.offer_oneshot:
+                reply['oneshot'] = True
+            return reply
+
+        set_pin = document.startswith('set_pin')
+        if document in ['set_pin', 'get_pin']:
+            encrypted, hmac_key = self.complete_handshake(
+                h2b(data['ske']), h2b(data['cke']), h2b(data['encrypted_data']),
+                h2b(data['hmac_encrypted_data']), set_pin)
+        elif document in ['set_pin_oneshot', 'get_pin_oneshot'] and self.offer_oneshot:
+            encrypted, hmac_key = self.oneshot(
+                h2b(data['cke']), h2b(data['encrypted_data']), h2b(data['hmac_encrypted_data']),
+                set_pin)
+        else:
+            # Unknown document (404) - including the single round-trip endpoints if not offered
+            raise KeyError(document)
+
+        return {'encrypted_key': b2h(encrypted), 'hmac': b2h(hmac_key)}
+
+
+def _make_handler(server):
+    class Handler(BaseHTTPRequestHandler):
+        def do_POST(self):
+            try:
+                length = int(self.headers.get('Content-Length', 0))
+                data = json.loads(self.rfile.read(length) or '{}')
+                reply = json.dumps(server.handle(self.path.strip('/'), data)).encode()
+                self.send_response(200)
+                self.send_header('Content-Type', 'application/json')
+                self.send_header('Content-Length', str(len(reply)))
+                self.end_headers()
+                self.wfile.write(reply)
+            except KeyError as e:
+                logger.error(f'Unknown document or field: {e}')
+                self.send_error(404)
+            except Exception as e:
+                logger.error(f'Error handling {self.path}: {e}')
+                self.send_error(500)
+
+    return Handler
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Local reference pinserver for tests')
+    parser.add_argument('--port', type=int, default=8096)
+    parser.add_argument('--key', default=SERVER_PRIVATE_KEY_FILE,
+                        help='Static server private key file')
+    parser.add_argument('--no-oneshot', action='store_true',
+                        help='Only support the two-step handshake protocol')
+    args = parser.parse_args()
+
+    logging.basicConfig(level=logging.INFO)
+    server = LocalPinServer(args.key, not args.no_oneshot)
+    logger.info(f'Serving on port {args.port}, single round-trip: {server.offer_oneshot}')
+    HTTPServer(('', args.port), _make_handler(server)).serve_forever()
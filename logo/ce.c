@@ -1,376 +1,90 @@
-/* GIMP RGB C-Source image dump (ce.c) */
+/* Palette+RLE encoded rgb565 picture (ce.c) */
+/* Generated by tools/mkpicture.py - do not edit */
 
 #include "tft.h"
 
+static const uint8_t ce_data[] = {
+  0x1b, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x82, 0x10, 0xa2, 0x10, 0xc3, 0x18, 0x45,
+  0x29, 0xc7, 0x39, 0x08, 0x42, 0x28, 0x42, 0x49, 0x4a, 0x2c, 0x63, 0x6d, 0x6b, 0xae, 0x73, 0xef,
+  0x7b, 0x10, 0x84, 0x30, 0x84, 0x51, 0x8c, 0x71, 0x8c, 0x92, 0x94, 0xb2, 0x94, 0x14, 0xa5, 0xb6,
+  0xb5, 0x9a, 0xd6, 0xdb, 0xde, 0x7d, 0xef, 0xff, 0xff, 0x15, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00,
+  0x0b, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x17, 0x03, 0x1b, 0x00, 0x17, 0x00, 0x05, 0x26, 0x00, 0x00,
+  0x02, 0x00, 0x07, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x17, 0x03, 0x1b, 0x00, 0x17, 0x12,
+  0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x13, 0x0a, 0x1b, 0x00, 0x06, 0x23, 0x00, 0x00, 0x04, 0x00,
+  0x0a, 0x00, 0x13, 0x0a, 0x1b, 0x10, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x0d, 0x1b, 0x00, 0x06, 0x21,
+  0x00, 0x00, 0x07, 0x00, 0x0f, 0x0d, 0x1b, 0x0e, 0x00, 0x00, 0x07, 0x00, 0x14, 0x0f, 0x1b, 0x00,
+  0x06, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x14, 0x0f, 0x1b, 0x0c, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11,
+  0x1b, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x1b, 0x0b, 0x00, 0x00, 0x08, 0x00,
+  0x18, 0x12, 0x1b, 0x00, 0x06, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x18, 0x12, 0x1b, 0x09, 0x00, 0x00,
+  0x01, 0x00, 0x0c, 0x14, 0x1b, 0x00, 0x06, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x14, 0x1b, 0x08,
+  0x00, 0x00, 0x02, 0x00, 0x12, 0x15, 0x1b, 0x00, 0x06, 0x19, 0x00, 0x00, 0x02, 0x00, 0x12, 0x15,
+  0x1b, 0x07, 0x00, 0x00, 0x03, 0x00, 0x15, 0x16, 0x1b, 0x00, 0x06, 0x18, 0x00, 0x00, 0x03, 0x00,
+  0x15, 0x16, 0x1b, 0x06, 0x00, 0x00, 0x02, 0x00, 0x15, 0x0d, 0x1b, 0x00, 0x1a, 0x00, 0x0f, 0x00,
+  0x0b, 0x00, 0x07, 0x00, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x01, 0x17,
+  0x00, 0x00, 0x02, 0x00, 0x15, 0x0d, 0x1b, 0x00, 0x1a, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00,
+  0x05, 0x00, 0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x05, 0x05, 0x00, 0x00, 0x01, 0x00, 0x12, 0x0c,
+  0x1b, 0x00, 0x15, 0x00, 0x08, 0x00, 0x02, 0x20, 0x00, 0x00, 0x01, 0x00, 0x12, 0x0c, 0x1b, 0x00,
+  0x15, 0x00, 0x08, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x0c, 0x0b, 0x1b, 0x00, 0x15, 0x00, 0x07, 0x23,
+  0x00, 0x00, 0x0c, 0x0b, 0x1b, 0x00, 0x15, 0x00, 0x07, 0x10, 0x00, 0x00, 0x08, 0x0a, 0x1b, 0x00,
+  0x19, 0x00, 0x09, 0x24, 0x00, 0x00, 0x08, 0x0a, 0x1b, 0x00, 0x19, 0x00, 0x09, 0x11, 0x00, 0x00,
+  0x04, 0x00, 0x18, 0x09, 0x1b, 0x00, 0x16, 0x00, 0x06, 0x24, 0x00, 0x00, 0x04, 0x00, 0x18, 0x09,
+  0x1b, 0x00, 0x16, 0x00, 0x06, 0x12, 0x00, 0x00, 0x0e, 0x09, 0x1b, 0x00, 0x11, 0x00, 0x02, 0x25,
+  0x00, 0x00, 0x0e, 0x09, 0x1b, 0x00, 0x11, 0x00, 0x02, 0x12, 0x00, 0x00, 0x07, 0x09, 0x1b, 0x00,
+  0x11, 0x00, 0x01, 0x25, 0x00, 0x00, 0x07, 0x09, 0x1b, 0x00, 0x11, 0x00, 0x01, 0x13, 0x00, 0x00,
+  0x14, 0x08, 0x1b, 0x00, 0x16, 0x00, 0x02, 0x26, 0x00, 0x00, 0x14, 0x08, 0x1b, 0x00, 0x16, 0x00,
+  0x02, 0x13, 0x00, 0x00, 0x07, 0x08, 0x1b, 0x00, 0x19, 0x00, 0x06, 0x26, 0x00, 0x00, 0x07, 0x08,
+  0x1b, 0x00, 0x19, 0x00, 0x06, 0x14, 0x00, 0x00, 0x0f, 0x08, 0x1b, 0x00, 0x09, 0x27, 0x00, 0x00,
+  0x0f, 0x08, 0x1b, 0x00, 0x09, 0x14, 0x00, 0x00, 0x04, 0x08, 0x1b, 0x00, 0x15, 0x27, 0x00, 0x00,
+  0x04, 0x08, 0x1b, 0x00, 0x15, 0x15, 0x00, 0x00, 0x0a, 0x08, 0x1b, 0x00, 0x07, 0x27, 0x00, 0x00,
+  0x0a, 0x08, 0x1b, 0x00, 0x07, 0x15, 0x00, 0x00, 0x13, 0x07, 0x1b, 0x00, 0x15, 0x28, 0x00, 0x00,
+  0x13, 0x07, 0x1b, 0x00, 0x15, 0x15, 0x00, 0x00, 0x02, 0x08, 0x1b, 0x00, 0x08, 0x27, 0x00, 0x00,
+  0x02, 0x08, 0x1b, 0x00, 0x08, 0x15, 0x00, 0x00, 0x07, 0x07, 0x1b, 0x00, 0x1a, 0x00, 0x02, 0x27,
+  0x00, 0x00, 0x07, 0x07, 0x1b, 0x00, 0x1a, 0x00, 0x02, 0x15, 0x00, 0x00, 0x0b, 0x07, 0x1b, 0x00,
+  0x0f, 0x28, 0x00, 0x00, 0x0b, 0x07, 0x1b, 0x00, 0x0f, 0x16, 0x00, 0x00, 0x0d, 0x07, 0x1b, 0x00,
+  0x0b, 0x28, 0x00, 0x00, 0x0d, 0x07, 0x1b, 0x00, 0x10, 0x0f, 0x09, 0x00, 0x0a, 0x05, 0x00, 0x00,
+  0x14, 0x07, 0x1b, 0x00, 0x07, 0x28, 0x00, 0x00, 0x14, 0x19, 0x1b, 0x05, 0x00, 0x00, 0x17, 0x07,
+  0x1b, 0x00, 0x05, 0x28, 0x00, 0x00, 0x17, 0x19, 0x1b, 0x05, 0x00, 0x08, 0x1b, 0x00, 0x03, 0x28,
+  0x00, 0x1a, 0x1b, 0x05, 0x00, 0x08, 0x1b, 0x29, 0x00, 0x1a, 0x1b, 0x05, 0x00, 0x08, 0x1b, 0x29,
+  0x00, 0x1a, 0x1b, 0x05, 0x00, 0x08, 0x1b, 0x00, 0x03, 0x28, 0x00, 0x1a, 0x1b, 0x05, 0x00, 0x00,
+  0x17, 0x07, 0x1b, 0x00, 0x05, 0x28, 0x00, 0x00, 0x17, 0x19, 0x1b, 0x05, 0x00, 0x00, 0x14, 0x07,
+  0x1b, 0x00, 0x07, 0x28, 0x00, 0x00, 0x14, 0x19, 0x1b, 0x05, 0x00, 0x00, 0x0d, 0x07, 0x1b, 0x00,
+  0x0b, 0x28, 0x00, 0x00, 0x0d, 0x07, 0x1b, 0x00, 0x10, 0x0f, 0x09, 0x00, 0x0a, 0x05, 0x00, 0x00,
+  0x0b, 0x07, 0x1b, 0x00, 0x0f, 0x28, 0x00, 0x00, 0x0b, 0x07, 0x1b, 0x00, 0x0f, 0x16, 0x00, 0x00,
+  0x07, 0x07, 0x1b, 0x00, 0x1a, 0x00, 0x02, 0x27, 0x00, 0x00, 0x07, 0x07, 0x1b, 0x00, 0x1a, 0x00,
+  0x02, 0x15, 0x00, 0x00, 0x02, 0x08, 0x1b, 0x00, 0x08, 0x27, 0x00, 0x00, 0x02, 0x08, 0x1b, 0x00,
+  0x08, 0x16, 0x00, 0x00, 0x13, 0x07, 0x1b, 0x00, 0x15, 0x28, 0x00, 0x00, 0x13, 0x07, 0x1b, 0x00,
+  0x15, 0x16, 0x00, 0x00, 0x0a, 0x08, 0x1b, 0x00, 0x07, 0x27, 0x00, 0x00, 0x0a, 0x08, 0x1b, 0x00,
+  0x07, 0x15, 0x00, 0x00, 0x04, 0x08, 0x1b, 0x00, 0x15, 0x27, 0x00, 0x00, 0x04, 0x08, 0x1b, 0x00,
+  0x15, 0x16, 0x00, 0x00, 0x0f, 0x08, 0x1b, 0x00, 0x09, 0x27, 0x00, 0x00, 0x0f, 0x08, 0x1b, 0x00,
+  0x09, 0x15, 0x00, 0x00, 0x07, 0x08, 0x1b, 0x00, 0x19, 0x00, 0x06, 0x26, 0x00, 0x00, 0x07, 0x08,
+  0x1b, 0x00, 0x19, 0x00, 0x06, 0x15, 0x00, 0x00, 0x14, 0x08, 0x1b, 0x00, 0x16, 0x00, 0x02, 0x26,
+  0x00, 0x00, 0x14, 0x08, 0x1b, 0x00, 0x16, 0x00, 0x02, 0x14, 0x00, 0x00, 0x07, 0x09, 0x1b, 0x00,
+  0x11, 0x00, 0x01, 0x25, 0x00, 0x00, 0x07, 0x09, 0x1b, 0x00, 0x11, 0x00, 0x01, 0x14, 0x00, 0x00,
+  0x0e, 0x09, 0x1b, 0x00, 0x11, 0x00, 0x02, 0x25, 0x00, 0x00, 0x0e, 0x09, 0x1b, 0x00, 0x11, 0x00,
+  0x02, 0x13, 0x00, 0x00, 0x04, 0x00, 0x18, 0x09, 0x1b, 0x00, 0x16, 0x00, 0x06, 0x24, 0x00, 0x00,
+  0x04, 0x00, 0x18, 0x09, 0x1b, 0x00, 0x16, 0x00, 0x06, 0x13, 0x00, 0x00, 0x08, 0x0a, 0x1b, 0x00,
+  0x19, 0x00, 0x09, 0x24, 0x00, 0x00, 0x08, 0x0a, 0x1b, 0x00, 0x19, 0x00, 0x09, 0x13, 0x00, 0x00,
+  0x0c, 0x0b, 0x1b, 0x00, 0x15, 0x00, 0x07, 0x23, 0x00, 0x00, 0x0c, 0x0b, 0x1b, 0x00, 0x15, 0x00,
+  0x07, 0x11, 0x00, 0x00, 0x01, 0x00, 0x12, 0x0c, 0x1b, 0x00, 0x15, 0x00, 0x08, 0x00, 0x02, 0x20,
+  0x00, 0x00, 0x01, 0x00, 0x12, 0x0c, 0x1b, 0x00, 0x15, 0x00, 0x08, 0x00, 0x02, 0x0f, 0x00, 0x00,
+  0x02, 0x00, 0x15, 0x0d, 0x1b, 0x00, 0x1a, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x05, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x01, 0x17, 0x00, 0x00, 0x02, 0x00, 0x15, 0x0d,
+  0x1b, 0x00, 0x1a, 0x00, 0x0f, 0x00, 0x0b, 0x00, 0x07, 0x00, 0x05, 0x00, 0x03, 0x01, 0x00, 0x00,
+  0x03, 0x00, 0x05, 0x07, 0x00, 0x00, 0x03, 0x00, 0x15, 0x16, 0x1b, 0x00, 0x06, 0x18, 0x00, 0x00,
+  0x03, 0x00, 0x15, 0x16, 0x1b, 0x08, 0x00, 0x00, 0x02, 0x00, 0x12, 0x15, 0x1b, 0x00, 0x06, 0x19,
+  0x00, 0x00, 0x02, 0x00, 0x12, 0x15, 0x1b, 0x09, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x14, 0x1b, 0x00,
+  0x06, 0x1a, 0x00, 0x00, 0x01, 0x00, 0x0c, 0x14, 0x1b, 0x0b, 0x00, 0x00, 0x08, 0x00, 0x18, 0x12,
+  0x1b, 0x00, 0x06, 0x1c, 0x00, 0x00, 0x08, 0x00, 0x18, 0x12, 0x1b, 0x0c, 0x00, 0x00, 0x04, 0x00,
+  0x0e, 0x11, 0x1b, 0x00, 0x06, 0x1d, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x11, 0x1b, 0x0e, 0x00, 0x00,
+  0x07, 0x00, 0x14, 0x0f, 0x1b, 0x00, 0x06, 0x1f, 0x00, 0x00, 0x07, 0x00, 0x14, 0x0f, 0x1b, 0x10,
+  0x00, 0x00, 0x07, 0x00, 0x0f, 0x0d, 0x1b, 0x00, 0x06, 0x21, 0x00, 0x00, 0x07, 0x00, 0x0f, 0x0d,
+  0x1b, 0x12, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00, 0x13, 0x0a, 0x1b, 0x00, 0x06, 0x23, 0x00, 0x00,
+  0x04, 0x00, 0x0a, 0x00, 0x13, 0x0a, 0x1b, 0x15, 0x00, 0x00, 0x02, 0x00, 0x07, 0x00, 0x0b, 0x00,
+  0x0d, 0x00, 0x14, 0x00, 0x17, 0x03, 0x1b, 0x00, 0x17, 0x00, 0x05, 0x26, 0x00, 0x00, 0x02, 0x00,
+  0x07, 0x00, 0x0b, 0x00, 0x0d, 0x00, 0x14, 0x00, 0x17, 0x03, 0x1b, 0x00, 0x17,
+};
+
 static const Picture ce = {
-  84, 60, 2, {
-  (uint16_t*)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000A\010E)IJmk\222\224\266\265\377\377\377\377\377\377\377\377"
-  "\266\265\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000A\010E)IJmk\222\224\266\265\377\377\377\377\377"
-  "\377\377\377\266\265\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\202\020(Bq\214\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020(Bq\214"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000E)\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000E)\222\224\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)"
-  "\222\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\256s\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\256s\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\307\071\232\326\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\307\071\232\326\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\040\000,c\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\040\000,c\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000A\010Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000A\010Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000a\010\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000a\010\262\224\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\262\224\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377}\357\357{IJE)\242\020a\010\000\000\000\000a\010\303\030\040\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000A\010\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\357{IJ"
-  "E)\242\020a\010\000\000\000\000a\010\242\020\000\000\000\000\000\000\000\000\000\000\000\000\040\000Q\214\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\262\224\307\071A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000Q\214\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\262\224\307\071A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000,c\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\262\224E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000,c\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262"
-  "\224E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\307\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\333\336\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\307\071\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\010B"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\202\020\232\326\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\024\245\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\232\326\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\024\245\303\030"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\256s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\060\204A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\256s\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\060\204A\010\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\060\204"
-  "\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\060\204\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\024\245A\010\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\222"
-  "\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\024\245A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\333\336\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\303\030\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\202\020\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\262\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000(B\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000(B\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377E)\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000q\214"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000q\214\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\262\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\307\071\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\307"
-  "\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377}\357A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377}\357A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000IJ\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\357{\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000IJ\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\357{\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000mk\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377IJ\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000mk\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\020\204\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010"
-  "B\010B\010B\010B\010B(B\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\266\265\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\266\265\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377a\010\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377a\010\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\266\265\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\266\265\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\222\224\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000mk\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377IJ\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000mk"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\020\204\010"
-  "B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B\010B(B\000\000\000\000\000"
-  "\000\000\000\000\000\000\000IJ\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\357{\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000IJ\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\357{\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377}\357A\010\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377}\357A\010\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000A\010\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\307\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\307\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000q\214\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\262\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000(B\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000(B\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377E)\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\202\020\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\262\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\262\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\010B"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\333\336\303\030\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\333"
-  "\336\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\024\245A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\024\245A\010\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000E)\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\060\204\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\060\204\040\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\256s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\060\204A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\256s\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\060\204A\010\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\232\326"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\024\245\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\232\326\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\024\245\303\030\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\307"
-  "\071\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\333\336\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\307\071\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\333\336\010B\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  ",c\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\262\224E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000,c\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224E)\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040"
-  "\000Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\262\224\307\071A\010\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000Q\214\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\262\224\307\071A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000A\010\262\224\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "}\357\357{IJE)\242\020a\010\000\000\000\000a\010\303\030\040\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "A\010\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\357{IJE)\242\020"
-  "a\010\000\000\000\000a\010\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\262\224\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\262"
-  "\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000A\010Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000A\010Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\040\000,c\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\040\000,c\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\307\071\232\326\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\307\071\232\326\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\202\020\256s\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\202\020\256s\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000E)\222\224\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)"
-  "\222\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\357{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\202\020(Bq\214\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020(Bq\214\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000A\010E)IJmk\222\224\266\265\377\377\377\377\377\377\377\377"
-  "\266\265\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000A\010E)IJmk\222\224\266\265\377\377\377\377\377"
-  "\377\377\377\266\265" } ,
+  84, 60, 2, { .data_8 = (uint8_t*)ce_data },
+  PICTURE_ENCODING_PALETTE_RLE, sizeof(ce_data),
 };
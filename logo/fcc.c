@@ -1,392 +1,134 @@
-/* GIMP RGB C-Source image dump (fcc.c) */
+/* Palette+RLE encoded rgb565 picture (fcc.c) */
+/* Generated by tools/mkpicture.py - do not edit */
 
 #include "tft.h"
 
+static const uint8_t fcc_data[] = {
+  0x3f, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x82, 0x10, 0xa2, 0x10, 0xc3, 0x18, 0xe3,
+  0x18, 0x04, 0x21, 0x24, 0x21, 0x45, 0x29, 0x65, 0x29, 0x86, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xe7,
+  0x39, 0x08, 0x42, 0x28, 0x42, 0x49, 0x4a, 0x69, 0x4a, 0x8a, 0x52, 0xaa, 0x52, 0xcb, 0x5a, 0xeb,
+  0x5a, 0x0c, 0x63, 0x2c, 0x63, 0x4d, 0x6b, 0x6d, 0x6b, 0x8e, 0x73, 0xae, 0x73, 0xcf, 0x7b, 0xef,
+  0x7b, 0x10, 0x84, 0x30, 0x84, 0x51, 0x8c, 0x71, 0x8c, 0x92, 0x94, 0xb2, 0x94, 0xd3, 0x9c, 0xf3,
+  0x9c, 0x14, 0xa5, 0x34, 0xa5, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7,
+  0xbd, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xdb, 0xde, 0xfb,
+  0xde, 0x1c, 0xe7, 0x3c, 0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9e, 0xf7, 0xbe, 0xf7, 0xdf, 0xff, 0xff,
+  0xff, 0x30, 0x00, 0x00, 0x02, 0x00, 0x09, 0x00, 0x11, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x23, 0x01,
+  0x26, 0x00, 0x23, 0x00, 0x1e, 0x00, 0x18, 0x00, 0x10, 0x00, 0x09, 0x00, 0x02, 0x11, 0x00, 0x00,
+  0x02, 0x00, 0x17, 0x19, 0x1e, 0x00, 0x0b, 0x10, 0x00, 0x00, 0x02, 0x00, 0x0f, 0x00, 0x1f, 0x00,
+  0x3a, 0x0b, 0x3f, 0x00, 0x39, 0x00, 0x1e, 0x00, 0x0e, 0x00, 0x02, 0x0e, 0x00, 0x00, 0x16, 0x1a,
+  0x3f, 0x00, 0x10, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x19, 0x00, 0x37, 0x11, 0x3f, 0x00, 0x35, 0x00,
+  0x17, 0x00, 0x05, 0x0c, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00, 0x10, 0x0c, 0x00, 0x00, 0x04, 0x00,
+  0x1a, 0x16, 0x3f, 0x00, 0x3b, 0x00, 0x18, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00,
+  0x10, 0x0b, 0x00, 0x00, 0x0f, 0x00, 0x33, 0x19, 0x3f, 0x00, 0x2f, 0x00, 0x0d, 0x09, 0x00, 0x00,
+  0x1f, 0x1a, 0x3f, 0x00, 0x10, 0x09, 0x00, 0x00, 0x03, 0x00, 0x1e, 0x1d, 0x3f, 0x00, 0x1b, 0x00,
+  0x02, 0x07, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00, 0x10, 0x08, 0x00, 0x00, 0x06, 0x00, 0x2a, 0x1f,
+  0x3f, 0x00, 0x27, 0x00, 0x05, 0x06, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00, 0x10, 0x07, 0x00, 0x00,
+  0x08, 0x00, 0x31, 0x21, 0x3f, 0x00, 0x2e, 0x00, 0x06, 0x05, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00,
+  0x10, 0x06, 0x00, 0x00, 0x08, 0x00, 0x33, 0x0c, 0x3f, 0x00, 0x3a, 0x00, 0x23, 0x00, 0x19, 0x00,
+  0x13, 0x01, 0x11, 0x00, 0x14, 0x00, 0x1a, 0x00, 0x24, 0x00, 0x3c, 0x0c, 0x3f, 0x00, 0x30, 0x00,
+  0x06, 0x04, 0x00, 0x00, 0x1f, 0x1a, 0x3f, 0x00, 0x10, 0x05, 0x00, 0x00, 0x05, 0x00, 0x30, 0x0a,
+  0x3f, 0x00, 0x34, 0x00, 0x18, 0x00, 0x0a, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00,
+  0x1a, 0x00, 0x36, 0x0a, 0x3f, 0x00, 0x2d, 0x00, 0x04, 0x03, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x28, 0x11, 0x0c, 0x00, 0x05, 0x04, 0x00, 0x00, 0x02, 0x00, 0x28, 0x09, 0x3f, 0x00, 0x33, 0x00,
+  0x13, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x03, 0x00, 0x14, 0x00, 0x36, 0x09, 0x3f, 0x00, 0x26, 0x00,
+  0x02, 0x02, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x22, 0x17, 0x00, 0x00, 0x1d, 0x09, 0x3f, 0x00,
+  0x1b, 0x00, 0x03, 0x11, 0x00, 0x00, 0x04, 0x00, 0x1e, 0x09, 0x3f, 0x00, 0x1a, 0x02, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x22, 0x16, 0x00, 0x00, 0x0f, 0x08, 0x3f, 0x00, 0x35, 0x00, 0x0d, 0x15,
+  0x00, 0x00, 0x10, 0x00, 0x3a, 0x08, 0x3f, 0x00, 0x0d, 0x01, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x22, 0x15, 0x00, 0x00, 0x04, 0x00, 0x32, 0x07, 0x3f, 0x00, 0x2f, 0x00, 0x07, 0x06, 0x00, 0x00,
+  0x08, 0x00, 0x14, 0x00, 0x1e, 0x00, 0x2a, 0x00, 0x37, 0x00, 0x36, 0x00, 0x29, 0x00, 0x1d, 0x00,
+  0x13, 0x00, 0x07, 0x06, 0x00, 0x00, 0x0a, 0x00, 0x34, 0x07, 0x3f, 0x00, 0x2f, 0x00, 0x02, 0x00,
+  0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x22, 0x15, 0x00, 0x00, 0x1a, 0x07, 0x3f, 0x00, 0x30, 0x00,
+  0x06, 0x04, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x2b, 0x09, 0x3f, 0x00, 0x29, 0x00, 0x0f, 0x00,
+  0x01, 0x04, 0x00, 0x00, 0x09, 0x00, 0x37, 0x07, 0x3f, 0x00, 0x13, 0x00, 0x00, 0x00, 0x1f, 0x07,
+  0x3f, 0x00, 0x22, 0x14, 0x00, 0x00, 0x07, 0x07, 0x3f, 0x00, 0x39, 0x00, 0x08, 0x04, 0x00, 0x00,
+  0x09, 0x00, 0x2a, 0x0d, 0x3f, 0x00, 0x27, 0x00, 0x08, 0x04, 0x00, 0x00, 0x0f, 0x07, 0x3f, 0x00,
+  0x31, 0x00, 0x02, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x21, 0x14, 0x00, 0x00, 0x1c, 0x07, 0x3f, 0x00,
+  0x10, 0x04, 0x00, 0x00, 0x13, 0x00, 0x3e, 0x0f, 0x3f, 0x00, 0x3a, 0x00, 0x11, 0x04, 0x00, 0x00,
+  0x19, 0x07, 0x3f, 0x00, 0x11, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x21, 0x13, 0x00, 0x00, 0x05, 0x00,
+  0x3b, 0x06, 0x3f, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x18, 0x13, 0x3f, 0x00, 0x15, 0x03, 0x00, 0x00,
+  0x01, 0x07, 0x0b, 0x00, 0x09, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x21, 0x13, 0x00, 0x00, 0x13, 0x06,
+  0x3f, 0x00, 0x38, 0x00, 0x05, 0x03, 0x00, 0x00, 0x15, 0x15, 0x3f, 0x00, 0x11, 0x0c, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x21, 0x13, 0x00, 0x00, 0x2c, 0x06, 0x3f, 0x00, 0x16, 0x03, 0x00, 0x00,
+  0x0c, 0x09, 0x3f, 0x00, 0x2f, 0x01, 0x23, 0x00, 0x30, 0x08, 0x3f, 0x00, 0x3d, 0x00, 0x0a, 0x0b,
+  0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x21, 0x12, 0x00, 0x00, 0x08, 0x06, 0x3f, 0x00, 0x38, 0x00,
+  0x04, 0x02, 0x00, 0x00, 0x03, 0x00, 0x31, 0x06, 0x3f, 0x00, 0x2f, 0x00, 0x12, 0x00, 0x05, 0x03,
+  0x00, 0x00, 0x05, 0x00, 0x13, 0x00, 0x32, 0x06, 0x3f, 0x00, 0x2b, 0x00, 0x02, 0x0a, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x21, 0x12, 0x00, 0x00, 0x14, 0x06, 0x3f, 0x00, 0x1b, 0x03, 0x00, 0x00,
+  0x18, 0x06, 0x3f, 0x00, 0x1a, 0x00, 0x02, 0x07, 0x00, 0x00, 0x03, 0x00, 0x1d, 0x06, 0x3f, 0x00,
+  0x13, 0x0a, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x20, 0x12, 0x00, 0x00, 0x22, 0x06, 0x3f, 0x00,
+  0x0a, 0x02, 0x00, 0x00, 0x04, 0x00, 0x3a, 0x05, 0x3f, 0x00, 0x14, 0x0b, 0x00, 0x00, 0x17, 0x05,
+  0x3f, 0x00, 0x32, 0x00, 0x02, 0x09, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x20, 0x11, 0x00, 0x00,
+  0x02, 0x00, 0x3a, 0x05, 0x3f, 0x00, 0x35, 0x00, 0x01, 0x02, 0x00, 0x00, 0x13, 0x05, 0x3f, 0x00,
+  0x1b, 0x0d, 0x00, 0x00, 0x21, 0x05, 0x3f, 0x00, 0x0f, 0x09, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x20, 0x11, 0x00, 0x00, 0x07, 0x06, 0x3f, 0x00, 0x1f, 0x03, 0x00, 0x00, 0x28, 0x04, 0x3f, 0x00,
+  0x31, 0x00, 0x03, 0x0d, 0x00, 0x00, 0x01, 0x05, 0x02, 0x00, 0x01, 0x09, 0x00, 0x00, 0x1f, 0x07,
+  0x3f, 0x00, 0x20, 0x11, 0x00, 0x00, 0x0d, 0x06, 0x3f, 0x00, 0x13, 0x02, 0x00, 0x00, 0x05, 0x05,
+  0x3f, 0x00, 0x13, 0x20, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x3e, 0x11, 0x3b, 0x00, 0x3d, 0x06,
+  0x3f, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x0c, 0x04, 0x3f, 0x00, 0x3e, 0x00, 0x04, 0x20, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x07, 0x02, 0x00, 0x00, 0x13, 0x04, 0x3f, 0x00, 0x27, 0x21, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x05, 0x02, 0x00, 0x00, 0x19, 0x04, 0x3f, 0x00, 0x1a, 0x21, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x1c, 0x04, 0x3f, 0x00, 0x15, 0x21, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x04, 0x02, 0x00, 0x00, 0x1b, 0x04, 0x3f, 0x00, 0x15, 0x21, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x05, 0x02, 0x00, 0x00, 0x18, 0x04, 0x3f, 0x00, 0x1b, 0x21, 0x00, 0x00,
+  0x1f, 0x22, 0x3f, 0x00, 0x08, 0x02, 0x00, 0x00, 0x13, 0x04, 0x3f, 0x00, 0x2a, 0x21, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x2b, 0x11, 0x1d, 0x00, 0x26, 0x06, 0x3f, 0x00, 0x0c, 0x02, 0x00, 0x00,
+  0x0b, 0x05, 0x3f, 0x00, 0x06, 0x20, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x11, 0x00, 0x00,
+  0x0b, 0x06, 0x3f, 0x00, 0x14, 0x02, 0x00, 0x00, 0x04, 0x05, 0x3f, 0x00, 0x16, 0x20, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x11, 0x00, 0x00, 0x06, 0x06, 0x3f, 0x00, 0x21, 0x03, 0x00, 0x00,
+  0x24, 0x04, 0x3f, 0x00, 0x36, 0x00, 0x05, 0x0d, 0x00, 0x00, 0x05, 0x05, 0x11, 0x00, 0x0a, 0x09,
+  0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x11, 0x00, 0x00, 0x01, 0x00, 0x35, 0x05, 0x3f, 0x00,
+  0x39, 0x00, 0x02, 0x02, 0x00, 0x00, 0x10, 0x05, 0x3f, 0x00, 0x21, 0x00, 0x01, 0x0b, 0x00, 0x00,
+  0x02, 0x00, 0x28, 0x05, 0x3f, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x12,
+  0x00, 0x00, 0x1f, 0x06, 0x3f, 0x00, 0x0c, 0x02, 0x00, 0x00, 0x02, 0x00, 0x35, 0x05, 0x3f, 0x00,
+  0x1b, 0x00, 0x01, 0x09, 0x00, 0x00, 0x01, 0x00, 0x1e, 0x05, 0x3f, 0x00, 0x2d, 0x00, 0x01, 0x09,
+  0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x12, 0x00, 0x00, 0x12, 0x06, 0x3f, 0x00, 0x1e, 0x03,
+  0x00, 0x00, 0x14, 0x06, 0x3f, 0x00, 0x22, 0x00, 0x05, 0x07, 0x00, 0x00, 0x06, 0x00, 0x24, 0x06,
+  0x3f, 0x00, 0x10, 0x0a, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x12, 0x00, 0x00, 0x06, 0x06,
+  0x3f, 0x00, 0x3d, 0x00, 0x06, 0x02, 0x00, 0x00, 0x02, 0x00, 0x2b, 0x06, 0x3f, 0x00, 0x3c, 0x00,
+  0x19, 0x00, 0x09, 0x00, 0x02, 0x01, 0x00, 0x00, 0x02, 0x00, 0x0a, 0x00, 0x1a, 0x07, 0x3f, 0x00,
+  0x25, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x13, 0x00, 0x00, 0x27, 0x06,
+  0x3f, 0x00, 0x19, 0x03, 0x00, 0x00, 0x09, 0x00, 0x3c, 0x08, 0x3f, 0x00, 0x3c, 0x01, 0x34, 0x00,
+  0x3d, 0x08, 0x3f, 0x00, 0x37, 0x00, 0x07, 0x0b, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x13,
+  0x00, 0x00, 0x11, 0x06, 0x3f, 0x00, 0x3d, 0x00, 0x07, 0x03, 0x00, 0x00, 0x10, 0x14, 0x3f, 0x00,
+  0x3e, 0x00, 0x0d, 0x0c, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x13, 0x00, 0x00, 0x03, 0x00,
+  0x36, 0x06, 0x3f, 0x00, 0x24, 0x00, 0x01, 0x03, 0x00, 0x00, 0x11, 0x12, 0x3f, 0x00, 0x3d, 0x00,
+  0x0f, 0x0d, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x14, 0x00, 0x00, 0x17, 0x07, 0x3f, 0x00,
+  0x14, 0x04, 0x00, 0x00, 0x0d, 0x00, 0x35, 0x0f, 0x3f, 0x00, 0x32, 0x00, 0x0b, 0x04, 0x00, 0x00,
+  0x1d, 0x07, 0x2d, 0x00, 0x0c, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x14, 0x00, 0x00, 0x05, 0x00,
+  0x38, 0x07, 0x3f, 0x00, 0x0d, 0x04, 0x00, 0x00, 0x05, 0x00, 0x21, 0x0d, 0x3f, 0x00, 0x1e, 0x00,
+  0x04, 0x04, 0x00, 0x00, 0x14, 0x07, 0x3f, 0x00, 0x2b, 0x00, 0x01, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x1a, 0x15, 0x00, 0x00, 0x16, 0x07, 0x3f, 0x00, 0x38, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x0b, 0x00,
+  0x20, 0x00, 0x3e, 0x07, 0x3f, 0x00, 0x3d, 0x00, 0x1e, 0x00, 0x0a, 0x05, 0x00, 0x00, 0x0d, 0x00,
+  0x3e, 0x07, 0x3f, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x15, 0x00, 0x00,
+  0x02, 0x00, 0x2d, 0x07, 0x3f, 0x00, 0x37, 0x00, 0x0b, 0x06, 0x00, 0x00, 0x04, 0x00, 0x0e, 0x00,
+  0x18, 0x00, 0x1f, 0x01, 0x24, 0x00, 0x1f, 0x00, 0x17, 0x00, 0x0d, 0x00, 0x04, 0x06, 0x00, 0x00,
+  0x0e, 0x00, 0x3c, 0x07, 0x3f, 0x00, 0x2a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x1a, 0x16, 0x00, 0x00, 0x0b, 0x09, 0x3f, 0x00, 0x13, 0x14, 0x00, 0x00, 0x01, 0x00, 0x16, 0x08,
+  0x3f, 0x00, 0x3d, 0x00, 0x09, 0x01, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x17, 0x00, 0x00,
+  0x17, 0x09, 0x3f, 0x00, 0x23, 0x00, 0x07, 0x11, 0x00, 0x00, 0x08, 0x00, 0x25, 0x09, 0x3f, 0x00,
+  0x14, 0x02, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x17, 0x00, 0x00, 0x01, 0x00, 0x22, 0x09,
+  0x3f, 0x00, 0x3d, 0x00, 0x19, 0x00, 0x06, 0x0d, 0x00, 0x00, 0x07, 0x00, 0x1c, 0x0a, 0x3f, 0x00,
+  0x1f, 0x03, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x18, 0x00, 0x00, 0x03, 0x00, 0x29, 0x0b,
+  0x3f, 0x00, 0x22, 0x00, 0x0f, 0x00, 0x06, 0x07, 0x00, 0x00, 0x07, 0x00, 0x10, 0x00, 0x23, 0x0b,
+  0x3f, 0x00, 0x25, 0x00, 0x02, 0x03, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x19, 0x00, 0x00,
+  0x05, 0x00, 0x2b, 0x0d, 0x3f, 0x00, 0x32, 0x00, 0x21, 0x00, 0x1b, 0x01, 0x19, 0x00, 0x1b, 0x00,
+  0x22, 0x00, 0x34, 0x0d, 0x3f, 0x00, 0x29, 0x00, 0x04, 0x04, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x1a, 0x1a, 0x00, 0x00, 0x05, 0x00, 0x2a, 0x21, 0x3f, 0x00, 0x27, 0x00, 0x04, 0x05, 0x00, 0x00,
+  0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x1b, 0x00, 0x00, 0x03, 0x00, 0x22, 0x1f, 0x3f, 0x00, 0x1f, 0x00,
+  0x02, 0x06, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x1c, 0x00, 0x00, 0x01, 0x00, 0x17, 0x1c,
+  0x3f, 0x00, 0x3d, 0x00, 0x14, 0x08, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x1e, 0x00, 0x00,
+  0x0a, 0x00, 0x29, 0x19, 0x3f, 0x00, 0x26, 0x00, 0x08, 0x09, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x1a, 0x1f, 0x00, 0x00, 0x01, 0x00, 0x12, 0x00, 0x32, 0x15, 0x3f, 0x00, 0x30, 0x00, 0x10, 0x00,
+  0x01, 0x0a, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00, 0x1a, 0x21, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00,
+  0x2b, 0x11, 0x3f, 0x00, 0x29, 0x00, 0x10, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x1f, 0x07, 0x3f, 0x00,
+  0x1a, 0x24, 0x00, 0x00, 0x09, 0x00, 0x16, 0x00, 0x2a, 0x0b, 0x3f, 0x00, 0x29, 0x00, 0x16, 0x00,
+  0x08, 0x0f, 0x00, 0x00, 0x1b, 0x07, 0x29, 0x00, 0x16, 0x27, 0x00, 0x00, 0x04, 0x00, 0x0a, 0x00,
+  0x11, 0x00, 0x17, 0x00, 0x1b, 0x01, 0x1c, 0x00, 0x1a, 0x00, 0x16, 0x00, 0x10, 0x00, 0x0a, 0x00,
+  0x04, 0x12, 0x00,
+};
+
 static const Picture fcc = {
-  81, 60, 2, {
-  (uint16_t*)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010$!(B\014c\317{q\214"
-  "\323\234\323\234q\214\317{\014c\010B$!A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\353Z\317{\317{\317{\317{\317"
-  "{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317{\317"
-  "{\317{\317{\317{\317{\317{\317{e)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\347\071\357{]\357\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "<\347\317{\307\071A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\313Z\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\303\030,c\373\336\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\272\326\353Z\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\202\020Mk\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377}\357\014ca\010\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\347\071y\316\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\367\275\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\317{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377mkA\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\303\030U\255\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\363\234\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\004!\070\306\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\327\275\303\030\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\004!y\316\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377]\357q\214,ciJ(B(B\212"
-  "RMk\222\224\236\367\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\030\306\303\030\000\000\000\000\000"
-  "\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\010B\000\000\000\000\000\000\000\000\000\000\000\000\242\020\030\306\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\232"
-  "\326\014cE)\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010e)Mk\333\336\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\266\265\202\020\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\024\245\206\061\206\061\206\061\206\061\206\061"
-  "\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206\061\206"
-  "\061\206\061\206\061\242\020\000\000\000\000\000\000\000\000\000\000A\010\024\245\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377y\316iJA\010\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\212R\333\336\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\323\234A\010\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377Q\214\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\256s\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377mka\010\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202"
-  "\020\317{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377Mk\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377Q\214\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\347\071\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\272\326\246\061\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\010B]\357\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\246\061\000\000\000\000\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377Q\214\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020Y\316\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\367\275\343\030\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\004!\212R\317{U\255\373\336\333\336\064\245\256siJ\343"
-  "\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\232\326\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\367\275A\010\000\000\357{\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377Q\214\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000Mk\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\030\306\303\030\000"
-  "\000\000\000\000\000\000\000\000\000\040\000\010Bu\255\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\064\245\347\071\040\000\000\000\000\000\000\000\000"
-  "\000\000\000$!\373\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377iJ\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377Q\214\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\343\030\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377<\347\004!\000\000\000\000\000\000\000\000\000\000$!U\255\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\363\234\004!\000\000\000\000\000\000\000\000\000\000\347\071\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\070\306A\010\357{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\060\204\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\216s\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\010"
-  "B\000\000\000\000\000\000\000\000\000\000iJ\337\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377]\357(B\000\000\000\000\000\000\000\000\000\000,c\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377(B\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\060\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\242\020}\357\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\317{\000\000\000\000\000\000\000\000\000\000\014c\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\252R\000\000\000\000\000\000\000\000\040\000e)e)e)e)e)e)e)e)$!\357{\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\060\204\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000iJ\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\034\347\242\020\000\000\000\000\000"
-  "\000\000\000\252R\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377(B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\060\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\226\265\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\313Z\000\000\000\000\000\000\000\000\206\061\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\367\275q\214q\214"
-  "\030\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\276\367E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\060\204\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004!\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\034\347\202\020\000\000\000"
-  "\000\000\000a\010\070\306\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\367\275IJ\242\020\000\000\000\000\000\000\000\000\242\020iJY\316\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377u\255A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\060\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\212R\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "mk\000\000\000\000\000\000\000\000\014c\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377MkA\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\256s\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377iJ\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\020\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000Q\214\377\377\377\377\377\377\377\377\377\377\377\377\377\377E"
-  ")\000\000\000\000\000\000\202\020]\357\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\212R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\353Z\377\377\377\377"
-  "\377\377\377\377\377\377\377\377Y\316A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\020\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000A\010]\357\377\377\377\377\377\377\377\377\377\377\377\377\272\326"
-  "\040\000\000\000\000\000\000\000iJ\377\377\377\377\377\377\377\377\377\377\377\377mk\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\347\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\020\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\343\030\377\377\377\377\377\377\377\377\377\377\377\377\377\377\357"
-  "{\000\000\000\000\000\000\000\000\024\245\377\377\377\377\377\377\377\377\377\377\070\306a"
-  "\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000A\010A\010"
-  "A\010A\010A\010A\010\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\020\204\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\246\061\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377iJ\000\000\000\000\000\000\242\020"
-  "\377\377\377\377\377\377\377\377\377\377\377\377iJ\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\337\377}\357}\357}\357}\357}\357}\357}\357"
-  "}\357}\357}\357}\357}\357}\357}\357}\357}\357}\357}\357\276\367\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\206\061\000\000\000\000\000\000\206\061\377"
-  "\377\377\377\377\377\377\377\377\377\337\377\202\020\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\343\030\000\000\000\000\000\000iJ\377\377\377\377\377"
-  "\377\377\377\377\377\363\234\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\242\020\000\000\000\000\000\000,c\377\377\377\377\377\377\377\377\377"
-  "\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357"
-  "{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\202\020\000"
-  "\000\000\000\000\000\216s\377\377\377\377\377\377\377\377\377\377\252R\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\202\020\000\000\000\000\000\000mk\377"
-  "\377\377\377\377\377\377\377\377\377\252R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\242\020\000\000\000\000\000\000\014c\377\377\377\377\377\377"
-  "\377\377\377\377mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\004!\000\000\000\000\000\000iJ\377\377\377\377\377\377\377\377\377\377U\255\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377u\255\256s\256s\256s"
-  "\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256s\256"
-  "s\323\234\377\377\377\377\377\377\377\377\377\377\377\377\377\377\206\061"
-  "\000\000\000\000\000\000e)\377\377\377\377\377\377\377\377\377\377\377\377\303\030\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000e)\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\212R\000\000\000\000\000\000\202\020\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\313Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\060\204\000\000\000\000\000\000\000\000\222\224\377\377\377\377\377\377"
-  "\377\377\377\377\333\336\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\242\020(B(B(B(B(B(BE)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377M"
-  "k\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\040\000\272\326\377\377\377\377\377\377\377\377\377\377\377\377<\347A\010\000"
-  "\000\000\000\000\000\010B\377\377\377\377\377\377\377\377\377\377\377\377\060\204\040"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\024\245\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\206"
-  "\061\000\000\000\000\000\000A\010\272\326\377\377\377\377\377\377\377\377\377\377\377\377"
-  "mk\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\317{\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\266\265\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000IJ\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\317{\000\000\000\000\000\000\000\000\212R\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377Q\214\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030\222\224\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\010B\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\276\367\303\030\000\000\000\000\000\000A\010u\255\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\236\367,c$!A\010\000\000\000\000A\010E)Mk\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224\040\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\363\234\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377,c\000\000\000\000\000\000\000\000$!\236\367\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\236"
-  "\367\232\326\232\326\276\367\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\373\336\343\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000(B\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\276\367\343\030\000\000\000\000\000\000\000\000\010B\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377"
-  "\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\333"
-  "\336\377\377\377\377\377\377\377\377\377\377\377\377\377\377\222\224\040\000"
-  "\000\000\000\000\000\000\000\000(B\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\276\367\347\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\353Z\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\212R\000\000\000\000\000\000\000\000\000\000\246\061\272\326\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377Y\316e)\000\000\000\000\000\000\000\000\000"
-  "\000\256s\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265\206"
-  "\061\357{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\242\020\034\347\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\246\061\000\000\000\000\000\000\000\000\000\000\242\020\060\204\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\317{\202\020\000\000\000\000\000\000\000\000\000\000\212R\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377u\255\040\000\357{\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\313Z\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\034\347E)\000\000\000\000\000\000\000\000\000\000\000\000e)\020\204\337\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\276\367\317{E)\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\246\061\337\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\347\071\000\000\357{\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\266\265\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\373\336e)\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\202\020\307\071\014c\357{\222\224\222\224\357{\353Z\246\061\202\020\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\307\071\236\367\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377U\255\040\000\000\000\357{\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000e)\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377iJ\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\040\000\313Z\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\276\367$!\000\000\000\000\357{\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\353Z\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377q\214"
-  "\343\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\004!\262\224\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\212R\000\000\000\000\000\000\357{\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000Q\214"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\276\367,c\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\343\030\216s\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\357{\000\000\000\000\000\000\000\000\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000a\010\064\245\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377Q\214\347\071\303\030\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\343\030\010Bq\214\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\262\224A\010"
-  "\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\242\020u\255\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377Y\316\060\204mk,c,cmkQ\214\232\326\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\064\245\202\020\000\000\000\000\000\000\000\000\000\000\357{\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\242\020U\255\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\363\234\202\020\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000a\010Q\214\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\357{A\010"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040"
-  "\000\353Z\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\276\367\212R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357"
-  "{\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377Mk\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\064\245\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\323\234\004!\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\040\000IJY\316\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\030\306\010B\040\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000A\010(Bu\255\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\064\245\010BA\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\357{\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000$!\313ZU\255\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\064\245\313Z"
-  "\004!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000mk\064"
-  "\245\064\245\064\245\064\245\064\245\064\245\064\245\064\245\313Z\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\202\020E)(B\353Zmk\216s\216sMk\313Z\010BE)\202\020\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000" } ,
+  81, 60, 2, { .data_8 = (uint8_t*)fcc_data },
+  PICTURE_ENCODING_PALETTE_RLE, sizeof(fcc_data),
 };
@@ -1,268 +1,127 @@
-/* GIMP RGB C-Source image dump (telec.c) */
-
+/* Palette+RLE encoded rgb565 picture (telec.c) */
+/* Generated by tools/mkpicture.py - do not edit */
 
 #include "tft.h"
 
+static const uint8_t telec_data[] = {
+  0x4f, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x62, 0x08, 0x82, 0x10, 0xa2, 0x10, 0xa3,
+  0x10, 0xc3, 0x18, 0xe3, 0x18, 0x04, 0x21, 0x24, 0x21, 0x45, 0x29, 0x65, 0x29, 0x86, 0x31, 0xa6,
+  0x31, 0xc7, 0x31, 0xc7, 0x39, 0xe7, 0x39, 0x08, 0x42, 0x28, 0x42, 0x49, 0x4a, 0x69, 0x4a, 0x8a,
+  0x52, 0xaa, 0x52, 0xab, 0x52, 0xcb, 0x5a, 0xeb, 0x5a, 0x0c, 0x63, 0x2c, 0x63, 0x2d, 0x63, 0x4d,
+  0x6b, 0x6d, 0x6b, 0x6e, 0x6b, 0x8e, 0x73, 0xae, 0x73, 0xcf, 0x7b, 0xef, 0x7b, 0x10, 0x84, 0x30,
+  0x84, 0x51, 0x84, 0x51, 0x8c, 0x71, 0x8c, 0x72, 0x8c, 0x92, 0x94, 0xb2, 0x94, 0xb3, 0x94, 0xd3,
+  0x94, 0xd3, 0x9c, 0xf3, 0x9c, 0x14, 0xa5, 0x34, 0xa5, 0x55, 0xa5, 0x55, 0xad, 0x75, 0xad, 0x96,
+  0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7, 0xbd, 0xf8, 0xbd, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79,
+  0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xda, 0xd6, 0xdb, 0xde, 0xfb, 0xde, 0x1b, 0xdf, 0x1c, 0xe7, 0x3c,
+  0xe7, 0x5d, 0xef, 0x7d, 0xef, 0x9e, 0xef, 0x9e, 0xf7, 0xbe, 0xf7, 0xdf, 0xf7, 0xdf, 0xff, 0xff,
+  0xff, 0x15, 0x00, 0x00, 0x02, 0x00, 0x0b, 0x00, 0x13, 0x00, 0x1b, 0x00, 0x24, 0x00, 0x26, 0x00,
+  0x29, 0x01, 0x2c, 0x00, 0x27, 0x00, 0x25, 0x00, 0x24, 0x00, 0x1c, 0x00, 0x15, 0x00, 0x0d, 0x00,
+  0x03, 0x27, 0x00, 0x00, 0x02, 0x00, 0x11, 0x00, 0x23, 0x00, 0x4f, 0x0d, 0x4e, 0x00, 0x4f, 0x00,
+  0x2a, 0x00, 0x14, 0x00, 0x03, 0x22, 0x00, 0x00, 0x09, 0x00, 0x1c, 0x00, 0x43, 0x13, 0x4e, 0x00,
+  0x4f, 0x00, 0x1f, 0x00, 0x09, 0x1e, 0x00, 0x00, 0x0b, 0x00, 0x25, 0x00, 0x4f, 0x08, 0x4e, 0x05,
+  0x4f, 0x08, 0x4e, 0x00, 0x4f, 0x00, 0x23, 0x00, 0x09, 0x1a, 0x00, 0x00, 0x03, 0x00, 0x21, 0x00,
+  0x4f, 0x05, 0x4e, 0x00, 0x4f, 0x00, 0x2c, 0x00, 0x1b, 0x00, 0x13, 0x00, 0x0d, 0x00, 0x08, 0x00,
+  0x03, 0x02, 0x00, 0x00, 0x06, 0x00, 0x0b, 0x00, 0x12, 0x00, 0x1b, 0x00, 0x32, 0x00, 0x4f, 0x05,
+  0x4e, 0x00, 0x4f, 0x00, 0x1c, 0x00, 0x03, 0x17, 0x00, 0x00, 0x0e, 0x00, 0x3c, 0x04, 0x4e, 0x00,
+  0x4f, 0x00, 0x2d, 0x00, 0x12, 0x00, 0x03, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x13, 0x00, 0x2a, 0x00,
+  0x4f, 0x04, 0x4e, 0x00, 0x3a, 0x00, 0x0e, 0x15, 0x00, 0x00, 0x1a, 0x00, 0x4f, 0x03, 0x4e, 0x00,
+  0x4f, 0x00, 0x25, 0x00, 0x0b, 0x13, 0x00, 0x00, 0x09, 0x00, 0x1d, 0x00, 0x4c, 0x03, 0x4e, 0x00,
+  0x4f, 0x00, 0x1c, 0x00, 0x01, 0x11, 0x00, 0x00, 0x02, 0x00, 0x26, 0x04, 0x4e, 0x00, 0x30, 0x00,
+  0x0c, 0x17, 0x00, 0x00, 0x09, 0x00, 0x2a, 0x04, 0x4e, 0x00, 0x26, 0x00, 0x02, 0x0f, 0x00, 0x00,
+  0x02, 0x00, 0x2b, 0x03, 0x4e, 0x00, 0x48, 0x00, 0x16, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x16, 0x00,
+  0x48, 0x03, 0x4e, 0x00, 0x27, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x01, 0x00, 0x29, 0x03, 0x4e, 0x00,
+  0x35, 0x00, 0x09, 0x1d, 0x00, 0x00, 0x09, 0x00, 0x33, 0x03, 0x4e, 0x00, 0x27, 0x00, 0x01, 0x0c,
+  0x00, 0x00, 0x1f, 0x03, 0x4e, 0x00, 0x29, 0x00, 0x03, 0x1f, 0x00, 0x00, 0x03, 0x00, 0x29, 0x03,
+  0x4e, 0x00, 0x24, 0x0b, 0x00, 0x00, 0x15, 0x03, 0x4e, 0x00, 0x26, 0x00, 0x01, 0x21, 0x00, 0x00,
+  0x01, 0x00, 0x27, 0x03, 0x4e, 0x00, 0x1c, 0x09, 0x00, 0x00, 0x0b, 0x00, 0x4b, 0x02, 0x4e, 0x00,
+  0x2a, 0x00, 0x01, 0x23, 0x00, 0x00, 0x02, 0x00, 0x2a, 0x03, 0x4e, 0x00, 0x0f, 0x07, 0x00, 0x00,
+  0x02, 0x00, 0x38, 0x02, 0x4e, 0x00, 0x37, 0x00, 0x03, 0x25, 0x00, 0x00, 0x03, 0x00, 0x32, 0x02,
+  0x4e, 0x00, 0x3e, 0x00, 0x05, 0x06, 0x00, 0x00, 0x1b, 0x03, 0x4e, 0x00, 0x0b, 0x27, 0x00, 0x00,
+  0x07, 0x00, 0x40, 0x02, 0x4e, 0x00, 0x24, 0x05, 0x00, 0x00, 0x08, 0x00, 0x4b, 0x02, 0x4e, 0x00,
+  0x1a, 0x29, 0x00, 0x00, 0x12, 0x00, 0x4f, 0x02, 0x4e, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x22, 0x02,
+  0x4e, 0x00, 0x37, 0x00, 0x01, 0x14, 0x00, 0x00, 0x06, 0x00, 0x0d, 0x00, 0x06, 0x12, 0x00, 0x00,
+  0x2a, 0x02, 0x4e, 0x00, 0x29, 0x03, 0x00, 0x00, 0x06, 0x02, 0x4e, 0x00, 0x4f, 0x00, 0x0f, 0x10,
+  0x00, 0x00, 0x03, 0x00, 0x0c, 0x00, 0x16, 0x00, 0x27, 0x00, 0x40, 0x00, 0x4f, 0x00, 0x4e, 0x00,
+  0x0e, 0x12, 0x00, 0x00, 0x0a, 0x00, 0x4f, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x0a, 0x02, 0x00, 0x00,
+  0x1b, 0x02, 0x4e, 0x00, 0x30, 0x0c, 0x00, 0x00, 0x01, 0x00, 0x09, 0x00, 0x12, 0x00, 0x1d, 0x00,
+  0x36, 0x00, 0x4b, 0x05, 0x4e, 0x00, 0x0f, 0x13, 0x00, 0x00, 0x24, 0x02, 0x4e, 0x00, 0x1f, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x43, 0x02, 0x4e, 0x00, 0x10, 0x08, 0x00, 0x00, 0x05, 0x00, 0x0d, 0x00,
+  0x17, 0x00, 0x29, 0x00, 0x41, 0x00, 0x4f, 0x09, 0x4e, 0x00, 0x0f, 0x12, 0x00, 0x00, 0x05, 0x00,
+  0x18, 0x02, 0x4e, 0x00, 0x4b, 0x00, 0x03, 0x00, 0x00, 0x00, 0x0f, 0x02, 0x4e, 0x00, 0x3a, 0x00,
+  0x01, 0x03, 0x00, 0x00, 0x03, 0x00, 0x0b, 0x00, 0x14, 0x00, 0x22, 0x00, 0x3a, 0x00, 0x4f, 0x0e,
+  0x4e, 0x00, 0x0f, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x11, 0x00, 0x1c, 0x00, 0x37, 0x00, 0x4f, 0x04,
+  0x4e, 0x00, 0x12, 0x00, 0x00, 0x00, 0x22, 0x02, 0x4e, 0x00, 0x15, 0x00, 0x01, 0x00, 0x09, 0x00,
+  0x11, 0x00, 0x1d, 0x00, 0x33, 0x00, 0x49, 0x00, 0x4f, 0x0a, 0x4e, 0x00, 0x4f, 0x00, 0x4c, 0x00,
+  0x2d, 0x00, 0x1b, 0x00, 0x44, 0x02, 0x4e, 0x00, 0x0f, 0x09, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
+  0x12, 0x00, 0x20, 0x00, 0x3c, 0x00, 0x4f, 0x08, 0x4e, 0x00, 0x20, 0x00, 0x01, 0x00, 0x47, 0x02,
+  0x4e, 0x00, 0x37, 0x00, 0x43, 0x00, 0x4f, 0x0b, 0x4e, 0x00, 0x4f, 0x00, 0x36, 0x00, 0x20, 0x00,
+  0x13, 0x00, 0x0a, 0x00, 0x01, 0x01, 0x00, 0x00, 0x41, 0x02, 0x4e, 0x00, 0x0f, 0x05, 0x00, 0x00,
+  0x01, 0x00, 0x0a, 0x00, 0x14, 0x00, 0x25, 0x00, 0x3f, 0x00, 0x4f, 0x0a, 0x4e, 0x00, 0x4f, 0x00,
+  0x4a, 0x00, 0x24, 0x00, 0x0b, 0x0d, 0x4e, 0x00, 0x4f, 0x00, 0x46, 0x00, 0x2a, 0x00, 0x18, 0x00,
+  0x0e, 0x00, 0x05, 0x06, 0x00, 0x00, 0x41, 0x02, 0x4e, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x03, 0x00,
+  0x0c, 0x00, 0x17, 0x00, 0x29, 0x00, 0x43, 0x00, 0x4f, 0x0a, 0x4e, 0x00, 0x4f, 0x00, 0x39, 0x00,
+  0x23, 0x00, 0x15, 0x00, 0x0b, 0x00, 0x02, 0x00, 0x00, 0x00, 0x13, 0x09, 0x4e, 0x00, 0x4f, 0x00,
+  0x37, 0x00, 0x22, 0x00, 0x13, 0x00, 0x0a, 0x00, 0x01, 0x0a, 0x00, 0x00, 0x41, 0x02, 0x4e, 0x00,
+  0x1b, 0x00, 0x18, 0x00, 0x2d, 0x00, 0x48, 0x00, 0x4f, 0x0a, 0x4e, 0x00, 0x4f, 0x00, 0x33, 0x00,
+  0x1d, 0x00, 0x11, 0x00, 0x06, 0x05, 0x00, 0x00, 0x1a, 0x04, 0x4e, 0x00, 0x4f, 0x00, 0x45, 0x00,
+  0x2a, 0x00, 0x19, 0x00, 0x0e, 0x00, 0x05, 0x0f, 0x00, 0x00, 0x41, 0x0d, 0x4e, 0x00, 0x4f, 0x00,
+  0x4b, 0x00, 0x2c, 0x00, 0x1a, 0x00, 0x0d, 0x00, 0x03, 0x09, 0x00, 0x00, 0x23, 0x02, 0x4e, 0x00,
+  0x29, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x01, 0x13, 0x00, 0x00, 0x40, 0x09, 0x4e, 0x00, 0x4f, 0x00,
+  0x44, 0x00, 0x28, 0x00, 0x17, 0x00, 0x0b, 0x00, 0x02, 0x0d, 0x00, 0x00, 0x26, 0x02, 0x4e, 0x00,
+  0x0a, 0x16, 0x00, 0x00, 0x3f, 0x05, 0x4e, 0x00, 0x4f, 0x00, 0x40, 0x00, 0x26, 0x00, 0x16, 0x00,
+  0x0a, 0x00, 0x01, 0x11, 0x00, 0x00, 0x31, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x16, 0x00, 0x00,
+  0x39, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x3d, 0x00, 0x25, 0x00, 0x15, 0x00, 0x0a, 0x00, 0x01, 0x15,
+  0x00, 0x00, 0x37, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x05, 0x16, 0x00, 0x00, 0x25, 0x00, 0x20, 0x00,
+  0x12, 0x00, 0x08, 0x00, 0x01, 0x19, 0x00, 0x00, 0x38, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x04, 0x35,
+  0x00, 0x00, 0x31, 0x01, 0x4e, 0x00, 0x4f, 0x00, 0x06, 0x08, 0x00, 0x00, 0x01, 0x1e, 0x02, 0x0c,
+  0x00, 0x00, 0x26, 0x02, 0x4e, 0x00, 0x09, 0x08, 0x00, 0x00, 0x33, 0x1e, 0x4f, 0x00, 0x02, 0x0b,
+  0x00, 0x00, 0x20, 0x02, 0x4e, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x32, 0x1d, 0x4e, 0x00, 0x4c, 0x00,
+  0x02, 0x0b, 0x00, 0x00, 0x17, 0x02, 0x4e, 0x00, 0x17, 0x08, 0x00, 0x00, 0x32, 0x1d, 0x4e, 0x00,
+  0x4c, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x0f, 0x02, 0x4e, 0x00, 0x26, 0x08, 0x00, 0x00, 0x32, 0x1d,
+  0x4e, 0x00, 0x4c, 0x00, 0x02, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x4f, 0x01, 0x4e, 0x00, 0x4f, 0x00,
+  0x01, 0x07, 0x00, 0x00, 0x29, 0x1e, 0x38, 0x00, 0x02, 0x0c, 0x00, 0x00, 0x37, 0x01, 0x4e, 0x00,
+  0x4f, 0x00, 0x0b, 0x35, 0x00, 0x00, 0x1b, 0x02, 0x4e, 0x00, 0x1a, 0x35, 0x00, 0x00, 0x0c, 0x02,
+  0x4e, 0x00, 0x3d, 0x00, 0x01, 0x06, 0x00, 0x00, 0x05, 0x1e, 0x06, 0x07, 0x00, 0x03, 0x09, 0x00,
+  0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x3c, 0x02, 0x4e, 0x00, 0x12, 0x06, 0x00, 0x00, 0x33, 0x1e,
+  0x4f, 0x00, 0x02, 0x05, 0x00, 0x00, 0x0a, 0x03, 0x4f, 0x00, 0x05, 0x01, 0x00, 0x00, 0x18, 0x02,
+  0x4e, 0x00, 0x33, 0x06, 0x00, 0x00, 0x32, 0x1d, 0x4e, 0x00, 0x4c, 0x00, 0x02, 0x05, 0x00, 0x00,
+  0x25, 0x02, 0x4e, 0x00, 0x22, 0x02, 0x00, 0x00, 0x06, 0x00, 0x4d, 0x02, 0x4e, 0x00, 0x12, 0x05,
+  0x00, 0x00, 0x32, 0x1d, 0x4e, 0x00, 0x4c, 0x00, 0x02, 0x04, 0x00, 0x00, 0x0c, 0x00, 0x4f, 0x02,
+  0x4e, 0x00, 0x0b, 0x03, 0x00, 0x00, 0x1f, 0x02, 0x4e, 0x00, 0x3a, 0x00, 0x02, 0x04, 0x00, 0x00,
+  0x32, 0x1d, 0x4e, 0x00, 0x4c, 0x00, 0x02, 0x03, 0x00, 0x00, 0x01, 0x00, 0x32, 0x02, 0x4e, 0x00,
+  0x27, 0x04, 0x00, 0x00, 0x06, 0x00, 0x49, 0x02, 0x4e, 0x00, 0x1e, 0x04, 0x00, 0x00, 0x2a, 0x0b,
+  0x39, 0x00, 0x46, 0x04, 0x4e, 0x00, 0x3c, 0x0a, 0x39, 0x00, 0x38, 0x00, 0x02, 0x03, 0x00, 0x00,
+  0x18, 0x03, 0x4e, 0x00, 0x0b, 0x05, 0x00, 0x00, 0x18, 0x02, 0x4e, 0x00, 0x4f, 0x00, 0x0f, 0x10,
+  0x00, 0x00, 0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0f, 0x00, 0x00, 0x0c, 0x03, 0x4e, 0x00,
+  0x1f, 0x06, 0x00, 0x00, 0x02, 0x00, 0x35, 0x02, 0x4e, 0x00, 0x3f, 0x00, 0x08, 0x0f, 0x00, 0x00,
+  0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0e, 0x00, 0x00, 0x06, 0x00, 0x3c, 0x02, 0x4e, 0x00,
+  0x39, 0x00, 0x03, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x4b, 0x02, 0x4e, 0x00, 0x36, 0x00, 0x03, 0x0e,
+  0x00, 0x00, 0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0d, 0x00, 0x00, 0x05, 0x00, 0x35, 0x02,
+  0x4e, 0x00, 0x4c, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x15, 0x03, 0x4e, 0x00, 0x2e, 0x00, 0x03, 0x0d,
+  0x00, 0x00, 0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x05, 0x00, 0x32, 0x03,
+  0x4e, 0x00, 0x15, 0x0b, 0x00, 0x00, 0x1d, 0x03, 0x4e, 0x00, 0x32, 0x00, 0x06, 0x0c, 0x00, 0x00,
+  0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x34, 0x03, 0x4e, 0x00,
+  0x1b, 0x0d, 0x00, 0x00, 0x20, 0x03, 0x4e, 0x00, 0x3e, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x27, 0x03,
+  0x4e, 0x00, 0x4f, 0x00, 0x08, 0x0a, 0x00, 0x00, 0x0c, 0x00, 0x3b, 0x03, 0x4e, 0x00, 0x1c, 0x0e,
+  0x00, 0x00, 0x01, 0x00, 0x23, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x1c, 0x00, 0x02, 0x09, 0x00, 0x00,
+  0x27, 0x03, 0x4e, 0x00, 0x4f, 0x00, 0x08, 0x08, 0x00, 0x00, 0x01, 0x00, 0x18, 0x04, 0x4e, 0x00,
+  0x1d, 0x11, 0x00, 0x00, 0x1d, 0x04, 0x4e, 0x00, 0x36, 0x00, 0x0f, 0x08, 0x00, 0x00, 0x26, 0x04,
+  0x47, 0x00, 0x08, 0x07, 0x00, 0x00, 0x0e, 0x00, 0x33, 0x04, 0x4e, 0x00, 0x1c, 0x13, 0x00, 0x00,
+  0x13, 0x00, 0x48, 0x04, 0x4e, 0x00, 0x2f, 0x00, 0x0f, 0x00, 0x01, 0x11, 0x00, 0x00, 0x01, 0x00,
+  0x0f, 0x00, 0x2d, 0x00, 0x4f, 0x03, 0x4e, 0x00, 0x48, 0x00, 0x13, 0x15, 0x00, 0x00, 0x09, 0x00,
+  0x31, 0x05, 0x4e, 0x00, 0x39, 0x00, 0x1a, 0x00, 0x0b, 0x0d, 0x00, 0x00, 0x0b, 0x00, 0x18, 0x00,
+  0x3a, 0x05, 0x4e, 0x00, 0x31, 0x00, 0x09, 0x17, 0x00, 0x00, 0x01, 0x00, 0x15, 0x00, 0x41, 0x05,
+  0x4e, 0x00, 0x4f, 0x00, 0x42, 0x00, 0x23, 0x00, 0x16, 0x00, 0x0f, 0x00, 0x0d, 0x00, 0x0c, 0x01,
+  0x0a, 0x00, 0x0b, 0x00, 0x0c, 0x00, 0x0f, 0x00, 0x17, 0x00, 0x24, 0x00, 0x43, 0x00, 0x4f, 0x05,
+  0x4e, 0x00, 0x47, 0x00, 0x17, 0x00, 0x01, 0x1a, 0x00, 0x00, 0x05, 0x00, 0x1d, 0x18, 0x4e, 0x00,
+  0x4f, 0x00, 0x20, 0x00, 0x06, 0x1e, 0x00, 0x00, 0x06, 0x00, 0x1a, 0x00, 0x3f, 0x13, 0x4e, 0x00,
+  0x44, 0x00, 0x1b, 0x00, 0x08, 0x22, 0x00, 0x00, 0x01, 0x00, 0x0e, 0x00, 0x1d, 0x00, 0x37, 0x00,
+  0x4f, 0x0b, 0x4e, 0x00, 0x4f, 0x00, 0x40, 0x00, 0x20, 0x00, 0x0f, 0x00, 0x02, 0x28, 0x00, 0x00,
+  0x05, 0x00, 0x0d, 0x00, 0x16, 0x00, 0x22, 0x00, 0x38, 0x01, 0x3e, 0x00, 0x37, 0x00, 0x2a, 0x00,
+  0x25, 0x00, 0x1d, 0x00, 0x16, 0x00, 0x0e, 0x00, 0x08, 0x15, 0x00,
+};
+
 static const Picture telec = {
-  59, 60, 2, {
-  (uint16_t*)"\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000A\010$!\010B\353Z\317{\020\204Q\214\222\224\222\224\060\204\357"
-  "{\317{\014cIJe)a\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\307\071\256s\377\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\377\377q\214(Ba\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030\014c\333\336\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\377\377Mk\343\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000$!\357"
-  "{\377\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\377\377\377\377\377\377\377\377\377\377\377\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\377\377\256s\343"
-  "\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010nk\377\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\377\377\222\224\353Z\010Be)\303\030a\010\000\000\000"
-  "\000\000\000\242\020$!\347\071\353Z\024\245\377\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\377\377\014ca\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\206\061\030\306\337"
-  "\377\337\377\337\377\337\377\337\377\377\377\262\224\347\071a\010\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\010Bq\214\377\377\337"
-  "\377\337\377\337\377\337\377\337\377\367\275\206\061\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\313Z\377"
-  "\377\337\377\337\377\337\377\337\377\377\377\357{$!\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030,c\276\367"
-  "\337\377\337\377\337\377\337\377\377\377\014c\040\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010\020\204\337\377\337\377"
-  "\337\377\337\377\337\377\323\234E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030q\214\337"
-  "\377\337\377\337\377\337\377\337\377\020\204A\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010r\214\337\377\337\377\337\377\337"
-  "\377]\357iJ\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000iJ]\357\337\377\337\377"
-  "\337\377\337\377\060\204A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\040\000Q\214\337\377\337\377\337\377\337\377U\255\343\030\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030\064\245\337\377\337\377\337"
-  "\377\337\377\060\204\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000Mk\337\377\337\377\337\377\337\377Q\214a\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010Q\214\337\377\337\377\337\377\337\377\317"
-  "{\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000IJ\337\377\337\377\337\377"
-  "\337\377\020\204\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\040\000\060\204\337\377\337\377\337\377\337\377\014c\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000$!\236\367\337\377\337\377\337\377q\214\040\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "A\010q\214\337\377\337\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000A\010\266\265\337\377\337\377\337\377\226\265a\010\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\024\245"
-  "\337\377\337\377\337\377Y\316\202\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\353Z\337"
-  "\377\337\377\337\377\337\377$!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\243\020\232\326\337\377\337"
-  "\377\337\377\317{\000\000\000\000\000\000\000\000\000\000\000\000\303\030\236\367\337\377\337\377"
-  "\337\377\313Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\347\071\377\377\337\377\337\377\337\377"
-  "E)\000\000\000\000\000\000\000\000\000\000\216s\337\377\337\377\337\377\226\265\040\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\242\020e)\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000q\214\337\377\337\377\337\377Q\214\000\000\000\000\000\000\000"
-  "\000\242\020\337\377\337\377\337\377\377\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010E)iJ\060\204\232\326\377\377"
-  "\337\377\206\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\004!\377\377\337\377\337\377\377\377\004!\000\000\000\000\000\000\353"
-  "Z\337\377\337\377\337\377\323\234\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\040\000\343\030\347\071,cu\255\236\367\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\317{\337\377\337\377\337\377Mk\000\000\000\000"
-  "\040\000\333\336\337\377\337\377\337\377\307\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\202\020e)\212RQ\214\272\326\377\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\252R\337"
-  "\377\337\377\337\377\236\367a\010\000\000\246\061\337\377\337\377\337\377\367\275"
-  "\040\000\000\000\000\000\000\000\000\000a\010$!(B\216s\367\275\377\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\242\020\307\071\014c\226\265\377\377\337\377\337\377\337"
-  "\377\337\377\337\377\347\071\000\000\216s\337\377\337\377\337\377IJ\040\000\343\030"
-  "\307\071,c\064\245}\357\377\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\377\377\276\367\262\224\353"
-  "Z\373\336\337\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\040\000\303\030\347\071mk\030\306\377\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377mk\040\000<\347\337\377\337\377"
-  "\337\377\226\265\333\336\377\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\377\377u\255mk\010"
-  "B\004!\040\000\000\000\000\000\272\326\337\377\337\377\337\377\246\061\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\040\000\004!(B\357{y\316\377\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\377\377\236\357\317"
-  "{$!\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\377\377\034\347q\214\252R\206\061"
-  "\202\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\272\326\337\377\337\377\337\377\246\061"
-  "\000\000\000\000a\010E)\212RQ\214\333\336\377\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\377\377\327\275"
-  "\256sIJ$!A\010\000\000\010B\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\377\377\226\265\216s\010B\004!\040\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\272\326\337\377\337\377\337\377\353Z\252"
-  "R\262\224]\357\377\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\377\377\064\245,c\307\071\242\020\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\313Z\337\377\337\377\337\377\337\377\337\377\377\377\033"
-  "\337q\214\253R\206\061\202\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\272\326\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\377"
-  "\377\236\367\222\224\313Ze)a\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\256"
-  "s\337\377\337\377\337\377Q\214IJ\004!\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\232\326\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\377\377"
-  "\373\336Q\204\212R$!A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\020\204\337\377\337\377\337\377\004!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000y\316\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\377\377\232\326\020\204iJ\004!\040\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\363\234\337\377\337\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\327\275\337\377"
-  "\337\377\377\377\070\306\357{IJ\004!\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\226\265\337\377\337"
-  "\377\377\377\202\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{mk\347\071\303\030\040\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\266\265\337\377\337\377\377\377b\010\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\363\234\337"
-  "\377\337\377\377\377\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000A\010"
-  "A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010"
-  "A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010A\010\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\204\337\377\337\377\337\377\343\030\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\064\245\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377A\010"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000mk\337\377\337\377\337\377"
-  "\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024\245\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\276\367A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\212R\337\377"
-  "\337\377\337\377\212R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024\245\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\276\367A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\246\061\337\377\337\377\337\377\020\204\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\024\245\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\276\367A\010\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\242\020\377\377\337\377\337\377\377\377\040\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000Q\214\266\265\266\265\266\265\266\265\266\265"
-  "\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265"
-  "\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265"
-  "\266\265\266\265\266\265\266\265\266\265\266\265\266\265\266\265A\010\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\226\265\337\377\337\377"
-  "\377\377$!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\353Z\337\377\337\377\337\377\313Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\337\377\337\377\337\377\070"
-  "\306\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\242\020\242\020\242\020\242\020"
-  "\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242"
-  "\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020\242\020"
-  "\242\020\242\020\242\020\242\020\242\020\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\343\030\343\030\343\030\343\030A\010\000\000\040\000\030\306\337\377\337\377\337\377"
-  "\347\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\064\245\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "A\010\000\000\000\000\000\000\000\000\000\000\000\000\004!\377\377\377\377\377\377\377\377\202\020\000"
-  "\000\000\000\252R\337\377\337\377\337\377\064\245\000\000\000\000\000\000\000\000\000\000\000\000\000\000\024"
-  "\245\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\276\367A\010\000\000\000\000\000\000\000\000\000\000\000\000\357{\337"
-  "\377\337\377\337\377\216s\000\000\000\000\000\000\242\020\337\367\337\377\337\377\337"
-  "\377\347\071\000\000\000\000\000\000\000\000\000\000\000\000\024\245\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\276\367"
-  "A\010\000\000\000\000\000\000\000\000\000\000E)\377\377\337\377\337\377\337\377$!\000\000\000\000\000\000"
-  "\000\000Mk\337\377\337\377\337\377\367\275A\010\000\000\000\000\000\000\000\000\000\000\024\245\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\276\367A\010\000\000\000\000\000\000\000\000\040\000\024\245\337\377\337"
-  "\377\337\377\060\204\000\000\000\000\000\000\000\000\000\000\242\020}\357\337\377\337\377\337\377"
-  "-c\000\000\000\000\000\000\000\000\000\000q\214\327\275\327\275\327\275\327\275\327\275\327\275"
-  "\327\275\327\275\327\275\327\275\327\275\327\275\034\347\337\377\337\377\337"
-  "\377\337\377\337\377\030\306\327\275\327\275\327\275\327\275\327\275\327\275"
-  "\327\275\327\275\327\275\327\275\327\275\266\265A\010\000\000\000\000\000\000\000\000\252"
-  "R\337\377\337\377\337\377\337\377$!\000\000\000\000\000\000\000\000\000\000\000\000\252R\337\377"
-  "\337\377\337\377\377\377\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337\377\337\377\377\377"
-  "\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E"
-  ")\337\377\337\377\337\377\337\377Mk\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010U\255"
-  "\337\377\337\377\337\377y\316\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337\377\337\377\377\377"
-  "\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\242\020"
-  "\030\306\337\377\337\377\337\377\327\275a\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000$!\236\367\337\377\337\377\337\377u\255a\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337\377\337\377\377"
-  "\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020"
-  "U\255\337\377\337\377\337\377\276\367e)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000IJ\337\377\337\377\337\377\337\377\263\224a\010\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337\377\337\377"
-  "\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020"
-  "\024\245\337\377\337\377\337\377\337\377IJ\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000,c\337\377\337\377\337\377\337\377\024\245\242\020\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337\377"
-  "\337\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\242"
-  "\020U\245\337\377\337\377\337\377\337\377\353Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000mk\337\377\337\377\337\377\337\377Y\316\206\061"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337\377\337"
-  "\377\337\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E"
-  ")\370\275\337\377\337\377\337\377\337\377\014c\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\256s\337\377\337\377\337\377\337\377"
-  "\377\377\014cA\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\060\204\337\377\337"
-  "\377\337\377\337\377\377\377\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040"
-  "\000\252R\337\377\337\377\337\377\337\377\337\377,c\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000,c\337\377\337\377\337\377"
-  "\337\377\337\377u\255\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\020\204<"
-  "\347<\347<\347<\347<\347\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\206\061\064"
-  "\245\337\377\337\377\337\377\337\377\337\377\014c\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010B]\357\337\377"
-  "\337\377\337\377\337\377\337\377\323\224\246\061\040\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\246\061\262\224"
-  "\377\377\337\377\337\377\337\377\337\377]\357\010B\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030\363"
-  "\234\337\377\337\377\337\377\337\377\337\377\337\377\327\275\313Z$!\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000$!\252R\367\275\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\363\234\343\030\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\040\000IJ\272\326\337\377\337\377\337\377\337\377\337\377\337\377\377"
-  "\377\332\326\256siJ\246\061e)E)\004!\004!$!E)\246\061\212R\317{\333\336\377\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377<\347\212R\040\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020,c\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\377\377mk\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\242\020\313Zy\316\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377\337"
-  "\377\337\377\337\377\337\377\337\377\337\377\373\336\353Z\303\030\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\206\061"
-  ",c\226\265\377\377\337\377\337\377\337\377\337\377\337\377\337\377\337\377"
-  "\337\377\337\377\337\377\337\377\337\377\377\377\232\326mk\246\061A\010\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\202\020e)iJ\216s\266\265Y\316Y\316\226\265q\214\357{,ciJ"
-  "\206\061\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000" } ,
+  59, 60, 2, { .data_8 = (uint8_t*)telec_data },
+  PICTURE_ENCODING_PALETTE_RLE, sizeof(telec_data),
 };
@@ -1,174 +1,100 @@
-/* GIMP RGB C-Source image dump (weee.c) */
-
+/* Palette+RLE encoded rgb565 picture (weee.c) */
+/* Generated by tools/mkpicture.py - do not edit */
 
 #include "tft.h"
 
+static const uint8_t weee_data[] = {
+  0x3c, 0x00, 0x00, 0x20, 0x00, 0x41, 0x08, 0x61, 0x08, 0x82, 0x10, 0xa2, 0x10, 0xc3, 0x18, 0xe3,
+  0x18, 0x04, 0x21, 0x24, 0x21, 0x45, 0x29, 0x65, 0x29, 0x86, 0x31, 0xa6, 0x31, 0xc7, 0x39, 0xe7,
+  0x39, 0x08, 0x42, 0x28, 0x42, 0x49, 0x4a, 0x69, 0x4a, 0x8a, 0x52, 0xaa, 0x52, 0xcb, 0x5a, 0xeb,
+  0x5a, 0x0c, 0x63, 0x2c, 0x63, 0x4d, 0x6b, 0x6d, 0x6b, 0x8e, 0x73, 0xae, 0x73, 0xcf, 0x7b, 0xef,
+  0x7b, 0x10, 0x84, 0x30, 0x84, 0x51, 0x8c, 0x71, 0x8c, 0x92, 0x94, 0xb2, 0x94, 0xd3, 0x9c, 0xf3,
+  0x9c, 0x14, 0xa5, 0x34, 0xa5, 0x55, 0xad, 0x75, 0xad, 0x96, 0xb5, 0xb6, 0xb5, 0xd7, 0xbd, 0xf7,
+  0xbd, 0x18, 0xc6, 0x38, 0xc6, 0x59, 0xce, 0x79, 0xce, 0x9a, 0xd6, 0xba, 0xd6, 0xfb, 0xde, 0x1c,
+  0xe7, 0x5d, 0xef, 0x9e, 0xf7, 0xbe, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0x00, 0x02, 0x00, 0x0d, 0x24,
+  0x00, 0x00, 0x0b, 0x00, 0x08, 0x00, 0x03, 0x00, 0x29, 0x00, 0x0e, 0x22, 0x00, 0x00, 0x08, 0x00,
+  0x2f, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2f, 0x00, 0x0b, 0x0c, 0x00, 0x00, 0x11, 0x05,
+  0x1d, 0x00, 0x0e, 0x0b, 0x00, 0x00, 0x06, 0x00, 0x2f, 0x00, 0x09, 0x02, 0x00, 0x00, 0x07, 0x00,
+  0x2f, 0x00, 0x08, 0x05, 0x00, 0x00, 0x01, 0x01, 0x21, 0x00, 0x1a, 0x00, 0x09, 0x00, 0x0e, 0x00,
+  0x24, 0x00, 0x16, 0x03, 0x0b, 0x00, 0x19, 0x00, 0x1d, 0x00, 0x06, 0x00, 0x01, 0x08, 0x00, 0x00,
+  0x05, 0x00, 0x2c, 0x00, 0x0c, 0x04, 0x00, 0x00, 0x0a, 0x00, 0x2f, 0x00, 0x06, 0x04, 0x00, 0x00,
+  0x0b, 0x00, 0x3c, 0x00, 0x0f, 0x00, 0x35, 0x00, 0x1f, 0x00, 0x16, 0x00, 0x25, 0x00, 0x26, 0x03,
+  0x1f, 0x00, 0x28, 0x00, 0x29, 0x00, 0x25, 0x00, 0x39, 0x00, 0x21, 0x00, 0x13, 0x00, 0x07, 0x00,
+  0x02, 0x00, 0x0f, 0x00, 0x0c, 0x01, 0x00, 0x00, 0x03, 0x00, 0x28, 0x00, 0x0f, 0x06, 0x00, 0x00,
+  0x0d, 0x00, 0x2b, 0x00, 0x03, 0x01, 0x00, 0x00, 0x04, 0x00, 0x2d, 0x00, 0x23, 0x00, 0x3c, 0x00,
+  0x08, 0x00, 0x21, 0x01, 0x00, 0x00, 0x04, 0x05, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00,
+  0x09, 0x00, 0x13, 0x00, 0x27, 0x00, 0x37, 0x00, 0x2c, 0x00, 0x37, 0x00, 0x0c, 0x00, 0x02, 0x00,
+  0x25, 0x00, 0x13, 0x08, 0x00, 0x00, 0x11, 0x00, 0x26, 0x00, 0x02, 0x00, 0x08, 0x00, 0x14, 0x00,
+  0x2b, 0x00, 0x10, 0x00, 0x3c, 0x00, 0x12, 0x00, 0x29, 0x0e, 0x0f, 0x00, 0x38, 0x00, 0x1d, 0x00,
+  0x2b, 0x00, 0x13, 0x00, 0x1f, 0x00, 0x17, 0x0a, 0x00, 0x00, 0x16, 0x00, 0x21, 0x00, 0x12, 0x00,
+  0x20, 0x00, 0x3c, 0x11, 0x20, 0x00, 0x21, 0x00, 0x3c, 0x00, 0x1f, 0x00, 0x1b, 0x00, 0x22, 0x00,
+  0x1b, 0x0c, 0x00, 0x00, 0x1a, 0x00, 0x1d, 0x00, 0x00, 0x00, 0x33, 0x00, 0x03, 0x10, 0x00, 0x00,
+  0x04, 0x00, 0x3b, 0x00, 0x2a, 0x00, 0x2d, 0x00, 0x21, 0x00, 0x01, 0x0c, 0x00, 0x00, 0x01, 0x00,
+  0x1e, 0x00, 0x18, 0x00, 0x21, 0x00, 0x06, 0x10, 0x00, 0x00, 0x06, 0x00, 0x34, 0x00, 0x1c, 0x00,
+  0x36, 0x00, 0x16, 0x0e, 0x00, 0x00, 0x02, 0x00, 0x23, 0x00, 0x3c, 0x00, 0x0b, 0x10, 0x00, 0x00,
+  0x09, 0x00, 0x3a, 0x00, 0x26, 0x00, 0x10, 0x00, 0x16, 0x0f, 0x00, 0x00, 0x03, 0x00, 0x27, 0x00,
+  0x13, 0x10, 0x00, 0x00, 0x12, 0x00, 0x3c, 0x00, 0x20, 0x00, 0x25, 0x00, 0x16, 0x10, 0x00, 0x00,
+  0x11, 0x00, 0x3c, 0x00, 0x0c, 0x0e, 0x00, 0x00, 0x0b, 0x00, 0x3a, 0x00, 0x1d, 0x00, 0x0d, 0x00,
+  0x0c, 0x00, 0x06, 0x10, 0x00, 0x00, 0x0c, 0x00, 0x25, 0x00, 0x30, 0x00, 0x08, 0x02, 0x00, 0x00,
+  0x03, 0x07, 0x09, 0x00, 0x05, 0x00, 0x08, 0x00, 0x30, 0x00, 0x20, 0x00, 0x0f, 0x13, 0x00, 0x00,
+  0x09, 0x00, 0x20, 0x00, 0x09, 0x00, 0x2f, 0x00, 0x06, 0x01, 0x00, 0x00, 0x0b, 0x00, 0x2e, 0x05,
+  0x20, 0x00, 0x27, 0x00, 0x20, 0x00, 0x31, 0x00, 0x09, 0x00, 0x18, 0x00, 0x0c, 0x13, 0x00, 0x00,
+  0x06, 0x00, 0x26, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x2c, 0x00, 0x04, 0x00, 0x00, 0x00, 0x0b, 0x00,
+  0x26, 0x05, 0x12, 0x00, 0x1b, 0x00, 0x3c, 0x00, 0x0b, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x0a, 0x13,
+  0x00, 0x00, 0x01, 0x00, 0x3c, 0x01, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00, 0x03, 0x00, 0x06, 0x05,
+  0x14, 0x00, 0x1a, 0x00, 0x3c, 0x00, 0x0f, 0x01, 0x00, 0x00, 0x22, 0x00, 0x05, 0x14, 0x00, 0x00,
+  0x36, 0x00, 0x03, 0x01, 0x00, 0x00, 0x15, 0x00, 0x22, 0x00, 0x01, 0x04, 0x00, 0x00, 0x02, 0x00,
+  0x25, 0x00, 0x12, 0x02, 0x00, 0x00, 0x34, 0x00, 0x04, 0x14, 0x00, 0x00, 0x24, 0x00, 0x06, 0x02,
+  0x00, 0x00, 0x18, 0x00, 0x1e, 0x00, 0x01, 0x02, 0x00, 0x00, 0x01, 0x00, 0x21, 0x00, 0x16, 0x03,
+  0x00, 0x00, 0x3c, 0x15, 0x00, 0x00, 0x1f, 0x00, 0x0a, 0x03, 0x00, 0x00, 0x1d, 0x00, 0x19, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x1e, 0x00, 0x19, 0x03, 0x00, 0x00, 0x04, 0x00, 0x31, 0x15, 0x00, 0x00,
+  0x17, 0x00, 0x0d, 0x03, 0x00, 0x00, 0x01, 0x00, 0x22, 0x00, 0x15, 0x00, 0x00, 0x00, 0x1a, 0x00,
+  0x1d, 0x04, 0x00, 0x00, 0x05, 0x00, 0x24, 0x15, 0x00, 0x00, 0x15, 0x00, 0x0f, 0x04, 0x00, 0x00,
+  0x02, 0x00, 0x27, 0x00, 0x23, 0x00, 0x20, 0x00, 0x01, 0x04, 0x00, 0x00, 0x09, 0x00, 0x1f, 0x15,
+  0x00, 0x00, 0x10, 0x00, 0x15, 0x05, 0x00, 0x00, 0x14, 0x00, 0x3c, 0x00, 0x0f, 0x05, 0x00, 0x00,
+  0x0d, 0x00, 0x18, 0x15, 0x00, 0x00, 0x0d, 0x00, 0x15, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x29, 0x00,
+  0x0a, 0x00, 0x2f, 0x00, 0x09, 0x04, 0x00, 0x00, 0x0e, 0x00, 0x15, 0x15, 0x00, 0x00, 0x0b, 0x00,
+  0x1d, 0x03, 0x00, 0x00, 0x0c, 0x00, 0x2d, 0x00, 0x05, 0x00, 0x00, 0x00, 0x08, 0x00, 0x30, 0x00,
+  0x07, 0x03, 0x00, 0x00, 0x15, 0x00, 0x10, 0x15, 0x00, 0x00, 0x07, 0x00, 0x20, 0x02, 0x00, 0x00,
+  0x09, 0x00, 0x31, 0x00, 0x06, 0x02, 0x00, 0x00, 0x0c, 0x00, 0x2d, 0x00, 0x05, 0x02, 0x00, 0x00,
+  0x16, 0x00, 0x0d, 0x15, 0x00, 0x00, 0x05, 0x00, 0x26, 0x01, 0x00, 0x00, 0x07, 0x00, 0x31, 0x00,
+  0x08, 0x04, 0x00, 0x00, 0x0f, 0x00, 0x28, 0x00, 0x03, 0x01, 0x00, 0x00, 0x1f, 0x00, 0x0a, 0x15,
+  0x00, 0x00, 0x03, 0x00, 0x35, 0x00, 0x00, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x0b, 0x06, 0x00, 0x00,
+  0x13, 0x00, 0x24, 0x00, 0x02, 0x00, 0x00, 0x00, 0x22, 0x00, 0x06, 0x16, 0x00, 0x00, 0x3c, 0x00,
+  0x04, 0x00, 0x2b, 0x00, 0x0e, 0x08, 0x00, 0x00, 0x18, 0x00, 0x1f, 0x00, 0x01, 0x00, 0x2d, 0x00,
+  0x05, 0x16, 0x00, 0x00, 0x35, 0x00, 0x29, 0x00, 0x11, 0x0a, 0x00, 0x00, 0x1c, 0x00, 0x1a, 0x00,
+  0x3c, 0x16, 0x00, 0x00, 0x01, 0x00, 0x2b, 0x00, 0x15, 0x0b, 0x00, 0x00, 0x01, 0x00, 0x20, 0x00,
+  0x3c, 0x15, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x3c, 0x00, 0x08, 0x0c, 0x00, 0x00, 0x06, 0x00,
+  0x3c, 0x00, 0x11, 0x14, 0x00, 0x00, 0x1b, 0x01, 0x1c, 0x00, 0x0c, 0x0a, 0x00, 0x00, 0x0d, 0x00,
+  0x1a, 0x00, 0x1e, 0x00, 0x2e, 0x00, 0x2c, 0x00, 0x0d, 0x12, 0x00, 0x00, 0x17, 0x00, 0x20, 0x00,
+  0x01, 0x00, 0x15, 0x00, 0x0d, 0x09, 0x00, 0x00, 0x1a, 0x00, 0x3c, 0x01, 0x25, 0x00, 0x3c, 0x00,
+  0x28, 0x00, 0x30, 0x00, 0x0a, 0x10, 0x00, 0x00, 0x13, 0x00, 0x24, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x14, 0x00, 0x11, 0x08, 0x00, 0x00, 0x09, 0x00, 0x3c, 0x00, 0x15, 0x00, 0x1b, 0x00, 0x1c, 0x00,
+  0x14, 0x00, 0x3c, 0x00, 0x13, 0x00, 0x2f, 0x00, 0x07, 0x0e, 0x00, 0x00, 0x10, 0x00, 0x27, 0x00,
+  0x03, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x24, 0x08, 0x15, 0x00, 0x21, 0x00, 0x39, 0x00, 0x13, 0x01,
+  0x3c, 0x00, 0x14, 0x00, 0x32, 0x00, 0x12, 0x00, 0x0b, 0x00, 0x2f, 0x00, 0x05, 0x0c, 0x00, 0x00,
+  0x0d, 0x00, 0x2b, 0x00, 0x04, 0x02, 0x00, 0x00, 0x01, 0x00, 0x26, 0x00, 0x24, 0x00, 0x1f, 0x06,
+  0x0e, 0x00, 0x19, 0x00, 0x3c, 0x00, 0x12, 0x01, 0x3c, 0x00, 0x12, 0x00, 0x3b, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0x0e, 0x00, 0x29, 0x00, 0x03, 0x0a, 0x00, 0x00, 0x0a, 0x00, 0x2f, 0x00, 0x06, 0x04,
+  0x00, 0x00, 0x20, 0x00, 0x16, 0x00, 0x14, 0x06, 0x00, 0x00, 0x04, 0x00, 0x37, 0x00, 0x1d, 0x00,
+  0x12, 0x00, 0x11, 0x00, 0x1d, 0x00, 0x36, 0x00, 0x04, 0x01, 0x00, 0x00, 0x12, 0x00, 0x24, 0x00,
+  0x02, 0x08, 0x00, 0x00, 0x08, 0x00, 0x2f, 0x00, 0x08, 0x05, 0x00, 0x00, 0x20, 0x00, 0x3a, 0x00,
+  0x14, 0x07, 0x00, 0x00, 0x0b, 0x00, 0x32, 0x01, 0x3c, 0x00, 0x31, 0x00, 0x0b, 0x03, 0x00, 0x00,
+  0x17, 0x00, 0x1f, 0x00, 0x01, 0x06, 0x00, 0x00, 0x05, 0x00, 0x2f, 0x00, 0x0a, 0x06, 0x00, 0x01,
+  0x03, 0x00, 0x02, 0x08, 0x00, 0x00, 0x02, 0x01, 0x0a, 0x00, 0x02, 0x05, 0x00, 0x01, 0x1c, 0x05,
+  0x00, 0x00, 0x04, 0x00, 0x2b, 0x00, 0x0d, 0x1d, 0x00, 0x00, 0x01, 0x00, 0x1f, 0x00, 0x17, 0x03,
+  0x00, 0x00, 0x03, 0x00, 0x27, 0x00, 0x10, 0x1f, 0x00, 0x00, 0x02, 0x00, 0x25, 0x00, 0x12, 0x01,
+  0x00, 0x00, 0x01, 0x00, 0x24, 0x00, 0x14, 0x21, 0x00, 0x00, 0x03, 0x00, 0x2a, 0x00, 0x0e, 0x00,
+  0x00, 0x00, 0x11, 0x00, 0x17, 0x23, 0x00, 0x00, 0x05, 0x00, 0x2e, 0x00, 0x0a, 0x26, 0x00, 0x00,
+  0x07, 0x00, 0x05, 0x80, 0x4f, 0x00, 0x00, 0x0a, 0x21, 0x0d, 0x00, 0x07, 0x04, 0x00, 0x00, 0x20,
+  0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20, 0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20,
+  0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20, 0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20,
+  0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20, 0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20,
+  0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x20, 0x21, 0x3c, 0x00, 0x14, 0x04, 0x00, 0x00, 0x0b,
+  0x21, 0x0f, 0x00, 0x08, 0x01, 0x00,
+};
+
 static const Picture weee = {
-  41, 60, 2, {
-  (uint16_t*)"A\010\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000e)\004!a\010\064\245\307\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\004!\367\275\343\030\000\000\242\020\367\275e)\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000(B\256s\256s\256s\256s"
-  "\256s\256s\307\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030"
-  "\367\275$!\000\000\000\000\000\000\343\030\367\275\004!\000\000\000\000\000\000\000\000\000\000\000\000\040\000\060"
-  "\204\060\204Mk$!\307\071\222\224\313Ze)e)e)e),c\256s\303\030\040\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\242\020\226\265\206\061\000\000\000\000\000\000\000\000\000\000E)\367"
-  "\275\303\030\000\000\000\000\000\000\000\000\000\000e)\377\377\347\071\272\326\357{\313Z\262\224"
-  "\323\234\357{\357{\357{\357{\024\245\064\245\262\224\236\367\060\204iJ\343\030"
-  "A\010\347\071\206\061\000\000\000\000a\010\024\245\347\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\246\061u\255a\010\000\000\000\000\202\020\266\265q\214\377\377\004!\060\204\000\000\000\000\202"
-  "\020\303\030\303\030\303\030\303\030\303\030\303\030a\010\000\000\040\000$!iJ\363\234\034"
-  "\347\226\265\034\347\206\061A\010\262\224iJ\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000(B\323\234A\010\004!\212Ru\255\010B\377\377IJ\064\245\347\071\347\071\347\071"
-  "\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347"
-  "\071\347\071]\357\256su\255iJ\357{\353Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\313Z\060\204IJ\020\204\377\377\020\204\020\204\020\204\020\204\020\204"
-  "\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020\204\020"
-  "\204\020\204\020\204\060\204\377\377\357{mkQ\214mk\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000Mk\256s\000\000y\316a\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\337\377U\255\266\265\060"
-  "\204\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\317{\014"
-  "c\060\204\303\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\303\030\232\326\216s\373\336\313Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010q\214\377\377e)\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000$!\276\367\323\234\010B\313Z\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\363\234"
-  "iJ\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000IJ"
-  "\377\377\020\204\262\224\313Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000(B\377\377\206\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000e)\276\367\256s\246\061\206\061\303\030\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\206\061\262\224"
-  "\030\306\004!\000\000\000\000\000\000a\010$!$!$!$!$!$!$!$!\242\020\004!\030\306\020\204\347\071"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000$!\020\204$!\367\275\303\030\000\000\000\000e)\327\275\020\204\020\204\020\204"
-  "\020\204\020\204\020\204\363\234\020\204\070\306$!\014c\206\061\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\303\030\323"
-  "\234\000\000\206\061\226\265\202\020\000\000e)\323\234IJIJIJIJIJIJmk\377\377e)\000\000"
-  "\357{E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\040\000\377\377\000\000\000\000\010B\363\234a\010\303\030\212R\212R\212"
-  "R\212R\212R\212RMk\377\377\347\071\000\000\000\000Q\214\242\020\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\373\336"
-  "a\010\000\000\000\000\252RQ\214\040\000\000\000\000\000\000\000\000\000\000\000A\010\262\224IJ\000\000\000\000\000\000"
-  "\232\326\202\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\222\224\303\030\000\000\000\000\000\000\014c\317{\040\000\000\000\000"
-  "\000\000\000\040\000\060\204\313Z\000\000\000\000\000\000\000\000\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\357{E)\000\000"
-  "\000\000\000\000\000\000\256s,c\000\000\000\000\040\000\317{,c\000\000\000\000\000\000\000\000\202\020\070\306\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\353Z\246\061\000\000\000\000\000\000\000\000\040\000Q\214\252R\000\000Mk\256s\000\000\000"
-  "\000\000\000\000\000\000\000\242\020\222\224\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\252R\347\071\000\000\000\000\000\000\000\000"
-  "\000\000A\010\363\234q\214\020\204\040\000\000\000\000\000\000\000\000\000\000\000$!\357{\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\010B\252R\000\000\000\000\000\000\000\000\000\000\000\000\212R\377\377\347\071\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\246\061\014c\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\246\061\252R\000\000\000\000\000\000\000\000\000\000\347\071"
-  "\064\245E)\367\275$!\000\000\000\000\000\000\000\000\000\000\307\071\252R\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000e)\256"
-  "s\000\000\000\000\000\000\000\000\206\061\266\265\242\020\000\000\004!\030\306\343\030\000\000\000\000\000\000"
-  "\000\000\252R\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030\020\204\000\000\000\000\000\000$!\070\306\303\030\000"
-  "\000\000\000\000\000\206\061\266\265\242\020\000\000\000\000\000\000\313Z\246\061\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\242\020\323\234\000\000\000\000\343\030\070\306\004!\000\000\000\000\000\000\000\000\000\000\347\071\024\245"
-  "a\010\000\000\000\000\357{E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010\272\326\000\000\242\020\327\275e)\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000iJ\222\224A\010\000\000Q\214\303\030\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\377\377\202\020u\255\307\071\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\014c\357{"
-  "\040\000\266\265\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\272\326\064\245(B\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\216sMk\377\377\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000u\255"
-  "\252R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\020\204\377\377"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\040\000\357{\377\377\004!\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\303\030\377\377(B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000mk\216s\216s\206\061\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\246\061Mk\317{\327\275\226\265\246\061\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\353Z\020\204\040\000\252R\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000M"
-  "k\377\377\262\224\262\224\377\377\024\245\030\306E)\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000iJ\222\224A\010\000\000\212R(B\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000$!\377\377\252Rmk\216s\212R\377\377iJ\367"
-  "\275\343\030\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\010"
-  "B\363\234a\010\000\000\000\000\246\061\222\224\252R\252R\252R\252R\252R\252R\252R\252"
-  "R\252R\060\204\236\367iJ\377\377\377\377\212RY\316IJe)\367\275\242\020\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\246\061u\255\202\020\000\000\000"
-  "\000\000\000\040\000\323\234\222\224\357{\307\071\307\071\307\071\307\071\307\071\307\071"
-  "\307\071,c\377\377IJ\377\377\377\377IJ\337\377\347\071\000\000\307\071\064\245a\010"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000E)\367\275\303\030\000\000\000\000\000\000"
-  "\000\000\000\000\020\204\313Z\212R\000\000\000\000\000\000\000\000\000\000\000\000\000\000\202\020\034\347\256s"
-  "IJ(B\256s\373\336\202\020\000\000\000\000IJ\222\224A\010\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\004!\367\275\004!\000\000\000\000\000\000\000\000\000\000\000\000\020\204\276\367\212R\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000e)Y\316\377\377\377\377\070\306e)\000\000\000\000\000\000"
-  "\000\000\353Z\357{\040\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\242\020\367\275E)\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000a\010a\010A\010\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000A\010"
-  "E)E)A\010\000\000\000\000\000\000\000\000\000\000\000\000\216s\216s\000\000\000\000\000\000\000\000\000\000\000\000\202\020"
-  "u\255\246\061\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\040\000\357{\353"
-  "Z\000\000\000\000\000\000\000\000a\010\363\234\010B\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000A\010\262\224IJ\000\000\000\000\040\000\222\224\212R\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000a\010U\255\307\071\000\000(B\353"
-  "Z\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\242\020\327\275E)\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\343\030\242\020\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000\000"
-  "\000\000\000\000\000E)\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246"
-  "\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061"
-  "\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246\061\246"
-  "\061\246\061\246\061\246\061\246\061\343\030\000\000\000\000\000\000\000\000\000\000\020\204\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\212R\000\000\000\000\000\000\000\000\000\000"
-  "\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\212R\000\000\000\000"
-  "\000\000\000\000\000\000\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\212R\000\000\000\000\000\000\000\000\000\000\020\204\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\212R\000\000\000\000\000\000\000\000\000\000\020\204\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\212R\000\000\000\000\000\000\000\000\000\000\020\204\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\212R\000\000\000\000\000\000\000\000\000\000"
-  "\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\212R\000\000\000\000"
-  "\000\000\000\000\000\000\020\204\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377\377"
-  "\212R\000\000\000\000\000\000\000\000\000\000e)\347\071\347\071\347\071\347\071\347\071\347\071\347"
-  "\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071"
-  "\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347\071\347"
-  "\071\347\071\347\071\347\071\347\071\347\071\347\071\004!\000\000\000\000" } ,
+  41, 60, 2, { .data_8 = (uint8_t*)weee_data },
+  PICTURE_ENCODING_PALETTE_RLE, sizeof(weee_data),
 };
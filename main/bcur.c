@@ -12,12 +12,15 @@
 
 // PSBT serialisation functions
 bool deserialise_psbt(const uint8_t* bytes, size_t bytes_len, struct wally_psbt** psbt_out);
-bool serialise_psbt(const struct wally_psbt* psbt, uint8_t** output, size_t* output_len);
+bool serialise_psbt_into(const struct wally_psbt* psbt, uint8_t** buf, size_t* buf_len, size_t offset, size_t reserve,
+    size_t* written);
 
 const char BCUR_TYPE_CRYPTO_ACCOUNT[] = "crypto-account";
 const char BCUR_TYPE_CRYPTO_HDKEY[] = "crypto-hdkey";
 const char BCUR_TYPE_CRYPTO_PSBT[] = "crypto-psbt";
 const char BCUR_TYPE_JADE_PIN[] = "jade-pin";
+const char BCUR_TYPE_JADE_PINREQ[] = "jade-pinreq";
+const char BCUR_TYPE_JADE_PINREP[] = "jade-pinrep";
 const char BCUR_TYPE_JADE_EPOCH[] = "jade-epoch";
 const char BCUR_TYPE_JADE_UPDPS[] = "jade-updps";
 const char BCUR_TYPE_BYTES[] = "bytes";
@@ -283,34 +286,32 @@ bool bcur_parse_jade_message(const uint8_t* cbor, size_t cbor_len, CborParser* p
 
 // Encode a txn psbt as a bcur cbor 'crypto-psbt' - just bytes
 // See: https://github.com/BlockchainCommons/Research/blob/master/papers/bcr-2020-006-urtypes.md
-bool bcur_build_cbor_crypto_psbt(const struct wally_psbt* psbt, uint8_t** output, size_t* output_len)
+// The psbt is serialised in-place after the cbor header, in a buffer sized from the passed estimate.
+bool bcur_build_cbor_crypto_psbt(
+    const struct wally_psbt* psbt, const size_t len_estimate, uint8_t** output, size_t* output_len)
 {
     JADE_ASSERT(psbt);
     JADE_INIT_OUT_PPTR(output);
     JADE_INIT_OUT_SIZE(output_len);
 
-    // Serialise updated psbt
-    uint8_t* psbt_bytes_out = NULL;
+    // Serialise updated psbt after space for the largest cbor header
+    size_t buflen = CBOR_HEADER_MAX_LEN + (len_estimate ? len_estimate : 1);
+    uint8_t* buf = JADE_MALLOC_PREFER_SPIRAM(buflen);
     size_t psbt_len_out = 0;
-    if (!serialise_psbt(psbt, &psbt_bytes_out, &psbt_len_out)) {
+    if (!serialise_psbt_into(psbt, &buf, &buflen, CBOR_HEADER_MAX_LEN, 0, &psbt_len_out)) {
+        free(buf);
         return false;
     }
 
-    // Format as simple cbor message
-    const size_t buflen = psbt_len_out + 8; // sufficent for cbor overhead
-    uint8_t* buf = JADE_MALLOC_PREFER_SPIRAM(buflen);
-    CborEncoder root_encoder;
-    cbor_encoder_init(&root_encoder, buf, buflen, 0);
-    const CborError cberr = cbor_encode_byte_string(&root_encoder, psbt_bytes_out, psbt_len_out);
-    JADE_ASSERT(cberr == CborNoError);
-    free(psbt_bytes_out);
-
-    const size_t cbor_len = cbor_encoder_get_buffer_size(&root_encoder, buf);
-    JADE_ASSERT(cbor_len > psbt_len_out && cbor_len <= buflen);
+    // Format as simple cbor message - move the psbt bytes down to follow the actual header
+    uint8_t header[CBOR_HEADER_MAX_LEN];
+    const size_t header_len = rpc_write_cbor_header(CborByteStringType, psbt_len_out, header, sizeof(header));
+    memmove(buf + header_len, buf + CBOR_HEADER_MAX_LEN, psbt_len_out);
+    memcpy(buf, header, header_len);
 
-    // Copy cbor buffer to output
+    // Return the cbor buffer
     *output = buf;
-    *output_len = cbor_len;
+    *output_len = header_len + psbt_len_out;
     return true;
 }
 
@@ -728,8 +729,8 @@ bool bcur_check_fragment_sizes(void)
     // Test various versions, with various message types, and various payload lengths
     bool overflowed = false;
     const uint8_t versions[] = { 4, 6, 12 }; // the versions & ur-types of interest
-    const char* types[]
-        = { BCUR_TYPE_CRYPTO_PSBT, BCUR_TYPE_CRYPTO_ACCOUNT, BCUR_TYPE_CRYPTO_HDKEY, BCUR_TYPE_JADE_PIN };
+    const char* types[] = { BCUR_TYPE_CRYPTO_PSBT, BCUR_TYPE_CRYPTO_ACCOUNT, BCUR_TYPE_CRYPTO_HDKEY, BCUR_TYPE_JADE_PIN,
+        BCUR_TYPE_JADE_PINREQ };
     uint8_t payload[4096];
 
     for (uint8_t iver = 0; iver < sizeof(versions); ++iver) {
@@ -737,7 +738,7 @@ bool bcur_check_fragment_sizes(void)
         const size_t capacity = QR_ALPHANUMERIC_CAPACITY[ver];
         JADE_LOGI("Testing version %u, capacity %u", ver, capacity);
 
-        for (uint8_t itype = 0; itype < 4; ++itype) {
+        for (uint8_t itype = 0; itype < sizeof(types) / sizeof(types[0]); ++itype) {
             const char* type = types[itype];
             const size_t maxlen = BCUR_MAX_FRAGMENT_SIZE(capacity, type);
             JADE_ASSERT(maxlen < capacity);
@@ -16,6 +16,8 @@ extern const char BCUR_TYPE_CRYPTO_ACCOUNT[];
 extern const char BCUR_TYPE_CRYPTO_HDKEY[];
 extern const char BCUR_TYPE_CRYPTO_PSBT[];
 extern const char BCUR_TYPE_JADE_PIN[];
+extern const char BCUR_TYPE_JADE_PINREQ[];
+extern const char BCUR_TYPE_JADE_PINREP[];
 extern const char BCUR_TYPE_JADE_EPOCH[];
 extern const char BCUR_TYPE_JADE_UPDPS[];
 extern const char BCUR_TYPE_BYTES[];
@@ -32,7 +34,8 @@ void bcur_build_cbor_crypto_hdkey(
     const uint32_t* path, size_t path_len, uint8_t* output, size_t output_len, size_t* written);
 void bcur_build_cbor_crypto_account(script_variant_t script_variant, const uint32_t* path, size_t path_len,
     uint8_t* output, size_t output_len, size_t* written);
-bool bcur_build_cbor_crypto_psbt(const struct wally_psbt* psbt, uint8_t** output, size_t* output_len);
+bool bcur_build_cbor_crypto_psbt(
+    const struct wally_psbt* psbt, size_t len_estimate, uint8_t** output, size_t* output_len);
 
 // Scan a QR code that may be a BC-UR code/fragment - ie. single-frame or animated/multi-frame.
 // Returns true if a complete (ie. potentially multi-frame) bc-ur code is scanned, or if a single
@@ -35,6 +35,13 @@
 
 #define BLE_CONNECTION_TIMEOUT_MS 5000
 
+// The number of writes a host may have outstanding (ie. written but not yet processed) when writing without
+// response.  Pending writes are held in the host stack's mbuf pool - each full-mtu write takes several blocks.
+#define BLE_WRITE_CREDIT_WINDOW 4
+
+// Processed writes are reported back to the host (returning its credits) in batches of this many
+#define BLE_WRITE_CREDIT_BATCH (BLE_WRITE_CREDIT_WINDOW / 2)
+
 // 6E400001-B5A3-F393-E0A9-E50E24DCCA9E
 static const ble_uuid128_t service_uuid
     = BLE_UUID128_INIT(0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9, 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x01, 0x00, 0x40, 0x6e);
@@ -47,6 +54,10 @@ static const ble_uuid128_t tx_service_uuid
 static const ble_uuid128_t rx_service_uuid
     = BLE_UUID128_INIT(0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9, 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x02, 0x00, 0x40, 0x6e);
 
+// 6E400004-B5A3-F393-E0A9-E50E24DCCA9E
+static const ble_uuid128_t credit_service_uuid
+    = BLE_UUID128_INIT(0x9e, 0xca, 0xdc, 0x24, 0x0e, 0xe5, 0xa9, 0xe0, 0x93, 0xf3, 0xa3, 0xb5, 0x04, 0x00, 0x40, 0x6e);
+
 static bool ble_is_enabled = false;
 static bool ble_is_connected = false;
 static size_t ble_read = 0;
@@ -59,6 +70,13 @@ static uint16_t peer_conn_attr_handle = 0;
 static const size_t ATT_OVERHEAD = 3;
 static size_t ble_max_write_size = CONFIG_BT_NIMBLE_ATT_PREFERRED_MTU - ATT_OVERHEAD;
 static TaskHandle_t* ble_writer_handle = NULL;
+static uint16_t tx_val_handle = 0;
+static uint16_t credit_val_handle = 0;
+
+// Writes processed on this connection, and the count last reported to a host subscribed for credits
+static bool credit_subscribed = false;
+static uint32_t writes_processed = 0;
+static uint32_t writes_reported = 0;
 
 void make_ble_confirmation_activity(gui_activity_t** activity_ptr, const uint32_t numcmp);
 
@@ -95,6 +113,36 @@ int ble_get_mac(char* mac, size_t length)
     return 18;
 }
 
+// Report the running count of writes processed to a subscribed host, so it can compute the credit it has
+// remaining - it may have (BLE_WRITE_CREDIT_WINDOW - (writes sent - writes processed)) writes outstanding.
+// The count is cumulative so a lost notification is made good by the next one.
+static void return_write_credits(const uint16_t conn_handle)
+{
+    if (!credit_subscribed || writes_processed - writes_reported < BLE_WRITE_CREDIT_BATCH) {
+        return;
+    }
+
+    const uint8_t processed[sizeof(uint32_t)] = { writes_processed & 0xff, (writes_processed >> 8) & 0xff,
+        (writes_processed >> 16) & 0xff, (writes_processed >> 24) & 0xff };
+
+    // os_mbuf data is consumed by notify_custom, regardless of the outcome
+    struct os_mbuf* data = ble_hs_mbuf_from_flat(processed, sizeof(processed));
+    if (!data) {
+        // mbuf pool exhausted - the count is retried (unchanged 'writes_reported') on the next write processed,
+        // or the host re-syncs with a write-with-response if it runs out of credit first
+        JADE_LOGW("ble_hs_mbuf_from_flat() failed returning write credits");
+        return;
+    }
+
+    const int rc = ble_gattc_notify_custom(conn_handle, credit_val_handle, data);
+    if (rc != 0) {
+        // Host will re-sync with a write-with-response if it runs out of credit
+        JADE_LOGW("ble_gattc_notify_custom() returned error %d returning write credits", rc);
+        return;
+    }
+    writes_reported = writes_processed;
+}
+
 static int gatt_chr_event(uint16_t conn_handle, uint16_t attr_handle, struct ble_gatt_access_ctxt* ctxt, void* arg)
 {
     JADE_LOGI("Entering gatt_chr_event %d", ctxt->op);
@@ -114,6 +162,8 @@ static int gatt_chr_event(uint16_t conn_handle, uint16_t attr_handle, struct ble
             JADE_LOGI("Reading %u bytes", ble_msg_len);
 
             if (ble_msg_len == 0) {
+                ++writes_processed;
+                return_write_credits(conn_handle);
                 return 0;
             }
 
@@ -136,6 +186,10 @@ static int gatt_chr_event(uint16_t conn_handle, uint16_t attr_handle, struct ble
             const bool force_reject_if_no_msg = false;
             handle_data(
                 full_ble_data_in, &ble_read, ble_msg_len, &last_processing_time, force_reject_if_no_msg, ble_data_out);
+
+            // Write drained into the input buffer - return credit to the host
+            ++writes_processed;
+            return_write_credits(conn_handle);
             return 0;
 
         default:
@@ -145,6 +199,17 @@ static int gatt_chr_event(uint16_t conn_handle, uint16_t attr_handle, struct ble
     } else if (ble_uuid_cmp(uuid, &tx_service_uuid.u) == 0) {
         JADE_LOGW("Received op %u for tx uuid, ignoring", ctxt->op);
         return 0;
+    } else if (ble_uuid_cmp(uuid, &credit_service_uuid.u) == 0) {
+        if (ctxt->op != BLE_GATT_ACCESS_OP_READ_CHR) {
+            JADE_LOGW("Received op %u for credit uuid, ignoring", ctxt->op);
+            return 0;
+        }
+
+        // Reading the credit characteristic returns the credit window
+        const uint16_t window = BLE_WRITE_CREDIT_WINDOW;
+        const uint8_t window_bytes[sizeof(window)] = { window & 0xff, (window >> 8) & 0xff };
+        rc = os_mbuf_append(ctxt->om, window_bytes, sizeof(window_bytes));
+        return rc == 0 ? 0 : BLE_ATT_ERR_INSUFFICIENT_RES;
     }
 
     char buf[BLE_UUID_STR_LEN];
@@ -160,11 +225,19 @@ static const struct ble_gatt_svc_def gatt_svr_svcs[] = {
         .uuid = &service_uuid.u,
         .characteristics = (struct ble_gatt_chr_def[]){ { .uuid = &tx_service_uuid.u,
                                                             .access_cb = gatt_chr_event,
+                                                            .val_handle = &tx_val_handle,
                                                             .flags = BLE_GATT_CHR_F_INDICATE | BLE_GATT_CHR_F_READ_ENC
                                                                 | BLE_GATT_CHR_F_READ_AUTHEN },
             { .uuid = &rx_service_uuid.u,
                 .access_cb = gatt_chr_event,
-                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_ENC | BLE_GATT_CHR_F_WRITE_AUTHEN },
+                .flags = BLE_GATT_CHR_F_WRITE | BLE_GATT_CHR_F_WRITE_NO_RSP | BLE_GATT_CHR_F_WRITE_ENC
+                    | BLE_GATT_CHR_F_WRITE_AUTHEN },
+            // Flow control for writes without response - see return_write_credits()
+            { .uuid = &credit_service_uuid.u,
+                .access_cb = gatt_chr_event,
+                .val_handle = &credit_val_handle,
+                .flags = BLE_GATT_CHR_F_READ | BLE_GATT_CHR_F_NOTIFY | BLE_GATT_CHR_F_READ_ENC
+                    | BLE_GATT_CHR_F_READ_AUTHEN },
             {
                 0,
             } },
@@ -483,7 +556,8 @@ bool ble_init(TaskHandle_t* ble_handle)
     ble_data_out = JADE_MALLOC_PREFER_SPIRAM(MAX_OUTPUT_MSG_SIZE);
 
     const BaseType_t retval = xTaskCreatePinnedToCore(
-        &ble_writer, "ble_writer", 2 * 1024, NULL, JADE_TASK_PRIO_WRITER, ble_handle, JADE_CORE_SECONDARY);
+        &ble_writer, "ble_writer", JADE_TASK_STACK_SIZE_WRITER, NULL, JADE_TASK_PRIO_WRITER, ble_handle,
+        JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create ble_writer task, xTaskCreatePinnedToCore() returned %d", retval);
 
@@ -619,6 +693,12 @@ static int ble_gap_event(struct ble_gap_event* event, void* arg)
         peer_conn_handle = 0;
         peer_conn_attr_handle = 0;
         ble_is_connected = false;
+        credit_subscribed = false;
+        writes_processed = 0;
+        writes_reported = 0;
+
+        // Any larger reply size was negotiated for that connection only
+        jade_process_negotiate_max_reply_size(SOURCE_BLE, 0);
 
         // Restart advertising if ble enabled
         if (ble_is_enabled) {
@@ -636,6 +716,11 @@ static int ble_gap_event(struct ble_gap_event* event, void* arg)
         return 0;
 
     case BLE_GAP_EVENT_NOTIFY_TX:
+        // Credit notifications are not of interest to the writer
+        if (event->notify_tx.attr_handle == credit_val_handle) {
+            return 0;
+        }
+
         // ble device got our notification, we can send the next msg
         JADE_LOGI("notify tx received, notifying writer");
         if (ble_writer_handle != NULL) {
@@ -666,6 +751,13 @@ static int ble_gap_event(struct ble_gap_event* event, void* arg)
             event->subscribe.conn_handle, event->subscribe.attr_handle, event->subscribe.reason,
             event->subscribe.prev_notify, event->subscribe.cur_notify, event->subscribe.prev_indicate,
             event->subscribe.cur_indicate);
+        if (event->subscribe.attr_handle == credit_val_handle) {
+            // Host is writing without response, and counting its writes from here
+            credit_subscribed = event->subscribe.cur_notify;
+            writes_processed = 0;
+            writes_reported = 0;
+            return 0;
+        }
         peer_conn_handle = event->subscribe.conn_handle;
         peer_conn_attr_handle = event->subscribe.attr_handle;
         ble_is_connected = true;
@@ -719,7 +811,7 @@ static int ble_gap_event(struct ble_gap_event* event, void* arg)
                 activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 30000 / portTICK_PERIOD_MS);
 #else
             gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-                CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+                gui_unattended_ci_timeout());
             const bool ret = true;
             ev_id = BTN_BLE_CONFIRM;
 #endif
@@ -17,6 +17,12 @@ typedef enum {
     BTN_CANCEL_SIGNATURE,
     BTN_ACCEPT_SIGNATURE,
 
+    BTN_TX_BATCH_REVIEW,
+    BTN_TX_BATCH_PREV,
+    BTN_TX_BATCH_NEXT,
+    BTN_TX_BATCH_OUTPUTS,
+    BTN_TX_BATCH_EXIT,
+
     BTN_CANCEL_ADDRESS,
     BTN_ACCEPT_ADDRESS,
 
@@ -1,4 +1,7 @@
 #include <esp_camera.h>
+#include <esp_timer.h>
+#include <freertos/semphr.h>
+#include <freertos/timers.h>
 
 #include "button_events.h"
 #include "camera.h"
@@ -7,14 +10,41 @@
 #include "jade_tasks.h"
 #include "power.h"
 #include "sensitive.h"
+#include "stack_usage.h"
 #include "ui.h"
 #include "utils/event.h"
 #include "utils/malloc_ext.h"
 
+#include <stdlib.h>
+#include <string.h>
+
 // When the camera is running we ensure the timeout is at least this value
 // as we don't want the unit to shut down because of apparent inactivity.
 #define CAMERA_MIN_TIMEOUT_SECS 300
 
+// How long the camera is left running after a scan, in case another scan follows
+#ifdef CONFIG_CAMERA_STANDBY_SECS
+#define CAMERA_STANDBY_SECS CONFIG_CAMERA_STANDBY_SECS
+#else
+#define CAMERA_STANDBY_SECS 0
+#endif
+
+// After a cold start the sensor's auto-exposure/gain takes a few frames to settle.
+// The camera is deemed ready when the mean brightness of consecutive frames is stable
+// (and not black), or after a maximum number of frames regardless.
+#define CAMERA_READY_MAX_FRAMES 20
+#define CAMERA_READY_MIN_MEAN 8
+#define CAMERA_READY_MAX_MEAN_DELTA 4
+#define CAMERA_READY_SAMPLE_STEP 16
+
+// Two frame buffers so the next frame is captured while the last is processed
+#define CAMERA_FB_COUNT 2
+
+// The ov2640 sensor array (UXGA, 1600x1200) is 5x the full-view frame size in each dimension,
+// so a window can be read out at up to 5x the full-view resolution
+#define CAMERA_SENSOR_SCALE 5
+#define CAMERA_SENSOR_MODE_UXGA 0
+
 void make_camera_activity(gui_activity_t** activity_ptr, const char* title, const char* btnText,
     progress_bar_t* progress_bar, gui_view_node_t** image_node, gui_view_node_t** label_node);
 
@@ -35,8 +65,31 @@ typedef struct {
 
     // Context info passed to that function
     void* ctx;
+
+    // When the scan was requested, for logging time-to-first-frame
+    int64_t start_time_us;
 } camera_task_config_t;
 
+// Whether the camera is initialised and running - and so needs no warm-up.
+// Protected by the mutex, held for the duration of each scan and by the standby timer when it fires.
+static bool camera_running = false;
+static SemaphoreHandle_t camera_mutex = NULL;
+static TimerHandle_t camera_standby_timer = NULL;
+
+// Set by the standby timer, and acted upon by the main task - see jade_camera_standby_check()
+static volatile bool camera_standby_expired_pending = false;
+
+// Any readout window requested by the processing function (zero width implies the full view),
+// and whether the sensor is currently reading out a window - only accessed by the camera task.
+static camera_window_t pending_window = { 0 };
+static bool window_pending = false;
+static bool camera_zoomed = false;
+
+// Likewise any exposure adjustments requested, and whether any are currently applied
+static camera_exposure_t pending_exposure = { 0 };
+static bool exposure_pending = false;
+static bool camera_exposure_adjusted = false;
+
 #ifdef CONFIG_DEBUG_MODE
 // Debug/testing function to cache an image - the next time the camera is called
 // a frame is captured but is ignored/discarded and this image presented instead.
@@ -59,6 +112,9 @@ static void post_exit_event_and_await_death(void)
 
     // Log the task stack HWM so we can estimate ideal stack size
     JADE_LOGI("Camera task complete - task stack HWM: %u free", uxTaskGetStackHighWaterMark(NULL));
+#ifdef CONFIG_DEBUG_MODE
+    stack_usage_record_current_task();
+#endif
 
     // Post 'camera-exit' event
     esp_event_post(JADE_EVENT, CAMERA_EXIT, NULL, 0, portMAX_DELAY);
@@ -100,7 +156,7 @@ static void jade_camera_init(void)
         .pixel_format = PIXFORMAT_GRAYSCALE,
         .frame_size = FRAMESIZE_QVGA,
 
-        .fb_count = 1,
+        .fb_count = CAMERA_FB_COUNT,
         .fb_location = CAMERA_FB_IN_PSRAM,
         .grab_mode = CAMERA_GRAB_LATEST,
 
@@ -111,6 +167,11 @@ static void jade_camera_init(void)
         JADE_LOGE("Camera init failed with error 0x%x", err);
         post_exit_event_and_await_death();
     }
+    camera_running = true;
+    camera_zoomed = false;
+    window_pending = false;
+    camera_exposure_adjusted = false;
+    exposure_pending = false;
 }
 
 // Stop the camera
@@ -118,6 +179,145 @@ static void jade_camera_stop(void)
 {
     esp_camera_deinit();
     power_camera_off();
+    camera_running = false;
+}
+
+// Mean brightness of a sample of the frame's pixels
+static uint8_t frame_mean_brightness(const camera_fb_t* fb)
+{
+    JADE_ASSERT(fb);
+
+    uint32_t total = 0;
+    size_t count = 0;
+    for (size_t i = 0; i < fb->len; i += CAMERA_READY_SAMPLE_STEP, ++count) {
+        total += fb->buf[i];
+    }
+    return count ? total / count : 0;
+}
+
+// Discard frames from a newly initialised camera until its exposure has settled
+static void await_camera_ready(void)
+{
+    int mean = -1;
+    for (size_t i = 0; i < CAMERA_READY_MAX_FRAMES; ++i) {
+        camera_fb_t* const fb = esp_camera_fb_get();
+        if (!fb) {
+            continue;
+        }
+        const int last_mean = mean;
+        mean = frame_mean_brightness(fb);
+        esp_camera_fb_return(fb);
+
+        if (last_mean >= 0 && mean >= CAMERA_READY_MIN_MEAN && abs(mean - last_mean) <= CAMERA_READY_MAX_MEAN_DELTA) {
+            JADE_LOGI("Camera ready after %u frames (mean brightness %d)", i + 1, mean);
+            return;
+        }
+    }
+    JADE_LOGW("Camera not settled after %u frames (mean brightness %d) - proceeding", CAMERA_READY_MAX_FRAMES, mean);
+}
+
+// Read out the given window of the sensor's field of view at the usual frame size - or the full view
+// if the window has zero width.  Frames captured before the change are still queued.
+static void apply_camera_window(const camera_window_t* window)
+{
+    JADE_ASSERT(window);
+
+    sensor_t* const sensor = esp_camera_sensor_get();
+    JADE_ASSERT(sensor);
+
+    int ret;
+    if (window->width) {
+        // NOTE: esp32-camera's ov2640 set_res_raw() takes the sensor mode as 'startX', and the
+        // window offset and size in that mode's pixels as 'offsetX/Y' and 'totalX/Y'
+        ret = sensor->set_res_raw(sensor, CAMERA_SENSOR_MODE_UXGA, 0, 0, 0, window->x * CAMERA_SENSOR_SCALE,
+            window->y * CAMERA_SENSOR_SCALE, window->width * CAMERA_SENSOR_SCALE, window->height * CAMERA_SENSOR_SCALE,
+            CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT, false, false);
+    } else {
+        ret = sensor->set_framesize(sensor, FRAMESIZE_QVGA);
+    }
+
+    if (ret) {
+        JADE_LOGE("Failed to set camera readout window: %d", ret);
+        return;
+    }
+    JADE_LOGI("Camera readout window %u,%u %ux%u", window->x, window->y, window->width, window->height);
+    camera_zoomed = window->width;
+}
+
+bool jade_camera_set_window(const camera_window_t* window)
+{
+    const sensor_t* const sensor = esp_camera_sensor_get();
+    if (!sensor || sensor->id.PID != OV2640_PID || !sensor->set_res_raw) {
+        return false;
+    }
+
+    if (window) {
+        JADE_ASSERT(window->width && window->height);
+        JADE_ASSERT(window->x + window->width <= CAMERA_IMAGE_WIDTH);
+        JADE_ASSERT(window->y + window->height <= CAMERA_IMAGE_HEIGHT);
+        JADE_ASSERT(window->width * CAMERA_IMAGE_HEIGHT == window->height * CAMERA_IMAGE_WIDTH);
+        pending_window = *window;
+    } else {
+        memset(&pending_window, 0, sizeof(pending_window));
+    }
+    window_pending = true;
+    return true;
+}
+
+// Apply the given adjustments to the sensor's automatic exposure level and contrast
+static void apply_camera_exposure(const camera_exposure_t* exposure)
+{
+    JADE_ASSERT(exposure);
+
+    sensor_t* const sensor = esp_camera_sensor_get();
+    JADE_ASSERT(sensor);
+
+    if (sensor->set_ae_level(sensor, exposure->ae_level) || sensor->set_contrast(sensor, exposure->contrast)) {
+        JADE_LOGE("Failed to set camera exposure adjustments");
+        return;
+    }
+    JADE_LOGI("Camera ae_level %d, contrast %d", exposure->ae_level, exposure->contrast);
+    camera_exposure_adjusted = exposure->ae_level || exposure->contrast;
+}
+
+bool jade_camera_set_exposure(const camera_exposure_t* exposure)
+{
+    const sensor_t* const sensor = esp_camera_sensor_get();
+    if (!sensor || !sensor->set_ae_level || !sensor->set_contrast) {
+        return false;
+    }
+
+    if (exposure) {
+        JADE_ASSERT(exposure->ae_level >= -CAMERA_EXPOSURE_LIMIT && exposure->ae_level <= CAMERA_EXPOSURE_LIMIT);
+        JADE_ASSERT(exposure->contrast >= -CAMERA_EXPOSURE_LIMIT && exposure->contrast <= CAMERA_EXPOSURE_LIMIT);
+        pending_exposure = *exposure;
+    } else {
+        memset(&pending_exposure, 0, sizeof(pending_exposure));
+    }
+    exposure_pending = true;
+    return true;
+}
+
+// Standby period expired - flag the camera to be powered down.
+// NOTE: runs on the timer task, so must not block - powering down the camera takes the i2c mutex and
+// may delay, so is left to the main task's idle loop (see below).
+static void camera_standby_expired(TimerHandle_t timer) { camera_standby_expired_pending = true; }
+
+void jade_camera_standby_check(void)
+{
+    if (!camera_standby_expired_pending) {
+        return;
+    }
+
+    // If a scan holds the camera it will re-arm the timer when done
+    if (xSemaphoreTake(camera_mutex, 0) == pdTRUE) {
+        camera_standby_expired_pending = false;
+        if (camera_running) {
+            JADE_LOGI("Camera standby expired - powering down");
+            jade_camera_stop();
+        }
+        xSemaphoreGive(camera_mutex);
+    }
 }
 
 static inline bool invoke_user_cb_fn(const camera_task_config_t* camera_config, const camera_fb_t* fb)
@@ -166,10 +366,15 @@ static void jade_camera_task(void* data)
         gui_set_current_activity(act);
     }
 
-    // Initialise the camera
+    // Initialise the camera if not already running
     sensitive_init();
-    jade_camera_init();
-    vTaskDelay(500 / portTICK_PERIOD_MS);
+    const bool warm = camera_running;
+    if (!warm) {
+        jade_camera_init();
+        await_camera_ready();
+    }
+    bool first_frame = true;
+    size_t discard_frames = 0;
     void* image_buffer = NULL;
     Picture pic = {};
     const size_t image_size = sizeof(uint8_t[CAMERA_IMAGE_WIDTH / 2][CAMERA_IMAGE_HEIGHT / 2]);
@@ -211,6 +416,19 @@ static void jade_camera_task(void* data)
         JADE_ASSERT(fb->width == CAMERA_IMAGE_WIDTH);
         JADE_ASSERT(fb->height == CAMERA_IMAGE_HEIGHT);
 
+        // Skip frames captured before a change of readout window or exposure
+        if (discard_frames) {
+            --discard_frames;
+            esp_camera_fb_return(fb);
+            continue;
+        }
+
+        if (first_frame) {
+            JADE_LOGI("Time to first frame (%s start): %lldms", warm ? "warm" : "cold",
+                (esp_timer_get_time() - camera_config->start_time_us) / 1000);
+            first_frame = false;
+        }
+
         if (!has_gui) {
             done = invoke_user_cb_fn(camera_config, fb);
         } else {
@@ -260,6 +478,31 @@ static void jade_camera_task(void* data)
             }
         }
         esp_camera_fb_return(fb);
+
+        // Apply any change of readout window requested by the processing function
+        if (window_pending && !done) {
+            apply_camera_window(&pending_window);
+            discard_frames = CAMERA_FB_COUNT;
+        }
+        window_pending = false;
+
+        // Likewise any change of exposure
+        if (exposure_pending && !done) {
+            apply_camera_exposure(&pending_exposure);
+            discard_frames = CAMERA_FB_COUNT;
+        }
+        exposure_pending = false;
+    }
+    JADE_LOGI("Camera scan complete after %lldms", (esp_timer_get_time() - camera_config->start_time_us) / 1000);
+
+    // Restore the full view and default exposure, as the camera may be kept running for the next scan
+    if (camera_zoomed) {
+        const camera_window_t full_view = { 0 };
+        apply_camera_window(&full_view);
+    }
+    if (camera_exposure_adjusted) {
+        const camera_exposure_t default_exposure = { 0 };
+        apply_camera_exposure(&default_exposure);
     }
 
     // Finished with camera - free everything and kill task
@@ -294,7 +537,27 @@ void jade_camera_process_images(camera_process_fn_t fn, void* ctx, const char* t
         .text_button = text_button,
         .progress_bar = progress_bar,
         .fn_process = fn,
-        .ctx = ctx };
+        .ctx = ctx,
+        .start_time_us = esp_timer_get_time() };
+
+    if (!camera_mutex) {
+        camera_mutex = xSemaphoreCreateMutex();
+        JADE_ASSERT(camera_mutex);
+        if (CAMERA_STANDBY_SECS) {
+            camera_standby_timer = xTimerCreate("camera_standby", CAMERA_STANDBY_SECS * 1000 / portTICK_PERIOD_MS,
+                pdFALSE, NULL, camera_standby_expired);
+            JADE_ASSERT(camera_standby_timer);
+        }
+    }
+
+    // Hold the camera for the duration of the scan, cancelling any pending standby power-down
+    while (xSemaphoreTake(camera_mutex, portMAX_DELAY) != pdTRUE) {
+        // wait for the mutex
+    }
+    if (camera_standby_timer) {
+        xTimerStop(camera_standby_timer, portMAX_DELAY);
+    }
+    camera_standby_expired_pending = false;
 
     // When running the camera task we set the minimum idle timeout to keep the hw from sleeping too quickly
     // (If the user has set a longer timeout value that is respected)
@@ -302,15 +565,22 @@ void jade_camera_process_images(camera_process_fn_t fn, void* ctx, const char* t
 
     // Run the camera task
     TaskHandle_t camera_task;
-    const BaseType_t retval = xTaskCreatePinnedToCore(&jade_camera_task, "jade_camera", 16 * 1024, &camera_config,
-        JADE_TASK_PRIO_CAMERA, &camera_task, JADE_CORE_SECONDARY);
+    const BaseType_t retval = xTaskCreatePinnedToCore(&jade_camera_task, "jade_camera", JADE_TASK_STACK_SIZE_CAMERA,
+        &camera_config, JADE_TASK_PRIO_CAMERA, &camera_task, JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create jade_camera task, xTaskCreatePinnedToCore() returned %d", retval);
 
     // Await camera exit event
     sync_await_single_event(JADE_EVENT, CAMERA_EXIT, NULL, NULL, NULL, 0);
     vTaskDelete(camera_task);
-    jade_camera_stop();
+
+    // Leave the camera running in standby, in case another scan follows - or stop it now
+    if (camera_running && camera_standby_timer) {
+        xTimerReset(camera_standby_timer, portMAX_DELAY);
+    } else {
+        jade_camera_stop();
+    }
+    xSemaphoreGive(camera_mutex);
 
     // Remove the minimum idle timeout - make the completed image capture count as 'activity'
     idletimer_register_activity();
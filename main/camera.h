@@ -12,6 +12,23 @@
 #define CAMERA_IMAGE_WIDTH 320
 #define CAMERA_IMAGE_HEIGHT 240
 
+// A window of the camera's full field of view, in full-view frame pixels
+// ie. within CAMERA_IMAGE_WIDTH x CAMERA_IMAGE_HEIGHT, and of the same aspect ratio
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t width;
+    uint16_t height;
+} camera_window_t;
+
+// Adjustments to the sensor's automatic exposure and to its contrast, each in the range
+// -CAMERA_EXPOSURE_LIMIT to +CAMERA_EXPOSURE_LIMIT (zero being the sensor default)
+#define CAMERA_EXPOSURE_LIMIT 2
+typedef struct {
+    int8_t ae_level;
+    int8_t contrast;
+} camera_exposure_t;
+
 // Function to process images from the camera.
 // Should return false if processing incomplete (and so should be called again with the next frame)
 // Should return true when processing complete (and the image capture loop/task should exit)
@@ -35,4 +52,19 @@ void camera_set_debug_image(const uint8_t* data, size_t len);
 void jade_camera_process_images(camera_process_fn_t fn, void* ctx, const char* title, const char* text_label,
     const char* text_button, progress_bar_t* progress_bar);
 
+// Power down a camera left running in standby after a scan, if the standby period has expired.
+// Called from the main task's idle loop.
+void jade_camera_standby_check(void);
+
+// Ask the camera to read out only the given window of its field of view (at the same frame size), ie. to
+// zoom in - or pass NULL to restore the full field of view.  Applies to frames passed to the processing
+// function after it returns.  Only valid from a processing function.
+// Returns false if the camera sensor does not support windowed readout.
+bool jade_camera_set_window(const camera_window_t* window);
+
+// Ask the camera to apply the given exposure adjustments - or pass NULL to restore the defaults.
+// Applies to frames passed to the processing function after it returns.  Only valid from a processing function.
+// Returns false if the camera sensor does not support the adjustments.
+bool jade_camera_set_exposure(const camera_exposure_t* exposure);
+
 #endif /* CAMERA_H_ */
@@ -2,6 +2,7 @@
 #include <string.h>
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/queue.h>
 #include <freertos/ringbuf.h>
 #include <freertos/task.h>
 
@@ -73,6 +74,21 @@ struct {
     bool updated;
 } status_bar;
 
+// When throttled the gui task only switches/renders activities - it does not run
+// animations/scrolling text nor update the status bar.  See gui_set_throttled().
+static volatile bool gui_throttled = false;
+
+#ifdef CONFIG_DEBUG_MODE
+// A function another task has asked to be run on the gui task, and the task waiting for it to complete.
+// Passed through a queue so the gui task sees the whole request.  See gui_run_on_gui_task().
+typedef struct {
+    void (*fn)(void*);
+    void* ctx;
+    TaskHandle_t caller;
+} gui_task_fn_request_t;
+static QueueHandle_t gui_task_fn_queue = NULL;
+#endif
+
 // Utils
 static inline uint16_t min(uint16_t a, uint16_t b) { return a < b ? a : b; }
 
@@ -168,9 +184,14 @@ void gui_init(void)
     // Create status-bar
     make_status_bar();
 
+#ifdef CONFIG_DEBUG_MODE
+    gui_task_fn_queue = xQueueCreate(1, sizeof(gui_task_fn_request_t));
+    JADE_ASSERT(gui_task_fn_queue);
+#endif
+
     // Create (high priority) gui task
     BaseType_t retval = xTaskCreatePinnedToCore(
-        gui_task, "gui", 3 * 1024, NULL, JADE_TASK_PRIO_GUI, &gui_task_handle, JADE_CORE_SECONDARY);
+        gui_task, "gui", JADE_TASK_STACK_SIZE_GUI, NULL, JADE_TASK_PRIO_GUI, &gui_task_handle, JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(retval == pdPASS, "Failed to create GUI task, xTaskCreatePinnedToCore() returned %d", retval);
 }
 
@@ -2122,7 +2143,23 @@ static void gui_task(void* args)
 
         // Check the current activity - set new activity if need be
         // Note: this can also free all the old/completed activities
-        if (!switch_activities()) {
+        const bool switched = switch_activities();
+
+#ifdef CONFIG_DEBUG_MODE
+        // Run any function requested by another task, and wake that task
+        gui_task_fn_request_t request;
+        if (xQueueReceive(gui_task_fn_queue, &request, 0) == pdTRUE) {
+            request.fn(request.ctx);
+            xTaskNotifyGive(request.caller);
+        }
+#endif
+
+        // When throttled, no other gui updates
+        if (gui_throttled) {
+            continue;
+        }
+
+        if (!switched) {
             // Not switching activities, update any 'updatable' gui elements on this activity
             update_updateables();
         }
@@ -2337,3 +2374,36 @@ void gui_set_title(const char* title)
 }
 
 gui_activity_t* gui_current_activity(void) { return current_activity; }
+
+// Throttle the gui to switching/rendering activities only (eg. to a progress bar updated by the caller),
+// so time-critical work in lower priority tasks is not preempted by animations and status bar updates.
+void gui_set_throttled(const bool throttled) { gui_throttled = throttled; }
+
+#ifdef CONFIG_DEBUG_MODE
+// Run a function on the gui task (between frames), blocking until it completes.
+// For debug code which must paint (eg. to time rendering) without racing the gui task.
+void gui_run_on_gui_task(void (*fn)(void*), void* ctx)
+{
+    JADE_ASSERT(fn);
+    JADE_ASSERT(gui_task_handle);
+    JADE_ASSERT(xTaskGetCurrentTaskHandle() != gui_task_handle);
+
+    const gui_task_fn_request_t request = { .fn = fn, .ctx = ctx, .caller = xTaskGetCurrentTaskHandle() };
+    const BaseType_t queued = xQueueSend(gui_task_fn_queue, &request, 0);
+    JADE_ASSERT(queued == pdTRUE);
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+}
+#endif // CONFIG_DEBUG_MODE
+
+#ifdef CONFIG_DEBUG_UNATTENDED_CI
+// 'fast ui' - auto-confirm after a single tick rather than the configured delay
+static bool fast_ui = false;
+
+void gui_set_fast_ui(const bool enabled) { fast_ui = enabled; }
+
+// NOTE: one tick rather than zero, as a zero timeout means 'wait forever'
+TickType_t gui_unattended_ci_timeout(void)
+{
+    return fast_ui ? 1 : CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS;
+}
+#endif // CONFIG_DEBUG_UNATTENDED_CI
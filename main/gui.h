@@ -440,10 +440,22 @@ void gui_set_activity_title(gui_activity_t* activity, const char* title);
 void gui_set_title(const char* title);
 
 gui_activity_t* gui_current_activity(void);
+void gui_set_throttled(bool throttled);
 
 void gui_wheel_click(void);
 void gui_front_click(void);
 void gui_next(void);
 void gui_prev(void);
 
+#ifdef CONFIG_DEBUG_MODE
+void gui_run_on_gui_task(void (*fn)(void*), void* ctx);
+#endif
+
+#ifdef CONFIG_DEBUG_UNATTENDED_CI
+// Time after which unattended-ci builds auto-confirm activities.
+// Usually CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS, but collapsed to one tick in 'fast ui' mode (for test harnesses).
+TickType_t gui_unattended_ci_timeout(void);
+void gui_set_fast_ui(bool enabled);
+#endif
+
 #endif /* GUI_H_ */
@@ -142,7 +142,8 @@ void idletimer_init(void)
 
     // Kick off the idletimer task
     const BaseType_t retval = xTaskCreatePinnedToCore(
-        idletimer_task, "idle_timeout", 2 * 1024, NULL, JADE_TASK_PRIO_IDLETIMER, NULL, JADE_CORE_PRIMARY);
+        idletimer_task, "idle_timeout", JADE_TASK_STACK_SIZE_IDLETIMER, NULL, JADE_TASK_PRIO_IDLETIMER, NULL,
+        JADE_CORE_PRIMARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create idle_timeout task, xTaskCreatePinnedToCore() returned %d", retval);
 }
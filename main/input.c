@@ -132,7 +132,8 @@ void wheel_init(void)
     JADE_ASSERT(rc == ESP_OK);
 
     const BaseType_t retval = xTaskCreatePinnedToCore(
-        &wheel_watch_task, "wheel_watcher", 2 * 1024, info, JADE_TASK_PRIO_WHEEL, NULL, JADE_CORE_SECONDARY);
+        &wheel_watch_task, "wheel_watcher", JADE_TASK_STACK_SIZE_WHEEL, info, JADE_TASK_PRIO_WHEEL, NULL,
+        JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create wheel_watcher task, xTaskCreatePinnedToCore() returned %d", retval);
 }
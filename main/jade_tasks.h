@@ -15,8 +15,12 @@
 #endif
 
 // Task priorities
-// NOTE: the automatically started main task has priority (tskIDLE_PRIORITY + 1)
+// NOTE: the automatically started main task has priority JADE_TASK_PRIO_MAIN, but is raised to
+// JADE_TASK_PRIO_MAIN_SIGNING from the user's final confirmation until the last signature is sent,
+// so signing is not preempted by the gui/wheel tasks (which share its core in a uni-core configuration).
+// It is not raised above the readers, so the next message (eg. 'get_signature') is not delayed.
 #define JADE_TASK_PRIO_READER (tskIDLE_PRIORITY + 4)
+#define JADE_TASK_PRIO_MAIN_SIGNING (tskIDLE_PRIORITY + 4)
 
 #define JADE_TASK_PRIO_GUI (tskIDLE_PRIORITY + 3)
 #define JADE_TASK_PRIO_WHEEL (tskIDLE_PRIORITY + 3)
@@ -24,8 +28,19 @@
 
 #define JADE_TASK_PRIO_WRITER (tskIDLE_PRIORITY + 2)
 
-// Main Task Priority : (tskIDLE_PRIORITY + 1)
+#define JADE_TASK_PRIO_MAIN (tskIDLE_PRIORITY + 1)
 
 #define JADE_TASK_PRIO_IDLETIMER (tskIDLE_PRIORITY)
 
+// Task stack sizes (bytes)
+// NOTE: the main task stack is CONFIG_ESP_MAIN_TASK_STACK_SIZE, set in the sdkconfig
+// NOTE: sizes should be reviewed against the 'debug_get_stack_usage' report (as logged by test_jade.py)
+#define JADE_TASK_STACK_SIZE_READER (2 * 1024)
+#define JADE_TASK_STACK_SIZE_WRITER (2 * 1024)
+#define JADE_TASK_STACK_SIZE_GUI (3 * 1024)
+#define JADE_TASK_STACK_SIZE_WHEEL (2 * 1024)
+#define JADE_TASK_STACK_SIZE_CAMERA (16 * 1024)
+#define JADE_TASK_STACK_SIZE_AUTH_QR (4 * 1024)
+#define JADE_TASK_STACK_SIZE_IDLETIMER (2 * 1024)
+
 #endif /* JADE_TASKS_H_ */
@@ -2,9 +2,12 @@
 #include "aes.h"
 #include "jade_assert.h"
 #include "jade_wally_verify.h"
+#include "multisig.h"
 #include "random.h"
 #include "sensitive.h"
+#include "sha_engine.h"
 #include "storage.h"
+#include "wallet.h"
 #include "utils/malloc_ext.h"
 #include "utils/network.h"
 
@@ -38,6 +41,56 @@ static size_t mnemonic_entropy_len = 0;
 // Cached passphrase flags
 static uint8_t passphrase_flags = 0;
 
+// While a persisted wallet is unlocked we hold the PIN-derived aes key, so the main wallet and any other
+// wallet slots (encrypted with keys derived from it) can be loaded without further pinserver interaction.
+static uint8_t unlock_aeskey[AES_KEY_LEN_256];
+static bool has_unlock_aeskey = false;
+
+// The wallet slot currently loaded, and any to load in place of the main wallet at the next unlock
+static size_t wallet_slot = 0;
+static size_t unlock_wallet_slot = 0;
+
+// Fixed message used to derive the aes key of each wallet slot
+static const uint8_t WALLET_SLOT_KEY_MSG[] = "Jade wallet slot";
+
+// Wipe the keys and related data held in memory (but not the key to access the persisted wallets)
+void keychain_clear_keys(void)
+{
+    if (keychain_data) {
+        JADE_WALLY_VERIFY(wally_bzero(keychain_data, sizeof(keychain_t)));
+        keychain_data = NULL;
+    }
+
+    // Clear any mnemonic entropy we may have been holding
+    JADE_WALLY_VERIFY(wally_bzero(mnemonic_entropy, sizeof(mnemonic_entropy)));
+    mnemonic_entropy_len = 0;
+
+    // Reload passphrase flags
+    passphrase_flags = storage_get_key_flags();
+
+    keychain_userdata = 0;
+    keychain_temporary = false;
+
+    // Reload the persisted wallet's network type restriction (which temporary keys may have cleared)
+    network_type_restriction = storage_get_network_type_restriction();
+
+    // Wipe any cached blinding keys derived from the keychain, and cached cosigner keys
+    wallet_clear_blinding_key_cache();
+    multisig_clear_key_cache();
+}
+
+static void set_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot < NUM_WALLET_SLOTS);
+    wallet_slot = slot;
+    if (!storage_set_active_wallet_slot(slot)) {
+        JADE_LOGE("Failed to initialise records for wallet slot %u", slot);
+    }
+
+    // Each wallet slot has its own network type restriction
+    network_type_restriction = storage_get_network_type_restriction();
+}
+
 void keychain_set(const keychain_t* src, const uint8_t userdata, const bool temporary)
 {
     JADE_ASSERT(src);
@@ -48,7 +101,7 @@ void keychain_set(const keychain_t* src, const uint8_t userdata, const bool temp
 
     // Copy-from-self is no-op for keys (but we may override 'userdata' below)
     if (src != keychain_data) {
-        keychain_clear();
+        keychain_clear_keys();
         keychain_data = &internal_keychain;
         memcpy(keychain_data, src, sizeof(keychain_t));
     }
@@ -69,20 +122,14 @@ void keychain_set(const keychain_t* src, const uint8_t userdata, const bool temp
 
 void keychain_clear(void)
 {
-    if (keychain_data) {
-        JADE_WALLY_VERIFY(wally_bzero(keychain_data, sizeof(keychain_t)));
-        keychain_data = NULL;
-    }
+    keychain_clear_keys();
 
-    // Clear any mnemonic entropy we may have been holding
-    JADE_WALLY_VERIFY(wally_bzero(mnemonic_entropy, sizeof(mnemonic_entropy)));
-    mnemonic_entropy_len = 0;
-
-    // Reload passphrase flags
-    passphrase_flags = storage_get_key_flags();
-
-    keychain_userdata = 0;
-    keychain_temporary = false;
+    // Wipe the key to the persisted wallets, and revert to the main wallet
+    JADE_WALLY_VERIFY(wally_bzero(unlock_aeskey, sizeof(unlock_aeskey)));
+    has_unlock_aeskey = false;
+    if (wallet_slot) {
+        set_wallet_slot(0);
+    }
 }
 
 const keychain_t* keychain_get(void) { return keychain_data; }
@@ -165,10 +212,10 @@ bool keychain_has_temporary(void)
 uint8_t keychain_get_userdata(void) { return keychain_userdata; }
 
 // Cache/clear mnemonic entropy (if using passphrase)
+// NOTE: a temporary keychain may cache the entropy in case it is persisted as a wallet slot
 void keychain_cache_mnemonic_entropy(const char* mnemonic)
 {
     JADE_ASSERT(mnemonic);
-    JADE_ASSERT(!keychain_temporary);
     JADE_ASSERT(!mnemonic_entropy_len);
 
     JADE_WALLY_VERIFY(
@@ -321,8 +368,11 @@ bool keychain_derive_from_mnemonic(const char* mnemonic, const char* passphrase,
     uint8_t seed[BIP32_ENTROPY_LEN_512];
     SENSITIVE_PUSH(seed, sizeof(seed));
 
+    // Reserve the hw sha engine for the pbkdf2 rounds
     size_t written = 0;
+    sha_engine_reserve();
     JADE_WALLY_VERIFY(bip39_mnemonic_to_seed(mnemonic, passphrase, seed, sizeof(seed), &written));
+    sha_engine_release();
     JADE_ASSERT_MSG(written == sizeof(seed), "Unexpected seed length: %u", written);
 
     keychain_derive_from_seed(seed, sizeof(seed), keydata);
@@ -440,6 +490,86 @@ static bool get_decrypted_payload(const uint8_t* aeskey, const size_t aes_len, c
     return true;
 }
 
+// Derive the aes key of a (non-main) wallet slot from the unlock aes key
+static void get_wallet_slot_aeskey(const size_t slot, uint8_t* aeskey, const size_t aes_len)
+{
+    JADE_ASSERT(has_unlock_aeskey);
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+    JADE_ASSERT(aeskey);
+    JADE_ASSERT(aes_len == AES_KEY_LEN_256);
+
+    uint8_t msg[sizeof(WALLET_SLOT_KEY_MSG) + 1];
+    memcpy(msg, WALLET_SLOT_KEY_MSG, sizeof(WALLET_SLOT_KEY_MSG));
+    msg[sizeof(WALLET_SLOT_KEY_MSG)] = slot;
+    JADE_WALLY_VERIFY(wally_hmac_sha256(unlock_aeskey, sizeof(unlock_aeskey), msg, sizeof(msg), aeskey, aes_len));
+}
+
+// Cache mnemonic entropy or deserialise and set the keychain, from the decrypted payload
+static bool load_payload(const uint8_t* serialized, const size_t serialized_len)
+{
+    JADE_ASSERT(serialized);
+
+    if (serialized_len == BIP39_ENTROPY_LEN_128 || serialized_len == BIP39_ENTROPY_LEN_256) {
+        // Write mnemonic entropy - only 12 or 24 word mnemonics are supported
+        memcpy(mnemonic_entropy, serialized, serialized_len);
+        mnemonic_entropy_len = serialized_len;
+    } else if (serialized_len == SERIALIZED_KEY_LEN) {
+        // Deserialise keychain
+        keychain_t keydata = { 0 };
+        SENSITIVE_PUSH(&keydata, sizeof(keydata));
+        unserialize(serialized, serialized_len, &keydata);
+        keychain_set(&keydata, 0, false);
+        SENSITIVE_POP(&keydata);
+    } else {
+        JADE_LOGE("Unexpected length of decrypted serialised data: %d", serialized_len);
+        return false;
+    }
+    return true;
+}
+
+// Load the keychain persisted in a (non-main) wallet slot
+static bool load_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(!keychain_data && !mnemonic_entropy_len);
+
+    uint8_t aeskey[AES_KEY_LEN_256];
+    uint8_t serialized[AES_PADDED_LEN(SERIALIZED_KEY_LEN)];
+    uint8_t encrypted[ENCRYPTED_DATA_LEN(SERIALIZED_KEY_LEN)];
+    SENSITIVE_PUSH(aeskey, sizeof(aeskey));
+    SENSITIVE_PUSH(serialized, sizeof(serialized));
+    bool ret = false;
+
+    size_t encrypted_data_len = 0;
+    if (!storage_get_wallet_slot_blob(slot, encrypted, sizeof(encrypted), &encrypted_data_len)) {
+        JADE_LOGE("Failed to load encrypted blob for wallet slot %u", slot);
+        goto cleanup;
+    }
+
+    size_t serialized_data_len = 0;
+    get_wallet_slot_aeskey(slot, aeskey, sizeof(aeskey));
+    if (!get_decrypted_payload(aeskey, sizeof(aeskey), encrypted, encrypted_data_len, serialized, sizeof(serialized),
+            &serialized_data_len)) {
+        JADE_LOGE("Failed to decrypt key data for wallet slot %u", slot);
+        goto cleanup;
+    }
+
+    ret = load_payload(serialized, serialized_data_len);
+    if (ret) {
+        set_wallet_slot(slot);
+
+        // A slot holding mnemonic entropy was added with a passphrase, which must be entered whatever the
+        // main wallet's passphrase preferences (reloaded when the derived keychain is set).
+        if (mnemonic_entropy_len) {
+            keychain_set_passphrase_frequency(PASSPHRASE_ALWAYS);
+        }
+    }
+
+cleanup:
+    SENSITIVE_POP(serialized);
+    SENSITIVE_POP(aeskey);
+    return ret;
+}
+
 bool keychain_store_encrypted(const uint8_t* aeskey, const size_t aes_len)
 {
     if (!aeskey || aes_len != AES_KEY_LEN_256) {
@@ -497,7 +627,16 @@ bool keychain_store_encrypted(const uint8_t* aeskey, const size_t aes_len)
     }
     SENSITIVE_POP(encrypted);
 
-    // 4. Clear main/test network restriction and cache that we have encrypted keys
+    // 4. Any other wallet slots are from a previous PIN, and can no longer be decrypted
+    // Hold the new key, to access any wallet slots added during this session.
+    if (wallet_slot) {
+        set_wallet_slot(0);
+    }
+    storage_erase_all_wallet_slots();
+    memcpy(unlock_aeskey, aeskey, aes_len);
+    has_unlock_aeskey = true;
+
+    // 5. Clear main/test network restriction and cache that we have encrypted keys
     keychain_clear_network_type_restriction();
     has_encrypted_blob = true;
 
@@ -550,27 +689,19 @@ bool keychain_load_cleartext(const uint8_t* aeskey, const size_t aes_len)
     // (Ignore failure as it can't make things worse)
     storage_restore_counter();
 
-    // 4. Cache mnemonic entropy or deserialise keychain
-    if (serialized_data_len == BIP39_ENTROPY_LEN_128 || serialized_data_len == BIP39_ENTROPY_LEN_256) {
-        // Write mnemonic entropy - only 12 or 24 word mnemonics are supported
-        memcpy(mnemonic_entropy, serialized, serialized_data_len);
-        mnemonic_entropy_len = serialized_data_len;
-    } else if (serialized_data_len == SERIALIZED_KEY_LEN) {
-        // Deserialise keychain
-        keychain_t keydata = { 0 };
-        SENSITIVE_PUSH(&keydata, sizeof(keydata));
-        unserialize(serialized, serialized_data_len, &keydata);
-        keychain_set(&keydata, 0, false);
-        SENSITIVE_POP(&keydata);
-    } else {
-        JADE_LOGE("Unexpected length of decrypted serialised data: %d", serialized_data_len);
-        SENSITIVE_POP(serialized);
-        return false;
-    }
+    // 4. Hold the key to access the persisted wallets
+    memcpy(unlock_aeskey, aeskey, aes_len);
+    has_unlock_aeskey = true;
 
+    // 5. Cache mnemonic entropy or deserialise keychain - or load any other wallet slot selected for this unlock
+    const size_t slot = unlock_wallet_slot;
+    unlock_wallet_slot = 0;
+    const bool ret = slot ? load_wallet_slot(slot) : load_payload(serialized, serialized_data_len);
     SENSITIVE_POP(serialized);
-
-    return true;
+    if (!ret) {
+        keychain_clear();
+    }
+    return ret;
 }
 
 bool keychain_has_pin(void) { return has_encrypted_blob; }
@@ -580,10 +711,147 @@ uint8_t keychain_pin_attempts_remaining(void) { return storage_get_counter(); }
 void keychain_erase_encrypted(void)
 {
     storage_erase_encrypted_blob();
+
+    // The other wallet slots share the PIN, so are erased also
+    JADE_WALLY_VERIFY(wally_bzero(unlock_aeskey, sizeof(unlock_aeskey)));
+    has_unlock_aeskey = false;
+    if (wallet_slot) {
+        set_wallet_slot(0);
+    }
+    storage_erase_all_wallet_slots();
+
     keychain_clear_network_type_restriction();
     has_encrypted_blob = false;
 }
 
+bool keychain_wallet_slots_unlocked(void) { return has_unlock_aeskey && has_encrypted_blob; }
+
+size_t keychain_get_wallet_slot(void) { return wallet_slot; }
+
+void keychain_set_unlock_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot < NUM_WALLET_SLOTS);
+    unlock_wallet_slot = slot;
+}
+
+bool keychain_find_wallet_slot(const char* name, size_t* slot)
+{
+    JADE_ASSERT(name);
+    JADE_INIT_OUT_SIZE(slot);
+
+    if (!strcmp(name, KEYCHAIN_MAIN_WALLET_NAME)) {
+        *slot = 0;
+        return true;
+    }
+
+    for (size_t i = 1; i < NUM_WALLET_SLOTS; ++i) {
+        char slot_name[NVS_KEY_NAME_MAX_SIZE];
+        size_t written = 0;
+        if (storage_get_wallet_slot_name(i, slot_name, sizeof(slot_name), &written) && !strcmp(name, slot_name)) {
+            *slot = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool keychain_save_wallet_slot(const size_t slot, const char* name)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+    JADE_ASSERT(name);
+
+    if (!keychain_wallet_slots_unlocked() || !keychain_data) {
+        // No key to encrypt with, or no keychain data to store
+        return false;
+    }
+    if (!storage_key_name_valid(name) || !strcmp(name, KEYCHAIN_MAIN_WALLET_NAME)) {
+        JADE_LOGE("Invalid wallet name");
+        return false;
+    }
+
+    // If the keychain was derived with a passphrase we have cached mnemonic entropy, and we store that (so
+    // the passphrase is required to load the slot, as for the main wallet).  Otherwise we store the derived
+    // keychain, so loading the slot requires no pbkdf2.
+    uint8_t aeskey[AES_KEY_LEN_256];
+    uint8_t serialized[SERIALIZED_KEY_LEN];
+    uint8_t encrypted[ENCRYPTED_DATA_LEN(sizeof(serialized))];
+    SENSITIVE_PUSH(aeskey, sizeof(aeskey));
+    SENSITIVE_PUSH(serialized, sizeof(serialized));
+
+    size_t serialized_data_len;
+    if (mnemonic_entropy_len) {
+        JADE_ASSERT(mnemonic_entropy_len == BIP39_ENTROPY_LEN_128 || mnemonic_entropy_len == BIP39_ENTROPY_LEN_256);
+        memcpy(serialized, mnemonic_entropy, mnemonic_entropy_len);
+        serialized_data_len = mnemonic_entropy_len;
+    } else {
+        serialize(serialized, sizeof(serialized), keychain_data);
+        serialized_data_len = sizeof(serialized);
+    }
+
+    const size_t encrypted_data_len = ENCRYPTED_DATA_LEN(serialized_data_len);
+    get_wallet_slot_aeskey(slot, aeskey, sizeof(aeskey));
+    const bool ret
+        = get_encrypted_blob(aeskey, sizeof(aeskey), serialized, serialized_data_len, encrypted, encrypted_data_len)
+        && storage_set_wallet_slot(slot, name, encrypted, encrypted_data_len);
+    SENSITIVE_POP(serialized);
+    SENSITIVE_POP(aeskey);
+
+    if (!ret) {
+        JADE_LOGE("Failed to store key data for wallet slot %u", slot);
+        return false;
+    }
+
+    // The keychain is now that of the slot, and persisted
+    set_wallet_slot(slot);
+    keychain_temporary = false;
+    return true;
+}
+
+bool keychain_select_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot < NUM_WALLET_SLOTS);
+
+    if (!keychain_wallet_slots_unlocked()) {
+        return false;
+    }
+    keychain_clear_keys();
+
+    if (slot) {
+        return load_wallet_slot(slot);
+    }
+
+    // The main wallet - may be mnemonic entropy, requiring a passphrase to complete
+    uint8_t serialized[AES_PADDED_LEN(SERIALIZED_KEY_LEN)];
+    uint8_t encrypted[ENCRYPTED_DATA_LEN(SERIALIZED_KEY_LEN)];
+    SENSITIVE_PUSH(serialized, sizeof(serialized));
+
+    size_t encrypted_data_len = 0;
+    size_t serialized_data_len = 0;
+    const bool ret = storage_get_encrypted_blob(encrypted, sizeof(encrypted), &encrypted_data_len)
+        && get_decrypted_payload(unlock_aeskey, sizeof(unlock_aeskey), encrypted, encrypted_data_len, serialized,
+            sizeof(serialized), &serialized_data_len)
+        && load_payload(serialized, serialized_data_len);
+    SENSITIVE_POP(serialized);
+
+    if (!ret) {
+        JADE_LOGE("Failed to load main wallet");
+        return false;
+    }
+    set_wallet_slot(0);
+    return true;
+}
+
+bool keychain_erase_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+
+    if (slot == wallet_slot) {
+        JADE_LOGE("Cannot erase the active wallet slot");
+        return false;
+    }
+    return storage_erase_wallet_slot(slot);
+}
+
 bool keychain_get_new_privatekey(uint8_t* privatekey, const size_t size)
 {
     if (!privatekey || size != EC_PRIVATE_KEY_LEN) {
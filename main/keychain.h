@@ -24,6 +24,9 @@ bool keychain_init(void);
 void keychain_set(const keychain_t* src, uint8_t userdata, bool temporary);
 void keychain_clear(void);
 
+// Clear the in-memory keys, but retain access to any other persisted wallets (see below)
+void keychain_clear_keys(void);
+
 const keychain_t* keychain_get(void);
 bool keychain_requires_passphrase(void);
 
@@ -60,4 +63,26 @@ bool keychain_complete_derivation_with_passphrase(const char* passphrase);
 bool keychain_store_encrypted(const uint8_t* aeskey, size_t aes_len);
 bool keychain_load_cleartext(const uint8_t* aeskey, size_t aes_len);
 
+// Additional named wallets, persisted encrypted with keys derived from that of the main wallet - so
+// sharing its PIN, and accessible without further pinserver interaction once the main wallet is unlocked.
+// Slot 0 is the main wallet.  The others hold the derived keychain so can be loaded without any pbkdf2 - unless
+// added with a passphrase, in which case they hold the mnemonic entropy and require the passphrase when loaded.
+// Each wallet slot has its own multisig and otp records.
+#define KEYCHAIN_MAIN_WALLET_NAME "main"
+
+bool keychain_wallet_slots_unlocked(void);
+size_t keychain_get_wallet_slot(void);
+bool keychain_find_wallet_slot(const char* name, size_t* slot);
+
+// Select the wallet slot to load (in place of the main wallet) at the next keychain_load_cleartext()
+void keychain_set_unlock_wallet_slot(size_t slot);
+
+// Persist the current keychain (or any cached mnemonic entropy) into the given slot, and make that the active slot
+bool keychain_save_wallet_slot(size_t slot, const char* name);
+
+// Switch to the given wallet slot.  The current keys are cleared, even if loading the slot fails.
+// NOTE: a passphrase-protected wallet requires keychain_complete_derivation_with_passphrase().
+bool keychain_select_wallet_slot(size_t slot);
+bool keychain_erase_wallet_slot(size_t slot);
+
 #endif /* KEYCHAIN_H_ */
@@ -4,7 +4,9 @@
 #include "storage.h"
 #include "utils/malloc_ext.h"
 
+#include <freertos/FreeRTOS.h>
 #include <sodium/utils.h>
+#include <stdlib.h>
 #include <wally_script.h>
 
 // 0 - 0.1.30 - variant, threshold, signers, hmac
@@ -16,6 +18,39 @@ static const uint8_t CURRENT_RECORD_VERSION = 2;
 // version 1, 1of1  (moving to v1 predated allowing just 1 signer)
 #define MIN_MULTISIG_BYTES_LEN (4 + 78 + 32)
 
+// Cache of the most recently used registration's cosigner keys - each cosigner's parsed xpub and
+// its most recently used 'branch' keys (the signer path less the final element, eg. xpub/0 and
+// xpub/1), so a script's pubkeys cost one single-step derivation per cosigner.
+// Keyed by sha256 of the registration's xpubs.  Wiped by keychain_clear() and on registration changes.
+#define KEY_CACHE_BRANCHES_PER_SIGNER 2
+#define KEY_CACHE_MAX_BRANCH_PATH_LEN 4
+
+typedef struct {
+    uint32_t path[KEY_CACHE_MAX_BRANCH_PATH_LEN];
+    size_t path_len;
+    uint32_t last_used; // 0 implies slot unused
+    struct ext_key key;
+} branch_key_cache_entry_t;
+
+typedef struct {
+    bool has_xpub;
+    struct ext_key xpub;
+    branch_key_cache_entry_t branches[KEY_CACHE_BRANCHES_PER_SIGNER];
+} signer_key_cache_entry_t;
+
+typedef struct {
+    uint8_t id[SHA256_LEN];
+    size_t num_xpubs; // 0 implies cache empty
+    signer_key_cache_entry_t signers[MAX_MULTISIG_SIGNERS];
+} signer_key_cache_t;
+
+// NOTE: allocated on first use (by the main task) and not freed - only ever wiped
+static signer_key_cache_t* key_cache = NULL;
+static uint32_t key_cache_clock = 0;
+static uint32_t key_cache_hits = 0;
+static uint32_t key_cache_misses = 0;
+static portMUX_TYPE key_cache_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
 // Walks the multisig signers and validates - this wallet must have at least one xpub and it must be correct
 bool multisig_validate_signers(const char* network, const signer_t* signers, const size_t num_signers,
     const uint8_t* wallet_fingerprint, const size_t wallet_fingerprint_len)
@@ -295,6 +330,205 @@ bool multisig_validate_paths(
     return true;
 }
 
+// Must be called with the spinlock held
+static void key_cache_reset(const uint8_t* id, const size_t num_xpubs)
+{
+    JADE_ASSERT(key_cache);
+    JADE_ASSERT(id || !num_xpubs);
+
+    if (id) {
+        memcpy(key_cache->id, id, sizeof(key_cache->id));
+    } else {
+        memset(key_cache->id, 0, sizeof(key_cache->id));
+    }
+    key_cache->num_xpubs = num_xpubs;
+
+    for (size_t i = 0; i < MAX_MULTISIG_SIGNERS; ++i) {
+        signer_key_cache_entry_t* const signer = key_cache->signers + i;
+        signer->has_xpub = false;
+        for (size_t j = 0; j < KEY_CACHE_BRANCHES_PER_SIGNER; ++j) {
+            signer->branches[j].last_used = 0;
+        }
+    }
+}
+
+void multisig_clear_key_cache(void)
+{
+    taskENTER_CRITICAL(&key_cache_spinlock);
+    const uint32_t hits = key_cache_hits;
+    const uint32_t misses = key_cache_misses;
+    if (key_cache) {
+        key_cache_reset(NULL, 0);
+    }
+    key_cache_clock = 0;
+    key_cache_hits = 0;
+    key_cache_misses = 0;
+    taskEXIT_CRITICAL(&key_cache_spinlock);
+
+    if (hits || misses) {
+        JADE_LOGI("Multisig key cache cleared - hits: %lu, misses: %lu", hits, misses);
+    }
+}
+
+void multisig_get_key_cache_stats(uint32_t* hits, uint32_t* misses)
+{
+    JADE_ASSERT(hits);
+    JADE_ASSERT(misses);
+
+    taskENTER_CRITICAL(&key_cache_spinlock);
+    *hits = key_cache_hits;
+    *misses = key_cache_misses;
+    taskEXIT_CRITICAL(&key_cache_spinlock);
+}
+
+// Point the cache at the given registration's xpubs, returning its id
+static void key_cache_select(const uint8_t* xpubs, const size_t num_xpubs, uint8_t* id, const size_t id_len)
+{
+    JADE_ASSERT(xpubs);
+    JADE_ASSERT(num_xpubs && num_xpubs <= MAX_MULTISIG_SIGNERS);
+    JADE_ASSERT(id);
+    JADE_ASSERT(id_len == SHA256_LEN);
+
+    JADE_WALLY_VERIFY(wally_sha256(xpubs, num_xpubs * BIP32_SERIALIZED_LEN, id, id_len));
+
+    if (!key_cache) {
+        key_cache = JADE_CALLOC_PREFER_SPIRAM(1, sizeof(signer_key_cache_t));
+    }
+
+    taskENTER_CRITICAL(&key_cache_spinlock);
+    if (key_cache->num_xpubs != num_xpubs || memcmp(key_cache->id, id, id_len)) {
+        key_cache_reset(id, num_xpubs);
+    }
+    taskEXIT_CRITICAL(&key_cache_spinlock);
+}
+
+// Derive a cosigner's pubkey for the given (unhardened) path, from the cosigner's cached branch key
+// if present - otherwise derive that branch key from the (cached) parsed xpub, and cache it.
+static bool key_cache_derive_pubkey(const uint8_t* id, const uint8_t* xpubs, const size_t index,
+    const uint32_t* path, const size_t path_len, uint8_t* pubkey, const size_t pubkey_len)
+{
+    JADE_ASSERT(id);
+    JADE_ASSERT(xpubs);
+    JADE_ASSERT(index < MAX_MULTISIG_SIGNERS);
+    JADE_ASSERT(path);
+    JADE_ASSERT(path_len);
+    JADE_ASSERT(pubkey);
+    JADE_ASSERT(pubkey_len == EC_PUBLIC_KEY_LEN);
+
+    const uint8_t* xpub = xpubs + (index * BIP32_SERIALIZED_LEN);
+    const size_t branch_len = path_len - 1;
+    struct ext_key hdkey;
+
+    // Unusually long paths are derived in full, uncached
+    if (branch_len > KEY_CACHE_MAX_BRANCH_PATH_LEN) {
+        if (!wallet_derive_pubkey(xpub, BIP32_SERIALIZED_LEN, path, path_len, BIP32_FLAG_SKIP_HASH, &hdkey)) {
+            return false;
+        }
+        memcpy(pubkey, hdkey.pub_key, pubkey_len);
+        return true;
+    }
+
+    // Look for the branch key, or failing that the parsed xpub
+    struct ext_key branch;
+    bool has_branch = false;
+    bool has_xpub = false;
+
+    taskENTER_CRITICAL(&key_cache_spinlock);
+    signer_key_cache_entry_t* const signer = key_cache->signers + index;
+    const bool cache_valid = key_cache->num_xpubs > index && !memcmp(key_cache->id, id, sizeof(key_cache->id));
+    if (cache_valid) {
+        for (size_t i = 0; i < KEY_CACHE_BRANCHES_PER_SIGNER; ++i) {
+            branch_key_cache_entry_t* const slot = signer->branches + i;
+            if (slot->last_used && slot->path_len == branch_len
+                && !memcmp(slot->path, path, branch_len * sizeof(path[0]))) {
+                slot->last_used = ++key_cache_clock;
+                memcpy(&branch, &slot->key, sizeof(branch));
+                has_branch = true;
+                break;
+            }
+        }
+        if (!has_branch && signer->has_xpub) {
+            memcpy(&hdkey, &signer->xpub, sizeof(hdkey));
+            has_xpub = true;
+        }
+    }
+    if (has_branch) {
+        ++key_cache_hits;
+    } else {
+        ++key_cache_misses;
+    }
+    taskEXIT_CRITICAL(&key_cache_spinlock);
+
+    if (!has_branch) {
+        if (!has_xpub && !wallet_derive_pubkey(xpub, BIP32_SERIALIZED_LEN, NULL, 0, 0, &hdkey)) {
+            return false;
+        }
+        if (branch_len) {
+            JADE_WALLY_VERIFY(bip32_key_from_parent_path(
+                &hdkey, path, branch_len, BIP32_FLAG_KEY_PUBLIC | BIP32_FLAG_SKIP_HASH, &branch));
+        } else {
+            memcpy(&branch, &hdkey, sizeof(branch));
+        }
+
+        // Cache the xpub and the branch key (in the least recently used slot), unless the
+        // cache has been cleared or moved to another registration in the meantime
+        taskENTER_CRITICAL(&key_cache_spinlock);
+        if (key_cache->num_xpubs > index && !memcmp(key_cache->id, id, sizeof(key_cache->id))) {
+            if (!signer->has_xpub) {
+                memcpy(&signer->xpub, &hdkey, sizeof(signer->xpub));
+                signer->has_xpub = true;
+            }
+            branch_key_cache_entry_t* slot = signer->branches;
+            for (size_t i = 1; i < KEY_CACHE_BRANCHES_PER_SIGNER; ++i) {
+                if (signer->branches[i].last_used < slot->last_used) {
+                    slot = signer->branches + i;
+                }
+            }
+            memcpy(slot->path, path, branch_len * sizeof(path[0]));
+            slot->path_len = branch_len;
+            memcpy(&slot->key, &branch, sizeof(slot->key));
+            slot->last_used = ++key_cache_clock;
+        }
+        taskEXIT_CRITICAL(&key_cache_spinlock);
+    }
+
+    // Single-step derivation of the final path element
+    JADE_WALLY_VERIFY(bip32_key_from_parent(
+        &branch, path[branch_len], BIP32_FLAG_KEY_PUBLIC | BIP32_FLAG_SKIP_HASH, &hdkey));
+    memcpy(pubkey, hdkey.pub_key, pubkey_len);
+    return true;
+}
+
+// Derive all the cosigners' pubkeys for the same (unhardened) path
+bool multisig_get_pubkeys_for_path(const uint8_t* xpubs, const size_t num_xpubs, const uint32_t* path,
+    const size_t path_len, uint8_t* pubkeys, const size_t pubkeys_len)
+{
+    JADE_ASSERT(xpubs);
+    JADE_ASSERT(num_xpubs >= 1 && num_xpubs <= MAX_MULTISIG_SIGNERS);
+    JADE_ASSERT(path);
+    JADE_ASSERT(pubkeys);
+    JADE_ASSERT(pubkeys_len == num_xpubs * EC_PUBLIC_KEY_LEN);
+
+    if (!path_len) {
+        return false;
+    }
+    for (size_t j = 0; j < path_len; ++j) {
+        if (path[j] & BIP32_INITIAL_HARDENED_CHILD) {
+            return false;
+        }
+    }
+
+    uint8_t id[SHA256_LEN];
+    key_cache_select(xpubs, num_xpubs, id, sizeof(id));
+    for (size_t i = 0; i < num_xpubs; ++i) {
+        uint8_t* dest = pubkeys + (i * EC_PUBLIC_KEY_LEN);
+        if (!key_cache_derive_pubkey(id, xpubs, i, path, path_len, dest, EC_PUBLIC_KEY_LEN)) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool multisig_get_pubkeys(const uint8_t* xpubs, const size_t num_xpubs, CborValue* all_signer_paths, uint8_t* pubkeys,
     const size_t pubkeys_len, size_t* written)
 {
@@ -313,6 +547,9 @@ bool multisig_get_pubkeys(const uint8_t* xpubs, const size_t num_xpubs, CborValu
     uint32_t path[MAX_PATH_LEN];
     const size_t max_path_len = sizeof(path) / sizeof(path[0]);
 
+    uint8_t id[SHA256_LEN];
+    key_cache_select(xpubs, num_xpubs, id, sizeof(id));
+
     CborValue arrayItem;
     CborError cberr = cbor_value_enter_container(all_signer_paths, &arrayItem);
     JADE_ASSERT(cberr == CborNoError);
@@ -329,14 +566,10 @@ bool multisig_get_pubkeys(const uint8_t* xpubs, const size_t num_xpubs, CborValu
             }
         }
 
-        struct ext_key hdkey;
-        const uint8_t* xpub = xpubs + (i * BIP32_SERIALIZED_LEN);
-        if (!wallet_derive_pubkey(xpub, BIP32_SERIALIZED_LEN, path, path_len, BIP32_FLAG_SKIP_HASH, &hdkey)) {
+        uint8_t* dest = pubkeys + (i * EC_PUBLIC_KEY_LEN);
+        if (!key_cache_derive_pubkey(id, xpubs, i, path, path_len, dest, EC_PUBLIC_KEY_LEN)) {
             return false;
         }
-
-        uint8_t* dest = pubkeys + (i * EC_PUBLIC_KEY_LEN);
-        memcpy(dest, hdkey.pub_key, EC_PUBLIC_KEY_LEN);
     }
     *written = num_xpubs * EC_PUBLIC_KEY_LEN;
 
@@ -371,36 +604,87 @@ static inline bool variant_matches_script_type(const script_variant_t variant, c
         || (*script_type == WALLY_SCRIPT_TYPE_P2SH && (variant == MULTI_P2SH || variant == MULTI_P2WSH_P2SH));
 }
 
-// Get the registered multisig record names
-// Filtered to those valid for this signer, and optionally for the given script type
-void multisig_get_valid_record_names(
-    const size_t* script_type, char names[][NVS_KEY_NAME_MAX_SIZE], const size_t num_names, size_t* num_written)
+// Search the registrations from index 'start' in the given direction for the first record valid for this signer,
+// and optionally for the given script type.  Does not wrap - returns false if there is no such record.
+bool multisig_find_valid_record(const size_t* script_type, const size_t start, const bool forward, size_t* index,
+    char* name, const size_t name_len)
 {
     // script_type filter is optional
-    JADE_ASSERT(names);
-    JADE_ASSERT(num_names);
-    JADE_INIT_OUT_SIZE(num_written);
-
-    // Get registered multisig names
-    size_t num_multisigs = 0;
-    if (!storage_get_all_multisig_registration_names(names, num_names, &num_multisigs) || !num_multisigs) {
-        // No registered multisig records
-        return;
-    }
+    JADE_INIT_OUT_SIZE(index);
+    JADE_ASSERT(name);
+    JADE_ASSERT(name_len >= NVS_KEY_NAME_MAX_SIZE);
+
+    // The index is read a page at a time, as the search moves onto each page
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    size_t num_entries = 0;
+    size_t page = SIZE_MAX;
+
+    // NOTE: searching backwards past zero wraps 'i' to SIZE_MAX, which terminates the loop
+    const size_t count = storage_get_multisig_registration_count();
+    for (size_t i = start; i < count; forward ? ++i : --i) {
+        if (i / MULTISIG_INDEX_PAGE_SIZE != page) {
+            page = i / MULTISIG_INDEX_PAGE_SIZE;
+            if (!storage_get_multisig_index_page(page, entries, MULTISIG_INDEX_PAGE_SIZE, &num_entries)) {
+                return false;
+            }
+        }
+        if (i % MULTISIG_INDEX_PAGE_SIZE >= num_entries) {
+            return false;
+        }
+        const multisig_index_entry_t* const entry = entries + (i % MULTISIG_INDEX_PAGE_SIZE);
 
-    // Load description of each - remove ones that are not valid for this wallet or passed script type
-    size_t written = 0;
-    for (int i = 0; i < num_multisigs; ++i) {
         const char* errmsg = NULL;
         multisig_data_t multisig_data;
-        if (multisig_load_from_storage(names[i], &multisig_data, &errmsg)
+        if (multisig_load_from_storage(entry->name, &multisig_data, &errmsg)
             && variant_matches_script_type(multisig_data.variant, script_type)) {
-            // If any previous records were not valid, move subsequent valid record names down
-            if (written != i) {
-                strcpy(names[written], names[i]);
-            }
-            ++written;
+            strcpy(name, entry->name);
+            *index = i;
+            return true;
         }
     }
-    *num_written = written;
+    return false;
+}
+
+static int fingerprint_cmp(const void* lhs, const void* rhs) { return memcmp(lhs, rhs, BIP32_KEY_FINGERPRINT_LEN); }
+
+// The 'policy fingerprint' indexes registrations by the (unordered) set of signer root key fingerprints, being
+// the leading bytes of the sha256 of those fingerprints sorted.  It can be computed both from the signers at
+// registration and from the keypaths of a psbt output, so candidate records can be found without loading every
+// record.  It is only a lookup hint - it is not authenticated, and any record found must still be fully verified.
+// NOTE: sorts the passed fingerprints in place.  All-zero is reserved to mean 'unknown'.
+void multisig_get_policy_fingerprint(uint8_t* fingerprints, const size_t num_fingerprints,
+    uint8_t* policy_fingerprint, const size_t policy_fingerprint_len)
+{
+    JADE_ASSERT(fingerprints);
+    JADE_ASSERT(num_fingerprints);
+    JADE_ASSERT(policy_fingerprint);
+    JADE_ASSERT(policy_fingerprint_len == MULTISIG_POLICY_FINGERPRINT_LEN);
+
+    qsort(fingerprints, num_fingerprints, BIP32_KEY_FINGERPRINT_LEN, fingerprint_cmp);
+
+    uint8_t hash[SHA256_LEN];
+    JADE_WALLY_VERIFY(wally_sha256(fingerprints, num_fingerprints * BIP32_KEY_FINGERPRINT_LEN, hash, sizeof(hash)));
+    memcpy(policy_fingerprint, hash, policy_fingerprint_len);
+
+    bool all_zero = true;
+    for (size_t i = 0; i < policy_fingerprint_len; ++i) {
+        all_zero &= !policy_fingerprint[i];
+    }
+    if (all_zero) {
+        policy_fingerprint[0] = 0x01;
+    }
+}
+
+void multisig_get_signers_policy_fingerprint(const signer_t* signers, const size_t num_signers,
+    uint8_t* policy_fingerprint, const size_t policy_fingerprint_len)
+{
+    JADE_ASSERT(signers);
+    JADE_ASSERT(num_signers);
+    JADE_ASSERT(num_signers <= MAX_MULTISIG_SIGNERS);
+
+    uint8_t fingerprints[MAX_MULTISIG_SIGNERS * BIP32_KEY_FINGERPRINT_LEN];
+    for (size_t i = 0; i < num_signers; ++i) {
+        memcpy(fingerprints + (i * BIP32_KEY_FINGERPRINT_LEN), signers[i].fingerprint, BIP32_KEY_FINGERPRINT_LEN);
+    }
+    multisig_get_policy_fingerprint(fingerprints, num_signers, policy_fingerprint, policy_fingerprint_len);
 }
@@ -9,9 +9,6 @@
 // The length of a multisig wallet name (see also storage key name size limit)
 #define MAX_MULTISIG_NAME_SIZE 16
 
-// The maximum number of concurrent multisig registrations supported
-#define MAX_MULTISIG_REGISTRATIONS 16
-
 // The expected size of a liquid master blinding key
 #define MULTISIG_MASTER_BLINDING_KEY_SIZE (HMAC_SHA512_LEN / 2)
 
@@ -76,10 +73,23 @@ bool multisig_validate_paths(
 bool multisig_get_pubkeys(const uint8_t* xpubs, size_t num_xpubs, CborValue* all_signer_paths, uint8_t* pubkeys,
     size_t pubkeys_len, size_t* written);
 
+bool multisig_get_pubkeys_for_path(const uint8_t* xpubs, size_t num_xpubs, const uint32_t* path, size_t path_len,
+    uint8_t* pubkeys, size_t pubkeys_len);
+
+// Cosigner xpub/branch keys are cached for the most recently used registration
+void multisig_clear_key_cache(void);
+void multisig_get_key_cache_stats(uint32_t* hits, uint32_t* misses);
+
 bool multisig_get_master_blinding_key(const multisig_data_t* multisig_data, uint8_t* master_blinding_key,
     size_t master_blinding_key_len, const char** errmsg);
 
-void multisig_get_valid_record_names(
-    const size_t* script_type, char names[][MAX_MULTISIG_NAME_SIZE], size_t num_names, size_t* num_written);
+void multisig_get_policy_fingerprint(
+    uint8_t* fingerprints, size_t num_fingerprints, uint8_t* policy_fingerprint, size_t policy_fingerprint_len);
+
+void multisig_get_signers_policy_fingerprint(
+    const signer_t* signers, size_t num_signers, uint8_t* policy_fingerprint, size_t policy_fingerprint_len);
+
+bool multisig_find_valid_record(
+    const size_t* script_type, size_t start, bool forward, size_t* index, char* name, size_t name_len);
 
 #endif /* MULTISIG_H_ */
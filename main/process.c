@@ -17,6 +17,7 @@
 
 #include <ctype.h>
 #include <stdlib.h>
+#include <string.h>
 
 static RingbufHandle_t shared_in = NULL;
 
@@ -38,6 +39,20 @@ static TaskHandle_t qemu_tcp_handle;
 
 static char jade_id[16];
 
+// Any larger reply size negotiated per message source (zero implies MAX_OUTPUT_MSG_SIZE)
+static size_t negotiated_reply_size[SOURCE_BLE + 1];
+
+// Each output ring buffer item starts with a type byte - the message either follows inline, or is a
+// reference to a heap copy.  Output messages larger than the ring buffer's max item size (ie. negotiated
+// larger replies) are queued by reference, so they are still written in order with all other outbound
+// messages (eg. logging).
+typedef enum { OUT_ITEM_INLINE, OUT_ITEM_LARGE } out_item_type_t;
+
+typedef struct {
+    uint8_t* data;
+    size_t size;
+} large_out_msg_t;
+
 #ifdef CONFIG_HEAP_TRACING
 
 #include <esp_heap_trace.h>
@@ -263,6 +278,79 @@ bool jade_process_push_in_message(const uint8_t* data, const size_t size)
     return true;
 }
 
+// Get the message held inline in, or referenced by, an output ring buffer item
+static void get_out_item_message(const void* item, const size_t item_size, const uint8_t** msg, size_t* msg_size)
+{
+    JADE_ASSERT(item);
+    JADE_ASSERT(item_size);
+    JADE_INIT_OUT_PPTR(msg);
+    JADE_INIT_OUT_SIZE(msg_size);
+
+    const uint8_t* const bytes = (const uint8_t*)item;
+    if (bytes[0] == OUT_ITEM_LARGE) {
+        JADE_ASSERT(item_size == 1 + sizeof(large_out_msg_t));
+        large_out_msg_t large_msg;
+        memcpy(&large_msg, bytes + 1, sizeof(large_msg));
+        *msg = large_msg.data;
+        *msg_size = large_msg.size;
+    } else {
+        JADE_ASSERT(bytes[0] == OUT_ITEM_INLINE);
+        *msg = bytes + 1;
+        *msg_size = item_size - 1;
+    }
+}
+
+// Return an output item to its ring buffer, freeing any large message it references
+static void release_out_item(RingbufHandle_t ring, void* item, const size_t item_size)
+{
+    if (!item) {
+        return;
+    }
+
+    if (*(const uint8_t*)item == OUT_ITEM_LARGE) {
+        const uint8_t* msg = NULL;
+        size_t msg_size = 0;
+        get_out_item_message(item, item_size, &msg, &msg_size);
+        free((void*)msg);
+    }
+    vRingbufferReturnItem(ring, item);
+}
+
+size_t jade_process_get_max_reply_size(const jade_msg_source_t source)
+{
+    JADE_ASSERT(source < sizeof(negotiated_reply_size) / sizeof(negotiated_reply_size[0]));
+    return negotiated_reply_size[source] ? negotiated_reply_size[source] : MAX_OUTPUT_MSG_SIZE;
+}
+
+// Negotiate a larger maximum reply size for a message source - returns the size granted.
+// Large replies are built in one buffer and copied to another when queued, so any grant is
+// limited to a quarter of the largest free SPIRAM block - so no grant without SPIRAM.
+// QR mode replies are bc-ur encoded and fragmented, so are never granted a larger size.
+size_t jade_process_negotiate_max_reply_size(const jade_msg_source_t source, const size_t requested)
+{
+    JADE_ASSERT(source < sizeof(negotiated_reply_size) / sizeof(negotiated_reply_size[0]));
+
+    size_t granted = MAX_OUTPUT_MSG_SIZE;
+    if (source != SOURCE_QR && requested > granted) {
+        const size_t spiram_limit
+            = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT | MALLOC_CAP_SPIRAM) / 4;
+        granted = requested < MAX_NEGOTIATED_OUTPUT_MSG_SIZE ? requested : MAX_NEGOTIATED_OUTPUT_MSG_SIZE;
+        granted = granted < spiram_limit ? granted : spiram_limit;
+        granted = granted > MAX_OUTPUT_MSG_SIZE ? granted : MAX_OUTPUT_MSG_SIZE;
+    }
+
+    JADE_LOGI("Max reply size for source %u: requested %u, granted %u", source, requested, granted);
+    negotiated_reply_size[source] = granted;
+    return granted;
+}
+
+// Revert all message sources to the default maximum reply size (eg. on logout)
+void jade_process_reset_max_reply_sizes(void)
+{
+    JADE_LOGI("Resetting max reply sizes");
+    memset(negotiated_reply_size, 0, sizeof(negotiated_reply_size));
+}
+
 void jade_process_push_out_message(const uint8_t* data, const size_t size, const jade_msg_source_t source)
 {
 #if defined(CONFIG_FREERTOS_UNICORE) && defined(CONFIG_ETH_USE_OPENETH)
@@ -301,12 +389,29 @@ void jade_process_push_out_message(const uint8_t* data, const size_t size, const
 
     JADE_ASSERT(ring);
 
-    // Output message too large - internal/logic error - abort
-    if (size > xRingbufferGetMaxItemSize(ring)) {
-        JADE_LOGE("Message of size %u too large for output queue (max: %u)", size, xRingbufferGetMaxItemSize(ring));
-        JADE_ABORT();
+    uint8_t type = OUT_ITEM_INLINE;
+    const uint8_t* payload = data;
+    size_t payload_size = size;
+    large_out_msg_t large_msg;
+    if (1 + size > xRingbufferGetMaxItemSize(ring)) {
+        // Output message too large - internal/logic error - abort
+        if (size > jade_process_get_max_reply_size(source)) {
+            JADE_LOGE("Message of size %u too large for output queue (max: %u)", size,
+                jade_process_get_max_reply_size(source));
+            JADE_ABORT();
+        }
+
+        // Negotiated large reply - queue a reference to a copy of the message
+        large_msg.data = JADE_MALLOC_PREFER_SPIRAM(size);
+        large_msg.size = size;
+        memcpy(large_msg.data, data, size);
+        type = OUT_ITEM_LARGE;
+        payload = (const uint8_t*)&large_msg;
+        payload_size = sizeof(large_msg);
     }
-    while (xRingbufferSend(ring, data, size, 10 / portTICK_PERIOD_MS) != pdTRUE) {
+
+    void* item = NULL;
+    while (xRingbufferSendAcquire(ring, &item, 1 + payload_size, 10 / portTICK_PERIOD_MS) != pdTRUE) {
 
         // If the ring buffer is full and the sink process (handle) is not yet running
         // discard an item from the buffer to make space
@@ -314,11 +419,17 @@ void jade_process_push_out_message(const uint8_t* data, const size_t size, const
         // still be null
         if (!handle) {
             size_t sz;
-            void* item = xRingbufferReceive(ring, &sz, 0);
-            vRingbufferReturnItem(ring, item);
+            void* discard = xRingbufferReceive(ring, &sz, 0);
+            release_out_item(ring, discard, sz);
         }
     }
 
+    uint8_t* const item_bytes = (uint8_t*)item;
+    item_bytes[0] = type;
+    memcpy(item_bytes + 1, payload, payload_size);
+    const BaseType_t ret = xRingbufferSendComplete(ring, item);
+    JADE_ASSERT(ret == pdTRUE);
+
     if (handle) {
         xTaskNotify(handle, 0, eNoAction);
     }
@@ -454,9 +565,12 @@ bool jade_process_get_out_message(outbound_message_writer_fn_t writer, const jad
 
     bool res = true; // default for simple discard
     if (writer) {
-        res = writer((const uint8_t*)item, item_size, ctx);
+        const uint8_t* msg = NULL;
+        size_t msg_size = 0;
+        get_out_item_message(item, item_size, &msg, &msg_size);
+        res = writer(msg, msg_size, ctx);
     }
-    vRingbufferReturnItem(ring, item);
+    release_out_item(ring, item, item_size);
 
     // FIXME: currently false signals that there isn't anything on the buffer
     // to process but this is not distinguished from a failure to write.
@@ -32,6 +32,11 @@
 #define MAX_OUTPUT_MSG_SIZE (MAX_STANDARD_OUTPUT_MSG_SIZE * 30)
 #endif
 
+// The largest reply size a host can negotiate (see 'set_max_reply_size'), so that large
+// results (eg. signed psbts) need fewer 'get_extended_data' round-trips.
+// NOTE: any grant is also bounded by free SPIRAM, and never exceeds MAX_OUTPUT_MSG_SIZE without it.
+#define MAX_NEGOTIATED_OUTPUT_MSG_SIZE (1024 * 256)
+
 // Cbor encoding function prototype
 typedef void (*cbor_encoder_fn_t)(const void*, CborEncoder*);
 
@@ -86,6 +91,11 @@ void jade_process_free_current_message(jade_process_t* process);
 bool jade_process_push_in_message(const uint8_t* data, size_t size);
 void jade_process_push_out_message(const uint8_t* data, size_t length, jade_msg_source_t source);
 
+// The maximum reply size for the given message source - MAX_OUTPUT_MSG_SIZE unless a larger size negotiated
+size_t jade_process_get_max_reply_size(jade_msg_source_t source);
+size_t jade_process_negotiate_max_reply_size(jade_msg_source_t source, size_t requested);
+void jade_process_reset_max_reply_sizes(void);
+
 // Send message replies
 void jade_process_reply_to_message_result_with_id(const char* id, uint8_t* output, size_t output_size,
     jade_msg_source_t source, const void* cbctx, cbor_encoder_fn_t cb);
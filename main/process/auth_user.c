@@ -75,7 +75,7 @@ void check_pin_load_keys(jade_process_t* process)
     uint8_t pin[sizeof(pin_insert.pin)];
     memcpy(pin, pin_insert.pin, sizeof(pin));
 #else
-    vTaskDelay(CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+    vTaskDelay(gui_unattended_ci_timeout());
     uint8_t pin[] = { 0, 1, 2, 3, 4, 5 };
 #endif
     SENSITIVE_PUSH(pin, sizeof(pin));
@@ -168,7 +168,7 @@ static void set_pin_save_keys(jade_process_t* process)
 #else
         const uint8_t testpin[sizeof(pin_insert.pin)] = { 0, 1, 2, 3, 4, 5 };
 
-        vTaskDelay(CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        vTaskDelay(gui_unattended_ci_timeout());
         memcpy(pin_insert.pin, testpin, sizeof(testpin));
 #endif
 
@@ -181,7 +181,7 @@ static void set_pin_save_keys(jade_process_t* process)
 #ifndef CONFIG_DEBUG_UNATTENDED_CI
         run_pin_entry_loop(&pin_insert);
 #else
-        vTaskDelay(CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        vTaskDelay(gui_unattended_ci_timeout());
         memcpy(pin_insert.pin, testpin, sizeof(testpin));
 #endif
 
@@ -264,6 +264,20 @@ void auth_user_process(void* process_ptr)
         }
     }
 
+    // Can optionally name the wallet to unlock - otherwise the main wallet is used
+    const bool has_wallet_param = rpc_has_field_data("wallet", &params);
+    size_t wallet_slot = 0;
+    if (has_wallet_param) {
+        char wallet[NVS_KEY_NAME_MAX_SIZE];
+        rpc_get_string("wallet", sizeof(wallet), &params, wallet, &written);
+        if (!written || !keychain_find_wallet_slot(wallet, &wallet_slot)
+            || (wallet_slot && (keychain_has_temporary() || !keychain_has_pin()))) {
+            jade_process_reject_message(
+                process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract valid wallet name from parameters", NULL);
+            goto cleanup;
+        }
+    }
+
     // We have five cases:
     // 1. Temporary - has a temporary keys in memory
     //    - nothing to do here, just return ok  (having checked message source)
@@ -298,7 +312,9 @@ void auth_user_process(void* process_ptr)
         }
     } else if (keychain_has_pin()) {
         // Jade is initialised with persisted wallet - if required use PIN to unlock
-        if (KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process)) {
+        // (Also if a different wallet is named than that currently loaded.)
+        if (KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process)
+            && (!has_wallet_param || wallet_slot == keychain_get_wallet_slot())) {
             JADE_LOGI("keychain already unlocked by this message-source");
             jade_process_reply_to_message_ok(process);
         } else {
@@ -306,6 +322,7 @@ void auth_user_process(void* process_ptr)
             if (keychain_get()) {
                 keychain_clear();
             }
+            keychain_set_unlock_wallet_slot(wallet_slot);
             check_pin_load_keys(process);
         }
     } else {
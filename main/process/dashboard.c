@@ -4,6 +4,7 @@
 
 #include "../bcur.h"
 #include "../button_events.h"
+#include "../camera.h"
 #include "../display.h"
 #include "../input.h"
 #include "../jade_assert.h"
@@ -17,6 +18,8 @@
 #include "../random.h"
 #include "../selfcheck.h"
 #include "../sensitive.h"
+#include "../sha_engine.h"
+#include "../stack_usage.h"
 #include "../storage.h"
 #include "../ui.h"
 #include "../utils/cbor_rpc.h"
@@ -35,6 +38,8 @@ static inline bool ble_connected(void) { return false; }
 static inline void ble_start(void) { JADE_ASSERT(false); }
 #endif
 #include "process/ota_defines.h"
+#include "process/ota_filter.h"
+#include "process/ota_util.h"
 #include "process_utils.h"
 
 #include <esp_chip_info.h>
@@ -44,6 +49,11 @@ static inline void ble_start(void) { JADE_ASSERT(false); }
 
 // Whether during initialisation we select USB, BLE QR etc.
 static jade_msg_source_t initialisation_source = SOURCE_NONE;
+
+// The source of the last message dispatched, and whether the keychain was then unlocked
+static jade_msg_source_t last_message_source = SOURCE_NONE;
+static bool last_message_unlocked = false;
+
 static bool show_connect_screen = false;
 
 // The device name and running firmware info, loaded at startup
@@ -62,6 +72,7 @@ void get_identity_shared_key_process(void* process_ptr);
 void sign_identity_process(void* process_ptr);
 void sign_message_process(void* process_ptr);
 void sign_psbt_process(void* process_ptr);
+void sign_psbts_process(void* process_ptr);
 void sign_tx_process(void* process_ptr);
 void get_master_blinding_key_process(void* process_ptr);
 void get_blinding_key_process(void* process_ptr);
@@ -75,11 +86,17 @@ void debug_scan_qr_process(void* process_ptr);
 void debug_set_mnemonic_process(void* process_ptr);
 void debug_clean_reset_process(void* process_ptr);
 void debug_handshake(void* process_ptr);
+void debug_iram_benchmark_process(void* process_ptr);
 #endif
 void ota_process(void* process_ptr);
 void ota_delta_process(void* process_ptr);
+void ota_resume_process(void* process_ptr);
 void update_pinserver_process(void* process_ptr);
 void auth_user_process(void* process_ptr);
+void get_wallets_process(void* process_ptr);
+void select_wallet_process(void* process_ptr);
+void add_wallet_process(void* process_ptr);
+void erase_wallet_process(void* process_ptr);
 
 // GUI screens
 void make_setup_screen(gui_activity_t** activity_ptr, const char* device_name, const char* firmware_version);
@@ -166,9 +183,9 @@ static void reply_version_info(const void* ctx, CborEncoder* container)
     JADE_ASSERT(container);
 
 #ifdef CONFIG_DEBUG_MODE
-    const uint8_t num_version_fields = 19;
+    const uint8_t num_version_fields = 20;
 #else
-    const uint8_t num_version_fields = 12;
+    const uint8_t num_version_fields = 13;
 #endif
 
     CborEncoder map_encoder;
@@ -178,6 +195,9 @@ static void reply_version_info(const void* ctx, CborEncoder* container)
     add_string_to_map(&map_encoder, "JADE_VERSION", running_app_info.version);
     add_uint_to_map(&map_encoder, "JADE_OTA_MAX_CHUNK", JADE_OTA_BUF_SIZE);
 
+    // Filters which can be applied to ota delta patches - see ota_filter.h
+    add_string_to_map(&map_encoder, "JADE_OTA_DELTA_FILTERS", OTA_FILTER_NAME);
+
     // Config - eg. ble/radio enabled in build, or not
     // defined in ota.h
     add_string_to_map(&map_encoder, "JADE_CONFIG", JADE_OTA_CONFIG);
@@ -310,11 +330,75 @@ cleanup:
     return;
 }
 
+// Negotiate a larger maximum reply size for this message source, and reply with the size granted
+static void process_set_max_reply_size_request(jade_process_t* process)
+{
+    ASSERT_CURRENT_MESSAGE(process, "set_max_reply_size");
+    GET_MSG_PARAMS(process);
+
+    size_t requested = 0;
+    if (!rpc_get_sizet("max_reply_size", &params, &requested)) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract valid reply size", NULL);
+        goto cleanup;
+    }
+
+    const uint64_t granted = jade_process_negotiate_max_reply_size(process->ctx.source, requested);
+    jade_process_reply_to_message_result(process->ctx, &granted, cbor_result_uint64_cb);
+
+cleanup:
+    return;
+}
+
+#ifdef CONFIG_DEBUG_UNATTENDED_CI
+// Enable/disable 'fast ui' - auto-confirming activities immediately rather than after the ci delay
+static void process_debug_set_fast_ui_request(jade_process_t* process)
+{
+    ASSERT_CURRENT_MESSAGE(process, "debug_set_fast_ui");
+    GET_MSG_PARAMS(process);
+
+    bool enabled = false;
+    if (!rpc_get_boolean("enabled", &params, &enabled)) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract valid parameters", NULL);
+        goto cleanup;
+    }
+
+    gui_set_fast_ui(enabled);
+    jade_process_reply_to_message_ok(process);
+
+cleanup:
+    return;
+}
+#endif // CONFIG_DEBUG_UNATTENDED_CI
+
+#ifdef CONFIG_DEBUG_MODE
+// Start/stop a competing hash load on the secondary core (to benchmark signing under contention)
+static void process_debug_set_sha_load_request(jade_process_t* process)
+{
+    ASSERT_CURRENT_MESSAGE(process, "debug_set_sha_load");
+    GET_MSG_PARAMS(process);
+
+    bool enabled = false;
+    if (!rpc_get_boolean("enabled", &params, &enabled)) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract valid parameters", NULL);
+        goto cleanup;
+    }
+
+    sha_engine_set_test_load(enabled);
+    jade_process_reply_to_message_ok(process);
+
+cleanup:
+    return;
+}
+#endif // CONFIG_DEBUG_MODE
+
 // Logout of jade hww, clear all key material
 static void process_logout_request(jade_process_t* process)
 {
     ASSERT_CURRENT_MESSAGE(process, "logout");
     keychain_clear();
+
+    // Any larger reply sizes were negotiated for the logged-in session only
+    jade_process_reset_max_reply_sizes();
     jade_process_reply_to_message_ok(process);
 }
 
@@ -333,8 +417,28 @@ static void dispatch_message(jade_process_t* process)
     rpc_get_method(&process->ctx.value, &method, &method_len);
     JADE_ASSERT(method_len != 0);
 
+#ifdef CONFIG_DEBUG_MODE
+    // Measure the stack used handling each message
+    stack_usage_begin(method, method_len);
+#endif
+
     TaskFunction_t task_function = NULL;
 
+    // A message from a different source implies a new host connection (eg. serial, which has no connect
+    // event) - so any larger reply size negotiated on that source by an earlier host no longer applies.
+    if (process->ctx.source != last_message_source) {
+        jade_process_negotiate_max_reply_size(process->ctx.source, 0);
+        last_message_source = process->ctx.source;
+    }
+
+    // Likewise if the session ended since the last message (eg. idle timeout) - but not merely because the
+    // keys were briefly cleared (eg. switching wallet slot).
+    const bool unlocked = keychain_get() != NULL;
+    if (last_message_unlocked && !unlocked) {
+        jade_process_reset_max_reply_sizes();
+    }
+    last_message_unlocked = unlocked;
+
     JADE_LOGD("dashboard dispatching message method='%.*s'", method_len, method);
 
     // Methods available before user is authorised
@@ -347,6 +451,9 @@ static void dispatch_message(jade_process_t* process)
     } else if (IS_METHOD("set_epoch")) {
         JADE_LOGD("Received set-epoch message");
         process_set_epoch_request(process);
+    } else if (IS_METHOD("set_max_reply_size")) {
+        JADE_LOGD("Received set-max-reply-size message");
+        process_set_max_reply_size_request(process);
     } else if (IS_METHOD("logout")) {
         JADE_LOGD("Received logout message");
         process_logout_request(process);
@@ -383,6 +490,22 @@ static void dispatch_message(jade_process_t* process)
             jade_process_reject_message(
                 process, CBOR_RPC_HW_LOCKED, "OTA delta is only allowed on new or logged-in device.", NULL);
         }
+    } else if (IS_METHOD("get_ota_checkpoint") || IS_METHOD("ota_resume")) {
+        // Resuming an interrupted OTA upload is subject to the same conditions as starting one
+        if ((KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process) && !keychain_has_temporary()) || !keychain_has_pin()) {
+            if (IS_METHOD("ota_resume")) {
+                task_function = ota_resume_process;
+            } else {
+                ota_checkpoint_t checkpoint;
+                const bool have_checkpoint = ota_checkpoint_load(&checkpoint);
+                jade_process_reply_to_message_result(
+                    process->ctx, have_checkpoint ? &checkpoint : NULL, ota_checkpoint_encode);
+            }
+        } else {
+            // Reject the message as hw locked
+            jade_process_reject_message(
+                process, CBOR_RPC_HW_LOCKED, "OTA resume is only allowed on new or logged-in device.", NULL);
+        }
 #ifdef CONFIG_DEBUG_MODE
     } else if (IS_METHOD("debug_selfcheck")) {
         // Time test run and return to caller
@@ -402,6 +525,18 @@ static void dispatch_message(jade_process_t* process)
         task_function = debug_handshake;
     } else if (IS_METHOD("debug_scan_qr")) {
         task_function = debug_scan_qr_process;
+    } else if (IS_METHOD("debug_iram_benchmark")) {
+        task_function = debug_iram_benchmark_process;
+    } else if (IS_METHOD("debug_get_stack_usage")) {
+        jade_process_reply_to_message_result(process->ctx, NULL, stack_usage_encode);
+    } else if (IS_METHOD("debug_get_signing_latency")) {
+        jade_process_reply_to_message_result(process->ctx, NULL, signing_latency_encode);
+    } else if (IS_METHOD("debug_set_sha_load")) {
+        process_debug_set_sha_load_request(process);
+#ifdef CONFIG_DEBUG_UNATTENDED_CI
+    } else if (IS_METHOD("debug_set_fast_ui")) {
+        process_debug_set_fast_ui_request(process);
+#endif // CONFIG_DEBUG_UNATTENDED_CI
 #ifdef CONFIG_RETURN_CAMERA_IMAGES
     } else if (IS_METHOD("debug_capture_image_data")) {
         task_function = debug_capture_image_data_process;
@@ -413,6 +548,21 @@ static void dispatch_message(jade_process_t* process)
             // Reject the message as hw locked
             jade_process_reject_message(
                 process, CBOR_RPC_HW_LOCKED, "Cannot process message - hardware locked or uninitialized", NULL);
+        } else if (IS_METHOD("get_wallets") || IS_METHOD("select_wallet") || IS_METHOD("add_wallet")
+            || IS_METHOD("erase_wallet")) {
+            // Managing the wallet slots requires the persisted wallet to have been unlocked with the PIN
+            if (keychain_has_temporary() || !keychain_wallet_slots_unlocked()) {
+                jade_process_reject_message(
+                    process, CBOR_RPC_HW_LOCKED, "Wallets are only available when unlocked with the PIN", NULL);
+            } else if (IS_METHOD("get_wallets")) {
+                task_function = get_wallets_process;
+            } else if (IS_METHOD("select_wallet")) {
+                task_function = select_wallet_process;
+            } else if (IS_METHOD("add_wallet")) {
+                task_function = add_wallet_process;
+            } else {
+                task_function = erase_wallet_process;
+            }
         } else if (IS_METHOD("register_otp")) {
             task_function = register_otp_process;
         } else if (IS_METHOD("get_otp_code")) {
@@ -435,6 +585,8 @@ static void dispatch_message(jade_process_t* process)
             task_function = sign_message_process;
         } else if (IS_METHOD("sign_psbt")) {
             task_function = sign_psbt_process;
+        } else if (IS_METHOD("sign_psbts")) {
+            task_function = sign_psbts_process;
         } else if (IS_METHOD("sign_tx")) {
             task_function = sign_tx_process;
         } else if (IS_METHOD("sign_liquid_tx")) {
@@ -480,6 +632,10 @@ static void dispatch_message(jade_process_t* process)
             initialisation_source = SOURCE_NONE;
         }
     }
+
+#ifdef CONFIG_DEBUG_MODE
+    stack_usage_end();
+#endif
 }
 
 // Function to get user confirmation, then erase all flash memory.
@@ -592,7 +748,7 @@ static void select_initial_connection(const bool temporary_restore)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_CONNECT_VIA_USB;
 #endif
@@ -733,20 +889,30 @@ static void handle_ble(void) { await_message_activity("BLE disabled in this firm
 
 static void handle_multisigs(void)
 {
-    char names[MAX_MULTISIG_REGISTRATIONS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
-    const size_t num_names = sizeof(names) / sizeof(names[0]);
-    size_t num_multisigs = 0;
-    bool ok = storage_get_all_multisig_registration_names(names, num_names, &num_multisigs);
-    JADE_ASSERT(ok);
-
+    size_t num_multisigs = storage_get_multisig_registration_count();
     if (num_multisigs == 0) {
         await_message_activity("No m-of-n multisigs registered");
         return;
     }
 
-    for (int i = 0; i < num_multisigs; ++i) {
+    // The index is read a page at a time, and re-read after a deletion
+    // NOTE: deleting a record moves the last record into its index position
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    size_t num_entries = 0;
+    size_t page = SIZE_MAX;
+    size_t i = 0;
+    while (i < num_multisigs) {
+        bool ok = true;
+        if (i / MULTISIG_INDEX_PAGE_SIZE != page) {
+            page = i / MULTISIG_INDEX_PAGE_SIZE;
+            ok = storage_get_multisig_index_page(page, entries, MULTISIG_INDEX_PAGE_SIZE, &num_entries);
+            JADE_ASSERT(ok);
+        }
+        JADE_ASSERT(i % MULTISIG_INDEX_PAGE_SIZE < num_entries);
+        const multisig_index_entry_t* const entry = entries + (i % MULTISIG_INDEX_PAGE_SIZE);
+
         const char* errmsg = NULL;
-        const char* multisig_name = names[i];
+        const char* multisig_name = entry->name;
         multisig_data_t multisig_data;
         const bool valid = multisig_load_from_storage(multisig_name, &multisig_data, &errmsg);
 
@@ -763,6 +929,7 @@ static void handle_multisigs(void)
             multisig_data.master_blinding_key_len);
         JADE_ASSERT(act);
 
+        bool deleted = false;
         while (true) {
             gui_set_current_activity(act);
 
@@ -778,9 +945,18 @@ static void handle_multisigs(void)
 
                 ok = storage_erase_multisig_registration(multisig_name);
                 JADE_ASSERT(ok);
+                multisig_clear_key_cache();
+                deleted = true;
             }
             break;
         };
+
+        if (deleted) {
+            --num_multisigs;
+            page = SIZE_MAX;
+        } else {
+            ++i;
+        }
     }
 }
 
@@ -888,7 +1064,7 @@ static void handle_passphrase_prefs()
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_XPUB_EXIT;
 #endif
@@ -935,8 +1111,7 @@ static bool display_hotp_screen(const char* name, const char* token, const bool
 #ifndef CONFIG_DEBUG_UNATTENDED_CI
     const bool btn_pressed = gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
-    gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+    gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const bool btn_pressed = true;
     ev_id = BTN_OTP_CONFIRM;
 #endif
@@ -990,7 +1165,7 @@ static bool display_totp_screen(otpauth_ctx_t* otp_ctx, uint64_t epoch_value, ch
         timeout = 1000 / portTICK_PERIOD_MS; // After initial update, update every 1s
 #else
         sync_wait_event(GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, event_data, NULL, &ev_id, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool btn_pressed = true;
         ev_id = BTN_OTP_CONFIRM;
 #endif
@@ -1672,6 +1847,11 @@ static void do_dashboard(jade_process_t* process, const keychain_t* const initia
             acted = true;
         }
 
+        // If idle, power down any camera left in standby whose standby period has expired
+        if (!acted) {
+            jade_camera_standby_check();
+        }
+
         // If we did some action this loop, run housekeeping
         if (acted) {
             // Cleanup anything attached to the dashboard process
@@ -9,6 +9,9 @@
 #include "process_utils.h"
 
 #ifdef CONFIG_DEBUG_MODE
+// Pinserver interaction
+void pinclient_reset_oneshot(void);
+
 void debug_clean_reset_process(void* process_ptr)
 {
     JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
@@ -28,19 +31,12 @@ void debug_clean_reset_process(void* process_ptr)
     // Clean pinserver overrides from storage
     storage_erase_pinserver_cert();
     storage_erase_pinserver_details();
+    pinclient_reset_oneshot();
 
     // Clean multisig registrations from storage
-    char multisig_names[MAX_MULTISIG_REGISTRATIONS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
-    const size_t num_multsig_names = sizeof(multisig_names) / sizeof(multisig_names[0]);
-    size_t num_multisigs = 0;
-    bool ok = storage_get_all_multisig_registration_names(multisig_names, num_multsig_names, &num_multisigs);
+    bool ok = storage_erase_all_multisig_registrations();
     JADE_ASSERT(ok);
 
-    for (int i = 0; i < num_multisigs; ++i) {
-        ok = storage_erase_multisig_registration(multisig_names[i]);
-        JADE_ASSERT(ok);
-    }
-
     // Clean OTP registrations from storage
     char otp_names[OTP_MAX_RECORDS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
     const size_t num_otp_names = sizeof(otp_names) / sizeof(otp_names[0]);
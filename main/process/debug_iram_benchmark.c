@@ -0,0 +1,291 @@
+#include "../camera.h"
+#include "../gui.h"
+#include "../jade_assert.h"
+#include "../jade_wally_verify.h"
+#include "../process.h"
+#include "../qrcode.h"
+#include "../random.h"
+#include "../ui.h"
+#include "../utils/cbor_rpc.h"
+#include "../utils/malloc_ext.h"
+#include "process_utils.h"
+
+#include <esp_ota_ops.h>
+#include <esp_partition.h>
+#include <mbedtls/sha256.h>
+#include <quirc.h>
+#include <wally_crypto.h>
+
+#ifdef CONFIG_IDF_TARGET_ESP32
+#include <sha/sha_parallel_engine.h>
+#endif
+
+#ifdef CONFIG_DEBUG_MODE
+
+// Benchmark for candidate IRAM placements (hot crypto, qr and rendering routines).
+// Each workload is timed in cpu cycles 'warm' (run back-to-back, so its code is resident in the
+// flash cache) and 'cold' (run immediately after reading through more flash than the cache holds,
+// as happens when gui, transport and crypto tasks interleave).  The difference is the cost of the
+// flash cache misses incurred - which is what IRAM placement removes.
+// A placement should only be added with the before/after numbers from this benchmark to justify it.
+
+#define BENCH_ITERATIONS 8
+#define CACHE_THRASH_SIZE (64 * 1024)
+#define CACHE_LINE_SIZE 32
+
+#define QR_VERSION 6
+#define QR_SCALE 4
+#define QR_QUIET_ZONE 4
+
+typedef struct {
+    // Mapped flash used to evict the cache
+    const uint8_t* thrash;
+
+    // secp256k1
+    uint8_t privkey[EC_PRIVATE_KEY_LEN];
+    uint8_t pubkey[EC_PUBLIC_KEY_LEN];
+    uint8_t hash[SHA256_LEN];
+
+    // sha256
+    uint8_t sha_data[1024];
+
+    // text rendering
+    gui_activity_t* activity;
+
+    // qrcode and quirc
+    QRCode qrcode;
+    uint8_t* qr_modules;
+    struct quirc* quirc;
+    uint8_t* image;
+} bench_ctx_t;
+
+typedef struct {
+    const char* name;
+    void (*fn)(bench_ctx_t* ctx);
+    bool on_gui_task;
+    uint32_t warm_cycles;
+    uint32_t cold_cycles;
+} bench_t;
+
+// Read through the mapped flash region, evicting the current contents of the flash cache
+static void thrash_cache(const bench_ctx_t* ctx)
+{
+    volatile uint32_t sum = 0;
+    for (size_t i = 0; i < CACHE_THRASH_SIZE; i += CACHE_LINE_SIZE) {
+        sum += ctx->thrash[i];
+    }
+}
+
+// ECDSA signing - secp256k1 scalar/field arithmetic (ecmult_gen) and rfc6979 nonce hashing
+static void bench_ec_sign(bench_ctx_t* ctx)
+{
+    uint8_t sig[EC_SIGNATURE_LEN];
+    JADE_WALLY_VERIFY(wally_ec_sig_from_bytes(
+        ctx->privkey, sizeof(ctx->privkey), ctx->hash, sizeof(ctx->hash), EC_FLAG_ECDSA, sig, sizeof(sig)));
+}
+
+// ECDH - secp256k1 field arithmetic (ecmult_const)
+static void bench_ecdh(bench_ctx_t* ctx)
+{
+    uint8_t secret[SHA256_LEN];
+    JADE_WALLY_VERIFY(
+        wally_ecdh(ctx->pubkey, sizeof(ctx->pubkey), ctx->privkey, sizeof(ctx->privkey), secret, sizeof(secret)));
+}
+
+// Software sha256 compression - as used when the hw engine is busy (or reserved by another task)
+static void bench_sha256_sw(bench_ctx_t* ctx)
+{
+    uint8_t output[SHA256_LEN];
+#ifdef CONFIG_IDF_TARGET_ESP32
+    // Hold the hw engine so mbedtls falls back to software
+    esp_sha_lock_engine(SHA2_256);
+#endif
+    mbedtls_sha256(ctx->sha_data, sizeof(ctx->sha_data), output, 0);
+#ifdef CONFIG_IDF_TARGET_ESP32
+    esp_sha_unlock_engine(SHA2_256);
+#endif
+}
+
+// QR code generation - reed-solomon and mask penalty scoring (main/qrcode.c)
+static void bench_qrcode(bench_ctx_t* ctx)
+{
+    const int8_t ret = qrcode_initText(&ctx->qrcode, ctx->qr_modules, QR_VERSION, ECC_LOW,
+        "UR:JADE-PINREP/OEADGDSTASBBAOFHKMWNGHHTKTEHIMGTYKPEMDWFRGAXWNDWKKVL");
+    JADE_ASSERT(ret == 0);
+}
+
+// QR code detection - quirc thresholding and finder pattern scanning
+static void bench_quirc(bench_ctx_t* ctx)
+{
+    int width = 0, height = 0;
+    uint8_t* const image = quirc_begin(ctx->quirc, &width, &height);
+    JADE_ASSERT(image);
+    JADE_ASSERT(width == CAMERA_IMAGE_WIDTH && height == CAMERA_IMAGE_HEIGHT);
+    memcpy(image, ctx->image, CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT);
+    quirc_end(ctx->quirc);
+    JADE_ASSERT(quirc_count(ctx->quirc) == 1);
+}
+
+// Text rendering - repaint of a text activity, mostly the tft glyph renderer
+// NOTE: runs on the gui task (see run_bench_on_gui_task()) so as not to race its painting
+static void bench_glyphs(bench_ctx_t* ctx) { gui_repaint(ctx->activity->root_node, true); }
+
+// Render the benchmark qr code into a greyscale camera-sized image, for quirc to find
+static void render_qr_image(bench_ctx_t* ctx)
+{
+    memset(ctx->image, 0xFF, CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT);
+    const size_t size = ctx->qrcode.size;
+    JADE_ASSERT((size + 2 * QR_QUIET_ZONE) * QR_SCALE <= CAMERA_IMAGE_HEIGHT);
+
+    for (size_t y = 0; y < size * QR_SCALE; ++y) {
+        uint8_t* const row = ctx->image + (y + QR_QUIET_ZONE * QR_SCALE) * CAMERA_IMAGE_WIDTH;
+        for (size_t x = 0; x < size * QR_SCALE; ++x) {
+            if (qrcode_getModule(&ctx->qrcode, x / QR_SCALE, y / QR_SCALE)) {
+                row[x + QR_QUIET_ZONE * QR_SCALE] = 0x00;
+            }
+        }
+    }
+}
+
+// Time a workload warm (min of back-to-back runs) and cold (mean of runs after evicting the cache)
+static void run_bench(bench_ctx_t* ctx, bench_t* bench)
+{
+    // Warm-up run, also validates the workload
+    bench->fn(ctx);
+
+    bench->warm_cycles = UINT32_MAX;
+    for (size_t i = 0; i < BENCH_ITERATIONS; ++i) {
+        const uint32_t start = xthal_get_ccount();
+        bench->fn(ctx);
+        const uint32_t cycles = xthal_get_ccount() - start;
+        bench->warm_cycles = cycles < bench->warm_cycles ? cycles : bench->warm_cycles;
+    }
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < BENCH_ITERATIONS; ++i) {
+        thrash_cache(ctx);
+        const uint32_t start = xthal_get_ccount();
+        bench->fn(ctx);
+        total += xthal_get_ccount() - start;
+    }
+    bench->cold_cycles = total / BENCH_ITERATIONS;
+
+    JADE_LOGI("%s: warm %lu cycles, cold %lu cycles, cache miss overhead %ld cycles", bench->name,
+        bench->warm_cycles, bench->cold_cycles, (int32_t)(bench->cold_cycles - bench->warm_cycles));
+}
+
+typedef struct {
+    bench_ctx_t* ctx;
+    bench_t* bench;
+} gui_bench_t;
+
+// Run a benchmark on the gui task - cache eviction and timing must happen on the core running the
+// workload, as each core has its own flash cache.
+static void run_bench_on_gui_task(void* ctx)
+{
+    JADE_ASSERT(ctx);
+    gui_bench_t* gui_bench = (gui_bench_t*)ctx;
+    run_bench(gui_bench->ctx, gui_bench->bench);
+}
+
+static void reply_results(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(ctx);
+    const bench_t* benches = (const bench_t*)ctx;
+
+    size_t num_benches = 0;
+    while (benches[num_benches].name) {
+        ++num_benches;
+    }
+
+    CborEncoder map_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &map_encoder, num_benches);
+    JADE_ASSERT(cberr == CborNoError);
+
+    for (const bench_t* bench = benches; bench->name; ++bench) {
+        cberr = cbor_encode_text_stringz(&map_encoder, bench->name);
+        JADE_ASSERT(cberr == CborNoError);
+
+        CborEncoder result_encoder;
+        cberr = cbor_encoder_create_map(&map_encoder, &result_encoder, 2);
+        JADE_ASSERT(cberr == CborNoError);
+        add_uint_to_map(&result_encoder, "warm_cycles", bench->warm_cycles);
+        add_uint_to_map(&result_encoder, "cold_cycles", bench->cold_cycles);
+        cberr = cbor_encoder_close_container(&map_encoder, &result_encoder);
+        JADE_ASSERT(cberr == CborNoError);
+    }
+
+    cberr = cbor_encoder_close_container(container, &map_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+
+void debug_iram_benchmark_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "debug_iram_benchmark");
+
+    bench_ctx_t ctx = { 0 };
+    spi_flash_mmap_handle_t thrash_handle;
+
+    // Map some of the running firmware image to read through to evict the flash cache
+    const esp_partition_t* const running = esp_ota_get_running_partition();
+    JADE_ASSERT(running);
+    JADE_ASSERT(running->size >= CACHE_THRASH_SIZE);
+    esp_err_t err = esp_partition_mmap(
+        running, 0, CACHE_THRASH_SIZE, ESP_PARTITION_MMAP_DATA, (const void**)&ctx.thrash, &thrash_handle);
+    if (err != ESP_OK) {
+        JADE_LOGE("esp_partition_mmap() failed: %d", err);
+        jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to map flash", NULL);
+        return;
+    }
+
+    // Workload inputs
+    get_random(ctx.privkey, sizeof(ctx.privkey));
+    get_random(ctx.hash, sizeof(ctx.hash));
+    get_random(ctx.sha_data, sizeof(ctx.sha_data));
+    JADE_WALLY_VERIFY(wally_ec_private_key_verify(ctx.privkey, sizeof(ctx.privkey)));
+    JADE_WALLY_VERIFY(
+        wally_ec_public_key_from_private_key(ctx.privkey, sizeof(ctx.privkey), ctx.pubkey, sizeof(ctx.pubkey)));
+
+    ctx.qr_modules = JADE_MALLOC(qrcode_getBufferSize(QR_VERSION));
+    ctx.image = JADE_MALLOC_PREFER_SPIRAM(CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT);
+    ctx.quirc = quirc_new();
+    JADE_ASSERT(ctx.quirc);
+    const int qret = quirc_resize(ctx.quirc, CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT);
+    JADE_ASSERT(qret == 0);
+    bench_qrcode(&ctx);
+    render_qr_image(&ctx);
+
+    // Let the gui task lay out (and first paint) the text activity before it is repainted
+    ctx.activity = display_message_activity("The quick brown fox\njumps over\nthe lazy dog 0123456789");
+    vTaskDelay(200 / portTICK_PERIOD_MS);
+
+    bench_t benches[] = { { .name = "ec_sign", .fn = bench_ec_sign },
+        { .name = "ecdh", .fn = bench_ecdh },
+        { .name = "sha256_sw", .fn = bench_sha256_sw },
+        { .name = "qrcode_encode", .fn = bench_qrcode },
+        { .name = "quirc_identify", .fn = bench_quirc },
+        { .name = "glyph_render", .fn = bench_glyphs, .on_gui_task = true },
+        { .name = NULL, .fn = NULL } };
+
+    for (bench_t* bench = benches; bench->name; ++bench) {
+        if (bench->on_gui_task) {
+            gui_bench_t gui_bench = { .ctx = &ctx, .bench = bench };
+            gui_run_on_gui_task(run_bench_on_gui_task, &gui_bench);
+        } else {
+            run_bench(&ctx, bench);
+        }
+    }
+
+    jade_process_reply_to_message_result(process->ctx, benches, reply_results);
+
+    quirc_destroy(ctx.quirc);
+    free(ctx.image);
+    free(ctx.qr_modules);
+    spi_flash_munmap(thrash_handle);
+    JADE_LOGI("Success");
+}
+#endif // CONFIG_DEBUG_MODE
@@ -11,6 +11,9 @@
 
 static const size_t CBOR_OVERHEAD = 64;
 
+// Largest 'high resolution' image accepted (replayed as a recording of the camera's full field of view)
+static const size_t MAX_REPLAY_IMAGE_WIDTH = CAMERA_IMAGE_WIDTH * 2;
+
 typedef struct {
     jade_process_t* process;
     bool check_qr; // check captured image is a valid qr code
@@ -155,8 +158,18 @@ void debug_scan_qr_process(void* process_ptr)
         goto cleanup;
     }
 
+    // Image may be higher resolution than a camera frame (with the same aspect ratio)
+    size_t width = CAMERA_IMAGE_WIDTH;
+    if (rpc_has_field_data("width", &params)
+        && (!rpc_get_sizet("width", &params, &width) || width < CAMERA_IMAGE_WIDTH || width > MAX_REPLAY_IMAGE_WIDTH
+            || (width * CAMERA_IMAGE_HEIGHT) % CAMERA_IMAGE_WIDTH)) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Invalid image width", NULL);
+        goto cleanup;
+    }
+    const size_t height = width * CAMERA_IMAGE_HEIGHT / CAMERA_IMAGE_WIDTH;
+
     // Decompress the image data
-    const size_t decompressed_buflen = CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT;
+    const size_t decompressed_buflen = width * height;
     uint8_t* const decompressed = JADE_MALLOC_PREFER_SPIRAM(decompressed_buflen);
     jade_process_free_on_exit(process, decompressed);
     const size_t decompressed_len = decompress(data, len, decompressed, decompressed_buflen);
@@ -165,14 +178,21 @@ void debug_scan_qr_process(void* process_ptr)
         goto cleanup;
     }
 
-    // Poke image into camera debug fixed image, and run camera qr scan
-    // which will then be presented with the passed/fixed image.
-    camera_set_debug_image(decompressed, decompressed_buflen);
-
-    // Attempt to scan a qr
     qr_data_t qr_data = { .len = 0 };
-    if (!jade_camera_scan_qr(&qr_data, "Test Scan QR", "Test Scan\n(fixed image)")) {
-        JADE_LOGW("QR scanning failed!");
+    if (width > CAMERA_IMAGE_WIDTH) {
+        // Replay the high resolution image as the camera would capture it, including any zoom
+        if (!scan_qr(width, height, decompressed, decompressed_buflen, &qr_data)) {
+            JADE_LOGW("QR scanning failed!");
+        }
+    } else {
+        // Poke image into camera debug fixed image, and run camera qr scan
+        // which will then be presented with the passed/fixed image.
+        camera_set_debug_image(decompressed, decompressed_buflen);
+
+        // Attempt to scan a qr
+        if (!jade_camera_scan_qr(&qr_data, "Test Scan QR", "Test Scan\n(fixed image)")) {
+            JADE_LOGW("QR scanning failed!");
+        }
     }
 
     // Reply with the decoded data (empty if failed)
@@ -7,8 +7,12 @@
 
 #include "process_utils.h"
 
+// Unpaged requests return (the valid records among) the first two pages of the index - ie. the first 16
+// records, as many as could be registered before the index was introduced.
+#define UNPAGED_INDEX_PAGES 2
+
 typedef struct {
-    const char* name;
+    char name[NVS_KEY_NAME_MAX_SIZE];
     const char* variant;
     bool sorted;
     bool has_master_blinding_key;
@@ -18,15 +22,18 @@ typedef struct {
 } multisig_desc_t;
 
 typedef struct {
-    multisig_desc_t multisigs[MAX_MULTISIG_REGISTRATIONS];
+    multisig_desc_t multisigs[UNPAGED_INDEX_PAGES * MULTISIG_INDEX_PAGE_SIZE];
     size_t num_multisigs;
+
+    // Paged requests only
+    bool paged;
+    size_t page;
+    size_t num_pages;
 } multisig_descriptions_t;
 
-static void reply_registered_multisigs(const void* ctx, CborEncoder* container)
+static void add_registered_multisigs(const multisig_descriptions_t* descriptions, CborEncoder* container)
 {
-    JADE_ASSERT(ctx);
-
-    const multisig_descriptions_t* descriptions = (const multisig_descriptions_t*)ctx;
+    JADE_ASSERT(descriptions);
     JADE_ASSERT(descriptions->num_multisigs <= sizeof(descriptions->multisigs) / sizeof(descriptions->multisigs[0]));
 
     CborEncoder root_encoder;
@@ -63,37 +70,52 @@ static void reply_registered_multisigs(const void* ctx, CborEncoder* container)
     JADE_ASSERT(cberr == CborNoError);
 }
 
-void get_registered_multisigs_process(void* process_ptr)
+static void reply_registered_multisigs(const void* ctx, CborEncoder* container)
 {
-    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
-    jade_process_t* process = process_ptr;
+    JADE_ASSERT(ctx);
+    const multisig_descriptions_t* descriptions = (const multisig_descriptions_t*)ctx;
 
-    // We expect a current message to be present
-    ASSERT_CURRENT_MESSAGE(process, "get_registered_multisigs");
-    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+    if (!descriptions->paged) {
+        // Unpaged - just the map of descriptions
+        add_registered_multisigs(descriptions, container);
+        return;
+    }
+
+    CborEncoder map_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &map_encoder, 3);
+    JADE_ASSERT(cberr == CborNoError);
+
+    add_uint_to_map(&map_encoder, "page", descriptions->page);
+    add_uint_to_map(&map_encoder, "num_pages", descriptions->num_pages);
+
+    cberr = cbor_encode_text_stringz(&map_encoder, "multisigs");
+    JADE_ASSERT(cberr == CborNoError);
+    add_registered_multisigs(descriptions, &map_encoder);
 
-    // Get registered multisig names
-    char names[MAX_MULTISIG_REGISTRATIONS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
-    const size_t num_names = sizeof(names) / sizeof(names[0]);
-    size_t num_multisigs = 0;
-    if (!storage_get_all_multisig_registration_names(names, num_names, &num_multisigs)) {
-        jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to load multisig registrations", NULL);
-        goto cleanup;
+    cberr = cbor_encoder_close_container(container, &map_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+
+// Load description of each record in the given index page which is valid for this wallet
+static bool load_index_page(const size_t page, multisig_descriptions_t* descriptions)
+{
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    size_t num_entries = 0;
+    if (!storage_get_multisig_index_page(page, entries, MULTISIG_INDEX_PAGE_SIZE, &num_entries)) {
+        return false;
     }
 
-    // Load description of each
-    multisig_descriptions_t descriptions;
-    descriptions.num_multisigs = 0;
-    JADE_ASSERT(num_multisigs <= sizeof(descriptions.multisigs) / sizeof(descriptions.multisigs[0]));
-    for (int i = 0; i < num_multisigs; ++i) {
+    JADE_ASSERT(descriptions->num_multisigs + num_entries
+        <= sizeof(descriptions->multisigs) / sizeof(descriptions->multisigs[0]));
+    for (int i = 0; i < num_entries; ++i) {
         const char* errmsg = NULL;
         multisig_data_t multisig_data;
-        const bool valid = multisig_load_from_storage(names[i], &multisig_data, &errmsg);
+        const bool valid = multisig_load_from_storage(entries[i].name, &multisig_data, &errmsg);
 
         // If valid for this wallet, add description/summary info
         if (valid) {
-            multisig_desc_t* const desc = descriptions.multisigs + descriptions.num_multisigs;
-            desc->name = names[i];
+            multisig_desc_t* const desc = descriptions->multisigs + descriptions->num_multisigs;
+            strcpy(desc->name, entries[i].name);
             desc->variant = get_script_variant_string(multisig_data.variant);
             desc->sorted = multisig_data.sorted;
             desc->threshold = multisig_data.threshold;
@@ -109,12 +131,50 @@ void get_registered_multisigs_process(void* process_ptr)
                 desc->has_master_blinding_key = false;
             }
 
-            ++descriptions.num_multisigs;
+            ++descriptions->num_multisigs;
         } else if (errmsg) {
             // Corrupt or for another wallet - just log and skip
             JADE_LOGD("%s", errmsg);
         }
     }
+    return true;
+}
+
+void get_registered_multisigs_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "get_registered_multisigs");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+
+    multisig_descriptions_t descriptions = { .num_multisigs = 0, .paged = false };
+
+    // Optional 'page' parameter, to fetch one index page at a time
+    CborValue params;
+    const CborError cberr = cbor_value_map_find_value(&process->ctx.value, CBOR_RPC_TAG_PARAMS, &params);
+    if (cberr == CborNoError && cbor_value_is_valid(&params) && cbor_value_is_map(&params)
+        && rpc_has_field_data("page", &params)) {
+        if (!rpc_get_sizet("page", &params, &descriptions.page)) {
+            jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Invalid page", NULL);
+            goto cleanup;
+        }
+        const size_t count = storage_get_multisig_registration_count();
+        descriptions.num_pages = (count + MULTISIG_INDEX_PAGE_SIZE - 1) / MULTISIG_INDEX_PAGE_SIZE;
+        descriptions.paged = true;
+    }
+
+    // Load description of each valid record in the requested page(s)
+    const size_t first_page = descriptions.paged ? descriptions.page : 0;
+    const size_t num_pages = descriptions.paged ? 1 : UNPAGED_INDEX_PAGES;
+    for (size_t page = first_page; page < first_page + num_pages; ++page) {
+        if (!load_index_page(page, &descriptions)) {
+            jade_process_reject_message(
+                process, CBOR_RPC_INTERNAL_ERROR, "Failed to load multisig registrations", NULL);
+            goto cleanup;
+        }
+    }
 
     // Reply with this info
     jade_process_reply_to_message_result(process->ctx, &descriptions, reply_registered_multisigs);
@@ -1272,7 +1272,7 @@ void initialise_with_mnemonic(const bool temporary_restore, const bool force_qr_
             }
 #else
             gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-                CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+                gui_unattended_ci_timeout());
             strcpy(mnemonic,
                 "fish inner face ginger orchard permit useful method fence kidney chuckle party favorite sunset draw "
                 "limb "
@@ -1380,9 +1380,10 @@ void initialise_with_mnemonic(const bool temporary_restore, const bool force_qr_
     keychain_set(&keydata, SOURCE_NONE, temporary_restore);
     keychain_clear_network_type_restriction();
 
-    if (!temporary_restore) {
+    if (!temporary_restore || passphrase_len) {
         // We need to cache the root mnemonic entropy as it is this that we will persist
         // encrypted to local flash (requiring a passphrase to derive the wallet master key).
+        // A temporary wallet using a passphrase may yet be persisted as a wallet slot.
         keychain_cache_mnemonic_entropy(mnemonic);
     }
 
@@ -1430,7 +1431,7 @@ void handle_bip85_mnemonic()
     const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool ret = true;
     ev_id = BTN_BIP85_EXIT;
 #endif
@@ -1,5 +1,6 @@
 #include "../keychain.h"
 #include "../process.h"
+#include "../sha_engine.h"
 #include "../ui.h"
 #include "ota_defines.h"
 #include "ota_util.h"
@@ -17,6 +18,7 @@
 
 #include <deflate.h>
 #include <mbedtls/sha256.h>
+#include <sodium/utils.h>
 #include <wally_core.h>
 
 #include "process_utils.h"
@@ -44,6 +46,9 @@ static int uncompressed_stream_writer(void* ctx, uint8_t* uncompressed, size_t t
             return res;
         }
         *octx->prevalidated = true;
+
+        // Reserve the hw sha engine for hashing the rest of the image, now the user has confirmed the upload
+        sha_engine_reserve();
     }
 
     const esp_err_t res = esp_ota_write(*octx->joctx->ota_handle, (const void*)uncompressed, towrite);
@@ -55,7 +60,7 @@ static int uncompressed_stream_writer(void* ctx, uint8_t* uncompressed, size_t t
 
     if (octx->joctx->hash_type == HASHTYPE_FULLFWDATA) {
         // Add written to hash calculation
-        mbedtls_sha256_update(octx->joctx->sha_ctx, uncompressed, towrite);
+        ota_hash_image_data(octx->joctx, uncompressed, towrite);
     }
 
     *octx->joctx->remaining_uncompressed -= towrite;
@@ -64,7 +69,9 @@ static int uncompressed_stream_writer(void* ctx, uint8_t* uncompressed, size_t t
     /* Update the progress bar once the user has confirmed and upload is in progress */
     if (*octx->prevalidated) {
         JADE_ASSERT(octx->joctx->progress_bar.progress_bar);
-        update_progress_bar(&octx->joctx->progress_bar, octx->joctx->uncompressedsize, written);
+        const size_t fw_written = octx->joctx->resume_offset + written;
+        update_progress_bar(&octx->joctx->progress_bar, octx->joctx->firmwaresize, fw_written);
+        ota_checkpoint(octx->joctx, fw_written);
     }
 
     if (written > CUSTOM_HEADER_MIN_WRITE && !*octx->prevalidated) {
@@ -74,14 +81,14 @@ static int uncompressed_stream_writer(void* ctx, uint8_t* uncompressed, size_t t
     return DEFLATE_OK;
 }
 
-void ota_process(void* process_ptr)
+// Handles 'ota' (a full firmware image upload) and 'ota_resume' (the remainder of a full firmware image,
+// the upload of which was interrupted after being checkpointed - see ota_checkpoint()).
+static void handle_ota(jade_process_t* process, const bool resume)
 {
-    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
-
-    jade_process_t* process = process_ptr;
     bool uploading = false;
     enum ota_status ota_return_status = ERROR_OTA_SETUP;
     bool prevalidated = false;
+    bool ota_begin_called = false;
     bool ota_end_called = false;
 
     char id[MAXLEN_ID + 1];
@@ -92,7 +99,7 @@ void ota_process(void* process_ptr)
     esp_ota_handle_t ota_handle = 0;
 
     // We expect a current message to be present
-    ASSERT_CURRENT_MESSAGE(process, "ota");
+    ASSERT_CURRENT_MESSAGE(process, resume ? "ota_resume" : "ota");
     GET_MSG_PARAMS(process);
     if (keychain_has_pin()) {
         ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
@@ -101,26 +108,39 @@ void ota_process(void* process_ptr)
 
     const jade_msg_source_t source = process->ctx.source;
 
+    // When resuming, the uploaded data is the remainder of the image from 'offset'
     size_t firmwaresize = 0;
     size_t compressedsize = 0;
+    size_t offset = 0;
     if (!rpc_get_sizet("fwsize", &params, &firmwaresize) || !rpc_get_sizet("cmpsize", &params, &compressedsize)
-        || firmwaresize <= compressedsize) {
+        || (resume && (!rpc_get_sizet("offset", &params, &offset) || !offset || offset >= firmwaresize))
+        || firmwaresize - offset <= compressedsize) {
         jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Bad filesize parameters", NULL);
         goto cleanup;
     }
 
     // Can accept either uploaded file data hash (legacy) or hash of the full/final firmware image (preferred)
+    // NOTE: resuming requires the hash of the final firmware image
     uint8_t expected_hash[SHA256_LEN];
     char* expected_hash_hexstr = NULL;
     hash_type_t hash_type;
     if (rpc_get_n_bytes("fwhash", &params, sizeof(expected_hash), expected_hash)) {
         hash_type = HASHTYPE_FULLFWDATA;
-    } else if (rpc_get_n_bytes("cmphash", &params, sizeof(expected_hash), expected_hash)) {
+    } else if (!resume && rpc_get_n_bytes("cmphash", &params, sizeof(expected_hash), expected_hash)) {
         hash_type = HASHTYPE_FILEDATA;
     } else {
         jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Cannot extract valid fw hash value", NULL);
         goto cleanup;
     }
+
+    // Any resume must match the persisted checkpoint
+    ota_checkpoint_t checkpoint;
+    if (resume
+        && (!ota_checkpoint_load(&checkpoint) || checkpoint.offset != offset || checkpoint.fwsize != firmwaresize
+            || sodium_memcmp(checkpoint.fwhash, expected_hash, sizeof(expected_hash)))) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "No matching OTA checkpoint", NULL);
+        goto cleanup;
+    }
     JADE_WALLY_VERIFY(wally_hex_from_bytes(expected_hash, sizeof(expected_hash), &expected_hash_hexstr));
     jade_process_wally_free_string_on_exit(process, expected_hash_hexstr);
 
@@ -136,7 +156,7 @@ void ota_process(void* process_ptr)
         .prevalidated = &prevalidated,
     };
 
-    size_t remaining_uncompressed = firmwaresize;
+    size_t remaining_uncompressed = firmwaresize - offset;
 
     jade_ota_ctx_t joctx = {
         .progress_bar = {},
@@ -144,7 +164,7 @@ void ota_process(void* process_ptr)
         .hash_type = hash_type,
         .dctx = dctx,
         .id = id,
-        .uncompressedsize = firmwaresize,
+        .uncompressedsize = firmwaresize - offset,
         .remaining_uncompressed = &remaining_uncompressed,
         .ota_return_status = &ota_return_status,
         .expected_source = &process->ctx.source,
@@ -154,6 +174,7 @@ void ota_process(void* process_ptr)
         .firmwaresize = firmwaresize,
         .expected_hash_hexstr = expected_hash_hexstr,
         .expected_hash = expected_hash,
+        .resume_offset = offset,
     };
 
     octx.joctx = &joctx;
@@ -162,9 +183,27 @@ void ota_process(void* process_ptr)
         jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to initialize OTA", NULL);
         goto cleanup;
     }
+    ota_begin_called = true;
+
+    // Any reservation of the hw sha engine (taken once the user confirms the upload) is released on exit
+    jade_process_call_on_exit(process, sha_engine_release_cb, NULL);
+
+    // When resuming, re-verify and re-write the image prefix (which includes the user confirming the version)
+    if (resume) {
+        ota_return_status = ota_resume_from_checkpoint(&joctx, &checkpoint);
+        if (ota_return_status != SUCCESS) {
+            JADE_LOGE("Failed to resume ota from checkpoint: %d", ota_return_status);
+            const int error_code
+                = ota_return_status == ERROR_USER_DECLINED ? CBOR_RPC_USER_CANCELLED : CBOR_RPC_INTERNAL_ERROR;
+            jade_process_reject_message(process, error_code, "Failed to resume OTA", MESSAGES[ota_return_status]);
+            goto cleanup;
+        }
+        prevalidated = true;
+        sha_engine_reserve();
+    }
 
-    const int dret
-        = deflate_init_write_compressed(dctx, compressedsize, firmwaresize, uncompressed_stream_writer, &octx);
+    const int dret = deflate_init_write_compressed(
+        dctx, compressedsize, firmwaresize - offset, uncompressed_stream_writer, &octx);
     JADE_ASSERT(!dret);
 
     // Send the ok response, which implies now we will get ota_data messages
@@ -188,7 +227,8 @@ void ota_process(void* process_ptr)
 
     // Bail-out if the fw uncompressed to an unexpected size
     if (remaining_uncompressed != 0) {
-        JADE_LOGE("Expected uncompressed size: %u, got %u", firmwaresize, firmwaresize - remaining_uncompressed);
+        JADE_LOGE("Expected uncompressed size: %u, got %u", joctx.uncompressedsize,
+            joctx.uncompressedsize - remaining_uncompressed);
         ota_return_status = ERROR_DECOMPRESS;
     }
 
@@ -230,7 +270,8 @@ cleanup:
         esp_restart();
     } else {
         JADE_LOGE("OTA error %u: %s", ota_return_status, MESSAGES[ota_return_status]);
-        if (prevalidated && !ota_end_called) {
+        const bool resumable = ota_begin_called && ota_checkpoint_keep_if_resumable(ota_return_status);
+        if (ota_begin_called && !ota_end_called) {
             // ota_begin has been called, cleanup
             const esp_err_t err = esp_ota_abort(ota_handle);
             JADE_ASSERT(err == ESP_OK);
@@ -249,8 +290,21 @@ cleanup:
         }
 
         // If the error is not 'did not start' or 'user declined', show an error screen
-        if (ota_return_status != ERROR_OTA_SETUP && ota_return_status != ERROR_USER_DECLINED) {
+        // (An interrupted upload which can be resumed does not await acknowledgement.)
+        if (ota_return_status != ERROR_OTA_SETUP && ota_return_status != ERROR_USER_DECLINED && !resumable) {
             await_error_activity(MESSAGES[ota_return_status]);
         }
     }
 }
+
+void ota_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    handle_ota(process_ptr, false);
+}
+
+void ota_resume_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    handle_ota(process_ptr, true);
+}
@@ -1,7 +1,9 @@
 #include "../keychain.h"
 #include "../process.h"
+#include "../sha_engine.h"
 #include "../ui.h"
 #include "ota_defines.h"
+#include "ota_filter.h"
 #include "ota_util.h"
 
 #include "../button_events.h"
@@ -11,6 +13,7 @@
 #include "../utils/malloc_ext.h"
 
 #include <stdint.h>
+#include <string.h>
 
 #include <esp_efuse.h>
 #include <esp_ota_ops.h>
@@ -22,12 +25,50 @@
 #include <bspatch.h>
 #include <deflate.h>
 
+// A segment of an esp image
+typedef struct {
+    size_t offset; // of the segment data in the image
+    size_t len;
+    uint32_t load_addr;
+} image_segment_t;
+
+// When the patch was created between filtered images, the base firmware is filtered as it is read.
+// The code segments of the base firmware, and the last block read and filtered.
+typedef struct {
+    image_segment_t segments[ESP_IMAGE_MAX_SEGMENTS];
+    size_t num_segments;
+    size_t block_offset; // image offset of the cached block
+    size_t block_len; // zero if no block cached
+    uint8_t block[OTA_FILTER_BLOCK_SIZE];
+} base_filter_t;
+
+typedef enum { OUTPUT_HEADER, OUTPUT_SEGMENT_HEADER, OUTPUT_SEGMENT_DATA, OUTPUT_TAIL } output_state_t;
+
+// ... and the patched output is un-filtered as it is written - tracking the image layout as it is written,
+// and collecting each block of a code segment to un-filter it.
+typedef struct {
+    output_state_t state;
+    size_t remaining; // of the current header/segment
+    size_t field_len;
+    union {
+        esp_image_header_t header;
+        esp_image_segment_header_t segment_header;
+    } field;
+    uint8_t segments_remaining;
+    bool is_code;
+    uint32_t block_addr;
+    size_t block_len;
+    uint8_t block[OTA_FILTER_BLOCK_SIZE];
+} output_filter_t;
+
 typedef struct {
     jade_ota_ctx_t* joctx;
     char* id;
     struct deflate_ctx* const dctx;
     size_t written;
     bool header_validated;
+    base_filter_t* base_filter;
+    output_filter_t* output_filter;
 } bsdiff_ctx_t;
 
 // Error reply in ota_delta is complicated by the fact that we reply 'ok' when we push the received patch data
@@ -77,6 +118,88 @@ static int patch_stream_reader(const struct bspatch_stream* stream, void* buffer
     return SUCCESS;
 }
 
+// Read the layout of the base firmware image, noting the code segments
+static bool base_filter_init(base_filter_t* bf, const esp_partition_t* partition)
+{
+    JADE_ASSERT(bf);
+    JADE_ASSERT(partition);
+
+    esp_image_header_t header;
+    if (esp_partition_read(partition, 0, &header, sizeof(header)) != ESP_OK || header.magic != ESP_IMAGE_HEADER_MAGIC
+        || header.segment_count > ESP_IMAGE_MAX_SEGMENTS) {
+        return false;
+    }
+
+    size_t offset = sizeof(header);
+    for (size_t i = 0; i < header.segment_count; ++i) {
+        esp_image_segment_header_t segment_header;
+        if (esp_partition_read(partition, offset, &segment_header, sizeof(segment_header)) != ESP_OK) {
+            return false;
+        }
+        offset += sizeof(segment_header);
+        if (segment_header.data_len > partition->size - offset) {
+            return false;
+        }
+        if (ota_filter_is_code(segment_header.load_addr)) {
+            image_segment_t* const segment = &bf->segments[bf->num_segments++];
+            segment->offset = offset;
+            segment->len = segment_header.data_len;
+            segment->load_addr = segment_header.load_addr;
+        }
+        offset += segment_header.data_len;
+    }
+    bf->block_len = 0;
+    return true;
+}
+
+// Read base firmware, filtering any code segment data
+static bool base_filter_read(base_filter_t* bf, const esp_partition_t* partition, size_t pos, uint8_t* buffer,
+    size_t length)
+{
+    while (length) {
+        // Find any code segment at or beyond 'pos'
+        const image_segment_t* segment = NULL;
+        for (size_t i = 0; i < bf->num_segments && !segment; ++i) {
+            if (pos < bf->segments[i].offset + bf->segments[i].len) {
+                segment = &bf->segments[i];
+            }
+        }
+
+        size_t n;
+        if (!segment || pos < segment->offset) {
+            // Read unfiltered up to the start of the next code segment
+            n = segment && segment->offset - pos < length ? segment->offset - pos : length;
+            if (esp_partition_read(partition, pos, buffer, n) != ESP_OK) {
+                return false;
+            }
+        } else {
+            // Read from the (filtered) block containing 'pos'
+            const size_t block_offset
+                = segment->offset + ((pos - segment->offset) / OTA_FILTER_BLOCK_SIZE) * OTA_FILTER_BLOCK_SIZE;
+            if (!bf->block_len || bf->block_offset != block_offset) {
+                const size_t segment_remaining = segment->offset + segment->len - block_offset;
+                bf->block_len = 0;
+                bf->block_offset = block_offset;
+                const size_t block_len
+                    = segment_remaining < OTA_FILTER_BLOCK_SIZE ? segment_remaining : OTA_FILTER_BLOCK_SIZE;
+                if (esp_partition_read(partition, block_offset, bf->block, block_len) != ESP_OK) {
+                    return false;
+                }
+                ota_filter_encode_block(bf->block, block_len, segment->load_addr + (block_offset - segment->offset));
+                bf->block_len = block_len;
+            }
+            const size_t block_remaining = block_offset + bf->block_len - pos;
+            n = block_remaining < length ? block_remaining : length;
+            memcpy(buffer, bf->block + (pos - block_offset), n);
+        }
+
+        pos += n;
+        buffer += n;
+        length -= n;
+    }
+    return true;
+}
+
 // NOTE: uses macros above so may return error immediately, or may just cache it for later return
 static int base_firmware_stream_reader(const struct bspatch_stream_i* stream, void* buffer, int pos, int length)
 {
@@ -86,23 +209,24 @@ static int base_firmware_stream_reader(const struct bspatch_stream_i* stream, vo
     // If currently in error, return immediately without reading anything
     HANDLE_ANY_CACHED_ERROR(bctx->joctx);
 
-    if (length <= 0 || pos + length >= bctx->joctx->running_partition->size
-        || esp_partition_read(bctx->joctx->running_partition, pos, buffer, length) != ESP_OK) {
+    const esp_partition_t* const partition = bctx->joctx->running_partition;
+    if (length <= 0 || pos + length >= partition->size) {
+        HANDLE_NEW_ERROR(bctx->joctx, ERROR_PATCH);
+    }
+
+    const bool ok = bctx->base_filter ? base_filter_read(bctx->base_filter, partition, pos, buffer, length)
+                                      : esp_partition_read(partition, pos, buffer, length) == ESP_OK;
+    if (!ok) {
         HANDLE_NEW_ERROR(bctx->joctx, ERROR_PATCH);
     }
 
     return SUCCESS;
 }
 
+// Write final firmware image data to the ota partition
 // NOTE: uses macros above so may return error immediately, or may just cache it for later return
-static int ota_stream_writer(const struct bspatch_stream_n* stream, const void* buffer, int length)
+static int write_image_data(bsdiff_ctx_t* bctx, const void* buffer, const int length)
 {
-    bsdiff_ctx_t* bctx = (bsdiff_ctx_t*)stream->opaque;
-    JADE_ASSERT(bctx);
-
-    // If currently in error, return immediately without writing anything
-    HANDLE_ANY_CACHED_ERROR(bctx->joctx);
-
     if (length <= 0 || esp_ota_write(*bctx->joctx->ota_handle, buffer, length) != ESP_OK) {
         HANDLE_NEW_ERROR(bctx->joctx, ERROR_PATCH);
     }
@@ -113,11 +237,14 @@ static int ota_stream_writer(const struct bspatch_stream_n* stream, const void*
             HANDLE_NEW_ERROR(bctx->joctx, validation);
         }
         bctx->header_validated = true;
+
+        // Reserve the hw sha engine for hashing the rest of the image, now the user has confirmed the upload
+        sha_engine_reserve();
     }
 
     if (bctx->joctx->hash_type == HASHTYPE_FULLFWDATA) {
         // Add written to hash calculation
-        mbedtls_sha256_update(bctx->joctx->sha_ctx, buffer, length);
+        ota_hash_image_data(bctx->joctx, buffer, length);
     }
 
     bctx->written += length;
@@ -128,11 +255,135 @@ static int ota_stream_writer(const struct bspatch_stream_n* stream, const void*
 
     if (bctx->header_validated) {
         update_progress_bar(&bctx->joctx->progress_bar, bctx->joctx->firmwaresize, bctx->written);
+
+        // NOTE: the patch state cannot be persisted, so any interrupted delta upload is resumed
+        // by the host sending the remainder of the final image (see 'ota_resume').
+        ota_checkpoint(bctx->joctx, bctx->written);
     }
 
     return SUCCESS;
 }
 
+// NOTE: uses macros above so may return error immediately, or may just cache it for later return
+static int ota_stream_writer(const struct bspatch_stream_n* stream, const void* buffer, int length)
+{
+    bsdiff_ctx_t* bctx = (bsdiff_ctx_t*)stream->opaque;
+    JADE_ASSERT(bctx);
+
+    // If currently in error, return immediately without writing anything
+    HANDLE_ANY_CACHED_ERROR(bctx->joctx);
+
+    return write_image_data(bctx, buffer, length);
+}
+
+// Move on to the next part of the output image once the current part is complete
+static bool output_filter_next(output_filter_t* of)
+{
+    JADE_ASSERT(!of->remaining);
+
+    switch (of->state) {
+    case OUTPUT_HEADER:
+        if (of->field.header.magic != ESP_IMAGE_HEADER_MAGIC
+            || of->field.header.segment_count > ESP_IMAGE_MAX_SEGMENTS) {
+            return false;
+        }
+        of->segments_remaining = of->field.header.segment_count;
+        of->state = of->segments_remaining ? OUTPUT_SEGMENT_HEADER : OUTPUT_TAIL;
+        of->remaining = of->segments_remaining ? sizeof(esp_image_segment_header_t) : SIZE_MAX;
+        break;
+
+    case OUTPUT_SEGMENT_HEADER:
+        of->is_code = ota_filter_is_code(of->field.segment_header.load_addr);
+        of->block_addr = of->field.segment_header.load_addr;
+        of->state = OUTPUT_SEGMENT_DATA;
+        of->remaining = of->field.segment_header.data_len;
+        break;
+
+    case OUTPUT_SEGMENT_DATA:
+        --of->segments_remaining;
+        of->state = of->segments_remaining ? OUTPUT_SEGMENT_HEADER : OUTPUT_TAIL;
+        of->remaining = of->segments_remaining ? sizeof(esp_image_segment_header_t) : SIZE_MAX;
+        break;
+
+    default:
+        JADE_ASSERT_MSG(false, "Unexpected output filter state %u", of->state);
+    }
+    of->field_len = 0;
+    return true;
+}
+
+// Un-filter the patched output before writing it
+// Data outside of code segments is passed straight through, in runs as long as possible (as the
+// first write is expected to contain the firmware header data for validation).
+// NOTE: uses macros above so may return error immediately, or may just cache it for later return
+static int filtered_stream_writer(const struct bspatch_stream_n* stream, const void* buffer, int length)
+{
+    bsdiff_ctx_t* bctx = (bsdiff_ctx_t*)stream->opaque;
+    JADE_ASSERT(bctx);
+    JADE_ASSERT(bctx->output_filter);
+
+    // If currently in error, return immediately without writing anything
+    HANDLE_ANY_CACHED_ERROR(bctx->joctx);
+
+    if (length <= 0) {
+        HANDLE_NEW_ERROR(bctx->joctx, ERROR_PATCH);
+    }
+
+    output_filter_t* const of = bctx->output_filter;
+    const uint8_t* data = buffer;
+    const uint8_t* unfiltered = data; // start of any run of data to pass straight through
+    size_t len = length;
+
+    while (len) {
+        size_t n = len < of->remaining ? len : of->remaining;
+        if (of->state == OUTPUT_SEGMENT_DATA && of->is_code) {
+            // Write any preceding unfiltered data
+            if (data > unfiltered) {
+                const int ret = write_image_data(bctx, unfiltered, data - unfiltered);
+                if (ret != SUCCESS || *bctx->joctx->ota_return_status != SUCCESS) {
+                    return ret;
+                }
+            }
+
+            // Collect the block, and un-filter and write it when complete
+            n = n < OTA_FILTER_BLOCK_SIZE - of->block_len ? n : OTA_FILTER_BLOCK_SIZE - of->block_len;
+            memcpy(of->block + of->block_len, data, n);
+            of->block_len += n;
+            if (of->block_len == OTA_FILTER_BLOCK_SIZE || n == of->remaining) {
+                ota_filter_decode_block(of->block, of->block_len, of->block_addr);
+                const int ret = write_image_data(bctx, of->block, of->block_len);
+                if (ret != SUCCESS || *bctx->joctx->ota_return_status != SUCCESS) {
+                    return ret;
+                }
+                of->block_addr += of->block_len;
+                of->block_len = 0;
+            }
+            unfiltered = data + n;
+        } else if (of->state == OUTPUT_HEADER || of->state == OUTPUT_SEGMENT_HEADER) {
+            uint8_t* const field = (uint8_t*)&of->field;
+            memcpy(field + of->field_len, data, n);
+            of->field_len += n;
+        }
+
+        data += n;
+        len -= n;
+        if (of->state != OUTPUT_TAIL) {
+            of->remaining -= n;
+        }
+        while (!of->remaining && of->state != OUTPUT_TAIL) {
+            if (!output_filter_next(of)) {
+                HANDLE_NEW_ERROR(bctx->joctx, ERROR_PATCH);
+            }
+        }
+    }
+
+    // Write any remaining unfiltered data
+    if (data > unfiltered) {
+        return write_image_data(bctx, unfiltered, data - unfiltered);
+    }
+    return SUCCESS;
+}
+
 static int compressed_stream_reader(void* ctx)
 {
     JADE_ASSERT(ctx);
@@ -196,6 +447,17 @@ void ota_delta_process(void* process_ptr)
     JADE_WALLY_VERIFY(wally_hex_from_bytes(expected_hash, sizeof(expected_hash), &expected_hash_hexstr));
     jade_process_wally_free_string_on_exit(process, expected_hash_hexstr);
 
+    // Optional filter applied to both firmware images when the patch was created
+    const char* patchfilter = NULL;
+    size_t patchfilter_len = 0;
+    rpc_get_string_ptr("patchfilter", &params, &patchfilter, &patchfilter_len);
+    const bool filtered = patchfilter != NULL;
+    if (filtered
+        && (patchfilter_len != strlen(OTA_FILTER_NAME) || strncmp(patchfilter, OTA_FILTER_NAME, patchfilter_len))) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Unsupported patch filter", NULL);
+        goto cleanup;
+    }
+
     // We will show a progress bar once the user has confirmed and the upload in progress
     // Initially just show a message screen.
     display_message_activity_two_lines("Preparing for firmware", "update");
@@ -207,6 +469,14 @@ void ota_delta_process(void* process_ptr)
     bsdiff_ctx_t bctx = {
         .dctx = dctx,
     };
+    if (filtered) {
+        bctx.base_filter = JADE_CALLOC_PREFER_SPIRAM(1, sizeof(base_filter_t));
+        jade_process_free_on_exit(process, bctx.base_filter);
+        bctx.output_filter = JADE_CALLOC_PREFER_SPIRAM(1, sizeof(output_filter_t));
+        jade_process_free_on_exit(process, bctx.output_filter);
+        bctx.output_filter->state = OUTPUT_HEADER;
+        bctx.output_filter->remaining = sizeof(esp_image_header_t);
+    }
 
     size_t remaining_uncompressed = uncompressedpatchsize;
 
@@ -241,13 +511,21 @@ void ota_delta_process(void* process_ptr)
 
     ota_begin_called = true;
 
+    if (filtered && !base_filter_init(bctx.base_filter, joctx.running_partition)) {
+        jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to read running firmware", NULL);
+        goto cleanup;
+    }
+
     // Send the ok response, which implies now we will get ota_data messages
     jade_process_reply_to_message_ok(process);
     uploading = true;
 
+    // Any reservation of the hw sha engine (taken once the user confirms the upload) is released on exit
+    jade_process_call_on_exit(process, sha_engine_release_cb, NULL);
+
     struct bspatch_stream_n destination_firmware_stream_writer;
     // new partition
-    destination_firmware_stream_writer.write = &ota_stream_writer;
+    destination_firmware_stream_writer.write = filtered ? &filtered_stream_writer : &ota_stream_writer;
     destination_firmware_stream_writer.opaque = &bctx;
     // patch
     struct bspatch_stream stream;
@@ -314,6 +592,7 @@ cleanup:
         esp_restart();
     } else {
         JADE_LOGE("OTA error %u: %s", ota_return_status, MESSAGES[ota_return_status]);
+        const bool resumable = ota_begin_called && ota_checkpoint_keep_if_resumable(ota_return_status);
         if (ota_begin_called && !ota_end_called) {
             // ota_begin has been called, cleanup
             const esp_err_t err = esp_ota_abort(ota_handle);
@@ -338,7 +617,8 @@ cleanup:
         }
 
         // If the error is not 'did not start' or 'user declined', show an error screen
-        if (ota_return_status != ERROR_OTA_SETUP && ota_return_status != ERROR_USER_DECLINED) {
+        // (An interrupted upload which can be resumed does not await acknowledgement.)
+        if (ota_return_status != ERROR_OTA_SETUP && ota_return_status != ERROR_USER_DECLINED && !resumable) {
             await_error_activity(MESSAGES[ota_return_status]);
         }
     }
@@ -0,0 +1,73 @@
+#include "ota_filter.h"
+
+#include <string.h>
+
+// Instruction address range (iram, rtc fast and irom)
+#define CODE_LOW 0x40070000
+#define CODE_HIGH 0x40400000
+#define CODE_RANGE (CODE_HIGH - CODE_LOW)
+
+// CALLn: op0 (low nibble of the first byte) is 5, with an 18-bit word offset in the top 18 bits
+#define CALL_OP0_MASK 0x0F
+#define CALL_OP0 0x05
+#define CALL_OFFSET_MASK 0x3FFFF
+#define CALL_LEN 3
+
+bool ota_filter_is_code(const uint32_t load_addr) { return load_addr >= CODE_LOW && load_addr < CODE_HIGH; }
+
+static inline uint32_t get_call_offset(const uint8_t* insn)
+{
+    return (insn[0] >> 6) | ((uint32_t)insn[1] << 2) | ((uint32_t)insn[2] << 10);
+}
+
+static inline void set_call_offset(uint8_t* insn, const uint32_t offset)
+{
+    insn[0] = (insn[0] & 0x3F) | ((offset & 0x03) << 6);
+    insn[1] = (offset >> 2) & 0xFF;
+    insn[2] = (offset >> 10) & 0xFF;
+}
+
+// Literal-pool words holding a code address are rotated within the code address range by their own address
+// NOTE: 'addr' is a word aligned code address, as are segment load addresses and block offsets
+static void filter_literals(uint8_t* block, const size_t len, const uint32_t addr, const bool encode)
+{
+    for (size_t i = 0; i + sizeof(uint32_t) <= len; i += sizeof(uint32_t)) {
+        uint32_t value;
+        memcpy(&value, block + i, sizeof(value));
+        if (ota_filter_is_code(value)) {
+            const uint32_t rotation = (addr + i - CODE_LOW) % CODE_RANGE;
+            const uint32_t offset = value - CODE_LOW;
+            value = CODE_LOW + (encode ? offset + CODE_RANGE - rotation : offset + rotation) % CODE_RANGE;
+            memcpy(block + i, &value, sizeof(value));
+        }
+    }
+}
+
+// Call targets are made absolute
+// NOTE: the scan skips the operand bytes of each call matched, but matches only on bits the transform does not
+// change - so un-filtering matches the same positions.
+static void filter_calls(uint8_t* block, const size_t len, const uint32_t addr, const bool encode)
+{
+    for (size_t i = 0; i + CALL_LEN <= len;) {
+        if ((block[i] & CALL_OP0_MASK) == CALL_OP0) {
+            const uint32_t pc_words = ((addr + i) >> 2) + 1;
+            const uint32_t offset = get_call_offset(block + i);
+            set_call_offset(block + i, (encode ? offset + pc_words : offset - pc_words) & CALL_OFFSET_MASK);
+            i += CALL_LEN;
+        } else {
+            ++i;
+        }
+    }
+}
+
+void ota_filter_encode_block(uint8_t* block, const size_t len, const uint32_t addr)
+{
+    filter_literals(block, len, addr, true);
+    filter_calls(block, len, addr, true);
+}
+
+void ota_filter_decode_block(uint8_t* block, const size_t len, const uint32_t addr)
+{
+    filter_calls(block, len, addr, false);
+    filter_literals(block, len, addr, false);
+}
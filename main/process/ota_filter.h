@@ -0,0 +1,19 @@
+#ifndef JADE_OTA_FILTER_H_
+#define JADE_OTA_FILTER_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// The 'xtensa' delta filter - a reversible transform of the code segments of an esp image, applied to both
+// firmware images before they are diffed so code which has only moved produces similar bytes (a smaller patch).
+// Each code segment is filtered in blocks of OTA_FILTER_BLOCK_SIZE bytes from the start of its data, so any
+// block can be (un)filtered independently.  Must match tools/xtensa_filter.py.
+#define OTA_FILTER_NAME "xtensa"
+#define OTA_FILTER_BLOCK_SIZE 4096
+
+bool ota_filter_is_code(uint32_t load_addr);
+void ota_filter_encode_block(uint8_t* block, size_t len, uint32_t addr);
+void ota_filter_decode_block(uint8_t* block, size_t len, uint32_t addr);
+
+#endif /* JADE_OTA_FILTER_H_ */
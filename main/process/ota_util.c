@@ -2,11 +2,14 @@
 #include "../button_events.h"
 #include "../jade_assert.h"
 #include "../jade_wally_verify.h"
+#include "../storage.h"
+#include "../utils/malloc_ext.h"
 #include "ota_defines.h"
 
 #include <ctype.h>
 #include <deflate.h>
 #include <esp_efuse.h>
+#include <esp_flash_encrypt.h>
 #include <sodium/utils.h>
 #include <string.h>
 
@@ -15,6 +18,20 @@ void make_ota_versions_activity(gui_activity_t** activity_ptr, const char* curre
     const char* expected_hash_hexstr, bool full_fw_hash);
 void make_show_ota_hash_activity(gui_activity_t** activity_ptr, const char* expected_hash_hexstr, bool full_fw_hash);
 
+// Upload progress is checkpointed each time this much more of the final image is written
+#define OTA_CHECKPOINT_INTERVAL (64 * 1024)
+#define OTA_CHECKPOINT_VERSION 1
+
+// Checkpoint offsets are aligned so no written bytes are held back by esp_ota_write() (eg. when encrypting)
+#define OTA_CHECKPOINT_ALIGNMENT 16
+
+// The partition prefix is re-verified and re-written in flash sector sized chunks
+#define OTA_RESUME_CHUNK_SIZE 4096
+
+// The image checksum seed, and the alignment of the image end (the last byte of which is the checksum)
+#define OTA_IMAGE_CHECKSUM_SEED 0xEF
+#define OTA_IMAGE_ALIGNMENT 16
+
 const __attribute__((section(".rodata_custom_desc"))) esp_custom_app_desc_t custom_app_desc
     = { .version = 1, .board_type = JADE_OTA_BOARD_TYPE, .features = JADE_OTA_FEATURES, .config = JADE_OTA_CONFIG };
 
@@ -131,7 +148,18 @@ bool ota_init(jade_ota_ctx_t* joctx)
 
     mbedtls_sha256_starts(joctx->sha_ctx, 0);
 
-    const esp_err_t err = esp_ota_begin(joctx->update_partition, joctx->firmwaresize, joctx->ota_handle);
+    memset(&joctx->image_check, 0, sizeof(joctx->image_check));
+    joctx->image_check.state = IMAGE_HEADER;
+    joctx->image_check.remaining = sizeof(esp_image_header_t);
+    joctx->image_check.checksum = OTA_IMAGE_CHECKSUM_SEED;
+
+    // A new upload invalidates any checkpoint, as the partition is erased.
+    // When resuming, erase only as the image is (re-)written, preserving the prefix already written.
+    if (!joctx->resume_offset) {
+        ota_checkpoint_clear();
+    }
+    const size_t image_size = joctx->resume_offset ? OTA_WITH_SEQUENTIAL_WRITES : joctx->firmwaresize;
+    const esp_err_t err = esp_ota_begin(joctx->update_partition, image_size, joctx->ota_handle);
     if (err != ESP_OK) {
         JADE_LOGE("Failed to begin ota, error: %d", err);
         return false;
@@ -140,6 +168,132 @@ bool ota_init(jade_ota_ctx_t* joctx)
     return true;
 }
 
+// Move on to the next part of the image once the current part is complete
+static void image_check_next(jade_ota_ctx_t* joctx)
+{
+    ota_image_check_t* const check = &joctx->image_check;
+    JADE_ASSERT(!check->remaining);
+
+    switch (check->state) {
+    case IMAGE_HEADER:
+        if (check->field.header.magic != ESP_IMAGE_HEADER_MAGIC || !check->field.header.segment_count
+            || check->field.header.segment_count > ESP_IMAGE_MAX_SEGMENTS) {
+            JADE_LOGW("Unexpected image header");
+            check->state = IMAGE_INVALID;
+            return;
+        }
+        check->segments_remaining = check->field.header.segment_count;
+        check->hash_appended = check->field.header.hash_appended;
+        check->state = IMAGE_SEGMENT_HEADER;
+        check->remaining = sizeof(esp_image_segment_header_t);
+        break;
+
+    case IMAGE_SEGMENT_HEADER:
+        if (check->field.segment_header.data_len % sizeof(uint32_t)
+            || check->field.segment_header.data_len >= joctx->firmwaresize - check->pos) {
+            JADE_LOGW("Unexpected image segment length %lu", check->field.segment_header.data_len);
+            check->state = IMAGE_INVALID;
+            return;
+        }
+        check->state = IMAGE_SEGMENT_DATA;
+        check->remaining = check->field.segment_header.data_len;
+        break;
+
+    case IMAGE_SEGMENT_DATA:
+        if (--check->segments_remaining) {
+            check->state = IMAGE_SEGMENT_HEADER;
+            check->remaining = sizeof(esp_image_segment_header_t);
+        } else {
+            // Padded so the checksum is the last byte of an aligned block
+            check->state = IMAGE_PADDING;
+            check->remaining = OTA_IMAGE_ALIGNMENT - (check->pos % OTA_IMAGE_ALIGNMENT);
+        }
+        break;
+
+    case IMAGE_PADDING:
+        // The checksum of the segment data should now be zero, having xor'd the stored checksum byte
+        if (check->checksum) {
+            JADE_LOGW("Image checksum mismatch");
+            check->state = IMAGE_INVALID;
+            return;
+        }
+        if (!check->hash_appended) {
+            check->state = IMAGE_VERIFIED;
+            return;
+        }
+
+        // The appended digest is of the image so far - take a copy of the running hash
+        mbedtls_sha256_context digest_ctx;
+        mbedtls_sha256_init(&digest_ctx);
+        mbedtls_sha256_clone(&digest_ctx, joctx->sha_ctx);
+        mbedtls_sha256_finish(&digest_ctx, check->calculated_digest);
+        mbedtls_sha256_free(&digest_ctx);
+
+        check->state = IMAGE_DIGEST;
+        check->remaining = sizeof(check->field.digest);
+        break;
+
+    case IMAGE_DIGEST:
+        if (sodium_memcmp(check->field.digest, check->calculated_digest, sizeof(check->calculated_digest))) {
+            JADE_LOGW("Image digest mismatch");
+            check->state = IMAGE_INVALID;
+            return;
+        }
+        check->state = IMAGE_VERIFIED;
+        return;
+
+    default:
+        JADE_ASSERT_MSG(false, "Unexpected image check state %u", check->state);
+    }
+    check->field_len = 0;
+}
+
+// Add data written to the final image to the running hash, and to the incremental checks of the image structure.
+void ota_hash_image_data(jade_ota_ctx_t* joctx, const uint8_t* data, const size_t len)
+{
+    JADE_ASSERT(joctx);
+    JADE_ASSERT(data);
+    JADE_ASSERT(joctx->hash_type == HASHTYPE_FULLFWDATA);
+
+    ota_image_check_t* const check = &joctx->image_check;
+    size_t processed = 0;
+    while (processed < len && check->state != IMAGE_VERIFIED && check->state != IMAGE_INVALID) {
+        const uint8_t* const chunk = data + processed;
+        const size_t n = len - processed < check->remaining ? len - processed : check->remaining;
+
+        if (check->state == IMAGE_SEGMENT_DATA) {
+            for (size_t i = 0; i < n; ++i) {
+                check->checksum ^= chunk[i];
+            }
+        } else if (check->state == IMAGE_PADDING) {
+            // The stored checksum is the last byte of the padding
+            if (n == check->remaining) {
+                check->checksum ^= chunk[n - 1];
+            }
+        } else {
+            uint8_t* const field = (uint8_t*)&check->field;
+            memcpy(field + check->field_len, chunk, n);
+            check->field_len += n;
+        }
+
+        // NOTE: image_check_next() copies the running hash after the padding, before any digest is hashed
+        mbedtls_sha256_update(joctx->sha_ctx, chunk, n);
+        processed += n;
+        check->pos += n;
+        check->remaining -= n;
+
+        if (!check->remaining) {
+            image_check_next(joctx);
+        }
+    }
+
+    // Any remainder (eg. a signature block)
+    if (processed < len) {
+        mbedtls_sha256_update(joctx->sha_ctx, data + processed, len - processed);
+        check->pos += len - processed;
+    }
+}
+
 enum ota_status post_ota_check(jade_ota_ctx_t* joctx, bool* ota_end_called)
 {
     JADE_ASSERT(joctx);
@@ -176,12 +330,21 @@ enum ota_status post_ota_check(jade_ota_ctx_t* joctx, bool* ota_end_called)
         return ERROR_BAD_HASH;
     }
 
-    // All good, finalise the ota and set the partition to boot
-    esp_err_t err = esp_ota_end(*joctx->ota_handle);
+    // All good, finalise the ota and set the partition to boot.
+    // esp_ota_end() reads back and verifies the entire image, as does esp_ota_set_boot_partition() (including any
+    // secure boot signature check).  If the image was verified incrementally as it was written, the ota handle is
+    // released without the first read-back - the second remains authoritative.
+    // NOTE: with flash encryption any trailing partial block is only written by esp_ota_end().
+    const bool verified_as_written = joctx->hash_type == HASHTYPE_FULLFWDATA
+        && joctx->image_check.state == IMAGE_VERIFIED
+        && !(esp_flash_encryption_enabled() && joctx->firmwaresize % OTA_IMAGE_ALIGNMENT);
+    const TickType_t start_time = xTaskGetTickCount();
+
+    esp_err_t err = verified_as_written ? esp_ota_abort(*joctx->ota_handle) : esp_ota_end(*joctx->ota_handle);
     *ota_end_called = true;
 
     if (err != ESP_OK) {
-        JADE_LOGE("esp_ota_end() returned %d", err);
+        JADE_LOGE("%s() returned %d", verified_as_written ? "esp_ota_abort" : "esp_ota_end", err);
         return ERROR_FINISH;
     }
 
@@ -191,6 +354,9 @@ enum ota_status post_ota_check(jade_ota_ctx_t* joctx, bool* ota_end_called)
         return ERROR_SETPARTITION;
     }
 
+    JADE_LOGI("Finalising ota took %lums, image %s", (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS,
+        verified_as_written ? "verified as written" : "verified by esp_ota_end()");
+
     return SUCCESS;
 }
 
@@ -288,7 +454,7 @@ enum ota_status ota_user_validation(jade_ota_ctx_t* joctx, const uint8_t* uncomp
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_ACCEPT_OTA;
 #endif
@@ -317,3 +483,173 @@ enum ota_status ota_user_validation(jade_ota_ctx_t* joctx, const uint8_t* uncomp
 
     return SUCCESS;
 }
+
+// Persist a checkpoint of an upload if a further OTA_CHECKPOINT_INTERVAL bytes of the final image have
+// been written since the last.  'offset' is the number of bytes of the final image written to the partition.
+// NOTE: failure to persist a checkpoint is not fatal to the upload.
+void ota_checkpoint(jade_ota_ctx_t* joctx, const size_t offset)
+{
+    JADE_ASSERT(joctx);
+    JADE_ASSERT(joctx->update_partition);
+
+    if (joctx->hash_type != HASHTYPE_FULLFWDATA || offset % OTA_CHECKPOINT_ALIGNMENT
+        || offset < joctx->last_checkpoint + OTA_CHECKPOINT_INTERVAL) {
+        return;
+    }
+
+    ota_checkpoint_t checkpoint = { .version = OTA_CHECKPOINT_VERSION,
+        .fwsize = joctx->firmwaresize,
+        .partition_address = joctx->update_partition->address,
+        .offset = offset };
+    memcpy(checkpoint.fwhash, joctx->expected_hash, sizeof(checkpoint.fwhash));
+
+    // Hash of the image written so far, from a copy of the running hash
+    mbedtls_sha256_context prefix_ctx;
+    mbedtls_sha256_init(&prefix_ctx);
+    mbedtls_sha256_clone(&prefix_ctx, joctx->sha_ctx);
+    mbedtls_sha256_finish(&prefix_ctx, checkpoint.prefix_hash);
+    mbedtls_sha256_free(&prefix_ctx);
+
+    if (!storage_set_ota_checkpoint((const uint8_t*)&checkpoint, sizeof(checkpoint))) {
+        JADE_LOGW("Failed to persist ota checkpoint at %u", offset);
+        return;
+    }
+    JADE_LOGI("Persisted ota checkpoint at %u", offset);
+    joctx->last_checkpoint = offset;
+}
+
+bool ota_checkpoint_load(ota_checkpoint_t* checkpoint)
+{
+    JADE_ASSERT(checkpoint);
+
+    if (!storage_get_ota_checkpoint((uint8_t*)checkpoint, sizeof(ota_checkpoint_t))) {
+        return false;
+    }
+    if (checkpoint->version != OTA_CHECKPOINT_VERSION || !checkpoint->offset
+        || checkpoint->offset >= checkpoint->fwsize) {
+        JADE_LOGW("Ignoring invalid ota checkpoint");
+        return false;
+    }
+    return true;
+}
+
+void ota_checkpoint_clear(void)
+{
+    if (!storage_erase_ota_checkpoint()) {
+        JADE_LOGW("Failed to erase ota checkpoint");
+    }
+}
+
+// Called when an upload ends without success - any checkpoint is kept only if the upload was interrupted
+// (by some other message arriving).  Returns whether the upload can be resumed.
+bool ota_checkpoint_keep_if_resumable(const enum ota_status status)
+{
+    ota_checkpoint_t checkpoint;
+    if (status == ERROR_BADDATA && ota_checkpoint_load(&checkpoint)) {
+        JADE_LOGI("Ota upload interrupted, can be resumed from %lu", checkpoint.offset);
+        return true;
+    }
+    ota_checkpoint_clear();
+    return false;
+}
+
+// { "fwhash": <bytes>, "fwsize": <bytes>, "offset": <bytes written> } or null if no checkpoint
+void ota_checkpoint_encode(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(container);
+
+    if (!ctx) {
+        const CborError cberr = cbor_encode_null(container);
+        JADE_ASSERT(cberr == CborNoError);
+        return;
+    }
+
+    const ota_checkpoint_t* checkpoint = (const ota_checkpoint_t*)ctx;
+
+    CborEncoder map_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &map_encoder, 3);
+    JADE_ASSERT(cberr == CborNoError);
+
+    add_bytes_to_map(&map_encoder, "fwhash", checkpoint->fwhash, sizeof(checkpoint->fwhash));
+    add_uint_to_map(&map_encoder, "fwsize", checkpoint->fwsize);
+    add_uint_to_map(&map_encoder, "offset", checkpoint->offset);
+
+    cberr = cbor_encoder_close_container(container, &map_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+
+// Prepare to resume an interrupted upload: re-verify the partition prefix written before the interruption against
+// the checkpoint (which also restores the running hash of the final image), have the user confirm the firmware
+// version (from the prefix), then re-write the prefix through the new ota handle so it continues from 'offset'.
+// NOTE: ota_init() must have been called with joctx->resume_offset set to the checkpoint offset.
+enum ota_status ota_resume_from_checkpoint(jade_ota_ctx_t* joctx, const ota_checkpoint_t* checkpoint)
+{
+    JADE_ASSERT(joctx);
+    JADE_ASSERT(checkpoint);
+    JADE_ASSERT(joctx->hash_type == HASHTYPE_FULLFWDATA);
+    JADE_ASSERT(joctx->update_partition);
+    JADE_ASSERT(checkpoint->offset == joctx->resume_offset);
+    JADE_ASSERT(checkpoint->offset >= CUSTOM_HEADER_MIN_WRITE);
+
+    if (checkpoint->partition_address != joctx->update_partition->address) {
+        JADE_LOGE("Ota checkpoint is for a different partition");
+        return ERROR_BADPARTITION;
+    }
+
+    enum ota_status status = SUCCESS;
+    uint8_t* const buf = JADE_MALLOC_PREFER_SPIRAM(OTA_RESUME_CHUNK_SIZE);
+
+    // 1. Re-verify the prefix
+    for (size_t pos = 0; pos < checkpoint->offset; pos += OTA_RESUME_CHUNK_SIZE) {
+        const size_t len = checkpoint->offset - pos < OTA_RESUME_CHUNK_SIZE ? checkpoint->offset - pos
+                                                                            : OTA_RESUME_CHUNK_SIZE;
+        if (esp_partition_read(joctx->update_partition, pos, buf, len) != ESP_OK) {
+            JADE_LOGE("Failed to read ota partition at %u", pos);
+            status = ERROR_BADPARTITION;
+            goto cleanup;
+        }
+        ota_hash_image_data(joctx, buf, len);
+    }
+
+    uint8_t prefix_hash[SHA256_LEN];
+    mbedtls_sha256_context prefix_ctx;
+    mbedtls_sha256_init(&prefix_ctx);
+    mbedtls_sha256_clone(&prefix_ctx, joctx->sha_ctx);
+    mbedtls_sha256_finish(&prefix_ctx, prefix_hash);
+    mbedtls_sha256_free(&prefix_ctx);
+
+    if (sodium_memcmp(prefix_hash, checkpoint->prefix_hash, sizeof(prefix_hash))) {
+        JADE_LOGE("Ota partition prefix does not match checkpoint");
+        status = ERROR_BAD_HASH;
+        goto cleanup;
+    }
+
+    // 2. User to confirm the firmware version, from the image header
+    if (esp_partition_read(joctx->update_partition, 0, buf, CUSTOM_HEADER_MIN_WRITE) != ESP_OK) {
+        status = ERROR_BADPARTITION;
+        goto cleanup;
+    }
+    status = ota_user_validation(joctx, buf);
+    if (status != SUCCESS) {
+        goto cleanup;
+    }
+
+    // 3. Re-write the prefix, so the ota handle continues from the checkpoint
+    // NOTE: each sector is read before esp_ota_write() erases and re-writes it
+    for (size_t pos = 0; pos < checkpoint->offset; pos += OTA_RESUME_CHUNK_SIZE) {
+        const size_t len = checkpoint->offset - pos < OTA_RESUME_CHUNK_SIZE ? checkpoint->offset - pos
+                                                                            : OTA_RESUME_CHUNK_SIZE;
+        if (esp_partition_read(joctx->update_partition, pos, buf, len) != ESP_OK
+            || esp_ota_write(*joctx->ota_handle, buf, len) != ESP_OK) {
+            JADE_LOGE("Failed to re-write ota partition at %u", pos);
+            status = ERROR_WRITE;
+            goto cleanup;
+        }
+        update_progress_bar(&joctx->progress_bar, joctx->firmwaresize, pos + len);
+    }
+    joctx->last_checkpoint = checkpoint->offset;
+
+cleanup:
+    free(buf);
+    return status;
+}
@@ -10,6 +10,7 @@
 #include <mbedtls/sha256.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <wally_crypto.h>
 
 #define VERSION_STRING_MAX_LENGTH 32
 
@@ -34,6 +35,34 @@ typedef struct {
 
 typedef enum { HASHTYPE_FILEDATA, HASHTYPE_FULLFWDATA } hash_type_t;
 
+typedef enum {
+    IMAGE_HEADER,
+    IMAGE_SEGMENT_HEADER,
+    IMAGE_SEGMENT_DATA,
+    IMAGE_PADDING,
+    IMAGE_DIGEST,
+    IMAGE_VERIFIED,
+    IMAGE_INVALID
+} ota_image_state_t;
+
+// The checks esp_image_verify() makes when reading an image back from flash (header and segment layout,
+// checksum and any appended sha256 digest), made incrementally as the final image is written.
+typedef struct {
+    ota_image_state_t state;
+    size_t pos; // bytes of the image processed
+    size_t remaining; // bytes remaining of the current header/segment/padding/digest
+    size_t field_len; // bytes of the current header/digest collected
+    union {
+        esp_image_header_t header;
+        esp_image_segment_header_t segment_header;
+        uint8_t digest[SHA256_LEN];
+    } field;
+    uint8_t segments_remaining;
+    bool hash_appended;
+    uint8_t checksum;
+    uint8_t calculated_digest[SHA256_LEN];
+} ota_image_check_t;
+
 typedef struct {
     progress_bar_t progress_bar;
     mbedtls_sha256_context* sha_ctx;
@@ -52,8 +81,23 @@ typedef struct {
     size_t uncompressedsize;
     size_t compressedsize;
     size_t firmwaresize;
+    size_t resume_offset; // non-zero when resuming an interrupted upload
+    size_t last_checkpoint;
+    ota_image_check_t image_check; // only when hash_type is HASHTYPE_FULLFWDATA
 } jade_ota_ctx_t;
 
+// Progress of an upload, persisted so that if interrupted it can be resumed from 'offset' once the
+// partition prefix has been re-verified against 'prefix_hash'.  Only uploads verified by the hash of
+// the final firmware image are checkpointed, as the host resumes by sending the remaining image.
+typedef struct {
+    uint8_t version;
+    uint8_t fwhash[SHA256_LEN];
+    uint32_t fwsize;
+    uint32_t partition_address;
+    uint32_t offset;
+    uint8_t prefix_hash[SHA256_LEN];
+} ota_checkpoint_t;
+
 enum ota_status {
     SUCCESS = 0,
     ERROR_OTA_SETUP,
@@ -92,7 +136,15 @@ static const char MESSAGES[][20] = {
 void handle_in_bin_data(void* ctx, uint8_t* data, size_t rawsize);
 
 bool ota_init(jade_ota_ctx_t* joctx);
+void ota_hash_image_data(jade_ota_ctx_t* joctx, const uint8_t* data, size_t len);
 enum ota_status post_ota_check(jade_ota_ctx_t* joctx, bool* ota_end_called);
 enum ota_status ota_user_validation(jade_ota_ctx_t* joctx, const uint8_t* uncompressed);
 
+void ota_checkpoint(jade_ota_ctx_t* joctx, size_t offset);
+bool ota_checkpoint_load(ota_checkpoint_t* checkpoint);
+void ota_checkpoint_clear(void);
+bool ota_checkpoint_keep_if_resumable(enum ota_status status);
+void ota_checkpoint_encode(const void* ctx, CborEncoder* container);
+enum ota_status ota_resume_from_checkpoint(jade_ota_ctx_t* joctx, const ota_checkpoint_t* checkpoint);
+
 #endif /* JADE_OTA_UTIL_H_ */
@@ -23,6 +23,8 @@ extern const uint8_t server_public_key_start[] asm("_binary_pinserver_public_key
 static const char PINSERVER_DOC_INIT[] = "start_handshake";
 static const char PINSERVER_DOC_GET_PIN[] = "get_pin";
 static const char PINSERVER_DOC_SET_PIN[] = "set_pin";
+static const char PINSERVER_DOC_GET_PIN_ONESHOT[] = "get_pin_oneshot";
+static const char PINSERVER_DOC_SET_PIN_ONESHOT[] = "set_pin_oneshot";
 
 #define PIN_SECRET_LEN HMAC_SHA256_LEN
 #define ENTROPY_LEN HMAC_SHA256_LEN
@@ -87,8 +89,8 @@ static void add_hex_bytes_to_map(CborEncoder* container, const char* name, const
 static void add_urls(CborEncoder* encoder, const char* document)
 {
     char buf[MAX_PINSVR_URL_LENGTH];
-    char urlA[sizeof(buf) + sizeof(PINSERVER_DOC_INIT)];
-    char urlB[sizeof(buf) + sizeof(PINSERVER_DOC_INIT)];
+    char urlA[sizeof(buf) + sizeof(PINSERVER_DOC_GET_PIN_ONESHOT)];
+    char urlB[sizeof(buf) + sizeof(PINSERVER_DOC_GET_PIN_ONESHOT)];
 
     // Get first URL (defaults to h/coded url)
     size_t urlA_len = 0;
@@ -177,7 +179,7 @@ static void http_post_cbor(const void* ctx, CborEncoder* container)
     // If we have payload data, add that
     const handshake_data_t* payload_data = envelope_data->data;
     if (payload_data) {
-        JADE_ASSERT(payload_data->ske);
+        // NOTE: ske is omitted in the single round-trip protocol, as the server's static key is used
         JADE_ASSERT(payload_data->cke);
         JADE_ASSERT(payload_data->encrypted_data);
         JADE_ASSERT(payload_data->hmac_encrypted_data);
@@ -186,11 +188,13 @@ static void http_post_cbor(const void* ctx, CborEncoder* container)
         JADE_ASSERT(cberr == CborNoError);
 
         CborEncoder data_encoder;
-        cberr = cbor_encoder_create_map(&params_encoder, &data_encoder, 4);
+        cberr = cbor_encoder_create_map(&params_encoder, &data_encoder, payload_data->ske ? 4 : 3);
         JADE_ASSERT(cberr == CborNoError);
 
         // Handshake payload data
-        add_hex_bytes_to_map(&data_encoder, "ske", payload_data->ske, EC_PUBLIC_KEY_LEN);
+        if (payload_data->ske) {
+            add_hex_bytes_to_map(&data_encoder, "ske", payload_data->ske, EC_PUBLIC_KEY_LEN);
+        }
         add_hex_bytes_to_map(&data_encoder, "cke", payload_data->cke, EC_PUBLIC_KEY_LEN);
         add_hex_bytes_to_map(&data_encoder, "encrypted_data", payload_data->encrypted_data, CLIENT_REQUEST_PAYLOAD_LEN);
         add_hex_bytes_to_map(&data_encoder, "hmac_encrypted_data", payload_data->hmac_encrypted_data, HMAC_SHA256_LEN);
@@ -215,6 +219,78 @@ static void http_post_cbor(const void* ctx, CborEncoder* container)
     JADE_ASSERT(cberr == CborNoError);
 }
 
+// Helper to get the pinserver's static pubkey - can be default or overridden by user
+static bool get_server_pubkey(uint8_t* pubkey, const size_t pubkey_len)
+{
+    JADE_ASSERT(pubkey);
+    JADE_ASSERT(pubkey_len == EC_PUBLIC_KEY_LEN);
+
+    if (!storage_get_pinserver_pubkey(pubkey, pubkey_len)) {
+        memcpy(pubkey, server_public_key_start, pubkey_len);
+    }
+
+    if (wally_ec_public_key_verify(pubkey, pubkey_len) != WALLY_OK) {
+        JADE_LOGE("Invalid pinserver pubkey!");
+        return false;
+    }
+    return true;
+}
+
+// {
+//   "pin_request": {
+//     "document": `document`,  ** posted to the default pinserver single round-trip endpoint
+//     "cke": <bytes>,
+//     "encrypted_data": <bytes>,
+//     "hmac_encrypted_data": <bytes>
+//   }
+// }
+// Compact form of the single round-trip request for QR mode - binary fields only,
+// the urls/method etc. of the http envelope are implied.
+static void pin_request_cbor(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(ctx);
+
+    const handshake_reply_t* envelope_data = (const handshake_reply_t*)ctx;
+    JADE_ASSERT(envelope_data->document);
+
+    const handshake_data_t* payload_data = envelope_data->data;
+    JADE_ASSERT(payload_data);
+    JADE_ASSERT(!payload_data->ske);
+    JADE_ASSERT(payload_data->cke);
+    JADE_ASSERT(payload_data->encrypted_data);
+    JADE_ASSERT(payload_data->hmac_encrypted_data);
+
+    CborEncoder root_map;
+    CborError cberr = cbor_encoder_create_map(container, &root_map, 1);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encode_text_stringz(&root_map, "pin_request");
+    JADE_ASSERT(cberr == CborNoError);
+
+    CborEncoder data_encoder;
+    cberr = cbor_encoder_create_map(&root_map, &data_encoder, 4);
+    JADE_ASSERT(cberr == CborNoError);
+
+    add_string_to_map(&data_encoder, "document", envelope_data->document);
+    add_bytes_to_map(&data_encoder, "cke", payload_data->cke, EC_PUBLIC_KEY_LEN);
+    add_bytes_to_map(&data_encoder, "encrypted_data", payload_data->encrypted_data, CLIENT_REQUEST_PAYLOAD_LEN);
+    add_bytes_to_map(&data_encoder, "hmac_encrypted_data", payload_data->hmac_encrypted_data, HMAC_SHA256_LEN);
+
+    cberr = cbor_encoder_close_container(&root_map, &data_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encoder_close_container(container, &root_map);
+    JADE_ASSERT(cberr == CborNoError);
+}
+
+// Whether the pinserver urls are the defaults (ie. not overridden in storage)
+static bool using_default_pinserver_urls(void)
+{
+    char buf[MAX_PINSVR_URL_LENGTH];
+    size_t written = 0;
+    return !storage_get_pinserver_urlA(buf, sizeof(buf), &written);
+}
+
 // Hepler to verify the server ske is correctly signed - ie. that the server is valid
 static bool verify_server_signature(const uint8_t* ske, const size_t ske_len, const uint8_t* sig, const size_t sig_len)
 {
@@ -223,15 +299,8 @@ static bool verify_server_signature(const uint8_t* ske, const size_t ske_len, co
     JADE_ASSERT(ske_len == EC_PUBLIC_KEY_LEN);
     JADE_ASSERT(sig_len == EC_SIGNATURE_LEN);
 
-    // The pinserver pubkey - can be default or overridden by user
-    const uint8_t* pubkey = server_public_key_start;
-    uint8_t user_pubkey[EC_PUBLIC_KEY_LEN];
-    if (storage_get_pinserver_pubkey(user_pubkey, sizeof(user_pubkey))) {
-        pubkey = user_pubkey;
-    }
-
-    if (wally_ec_public_key_verify(pubkey, EC_PUBLIC_KEY_LEN) != WALLY_OK) {
-        JADE_LOGE("Invalid pinserver pubkey!");
+    uint8_t pubkey[EC_PUBLIC_KEY_LEN];
+    if (!get_server_pubkey(pubkey, sizeof(pubkey))) {
         return false;
     }
 
@@ -353,12 +422,14 @@ static bool decrypt_reply(const uint8_t* aeskey, const uint8_t* encrypted, const
 
 // Trigger, and then parse, handshake_init message
 // Sets-up the ECDH and the ephemeral encryption keys - populates pinkeys structure
+// Also returns whether the server advertises the single round-trip protocol.
 // Returns a small struct containing the success/fail, whether it is a 'hard' or
 // 'retryable' error, and any error code/message that should be sent.
-static pinserver_result_t start_handshake(jade_process_t* process, pin_keys_t* pinkeys)
+static pinserver_result_t start_handshake(jade_process_t* process, pin_keys_t* pinkeys, bool* server_oneshot)
 {
     JADE_ASSERT(process);
     JADE_ASSERT(pinkeys);
+    JADE_ASSERT(server_oneshot);
     ASSERT_HAS_CURRENT_MESSAGE(process);
 
     CborValue params;
@@ -421,6 +492,10 @@ static pinserver_result_t start_handshake(jade_process_t* process, pin_keys_t* p
         RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "Cannot initiate handshake - ske and/or sig invalid");
     }
 
+    // Optional flag indicating the server also supports the single round-trip protocol
+    *server_oneshot = false;
+    rpc_get_boolean("oneshot", &params, server_oneshot);
+
     // Derive all the various encryption keys
     JADE_LOGD("Deriving shared secrets/keys");
     if (!generate_ecdh_pinkeys(ske, sizeof(ske), pinkeys)) {
@@ -443,7 +518,7 @@ static pinserver_result_t complete_handshake(
     JADE_ASSERT(pinkeys);
     JADE_ASSERT(serverkey);
     JADE_ASSERT(serverkey_len == AES_KEY_LEN_256);
-    ASSERT_CURRENT_MESSAGE(process, "handshake_init");
+    ASSERT_HAS_CURRENT_MESSAGE(process);
 
     CborValue params;
     uint8_t aes_encrypted[SERVER_REPLY_PAYLOAD_LEN];
@@ -470,29 +545,36 @@ static pinserver_result_t complete_handshake(
         RETURN_RESULT(CAN_RETRY, CBOR_RPC_BAD_PARAMETERS, "Failed to read parameters from PinServer");
     }
 
+    // NOTE: fields are hex strings as returned by the pinserver, or may be
+    // binary if relayed in compact form (eg. from QR mode)
+
     // encrypted key
-    size_t len = 0;
-    rpc_get_string("encrypted_key", sizeof(tmpstr), &params, tmpstr, &len);
-    if (len == 0) {
-        RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "encrypted_key missing");
-    }
+    if (!rpc_get_n_bytes("encrypted_key", &params, sizeof(aes_encrypted), aes_encrypted)) {
+        size_t len = 0;
+        rpc_get_string("encrypted_key", sizeof(tmpstr), &params, tmpstr, &len);
+        if (len == 0) {
+            RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "encrypted_key missing");
+        }
 
-    len = 0;
-    if (wally_hex_to_bytes(tmpstr, aes_encrypted, sizeof(aes_encrypted), &len) != WALLY_OK
-        || len != SERVER_REPLY_PAYLOAD_LEN) {
-        RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "encrypted_key invalid");
+        len = 0;
+        if (wally_hex_to_bytes(tmpstr, aes_encrypted, sizeof(aes_encrypted), &len) != WALLY_OK
+            || len != SERVER_REPLY_PAYLOAD_LEN) {
+            RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "encrypted_key invalid");
+        }
     }
 
     // hmac
-    len = 0;
-    rpc_get_string("hmac", sizeof(tmpstr), &params, tmpstr, &len);
-    if (len == 0) {
-        RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "hmac missing");
-    }
+    if (!rpc_get_n_bytes("hmac", &params, sizeof(aes_hmac), aes_hmac)) {
+        size_t len = 0;
+        rpc_get_string("hmac", sizeof(tmpstr), &params, tmpstr, &len);
+        if (len == 0) {
+            RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "hmac missing");
+        }
 
-    len = 0;
-    if (wally_hex_to_bytes(tmpstr, aes_hmac, sizeof(aes_hmac), &len) != WALLY_OK || len != HMAC_SHA256_LEN) {
-        RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "hmac invalid");
+        len = 0;
+        if (wally_hex_to_bytes(tmpstr, aes_hmac, sizeof(aes_hmac), &len) != WALLY_OK || len != HMAC_SHA256_LEN) {
+            RETURN_RESULT(FAILURE, CBOR_RPC_BAD_PARAMETERS, "hmac invalid");
+        }
     }
 
     // Decrypt the message payload and check hmacs
@@ -571,20 +653,21 @@ static bool hmac_ckepayload(const pin_keys_t* pinkeys, const uint8_t* payload, u
         == WALLY_OK;
 }
 
-// Dance with the pinserver to obtain the final aes-key - start handshake,
-// compute shared secrets, fetch server key, and then compute final aes key.
-static pinserver_result_t pinserver_interaction(jade_process_t* process, const uint8_t* pin, const size_t pin_len,
-    const char* document, uint8_t* finalaes, const size_t finalaes_len)
+// Generate, sign, encrypt and hmac the pin data, and send it to the given pinserver document.
+// Then await and decrypt the server's reply to get the server's aes key for the pin.
+// The ske is included in the payload only for the two-step protocol.
+static pinserver_result_t post_pin_payload(jade_process_t* process, const pin_keys_t* pinkeys, const bool include_ske,
+    const uint8_t* pin, const size_t pin_len, const char* document, uint8_t* serverkey, const size_t serverkey_len)
 {
     JADE_ASSERT(process);
+    JADE_ASSERT(pinkeys);
     JADE_ASSERT(pin);
     JADE_ASSERT(pin_len > 0);
     JADE_ASSERT(document);
-    JADE_ASSERT(finalaes);
-    JADE_ASSERT(finalaes_len == AES_KEY_LEN_256);
+    JADE_ASSERT(serverkey);
+    JADE_ASSERT(serverkey_len == AES_KEY_LEN_256);
     ASSERT_HAS_CURRENT_MESSAGE(process);
 
-    pin_keys_t pinkeys;
     uint8_t pin_privatekey[EC_PRIVATE_KEY_LEN];
     uint8_t pinsecret[PIN_SECRET_LEN];
     uint8_t entropy[ENTROPY_LEN];
@@ -592,17 +675,12 @@ static pinserver_result_t pinserver_interaction(jade_process_t* process, const u
     uint8_t payload[CLIENT_REQUEST_PAYLOAD_LEN];
     uint8_t hmac_payload[HMAC_SHA256_LEN];
 
-    SENSITIVE_PUSH(&pinkeys, sizeof(pinkeys));
     SENSITIVE_PUSH(pin_privatekey, sizeof(pin_privatekey));
     SENSITIVE_PUSH(pinsecret, sizeof(pinsecret));
     SENSITIVE_PUSH(entropy, sizeof(entropy));
     SENSITIVE_PUSH(sig, sizeof(sig));
 
-    // Start the pinserver handshake and derive the shared encryption keys
-    pinserver_result_t retval = start_handshake(process, &pinkeys);
-    if (retval.result != SUCCESS) {
-        goto cleanup;
-    }
+    pinserver_result_t retval = { .result = SUCCESS, .errorcode = 0, .message = NULL };
 
     // Generate, sign, encrypt and hmac the pin data to send
     JADE_LOGI("Generating pinserver payload");
@@ -610,9 +688,9 @@ static pinserver_result_t pinserver_interaction(jade_process_t* process, const u
 
     if (!storage_get_pin_privatekey(pin_privatekey, sizeof(pin_privatekey))
         || !get_pin_secret(pin, pin_len, pin_privatekey, pinsecret)
-        || !sign_payload(pin_privatekey, pinkeys.cke, pinsecret, entropy, sig)
-        || !encrypt_payload(pinkeys.encrypt_key, pinsecret, entropy, sig, payload, sizeof(payload))
-        || !hmac_ckepayload(&pinkeys, payload, hmac_payload)) {
+        || !sign_payload(pin_privatekey, pinkeys->cke, pinsecret, entropy, sig)
+        || !encrypt_payload(pinkeys->encrypt_key, pinsecret, entropy, sig, payload, sizeof(payload))
+        || !hmac_ckepayload(pinkeys, payload, hmac_payload)) {
         // Internal failure
         retval.result = FAILURE;
         retval.errorcode = CBOR_RPC_INTERNAL_ERROR;
@@ -621,47 +699,173 @@ static pinserver_result_t pinserver_interaction(jade_process_t* process, const u
     }
 
     // Build and send cbor reply
-    const handshake_data_t payload_data
-        = { .ske = pinkeys.ske, .cke = pinkeys.cke, .encrypted_data = payload, .hmac_encrypted_data = hmac_payload };
+    // In QR mode the single round-trip request to the default pinserver is sent in compact form
+    const handshake_data_t payload_data = { .ske = include_ske ? pinkeys->ske : NULL,
+        .cke = pinkeys->cke,
+        .encrypted_data = payload,
+        .hmac_encrypted_data = hmac_payload };
     const handshake_reply_t handshake_complete
         = { .document = document, .on_reply = "handshake_complete", .data = &payload_data };
-    jade_process_reply_to_message_result(process->ctx, &handshake_complete, http_post_cbor);
+    const bool compact = !include_ske && process->ctx.source == SOURCE_QR && using_default_pinserver_urls();
+    jade_process_reply_to_message_result(
+        process->ctx, &handshake_complete, compact ? pin_request_cbor : http_post_cbor);
 
     // Get the server's aes key for the given pin/key data
-    uint8_t serverkey[AES_KEY_LEN_256];
-    retval = complete_handshake(process, &pinkeys, serverkey, sizeof(serverkey));
-    if (retval.result != SUCCESS) {
-        goto cleanup;
-    }
-
-    // Derive the final aes key by combining the server key with the pin
-    JADE_LOGI("Deriving final aes-key");
-    JADE_WALLY_VERIFY(wally_hmac_sha256(serverkey, sizeof(serverkey), pin, pin_len, finalaes, finalaes_len));
-
-    // Success - well nothing has obviously failed anyway
-    JADE_ASSERT(retval.result == SUCCESS);
+    retval = complete_handshake(process, pinkeys, serverkey, serverkey_len);
 
 cleanup:
     SENSITIVE_POP(sig);
     SENSITIVE_POP(entropy);
     SENSITIVE_POP(pinsecret);
     SENSITIVE_POP(pin_privatekey);
+
+    return retval;
+}
+
+// Two-step protocol: start handshake to get a signed ephemeral server key,
+// compute shared secrets, then post the pin data to get the server key.
+static pinserver_result_t legacy_interaction(jade_process_t* process, const uint8_t* pin, const size_t pin_len,
+    const char* document, uint8_t* serverkey, const size_t serverkey_len, bool* server_oneshot)
+{
+    pin_keys_t pinkeys;
+    SENSITIVE_PUSH(&pinkeys, sizeof(pinkeys));
+
+    // Start the pinserver handshake and derive the shared encryption keys
+    pinserver_result_t retval = start_handshake(process, &pinkeys, server_oneshot);
+    if (retval.result == SUCCESS) {
+        retval = post_pin_payload(process, &pinkeys, true, pin, pin_len, document, serverkey, serverkey_len);
+    }
+
+    SENSITIVE_POP(&pinkeys);
+    return retval;
+}
+
+// Single round-trip protocol: compute shared secrets using the pinserver's static public key
+// (rather than a signed ephemeral key), and post the pin data immediately to get the server key.
+// Only the genuine server can decrypt the payload and produce a reply we can decrypt.
+static pinserver_result_t oneshot_interaction(jade_process_t* process, const uint8_t* pin, const size_t pin_len,
+    const char* document, uint8_t* serverkey, const size_t serverkey_len)
+{
+    pin_keys_t pinkeys;
+    SENSITIVE_PUSH(&pinkeys, sizeof(pinkeys));
+
+    pinserver_result_t retval = { .result = SUCCESS, .errorcode = 0, .message = NULL };
+
+    uint8_t server_pubkey[EC_PUBLIC_KEY_LEN];
+    JADE_LOGD("Deriving shared secrets/keys from static pinserver key");
+    if (!get_server_pubkey(server_pubkey, sizeof(server_pubkey))
+        || !generate_ecdh_pinkeys(server_pubkey, sizeof(server_pubkey), &pinkeys)) {
+        retval.result = FAILURE;
+        retval.errorcode = CBOR_RPC_INTERNAL_ERROR;
+        retval.message = "Failed to generate shared secrets";
+        goto cleanup;
+    }
+
+    retval = post_pin_payload(process, &pinkeys, false, pin, pin_len, document, serverkey, serverkey_len);
+
+cleanup:
     SENSITIVE_POP(&pinkeys);
+    return retval;
+}
+
+// Whether the pinserver advertised the single round-trip protocol in a handshake this session.
+// The flag in storage is only set once a single round-trip exchange has succeeded.
+static bool oneshot_advertised = false;
+
+// Forget the pinserver advertising the single round-trip protocol - called when the pinserver details
+// change (the flag in storage is erased with the details).
+void pinclient_reset_oneshot(void) { oneshot_advertised = false; }
+
+// Dance with the pinserver to obtain the final aes-key - get the server key for
+// the pin data, and then compute final aes key.
+// Uses the single round-trip protocol if the server has advertised it (or it has succeeded
+// previously), falling back to the two-step handshake only if that gets an empty reply.
+// NOTE: the host relays an empty reply only if the server does not have the single round-trip endpoint
+// (eg. http 404/405) - so the pin attempt was not processed, and it is safe to make it again.
+// Any other failure may follow the server having counted the attempt, so it is not repeated here.
+static pinserver_result_t pinserver_interaction(jade_process_t* process, const uint8_t* pin, const size_t pin_len,
+    const char* document, const char* document_oneshot, uint8_t* finalaes, const size_t finalaes_len)
+{
+    JADE_ASSERT(process);
+    JADE_ASSERT(pin);
+    JADE_ASSERT(pin_len > 0);
+    JADE_ASSERT(document);
+    JADE_ASSERT(document_oneshot);
+    JADE_ASSERT(finalaes);
+    JADE_ASSERT(finalaes_len == AES_KEY_LEN_256);
+    ASSERT_HAS_CURRENT_MESSAGE(process);
+
+    uint8_t serverkey[AES_KEY_LEN_256];
+    SENSITIVE_PUSH(serverkey, sizeof(serverkey));
+
+    const bool oneshot_persisted = storage_get_pinserver_oneshot();
+    const bool try_oneshot = oneshot_persisted || oneshot_advertised;
+
+    pinserver_result_t retval = { .result = FAILURE, .errorcode = 0, .message = NULL };
+    if (try_oneshot) {
+        JADE_LOGI("Attempting single round-trip pinserver protocol");
+        retval = oneshot_interaction(process, pin, pin_len, document_oneshot, serverkey, sizeof(serverkey));
+        if (retval.result == SUCCESS) {
+            // Only persisted once the server has completed a single round-trip exchange
+            if (!oneshot_persisted && !storage_set_pinserver_oneshot(true)) {
+                JADE_LOGW("Failed to persist pinserver protocol flag");
+            }
+            goto cleanup;
+        }
+        if (retval.result == CANCELLED) {
+            goto cleanup;
+        }
+
+        // Don't try the single round-trip again until the server re-advertises it
+        oneshot_advertised = false;
+        if (oneshot_persisted && !storage_set_pinserver_oneshot(false)) {
+            JADE_LOGW("Failed to clear pinserver protocol flag");
+        }
+
+        if (retval.result != CAN_RETRY) {
+            // The server may have processed the pin attempt - do not submit it again
+            JADE_LOGE("Single round-trip pinserver protocol failed (%s)", retval.message ? retval.message : "");
+            goto cleanup;
+        }
+
+        // Empty reply - the server did not process the request, fall back to the two-step handshake
+        // (replying to the empty message).
+        JADE_LOGW("Single round-trip pinserver protocol not available - falling back to handshake");
+    }
+
+    bool server_oneshot = false;
+    retval = legacy_interaction(process, pin, pin_len, document, serverkey, sizeof(serverkey), &server_oneshot);
+    if (retval.result != SUCCESS) {
+        goto cleanup;
+    }
+
+    // Note whether the server advertises the single round-trip protocol, to try it next time
+    // (but if we just tried it and it failed, don't try again until the server re-advertises it)
+    oneshot_advertised = server_oneshot && !try_oneshot;
+
+cleanup:
+    if (retval.result == SUCCESS) {
+        // Derive the final aes key by combining the server key with the pin
+        JADE_LOGI("Deriving final aes-key");
+        JADE_WALLY_VERIFY(wally_hmac_sha256(serverkey, sizeof(serverkey), pin, pin_len, finalaes, finalaes_len));
+    }
 
+    SENSITIVE_POP(serverkey);
     return retval;
 }
 
 // Dance with the pinserver to obtain the final aes-key.  Wraps pinserver interaction
 // with retry logic in-case there are http/network issues.
 static bool get_pinserver_aeskey(jade_process_t* process, const uint8_t* pin, const size_t pin_len,
-    const char* document, uint8_t* finalaes, const size_t finalaes_len)
+    const char* document, const char* document_oneshot, uint8_t* finalaes, const size_t finalaes_len)
 {
     // pinserver interaction only happens atm as a result of a call to 'auth_user'
     ASSERT_CURRENT_MESSAGE(process, "auth_user");
 
     while (true) {
         // Do the pinserver interaction dance, and get the resulting aes-key
-        const pinserver_result_t pir = pinserver_interaction(process, pin, pin_len, document, finalaes, finalaes_len);
+        const pinserver_result_t pir
+            = pinserver_interaction(process, pin, pin_len, document, document_oneshot, finalaes, finalaes_len);
 
 #ifndef CONFIG_DEBUG_UNATTENDED_CI
         // If a) the error is 'retry-able' and b) the user elects to retry, then loop and try again
@@ -691,7 +895,8 @@ bool pinclient_get(
     jade_process_t* process, const uint8_t* pin, const size_t pin_len, uint8_t* finalaes, const size_t finalaes_len)
 {
     JADE_LOGI("Fetching pinserver data");
-    return get_pinserver_aeskey(process, pin, pin_len, PINSERVER_DOC_GET_PIN, finalaes, finalaes_len);
+    return get_pinserver_aeskey(
+        process, pin, pin_len, PINSERVER_DOC_GET_PIN, PINSERVER_DOC_GET_PIN_ONESHOT, finalaes, finalaes_len);
 }
 
 // Interact with the pinserver to get a new server key
@@ -700,5 +905,6 @@ bool pinclient_set(
     jade_process_t* process, const uint8_t* pin, const size_t pin_len, uint8_t* finalaes, const size_t finalaes_len)
 {
     JADE_LOGI("Setting new pinserver data");
-    return get_pinserver_aeskey(process, pin, pin_len, PINSERVER_DOC_SET_PIN, finalaes, finalaes_len);
+    return get_pinserver_aeskey(
+        process, pin, pin_len, PINSERVER_DOC_SET_PIN, PINSERVER_DOC_SET_PIN_ONESHOT, finalaes, finalaes_len);
 }
@@ -1,11 +1,15 @@
 #include "../identity.h"
 #include "../jade_assert.h"
+#include "../jade_tasks.h"
 #include "../jade_wally_verify.h"
 #include "../keychain.h"
 #include "../multisig.h"
+#include "../sha_engine.h"
 #include "../ui.h"
 #include "../utils/cbor_rpc.h"
 
+#include <esp_timer.h>
+#include <inttypes.h>
 #include <sys/time.h>
 #include <wally_script.h>
 
@@ -284,4 +288,115 @@ void update_aggregate_scripts_flavour(
         // As soon as we see something differet, set to 'mixed'
         *aggregate_scripts_flavour = SCRIPT_FLAVOUR_MIXED;
     }
-}
\ No newline at end of file
+}
+
+// Confirmation-to-last-signature latency of the most recent, and slowest, signing
+static int64_t signing_start_us = 0;
+static uint32_t signing_count = 0;
+static uint32_t signing_last_ms = 0;
+static uint32_t signing_max_ms = 0;
+
+// Whether between signing_priority_begin() and _end(), and whether paused in between.
+// NOTE: tracked explicitly rather than inferred from the task priority, which may be temporarily
+// raised further by mutex priority inheritance.
+static bool signing_active = false;
+static bool signing_paused = false;
+
+// Raise the main task above the gui, wheel and camera tasks, throttle the gui and reserve the hw sha engine
+// (for rfc6979 nonces etc.) - or restore all three
+static void set_signing_priority(const bool raised)
+{
+    if (raised) {
+        gui_set_throttled(true);
+        vTaskPrioritySet(NULL, JADE_TASK_PRIO_MAIN_SIGNING);
+        sha_engine_reserve();
+    } else {
+        sha_engine_release();
+        vTaskPrioritySet(NULL, JADE_TASK_PRIO_MAIN);
+        gui_set_throttled(false);
+    }
+}
+
+// From the user's final confirmation until the last signature is sent the main task runs above the gui,
+// wheel and camera tasks, and the gui is throttled - it only shows the passed progress bar (updated by the
+// signing handler).  The priority is restored (and the latency recorded) by signing_priority_end().
+// Any wait on the host in between should be bracketed by signing_priority_pause() and _resume().
+void signing_priority_begin(const char* message, progress_bar_t* progress_bar)
+{
+    JADE_ASSERT(message);
+    JADE_ASSERT(progress_bar);
+    JADE_ASSERT(!signing_active);
+
+    signing_start_us = esp_timer_get_time();
+
+    // Let the gui task switch to the progress bar before it is throttled, and before we preempt it
+    display_progress_bar_activity("Signing", message, progress_bar);
+    for (size_t i = 0; i < 10 && gui_current_activity() != progress_bar->progress_bar->activity; ++i) {
+        vTaskDelay(10 / portTICK_PERIOD_MS);
+    }
+
+    signing_active = true;
+    signing_paused = false;
+    set_signing_priority(true);
+}
+
+// Restore normal priority while blocked waiting on the host (eg. for the next 'get_signature' message),
+// so the gui is not held throttled by the host's round-trip time.
+void signing_priority_pause(void)
+{
+    JADE_ASSERT(signing_active);
+    JADE_ASSERT(!signing_paused);
+    signing_paused = true;
+    set_signing_priority(false);
+}
+
+void signing_priority_resume(void)
+{
+    JADE_ASSERT(signing_active);
+    JADE_ASSERT(signing_paused);
+    signing_paused = false;
+    set_signing_priority(true);
+}
+
+// Restores normal priority and records the latency - a no-op if not signing (eg. declined or failed before
+// signing, or already ended).  Failing while paused restores nothing, and records no latency.
+void signing_priority_end(void)
+{
+    if (!signing_active) {
+        return;
+    }
+    signing_active = false;
+    if (signing_paused) {
+        signing_paused = false;
+        return;
+    }
+
+    set_signing_priority(false);
+
+    signing_last_ms = (esp_timer_get_time() - signing_start_us) / 1000;
+    signing_max_ms = signing_last_ms > signing_max_ms ? signing_last_ms : signing_max_ms;
+    ++signing_count;
+    JADE_LOGI("Confirmation to last signature: %" PRIu32 "ms", signing_last_ms);
+}
+
+// End signing priority as a process 'on exit' function - so no early exit leaves the main task raised
+void signing_priority_end_cb(void* ignored) { signing_priority_end(); }
+
+#ifdef CONFIG_DEBUG_MODE
+// { "count": <signings>, "last_ms": <latency>, "max_ms": <latency> }
+void signing_latency_encode(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(container);
+
+    CborEncoder map_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &map_encoder, 3);
+    JADE_ASSERT(cberr == CborNoError);
+
+    add_uint_to_map(&map_encoder, "count", signing_count);
+    add_uint_to_map(&map_encoder, "last_ms", signing_last_ms);
+    add_uint_to_map(&map_encoder, "max_ms", signing_max_ms);
+
+    cberr = cbor_encoder_close_container(container, &map_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+#endif // CONFIG_DEBUG_MODE
@@ -3,6 +3,7 @@
 
 #include "../keychain.h"
 #include "../process.h"
+#include "../ui.h"
 #include "../utils/cbor_rpc.h"
 #include "../utils/network.h"
 
@@ -108,4 +109,15 @@ bool params_get_master_blindingkey(
 script_flavour_t get_script_flavour(const uint8_t* script, const size_t script_len);
 void update_aggregate_scripts_flavour(script_flavour_t new_script_flavour, script_flavour_t* aggregate_scripts_flavour);
 
+// Run signing (on the main task) at raised priority, with the gui throttled to a progress bar and the hw sha
+// engine reserved
+void signing_priority_begin(const char* message, progress_bar_t* progress_bar);
+void signing_priority_pause(void);
+void signing_priority_resume(void);
+void signing_priority_end(void);
+void signing_priority_end_cb(void* ignored);
+#ifdef CONFIG_DEBUG_MODE
+void signing_latency_encode(const void* ctx, CborEncoder* container);
+#endif
+
 #endif /* PROCESS_UTILS_H_ */
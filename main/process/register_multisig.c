@@ -87,9 +87,9 @@ static int register_multisig(const char* multisig_name, const char* network, con
             return 0; // success
         }
     } else {
-        // Not overwriting an existing record - check storage slot available
-        if (storage_get_multisig_registration_count() >= MAX_MULTISIG_REGISTRATIONS) {
-            *errmsg = "Already have maximum number of multisig wallets";
+        // Not overwriting an existing record - check storage space available
+        if (!storage_multisig_registration_fits(registration_len)) {
+            *errmsg = "Insufficient storage for multisig wallet";
             return CBOR_RPC_BAD_PARAMETERS;
         }
     }
@@ -108,7 +108,7 @@ static int register_multisig(const char* multisig_name, const char* network, con
     const esp_err_t gui_ret = sync_await_single_event(JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     sync_await_single_event(
-        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const esp_err_t gui_ret = ESP_OK;
     ev_id = MULTISIG_ACCEPT;
 #endif
@@ -122,12 +122,16 @@ static int register_multisig(const char* multisig_name, const char* network, con
 
     JADE_LOGD("User accepted multisig");
 
-    // Persist multisig registration in nvs
-    if (!storage_set_multisig_registration(multisig_name, registration, registration_len)) {
+    // Persist multisig registration in nvs, indexed by signers policy fingerprint
+    uint8_t policy_fingerprint[MULTISIG_POLICY_FINGERPRINT_LEN];
+    multisig_get_signers_policy_fingerprint(signers, num_signers, policy_fingerprint, sizeof(policy_fingerprint));
+    if (!storage_set_multisig_registration(
+            multisig_name, registration, registration_len, policy_fingerprint, sizeof(policy_fingerprint))) {
         *errmsg = "Failed to persist multisig data";
         await_error_activity("Error saving multisig");
         return CBOR_RPC_INTERNAL_ERROR;
     }
+    multisig_clear_key_cache();
 
     // All good - return 0
     return 0;
@@ -76,8 +76,7 @@ static int handle_new_otp_uri(const char* otp_name, const char* otp_uri, const s
 #ifndef CONFIG_DEBUG_UNATTENDED_CI
     const bool ret = gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
-    gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+    gui_activity_wait_event(act, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const bool ret = true;
     ev_id = BTN_OTP_CONFIRM;
 #endif
@@ -85,7 +85,7 @@ void sign_identity_process(void* process_ptr)
     const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool ret = true;
     ev_id = BTN_ACCEPT_SIGNATURE;
 #endif
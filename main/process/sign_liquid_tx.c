@@ -5,6 +5,7 @@
 #include "../keychain.h"
 #include "../process.h"
 #include "../sensitive.h"
+#include "../sha_engine.h"
 #include "../ui.h"
 #include "../utils/cbor_rpc.h"
 #include "../utils/event.h"
@@ -22,8 +23,10 @@
 // From sign_tx.c
 bool validate_wallet_outputs(jade_process_t* process, const char* network, const struct wally_tx* tx,
     CborValue* wallet_outputs, output_info_t* output_info, const char** errmsg);
-void send_ae_signature_replies(jade_process_t* process, signing_data_t* all_signing_data, uint32_t num_inputs);
-void send_ec_signature_replies(jade_msg_source_t source, signing_data_t* all_signing_data, uint32_t num_inputs);
+void send_ae_signature_replies(
+    jade_process_t* process, signing_data_t* all_signing_data, uint32_t num_inputs, progress_bar_t* progress_bar);
+void send_ec_signature_replies(
+    jade_msg_source_t source, signing_data_t* all_signing_data, uint32_t num_inputs, progress_bar_t* progress_bar);
 
 static void wally_free_tx_wrapper(void* tx) { JADE_WALLY_VERIFY(wally_tx_free((struct wally_tx*)tx)); }
 
@@ -388,7 +391,7 @@ void sign_liquid_tx_process(void* process_ptr)
     const esp_err_t outputs_ret = sync_await_single_event(JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     sync_await_single_event(
-        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const esp_err_t outputs_ret = ESP_OK;
     ev_id = SIGN_TX_ACCEPT_OUTPUTS;
 #endif
@@ -507,9 +510,13 @@ void sign_liquid_tx_process(void* process_ptr)
             JADE_ASSERT(sig_data->path_len > 0);
 
             // Generate hash of this input which we will sign later
-            if (!wallet_get_elements_tx_input_hash(tx, index, is_witness, script, script_len,
-                    value_len == 0 ? NULL : value_commitment, value_len, sig_data->signature_hash,
-                    sizeof(sig_data->signature_hash))) {
+            // (The hw sha engine is reserved for the hashing only, not while waiting on the host or user.)
+            sha_engine_reserve();
+            const bool hashed = wallet_get_elements_tx_input_hash(tx, index, is_witness, script, script_len,
+                value_len == 0 ? NULL : value_commitment, value_len, sig_data->signature_hash,
+                sizeof(sig_data->signature_hash));
+            sha_engine_release();
+            if (!hashed) {
                 jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to make tx input hash", NULL);
                 goto cleanup;
             }
@@ -558,7 +565,7 @@ void sign_liquid_tx_process(void* process_ptr)
         = gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool fee_ret = true;
     ev_id = BTN_ACCEPT_SIGNATURE;
 #endif
@@ -575,7 +582,11 @@ void sign_liquid_tx_process(void* process_ptr)
     }
 
     JADE_LOGD("User accepted fee");
-    display_message_activity("Processing...");
+
+    // Generate signatures at raised priority, with the gui throttled to a progress bar
+    progress_bar_t progress_bar = {};
+    signing_priority_begin("Signing inputs", &progress_bar);
+    jade_process_call_on_exit(process, signing_priority_end_cb, NULL);
 
     // Send signature replies.
     // NOTE: currently we have two message flows - the backward compatible version
@@ -584,11 +595,12 @@ void sign_liquid_tx_process(void* process_ptr)
     // convert normal EC signatures to use the new/improved message flow.
     if (use_ae_signatures) {
         // Generate and send Anti-Exfil signature replies
-        send_ae_signature_replies(process, all_signing_data, num_inputs);
+        send_ae_signature_replies(process, all_signing_data, num_inputs, &progress_bar);
     } else {
         // Generate and send standard EC signature replies
-        send_ec_signature_replies(source, all_signing_data, num_inputs);
+        send_ec_signature_replies(source, all_signing_data, num_inputs, &progress_bar);
     }
+    signing_priority_end();
     JADE_LOGI("Success");
 
 cleanup:
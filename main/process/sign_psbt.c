@@ -32,37 +32,181 @@ static void wally_free_psbt_wrapper(void* psbt) { JADE_WALLY_VERIFY(wally_psbt_f
 #define PSBT_SIGNING_SINGLE_MULTISIG_RECORD 0x10
 #define PSBT_SIGNING_MULTISIG_CHANGE_ABANDONED 0x20
 
-#define PSBT_OUT_CHUNK_SIZE (MAX_OUTPUT_MSG_SIZE - 64)
+// Space for the message envelope (id, seqnum, seqlen etc.) around each chunk of output psbt
+#define PSBT_OUT_CHUNK_OVERHEAD 64
+
+// Largest psbt record added by signing an input - an ecdsa partial signature:
+// key length, key type, pubkey, value length, der signature + sighash byte
+#define PSBT_SIGNATURE_RECORD_MAX_LEN (1 + 1 + EC_PUBLIC_KEY_LEN + 1 + EC_SIGNATURE_DER_MAX_LEN + 1)
+
+// Max psbts accepted in a single 'sign_psbts' batch
+#define MAX_BATCH_PSBTS 32
+
+// Number of derived parent keys cached while signing
+#define PSBT_KEY_CACHE_SIZE 8
+
+// Warning shown when a psbt in a batch has output(s) which carry their own warning message
+#define WARN_MSG_REVIEW_OUTPUTS "Some outputs have warnings - review the outputs."
+
+// A derived key cached so its children (eg. sibling receive/change keys) need only one derivation step
+typedef struct {
+    uint32_t path[MAX_PATH_LEN];
+    size_t path_len;
+    struct ext_key key;
+} cached_key_t;
+
+// State shared across all the psbts signed in one request - derived keys and the last multisig
+// registration found, so psbts from the same wallet need not repeat the derivations nor reload
+// and retry all the registrations from storage.
+// NOTE: contains private keys - must be freed with free_psbt_signing_cache()
+typedef struct {
+    uint8_t fingerprint[BIP32_KEY_FINGERPRINT_LEN];
+    cached_key_t parent_keys[PSBT_KEY_CACHE_SIZE];
+    size_t num_parent_keys;
+    size_t next_parent_key;
+    multisig_data_t multisig_data;
+    bool have_multisig_data;
+} psbt_signing_cache_t;
+
+// Details of a psbt gathered before it is shown to the user, and which are needed to sign it
+typedef struct {
+    struct wally_psbt* psbt;
+    struct wally_tx* tx;
+    output_info_t* output_info;
+    bool* signing_inputs;
+    uint64_t input_amount;
+    uint64_t output_amount;
+    script_flavour_t inputs_scripts_flavour;
+} psbt_signing_info_t;
+
+static psbt_signing_cache_t* make_psbt_signing_cache(void)
+{
+    psbt_signing_cache_t* const cache = JADE_CALLOC(1, sizeof(psbt_signing_cache_t));
+    wallet_get_fingerprint(cache->fingerprint, sizeof(cache->fingerprint));
+    return cache;
+}
+
+static void free_psbt_signing_cache(psbt_signing_cache_t* cache)
+{
+    if (cache) {
+        JADE_WALLY_VERIFY(wally_bzero(cache, sizeof(psbt_signing_cache_t)));
+        free(cache);
+    }
+}
+
+static void free_psbt_signing_info(psbt_signing_info_t* info)
+{
+    JADE_ASSERT(info);
+    if (info->tx) {
+        JADE_WALLY_VERIFY(wally_tx_free(info->tx));
+        info->tx = NULL;
+    }
+    free(info->signing_inputs);
+    info->signing_inputs = NULL;
+    free(info->output_info);
+    info->output_info = NULL;
+}
+
+// Derive the private key at the passed path from the signer master key.
+// The parent key is cached, so any other children of the same parent need only a single derivation step.
+static void derive_our_key(
+    psbt_signing_cache_t* cache, const uint32_t* path, const size_t path_len, struct ext_key* hdkey)
+{
+    JADE_ASSERT(cache);
+    JADE_ASSERT(path || !path_len);
+    JADE_ASSERT(path_len <= MAX_PATH_LEN);
+    JADE_ASSERT(hdkey);
+    JADE_ASSERT(keychain_get());
+
+    const struct ext_key* const master = &keychain_get()->xpriv;
+    if (!path_len) {
+        memcpy(hdkey, master, sizeof(struct ext_key));
+        return;
+    }
+
+    const size_t parent_path_len = path_len - 1;
+    const struct ext_key* parent = master;
+    if (parent_path_len) {
+        cached_key_t* cached = NULL;
+        for (size_t i = 0; i < cache->num_parent_keys; ++i) {
+            if (cache->parent_keys[i].path_len == parent_path_len
+                && !memcmp(cache->parent_keys[i].path, path, parent_path_len * sizeof(uint32_t))) {
+                cached = &cache->parent_keys[i];
+                break;
+            }
+        }
+
+        if (!cached) {
+            // Not cached - derive and cache, replacing the oldest entry if the cache is full
+            cached = &cache->parent_keys[cache->next_parent_key];
+            cache->next_parent_key = (cache->next_parent_key + 1) % PSBT_KEY_CACHE_SIZE;
+            if (cache->num_parent_keys < PSBT_KEY_CACHE_SIZE) {
+                ++cache->num_parent_keys;
+            }
+
+            JADE_WALLY_VERIFY(
+                bip32_key_from_parent_path(master, path, parent_path_len, BIP32_FLAG_KEY_PRIVATE, &cached->key));
+            memcpy(cached->path, path, parent_path_len * sizeof(uint32_t));
+            cached->path_len = parent_path_len;
+        }
+        parent = &cached->key;
+    }
+
+    JADE_WALLY_VERIFY(bip32_key_from_parent(parent, path[parent_path_len], BIP32_FLAG_KEY_PRIVATE, hdkey));
+}
 
 // Helper to get next key derived from the signer master key in the passed keypath map.
 // NOTE: Both start_index and found_index are zero-based.
 // The return indicates whether any key was found - and if so hdkey and index will be populated.
-static bool get_our_next_key(
-    const struct wally_map* keypaths, const size_t start_index, struct ext_key* hdkey, size_t* index)
+static bool get_our_next_key(psbt_signing_cache_t* cache, const struct wally_map* keypaths, const size_t start_index,
+    struct ext_key* hdkey, size_t* index)
 {
+    JADE_ASSERT(cache);
     JADE_ASSERT(keypaths);
     JADE_ASSERT(hdkey);
     JADE_ASSERT(index);
-    JADE_ASSERT(keychain_get());
 
-    struct ext_key* nextkey = NULL;
-    JADE_WALLY_VERIFY(
-        wally_map_keypath_get_bip32_key_from_alloc(keypaths, start_index, &keychain_get()->xpriv, &nextkey));
-    if (!nextkey) {
-        // No key of ours here
-        return false;
-    }
+    size_t num_keys = 0;
+    JADE_WALLY_VERIFY(wally_map_get_num_items(keypaths, &num_keys));
+    for (size_t i = start_index; i < num_keys; ++i) {
+        // Skip keys not derived from our master key
+        uint8_t fingerprint[BIP32_KEY_FINGERPRINT_LEN];
+        JADE_WALLY_VERIFY(wally_map_keypath_get_item_fingerprint(keypaths, i, fingerprint, sizeof(fingerprint)));
+        if (memcmp(fingerprint, cache->fingerprint, sizeof(fingerprint))) {
+            continue;
+        }
+
+        size_t path_len = 0;
+        uint32_t path[MAX_PATH_LEN];
+        if (wally_map_keypath_get_item_path(keypaths, i, path, MAX_PATH_LEN, &path_len) != WALLY_OK
+            || path_len > MAX_PATH_LEN) {
+            JADE_LOGW("Ignoring key %u with unsupported path", i);
+            continue;
+        }
 
-    // Copy and free the allocated key
-    memcpy(hdkey, nextkey, sizeof(struct ext_key));
-    JADE_WALLY_VERIFY(bip32_key_free(nextkey));
+        // Derive the key, and check it is the pubkey in the map (ie. not merely a fingerprint collision)
+        derive_our_key(cache, path, path_len, hdkey);
 
-    // Find the pubkey in the map and return the (0-based) index
-    JADE_WALLY_VERIFY(wally_map_find_bip32_public_key_from(keypaths, start_index, hdkey, index));
-    JADE_ASSERT(index); // 1-based - should def be found!
-    --*index; // reduce to 0-based
+        uint8_t pubkey[EC_PUBLIC_KEY_UNCOMPRESSED_LEN];
+        size_t pubkey_len = 0;
+        JADE_WALLY_VERIFY(wally_map_get_item_key(keypaths, i, pubkey, sizeof(pubkey), &pubkey_len));
+        if (pubkey_len == EC_PUBLIC_KEY_LEN && !memcmp(pubkey, hdkey->pub_key, EC_PUBLIC_KEY_LEN)) {
+            *index = i;
+            return true;
+        }
+        if (pubkey_len == EC_PUBLIC_KEY_UNCOMPRESSED_LEN) {
+            uint8_t uncompressed[EC_PUBLIC_KEY_UNCOMPRESSED_LEN];
+            JADE_WALLY_VERIFY(wally_ec_public_key_decompress(
+                hdkey->pub_key, sizeof(hdkey->pub_key), uncompressed, sizeof(uncompressed)));
+            if (!memcmp(pubkey, uncompressed, sizeof(uncompressed))) {
+                *index = i;
+                return true;
+            }
+        }
+    }
 
-    return true;
+    // No key of ours here
+    return false;
 }
 
 // Helper to generate a singlesig script of the given type with the pubkey given, and
@@ -144,29 +288,25 @@ static bool verify_multisig_script_matches(const multisig_data_t* multisig_data,
         return false;
     }
 
-    // Check pubkeys match those given
-    struct ext_key hdkey;
+    // Derive pubkeys for the registered signers based on the common path tail
     uint8_t pubkeys[MAX_MULTISIG_SIGNERS * EC_PUBLIC_KEY_LEN]; // Sufficient
     const size_t pubkeys_len = multisig_data->num_xpubs * EC_PUBLIC_KEY_LEN;
-    for (size_t i = 0; i < multisig_data->num_xpubs; ++i) {
-        // Derive a pubkey for this registered signer based for the common path tail
-        const uint8_t* xpub = multisig_data->xpubs + (i * BIP32_SERIALIZED_LEN);
-        if (!wallet_derive_pubkey(xpub, BIP32_SERIALIZED_LEN, path, path_len, BIP32_FLAG_SKIP_HASH, &hdkey)) {
-            JADE_LOGE("Failed to derive pubkey from xpub and path (len %u)", path_len);
-            return false;
-        }
+    if (!multisig_get_pubkeys_for_path(
+            multisig_data->xpubs, multisig_data->num_xpubs, path, path_len, pubkeys, pubkeys_len)) {
+        JADE_LOGE("Failed to derive pubkeys from xpubs and path (len %u)", path_len);
+        return false;
+    }
 
+    // Check pubkeys match those given
+    for (size_t i = 0; i < multisig_data->num_xpubs; ++i) {
         // See if it is present in the keypath map
         size_t written = 0;
-        if (wally_map_find(keypaths, hdkey.pub_key, sizeof(hdkey.pub_key), &written) != WALLY_OK || !written) {
+        const uint8_t* const pubkey = pubkeys + (i * EC_PUBLIC_KEY_LEN);
+        if (wally_map_find(keypaths, pubkey, EC_PUBLIC_KEY_LEN, &written) != WALLY_OK || !written) {
             // Derived key not in map
             JADE_LOGD("Derived key not present in output keymap");
             return false;
         }
-
-        // Copy pubkey
-        uint8_t* const dest = pubkeys + (i * EC_PUBLIC_KEY_LEN);
-        memcpy(dest, hdkey.pub_key, EC_PUBLIC_KEY_LEN);
     }
 
     // Build multisig script
@@ -188,26 +328,68 @@ static bool verify_multisig_script_matches(const multisig_data_t* multisig_data,
     return true;
 }
 
+// Try the registrations in the index with the given policy fingerprint - either that of the signers in the
+// keypaths, or the all-zero 'unknown' fingerprint of records not yet used (eg. migrated from older firmware).
+// If a record with an unknown fingerprint is found, its policy fingerprint is recorded to find it directly.
+static bool try_multisig_records(const uint8_t* index_fingerprint, const uint8_t* policy_fingerprint,
+    const uint32_t* path_tail, const size_t path_tail_len, const struct wally_map* keypaths,
+    const uint8_t* target_script, const size_t target_script_len, multisig_data_t* const multisig_data)
+{
+    JADE_ASSERT(index_fingerprint);
+
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    size_t num_entries = 0;
+    for (size_t page = 0;
+         storage_get_multisig_index_page(page, entries, MULTISIG_INDEX_PAGE_SIZE, &num_entries) && num_entries;
+         ++page) {
+        for (size_t i = 0; i < num_entries; ++i) {
+            const multisig_index_entry_t* const entry = entries + i;
+            if (memcmp(entry->policy_fingerprint, index_fingerprint, MULTISIG_POLICY_FINGERPRINT_LEN)) {
+                continue;
+            }
+
+            const char* errmsg = NULL;
+            if (!multisig_load_from_storage(entry->name, multisig_data, &errmsg)) {
+                JADE_LOGD("Ignoring multisig %s as not valid for this wallet", entry->name);
+                JADE_LOGD("%s", errmsg);
+                continue;
+            }
+
+            JADE_LOGD("Trying loaded multisig: %s", entry->name);
+            if (!verify_multisig_script_matches(
+                    multisig_data, path_tail, path_tail_len, keypaths, target_script, target_script_len)) {
+                JADE_LOGD("Receive script failed validation with %s", entry->name);
+                continue;
+            }
+
+            // Found suitable record - if its fingerprint was unknown, record it to find it directly next time
+            JADE_LOGI("Found suitable multisig record: %s", entry->name);
+            if (policy_fingerprint && index_fingerprint != policy_fingerprint
+                && !storage_set_multisig_policy_fingerprint(
+                    entry->name, policy_fingerprint, MULTISIG_POLICY_FINGERPRINT_LEN)) {
+                JADE_LOGW("Failed to update policy fingerprint for multisig %s", entry->name);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
 // Try to find a multisig registration which creates the passed script with the given
 // keypaths map.  NOTE: our signer's path is passed in, from which the common path tail
 // is deduced.
-static bool get_suitable_multisig_record(const struct wally_map* keypaths, const size_t our_key_index,
-    const uint8_t* target_script, const size_t target_script_len, multisig_data_t* const multisig_data)
+// Any registration already found for an earlier psbt in this request is tried first, then those indexed
+// under the policy fingerprint of the keypaths' signers, then any whose fingerprint is not yet known.
+static bool get_suitable_multisig_record(psbt_signing_cache_t* cache, const struct wally_map* keypaths,
+    const size_t our_key_index, const uint8_t* target_script, const size_t target_script_len,
+    multisig_data_t* const multisig_data)
 {
+    JADE_ASSERT(cache);
     JADE_ASSERT(keypaths);
     JADE_ASSERT(target_script);
     JADE_ASSERT(target_script_len);
     JADE_ASSERT(multisig_data);
 
-    // Load multisig record names saved in nvs
-    char names[MAX_MULTISIG_REGISTRATIONS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
-    const size_t num_names = sizeof(names) / sizeof(names[0]);
-    size_t num_multisigs = 0;
-    if (!storage_get_all_multisig_registration_names(names, num_names, &num_multisigs)) {
-        JADE_LOGE("Error loading multisig record names - won't be able to verify multisig change");
-        return false;
-    }
-
     size_t path_len = 0;
     uint32_t path[MAX_PATH_LEN];
     JADE_WALLY_VERIFY(wally_map_keypath_get_item_path(keypaths, our_key_index, path, MAX_PATH_LEN, &path_len));
@@ -217,24 +399,37 @@ static bool get_suitable_multisig_record(const struct wally_map* keypaths, const
     JADE_ASSERT(path_tail_start <= path_len);
     const size_t path_tail_len = path_len - path_tail_start;
 
-    // Iterate over named persisted multisigs to see if one fits
-    for (int i = 0; i < num_multisigs; ++i) {
-        const char* errmsg = NULL;
-        if (!multisig_load_from_storage(names[i], multisig_data, &errmsg)) {
-            JADE_LOGD("Ignoring multisig %s as not valid for this wallet", names[i]);
-            JADE_LOGD("%s", errmsg);
-            continue;
-        }
+    if (cache->have_multisig_data
+        && verify_multisig_script_matches(&cache->multisig_data, &path[path_tail_start], path_tail_len, keypaths,
+            target_script, target_script_len)) {
+        JADE_LOGD("Using previously found multisig record");
+        memcpy(multisig_data, &cache->multisig_data, sizeof(multisig_data_t));
+        return true;
+    }
 
-        JADE_LOGD("Trying loaded multisig: %s", names[i]);
-        if (!verify_multisig_script_matches(
-                multisig_data, &path[path_tail_start], path_tail_len, keypaths, target_script, target_script_len)) {
-            JADE_LOGD("Receive script failed validation with %s", names[i]);
-            continue;
+    // Get the policy fingerprint of the signers in the keypaths (if a plausible number of signers)
+    size_t num_keys = 0;
+    uint8_t fingerprints[MAX_MULTISIG_SIGNERS * BIP32_KEY_FINGERPRINT_LEN];
+    uint8_t policy_fingerprint[MULTISIG_POLICY_FINGERPRINT_LEN];
+    JADE_WALLY_VERIFY(wally_map_get_num_items(keypaths, &num_keys));
+    const bool have_policy_fingerprint = num_keys && num_keys <= MAX_MULTISIG_SIGNERS;
+    if (have_policy_fingerprint) {
+        for (size_t i = 0; i < num_keys; ++i) {
+            JADE_WALLY_VERIFY(wally_map_keypath_get_item_fingerprint(
+                keypaths, i, fingerprints + (i * BIP32_KEY_FINGERPRINT_LEN), BIP32_KEY_FINGERPRINT_LEN));
         }
-
-        // Found suitable record
-        JADE_LOGI("Found suitable multisig record: %s", names[i]);
+        multisig_get_policy_fingerprint(fingerprints, num_keys, policy_fingerprint, sizeof(policy_fingerprint));
+    }
+    const uint8_t* const policy = have_policy_fingerprint ? policy_fingerprint : NULL;
+    static const uint8_t unknown_fingerprint[MULTISIG_POLICY_FINGERPRINT_LEN] = { 0 };
+
+    if ((policy
+            && try_multisig_records(policy, policy, &path[path_tail_start], path_tail_len, keypaths, target_script,
+                target_script_len, multisig_data))
+        || try_multisig_records(unknown_fingerprint, policy, &path[path_tail_start], path_tail_len, keypaths,
+            target_script, target_script_len, multisig_data)) {
+        memcpy(&cache->multisig_data, multisig_data, sizeof(multisig_data_t));
+        cache->have_multisig_data = true;
         return true;
     }
 
@@ -243,10 +438,12 @@ static bool get_suitable_multisig_record(const struct wally_map* keypaths, const
 }
 
 // Examine outputs for change we can automatically validate
-static void validate_any_change_outputs(const char* network, struct wally_psbt* psbt, const uint8_t signing_flags,
-    const multisig_data_t* multisig_data, output_info_t* output_info, struct ext_key* hdkey)
+static void validate_any_change_outputs(const char* network, psbt_signing_cache_t* cache, struct wally_psbt* psbt,
+    const uint8_t signing_flags, const multisig_data_t* multisig_data, output_info_t* output_info,
+    struct ext_key* hdkey)
 {
     JADE_ASSERT(network);
+    JADE_ASSERT(cache);
     JADE_ASSERT(psbt);
     JADE_ASSERT(signing_flags);
     JADE_ASSERT(multisig_data);
@@ -264,7 +461,7 @@ static void validate_any_change_outputs(const char* network, struct wally_psbt*
         // Find the first key belonging to this signer
         const size_t start_index_zero = 0;
         size_t our_key_index = 0;
-        if (!get_our_next_key(&output->keypaths, start_index_zero, hdkey, &our_key_index)) {
+        if (!get_our_next_key(cache, &output->keypaths, start_index_zero, hdkey, &our_key_index)) {
             // No key in this output belongs to this signer
             JADE_LOGD("No key in input %u, ignoring", index);
             continue;
@@ -373,15 +570,22 @@ static void validate_any_change_outputs(const char* network, struct wally_psbt*
     }
 }
 
-// Sign a psbt - the passed wally psbt struct is updated with any signatures.
-// Returns 0 if no errors occurred - does not necessarily indicate that signatures were added.
-// Returns an rpc/message error code on error, and the error string should be populated.
-int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
+// Examine a psbt before it is reviewed by the user - the inputs we are to sign, the amounts, and
+// any change outputs we can validate.  The passed info is populated, and must be freed by the caller
+// with free_psbt_signing_info(), even in the event of an error.
+// Returns 0 if no errors occurred, otherwise an rpc/message error code, and the error string is populated.
+static int analyse_psbt(
+    const char* network, psbt_signing_cache_t* cache, psbt_signing_info_t* info, const char** errmsg)
 {
     JADE_ASSERT(network);
-    JADE_ASSERT(psbt);
+    JADE_ASSERT(cache);
+    JADE_ASSERT(info);
+    JADE_ASSERT(info->psbt);
+    JADE_ASSERT(!info->tx);
     JADE_INIT_OUT_PPTR(errmsg);
 
+    struct wally_psbt* const psbt = info->psbt;
+
     // Elements/PSET not supported
     size_t is_elements = 0;
     if (wally_psbt_is_elements(psbt, &is_elements) != WALLY_OK || is_elements) {
@@ -390,12 +594,11 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
     }
 
     // Txn data must be available
-    struct wally_tx* tx = NULL;
-    if (wally_psbt_extract(psbt, WALLY_PSBT_EXTRACT_NON_FINAL, &tx) != WALLY_OK || !tx) {
+    if (wally_psbt_extract(psbt, WALLY_PSBT_EXTRACT_NON_FINAL, &info->tx) != WALLY_OK || !info->tx) {
         *errmsg = "Failed to extract valid txn from passed psbt";
         return CBOR_RPC_BAD_PARAMETERS;
     }
-    JADE_ASSERT(tx->num_inputs == psbt->num_inputs && tx->num_outputs == psbt->num_outputs);
+    JADE_ASSERT(info->tx->num_inputs == psbt->num_inputs && info->tx->num_outputs == psbt->num_outputs);
 
     // Any private key in use
     struct ext_key hdkey;
@@ -404,16 +607,16 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
 
     // We track if the type of the inputs we are signing changes (ie. single-sig vs
     // green/multisig/other) so we can show a warning to the user if so.
-    script_flavour_t aggregate_inputs_scripts_flavour = SCRIPT_FLAVOUR_NONE;
+    info->inputs_scripts_flavour = SCRIPT_FLAVOUR_NONE;
 
     // Output info
-    output_info_t* output_info = JADE_CALLOC(psbt->num_outputs, sizeof(output_info_t));
+    info->output_info = JADE_CALLOC(psbt->num_outputs, sizeof(output_info_t));
 
     // Go through each of the inputs summing amounts
     // Also, if we are signing this input, inspect the script type and any multisig info
     // Record which inputs we are interested in signing
-    bool* const signing_inputs = JADE_CALLOC(psbt->num_inputs, sizeof(bool));
-    uint64_t input_amount = 0;
+    info->signing_inputs = JADE_CALLOC(psbt->num_inputs, sizeof(bool));
+    info->input_amount = 0;
     uint8_t signing_flags = 0;
     multisig_data_t multisig_data;
     for (size_t index = 0; index < psbt->num_inputs; ++index) {
@@ -427,15 +630,15 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
             retval = CBOR_RPC_BAD_PARAMETERS;
             goto cleanup;
         }
-        input_amount += utxo->satoshi;
+        info->input_amount += utxo->satoshi;
 
         // If we are signing this input, look at the script type, sighash, multisigs etc.
         const size_t start_index_zero = 0;
         size_t our_key_index = 0;
-        if (get_our_next_key(&input->keypaths, start_index_zero, &hdkey, &our_key_index)) {
+        if (get_our_next_key(cache, &input->keypaths, start_index_zero, &hdkey, &our_key_index)) {
             // Found our key - we are signing this input
             JADE_LOGD("Key %u belongs to this signer, so we will need to sign input %u", our_key_index, index);
-            signing_inputs[index] = true;
+            info->signing_inputs[index] = true;
 
             size_t num_keys = 0;
             JADE_WALLY_VERIFY(wally_map_get_num_items(&input->keypaths, &num_keys));
@@ -453,7 +656,7 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
             // Track the types of the input prevout scripts
             if (utxo->script && utxo->script_len) {
                 const script_flavour_t script_flavour = get_script_flavour(utxo->script, utxo->script_len);
-                update_aggregate_scripts_flavour(script_flavour, &aggregate_inputs_scripts_flavour);
+                update_aggregate_scripts_flavour(script_flavour, &info->inputs_scripts_flavour);
             }
 
             // If multisig, see if all signing inputs match the same persisted multisig record
@@ -483,8 +686,8 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
                     }
                 } else {
                     // Search all multisig records looking for one that fits this input
-                    if (get_suitable_multisig_record(
-                            &input->keypaths, our_key_index, utxo->script, utxo->script_len, &multisig_data)) {
+                    if (get_suitable_multisig_record(cache, &input->keypaths, our_key_index, utxo->script,
+                            utxo->script_len, &multisig_data)) {
                         JADE_LOGI("Signing multisig - registered record found");
                         signing_flags |= PSBT_SIGNING_SINGLE_MULTISIG_RECORD;
                     } else {
@@ -499,9 +702,8 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
     }
 
     // Sanity check amounts
-    uint64_t output_amount;
-    JADE_WALLY_VERIFY(wally_tx_get_total_output_satoshi(tx, &output_amount));
-    if (output_amount > input_amount) {
+    JADE_WALLY_VERIFY(wally_tx_get_total_output_satoshi(info->tx, &info->output_amount));
+    if (info->output_amount > info->input_amount) {
         *errmsg = "Invalid input/output amounts";
         retval = CBOR_RPC_BAD_PARAMETERS;
         goto cleanup;
@@ -509,12 +711,28 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
 
     // Examine outputs for change we can automatically validate
     if (signing_flags) {
-        validate_any_change_outputs(network, psbt, signing_flags, &multisig_data, output_info, &hdkey);
+        validate_any_change_outputs(network, cache, psbt, signing_flags, &multisig_data, info->output_info, &hdkey);
     }
 
+    // No errors
+    JADE_ASSERT(!retval);
+
+cleanup:
+    SENSITIVE_POP(&hdkey);
+    return retval;
+}
+
+// User to verify the outputs and fee amount of a single psbt
+// Returns 0 if the user accepted, otherwise an rpc/message error code, and the error string is populated.
+static int review_psbt(const char* network, const psbt_signing_info_t* info, const char** errmsg)
+{
+    JADE_ASSERT(network);
+    JADE_ASSERT(info);
+    JADE_INIT_OUT_PPTR(errmsg);
+
     // User to verify outputs and fee amount
     gui_activity_t* first_activity = NULL;
-    make_display_output_activity(network, tx, output_info, &first_activity);
+    make_display_output_activity(network, info->tx, info->output_info, &first_activity);
     JADE_ASSERT(first_activity);
     gui_set_current_activity(first_activity);
 
@@ -526,7 +744,7 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
     const esp_err_t outputs_ret = sync_await_single_event(JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     sync_await_single_event(
-        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const esp_err_t outputs_ret = ESP_OK;
     ev_id = SIGN_TX_ACCEPT_OUTPUTS;
 #endif
@@ -534,17 +752,16 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
     // Check to see whether user accepted or declined
     if (outputs_ret != ESP_OK || ev_id != SIGN_TX_ACCEPT_OUTPUTS) {
         *errmsg = "User declined to sign psbt";
-        retval = CBOR_RPC_USER_CANCELLED;
-        goto cleanup;
+        return CBOR_RPC_USER_CANCELLED;
     }
 
     JADE_LOGD("User accepted outputs");
 
     // User to agree fee amount
     gui_activity_t* final_activity = NULL;
-    const uint64_t fees = input_amount - output_amount;
+    const uint64_t fees = info->input_amount - info->output_amount;
     const char* const warning_msg
-        = aggregate_inputs_scripts_flavour == SCRIPT_FLAVOUR_MIXED ? WARN_MSG_MIXED_INPUTS : NULL;
+        = info->inputs_scripts_flavour == SCRIPT_FLAVOUR_MIXED ? WARN_MSG_MIXED_INPUTS : NULL;
     make_display_final_confirmation_activity(fees, warning_msg, &final_activity);
     JADE_ASSERT(final_activity);
     gui_set_current_activity(final_activity);
@@ -557,7 +774,7 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
         = gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool fee_ret = true;
     ev_id = BTN_ACCEPT_SIGNATURE;
 #endif
@@ -565,17 +782,183 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
     // Check to see whether user accepted or declined
     if (!fee_ret || ev_id != BTN_ACCEPT_SIGNATURE) {
         *errmsg = "User declined to sign psbt";
-        retval = CBOR_RPC_USER_CANCELLED;
-        goto cleanup;
+        return CBOR_RPC_USER_CANCELLED;
     }
 
     JADE_LOGD("User accepted fee");
-    display_message_activity("Processing...");
+    return 0;
+}
+
+// The amount a psbt sends, ie. excluding change outputs we have validated
+static uint64_t get_psbt_amount_sent(const psbt_signing_info_t* info)
+{
+    JADE_ASSERT(info);
+
+    uint64_t sent = 0;
+    for (size_t i = 0; i < info->tx->num_outputs; ++i) {
+        const uint8_t flags = info->output_info[i].flags;
+        if (!(flags & OUTPUT_FLAG_VALIDATED && flags & OUTPUT_FLAG_CHANGE)) {
+            sent += info->tx->outputs[i].satoshi;
+        }
+    }
+    return sent;
+}
+
+// Any warning to show for a psbt in a batch
+static const char* get_psbt_batch_warning(const psbt_signing_info_t* info)
+{
+    JADE_ASSERT(info);
+
+    if (info->inputs_scripts_flavour == SCRIPT_FLAVOUR_MIXED) {
+        return WARN_MSG_MIXED_INPUTS;
+    }
+    for (size_t i = 0; i < info->tx->num_outputs; ++i) {
+        if (info->output_info[i].message[0] != '\0') {
+            return WARN_MSG_REVIEW_OUTPUTS;
+        }
+    }
+    return NULL;
+}
+
+// Step through the individual psbts in a batch, so the user can review any/all of their outputs
+static void review_psbt_batch_items(
+    const char* network, const psbt_signing_info_t* infos, const size_t num_psbts, size_t* selected)
+{
+    JADE_ASSERT(network);
+    JADE_ASSERT(infos);
+    JADE_ASSERT(selected);
+    JADE_ASSERT(*selected < num_psbts);
+
+    while (true) {
+        const psbt_signing_info_t* const info = infos + *selected;
+        gui_activity_t* item_activity = NULL;
+        make_display_batch_item_activity(*selected, num_psbts, get_psbt_amount_sent(info),
+            info->input_amount - info->output_amount, get_psbt_batch_warning(info), &item_activity);
+        JADE_ASSERT(item_activity);
+        gui_set_current_activity(item_activity);
+
+        int32_t ev_id;
+        if (!gui_activity_wait_event(item_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0)
+            || ev_id == BTN_TX_BATCH_EXIT) {
+            // Back to the batch summary
+            return;
+        }
+
+        if (ev_id == BTN_TX_BATCH_PREV) {
+            *selected = (*selected + num_psbts - 1) % num_psbts;
+        } else if (ev_id == BTN_TX_BATCH_NEXT) {
+            *selected = (*selected + 1) % num_psbts;
+        } else if (ev_id == BTN_TX_BATCH_OUTPUTS) {
+            gui_activity_t* first_activity = NULL;
+            make_display_output_activity(network, info->tx, info->output_info, &first_activity);
+            JADE_ASSERT(first_activity);
+            gui_set_current_activity(first_activity);
+
+            // Either accepting or declining the outputs returns to this psbt
+            sync_await_single_event(JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
+        }
+    }
+}
+
+// User to review a batch of psbts - one consolidated summary of the amounts sent and fees paid,
+// from where the user can drill down into the individual psbts and their outputs.
+// Returns 0 if the user accepted, otherwise an rpc/message error code, and the error string is populated.
+static int review_psbt_batch(
+    const char* network, const psbt_signing_info_t* infos, const size_t num_psbts, const char** errmsg)
+{
+    JADE_ASSERT(network);
+    JADE_ASSERT(infos);
+    JADE_ASSERT(num_psbts);
+    JADE_INIT_OUT_PPTR(errmsg);
+
+    uint64_t total_sent = 0;
+    uint64_t total_fees = 0;
+    const char* warning_msg = NULL;
+    for (size_t i = 0; i < num_psbts; ++i) {
+        total_sent += get_psbt_amount_sent(infos + i);
+        total_fees += infos[i].input_amount - infos[i].output_amount;
+        if (!warning_msg) {
+            warning_msg = get_psbt_batch_warning(infos + i);
+        }
+    }
+
+    size_t selected = 0;
+    while (true) {
+        gui_activity_t* summary_activity = NULL;
+        make_display_batch_summary_activity(num_psbts, total_sent, total_fees, warning_msg, &summary_activity);
+        JADE_ASSERT(summary_activity);
+        gui_set_current_activity(summary_activity);
+
+        // In a debug unattended ci build, assume 'accept' button pressed after a short delay
+        int32_t ev_id;
+#ifndef CONFIG_DEBUG_UNATTENDED_CI
+        const bool ret
+            = gui_activity_wait_event(summary_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
+#else
+        gui_activity_wait_event(summary_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
+            gui_unattended_ci_timeout());
+        const bool ret = true;
+        ev_id = BTN_ACCEPT_SIGNATURE;
+#endif
+
+        if (ret && ev_id == BTN_ACCEPT_SIGNATURE) {
+            JADE_LOGD("User accepted batch");
+            return 0;
+        }
+
+        if (!ret || ev_id == BTN_CANCEL_SIGNATURE) {
+            *errmsg = "User declined to sign psbts";
+            return CBOR_RPC_USER_CANCELLED;
+        }
+
+        if (ev_id == BTN_TX_BATCH_REVIEW) {
+            review_psbt_batch_items(network, infos, num_psbts, &selected);
+        }
+    }
+}
+
+// The number of inputs of an analysed psbt flagged for signing
+static size_t count_signing_inputs(const psbt_signing_info_t* info)
+{
+    JADE_ASSERT(info);
+    JADE_ASSERT(info->psbt);
+    JADE_ASSERT(info->signing_inputs);
+
+    size_t count = 0;
+    for (size_t index = 0; index < info->psbt->num_inputs; ++index) {
+        count += info->signing_inputs[index] ? 1 : 0;
+    }
+    return count;
+}
+
+// Sign the inputs of an analysed psbt flagged for signing - the psbt is updated with the signatures.
+// The progress bar is updated as each input is signed - 'num_signed' is the running count (across
+// all psbts being signed) and 'num_to_sign' the total.
+// NOTE: the caller should reserve the sha engine.
+// Returns 0 if no errors occurred, otherwise an rpc/message error code, and the error string is populated.
+static int sign_analysed_psbt(psbt_signing_cache_t* cache, const psbt_signing_info_t* info,
+    progress_bar_t* progress_bar, const size_t num_to_sign, size_t* num_signed, const char** errmsg)
+{
+    JADE_ASSERT(cache);
+    JADE_ASSERT(info);
+    JADE_ASSERT(info->psbt);
+    JADE_ASSERT(info->tx);
+    JADE_ASSERT(info->signing_inputs);
+    JADE_ASSERT(progress_bar);
+    JADE_ASSERT(num_signed);
+    JADE_INIT_OUT_PPTR(errmsg);
+
+    struct wally_psbt* const psbt = info->psbt;
+
+    // Any private key in use
+    struct ext_key hdkey;
+    SENSITIVE_PUSH(&hdkey, sizeof(hdkey));
+    int retval = 0;
 
     // Sign our inputs
     for (size_t index = 0; index < psbt->num_inputs; ++index) {
         // See if we flagged this input for signing
-        if (!signing_inputs[index]) {
+        if (!info->signing_inputs[index]) {
             JADE_LOGD("Not required to sign input %u", index);
             continue;
         }
@@ -596,7 +979,7 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
                 != WALLY_OK
             || scriptcode_len > sizeof(scriptcode)
             || wally_psbt_get_input_signature_hash(
-                   psbt, index, tx, scriptcode, scriptcode_len, 0, txhash, sizeof(txhash))
+                   psbt, index, info->tx, scriptcode, scriptcode_len, 0, txhash, sizeof(txhash))
                 != WALLY_OK) {
             JADE_LOGE("Failed to generate tx input hash");
             *errmsg = "Failed to generate tx input hash";
@@ -605,7 +988,7 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
         }
 
         size_t key_index = 0; // Counter updated as we search for our key(s)
-        while (get_our_next_key(&input->keypaths, key_index, &hdkey, &key_index)) {
+        while (get_our_next_key(cache, &input->keypaths, key_index, &hdkey, &key_index)) {
             // Sign the input with this key
             if (wally_psbt_sign_input_bip32(psbt, index, key_index, txhash, sizeof(txhash), &hdkey, EC_FLAG_GRIND_R)
                 != WALLY_OK) {
@@ -618,6 +1001,9 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
             // Continue search from next key index position
             ++key_index;
         }
+
+        ++*num_signed;
+        update_progress_bar(progress_bar, num_to_sign, *num_signed);
     }
 
     // No errors - may or may not have added signatures
@@ -625,9 +1011,103 @@ int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
 
 cleanup:
     SENSITIVE_POP(&hdkey);
-    JADE_WALLY_VERIFY(wally_tx_free(tx));
-    free(signing_inputs);
-    free(output_info);
+    return retval;
+}
+
+// Sign a psbt - the passed wally psbt struct is updated with any signatures.
+// Returns 0 if no errors occurred - does not necessarily indicate that signatures were added.
+// Returns an rpc/message error code on error, and the error string should be populated.
+int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg)
+{
+    JADE_ASSERT(network);
+    JADE_ASSERT(psbt);
+    JADE_INIT_OUT_PPTR(errmsg);
+
+    psbt_signing_cache_t* const cache = make_psbt_signing_cache();
+    psbt_signing_info_t info = { .psbt = psbt };
+
+    int retval = analyse_psbt(network, cache, &info, errmsg);
+    if (retval) {
+        goto cleanup;
+    }
+
+    retval = review_psbt(network, &info, errmsg);
+    if (retval) {
+        goto cleanup;
+    }
+
+    // Sign at raised priority (with the hw sha engine reserved), with the gui throttled to a progress bar
+    progress_bar_t progress_bar = {};
+    signing_priority_begin("Signing inputs", &progress_bar);
+
+    size_t num_signed = 0;
+    retval = sign_analysed_psbt(cache, &info, &progress_bar, count_signing_inputs(&info), &num_signed, errmsg);
+
+cleanup:
+    signing_priority_end();
+    free_psbt_signing_info(&info);
+    free_psbt_signing_cache(cache);
+    return retval;
+}
+
+// Sign a batch of psbts after a single consolidated review - the passed wally psbt structs are
+// updated with any signatures.  Derived keys and multisig registrations are shared across the psbts.
+// Returns 0 if no errors occurred - does not necessarily indicate that signatures were added.
+// Returns an rpc/message error code on error, and the error string should be populated.
+static int sign_psbt_batch(
+    const char* network, struct wally_psbt* const* psbts, const size_t num_psbts, const char** errmsg)
+{
+    JADE_ASSERT(network);
+    JADE_ASSERT(psbts);
+    JADE_ASSERT(num_psbts);
+    JADE_INIT_OUT_PPTR(errmsg);
+
+    psbt_signing_cache_t* const cache = make_psbt_signing_cache();
+    psbt_signing_info_t* const infos = JADE_CALLOC(num_psbts, sizeof(psbt_signing_info_t));
+    int retval = 0;
+
+    for (size_t i = 0; i < num_psbts; ++i) {
+        infos[i].psbt = psbts[i];
+        retval = analyse_psbt(network, cache, infos + i, errmsg);
+        if (retval) {
+            JADE_LOGE("Failed to analyse psbt %u of %u", i + 1, num_psbts);
+            goto cleanup;
+        }
+    }
+
+    retval = review_psbt_batch(network, infos, num_psbts, errmsg);
+    if (retval) {
+        goto cleanup;
+    }
+
+    size_t num_to_sign = 0;
+    for (size_t i = 0; i < num_psbts; ++i) {
+        num_to_sign += count_signing_inputs(infos + i);
+    }
+
+    // Sign at raised priority (with the hw sha engine reserved), with the gui throttled to a progress bar
+    progress_bar_t progress_bar = {};
+    signing_priority_begin("Signing inputs", &progress_bar);
+
+    size_t num_signed = 0;
+    for (size_t i = 0; i < num_psbts; ++i) {
+        retval = sign_analysed_psbt(cache, infos + i, &progress_bar, num_to_sign, &num_signed, errmsg);
+        if (retval) {
+            JADE_LOGE("Failed to sign psbt %u of %u", i + 1, num_psbts);
+            goto cleanup;
+        }
+    }
+
+    // No errors - may or may not have added signatures
+    JADE_ASSERT(!retval);
+
+cleanup:
+    signing_priority_end();
+    for (size_t i = 0; i < num_psbts; ++i) {
+        free_psbt_signing_info(infos + i);
+    }
+    free(infos);
+    free_psbt_signing_cache(cache);
     return retval;
 }
 
@@ -641,34 +1121,150 @@ bool deserialise_psbt(const uint8_t* psbt_bytes, const size_t psbt_len, struct w
     return wally_psbt_from_bytes(psbt_bytes, psbt_len, WALLY_PSBT_PARSE_FLAG_STRICT, psbt_out) == WALLY_OK && *psbt_out;
 }
 
+// Estimated length of a psbt once signed, given its length as received - allowing for one
+// signature record (the largest being an ecdsa partial signature) added to every input.
+size_t psbt_signed_length_estimate(const struct wally_psbt* psbt, const size_t unsigned_len)
+{
+    JADE_ASSERT(psbt);
+    return unsigned_len + psbt->num_inputs * PSBT_SIGNATURE_RECORD_MAX_LEN;
+}
+
+// PSBT wally struct -> bytes, written in-place at 'offset' into the passed buffer, which is grown if the
+// psbt does not fit with at least 'reserve' bytes left after it.
+// The caller sizes the buffer from an estimate (see above), so generally the psbt is walked just once by the
+// one call to wally_psbt_to_bytes() - rather than once to get the exact length, and again to serialise it.
+// NOTE: this is not a streaming serialiser - the whole serialised psbt is held in the buffer, so peak memory
+// is still proportional to the psbt size.  Wally exposes only whole-psbt serialisation (the per-input/output
+// map writers are internal), and byte-identical windowed output would mean reimplementing them here.
+// Returns false on error.
+// Otherwise the buffer may have been reallocated (preserving the first 'offset' bytes), and the caller
+// retains ownership of it and must call free().
+bool serialise_psbt_into(const struct wally_psbt* psbt, uint8_t** buf, size_t* buf_len, const size_t offset,
+    const size_t reserve, size_t* written)
+{
+    JADE_ASSERT(psbt);
+    JADE_ASSERT(buf);
+    JADE_ASSERT(*buf);
+    JADE_ASSERT(buf_len);
+    JADE_ASSERT(offset + reserve <= *buf_len);
+    JADE_INIT_OUT_SIZE(written);
+
+    const size_t available = *buf_len - offset - reserve;
+    size_t psbt_len = 0;
+    if (available && wally_psbt_to_bytes(psbt, 0, *buf + offset, available, written) == WALLY_OK) {
+        if (*written <= available) {
+            return true;
+        }
+        // Buffer too small - wally reports the length required
+        psbt_len = *written;
+    }
+
+    // Estimate too small - get the exact length if not known, and serialise into a larger buffer
+    if (!psbt_len && wally_psbt_get_length(psbt, 0, &psbt_len) != WALLY_OK) {
+        *written = 0;
+        return false;
+    }
+    if (psbt_len <= available) {
+        // Failed for some reason other than the buffer size
+        *written = 0;
+        return false;
+    }
+    JADE_LOGI("Psbt length %u exceeds estimate %u", psbt_len, available);
+
+    const size_t new_len = offset + psbt_len + reserve;
+    uint8_t* const new_buf = JADE_MALLOC_PREFER_SPIRAM(new_len);
+    memcpy(new_buf, *buf, offset);
+    free(*buf);
+    *buf = new_buf;
+    *buf_len = new_len;
+
+    if (wally_psbt_to_bytes(psbt, 0, *buf + offset, psbt_len, written) != WALLY_OK || *written != psbt_len) {
+        *written = 0;
+        return false;
+    }
+    return true;
+}
+
 // PSBT wally struct -> bytes
 // Returns false on error.
 // Otherwise caller takes ownership of bytes, and must call free()
-bool serialise_psbt(const struct wally_psbt* psbt, uint8_t** output, size_t* output_len)
+static bool serialise_psbt(
+    const struct wally_psbt* psbt, const size_t len_estimate, uint8_t** output, size_t* output_len)
 {
     JADE_ASSERT(psbt);
     JADE_INIT_OUT_PPTR(output);
     JADE_INIT_OUT_SIZE(output_len);
 
-    // Serialise updated psbt
-    size_t psbt_len_out = 0;
-    if (wally_psbt_get_length(psbt, 0, &psbt_len_out) != WALLY_OK) {
-        return false;
-    }
-
-    uint8_t* psbt_bytes_out = JADE_MALLOC_PREFER_SPIRAM(psbt_len_out);
-    size_t written = 0;
-    if (wally_psbt_to_bytes(psbt, 0, psbt_bytes_out, psbt_len_out, &written) != WALLY_OK || written != psbt_len_out) {
-        free(psbt_bytes_out);
+    size_t buf_len = len_estimate ? len_estimate : 1;
+    uint8_t* buf = JADE_MALLOC_PREFER_SPIRAM(buf_len);
+    if (!serialise_psbt_into(psbt, &buf, &buf_len, 0, 0, output_len)) {
+        free(buf);
         return false;
     }
 
     // Return allocated buffer
-    *output = psbt_bytes_out;
-    *output_len = psbt_len_out;
+    *output = buf;
     return true;
 }
 
+// Send the reply data - split over N messages if the result is large, the host sending a
+// 'get_extended_data' message to request each subsequent chunk.
+// Returns false (having sent an error reply) if the host does not request the chunks as expected.
+static bool reply_with_extended_data(jade_process_t* process, const char* method, const uint8_t* data, const size_t len)
+{
+    JADE_ASSERT(process);
+    JADE_ASSERT(method);
+    JADE_ASSERT(data);
+    JADE_ASSERT(len);
+
+    char original_id[MAXLEN_ID];
+    size_t original_id_len = 0;
+    rpc_get_id(&process->ctx.value, original_id, sizeof(original_id), &original_id_len);
+
+    // Chunk size is bounded by the max reply size (which the host may have negotiated to be larger)
+    const size_t max_reply_size = jade_process_get_max_reply_size(process->ctx.source);
+    JADE_ASSERT(max_reply_size > PSBT_OUT_CHUNK_OVERHEAD);
+    const size_t chunk_size = max_reply_size - PSBT_OUT_CHUNK_OVERHEAD;
+    const size_t nmsgs = (len + chunk_size - 1) / chunk_size;
+    const size_t buflen = (nmsgs > 1 ? chunk_size : len) + PSBT_OUT_CHUNK_OVERHEAD;
+    uint8_t* const buf = JADE_MALLOC_PREFER_SPIRAM(buflen);
+    jade_process_free_on_exit(process, buf);
+    const uint8_t* chunk = data;
+    bool retval = false;
+    for (size_t imsg = 0; imsg < nmsgs; ++imsg) {
+        JADE_ASSERT(chunk < data + len);
+        const size_t remaining = data + len - chunk;
+        const size_t chunk_len = remaining < chunk_size ? remaining : chunk_size;
+        const size_t seqnum = imsg + 1;
+        jade_process_reply_to_message_bytes_sequence(process->ctx, seqnum, nmsgs, chunk, chunk_len, buf, buflen);
+        chunk += chunk_len;
+
+        if (seqnum < nmsgs) {
+            // Await a 'get_extended_data' message
+            jade_process_load_in_message(process, true);
+            if (!IS_CURRENT_MESSAGE(process, "get_extended_data")) {
+                // Protocol error
+                jade_process_reject_message(
+                    process, CBOR_RPC_PROTOCOL_ERROR, "Unexpected message, expecting 'get_extended_data'", NULL);
+                goto cleanup;
+            }
+
+            // Sanity check extended-data payload fields
+            GET_MSG_PARAMS(process);
+            if (!check_extended_data_fields(&params, original_id, method, seqnum + 1, nmsgs)) {
+                // Protocol error
+                jade_process_reject_message(
+                    process, CBOR_RPC_PROTOCOL_ERROR, "Mismatched fields in 'get_extended_data' message", NULL);
+                goto cleanup;
+            }
+        }
+    }
+    retval = true;
+
+cleanup:
+    return retval;
+}
+
 void sign_psbt_process(void* process_ptr)
 {
     JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
@@ -719,47 +1315,126 @@ void sign_psbt_process(void* process_ptr)
     // Serialise updated psbt
     size_t psbt_len_out = 0;
     uint8_t* psbt_bytes_out = NULL;
-    if (!serialise_psbt(psbt, &psbt_bytes_out, &psbt_len_out)) {
+    const size_t len_estimate = psbt_signed_length_estimate(psbt, psbt_len_in);
+    if (!serialise_psbt(psbt, len_estimate, &psbt_bytes_out, &psbt_len_out)) {
         jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to serialise sign psbt", NULL);
         goto cleanup;
     }
     jade_process_free_on_exit(process, psbt_bytes_out);
 
     // Send as cbor message - maybe split over N messages if the result is large
-    char original_id[MAXLEN_ID];
-    size_t original_id_len = 0;
-    rpc_get_id(&process->ctx.value, original_id, sizeof(original_id), &original_id_len);
+    if (!reply_with_extended_data(process, "sign_psbt", psbt_bytes_out, psbt_len_out)) {
+        goto cleanup;
+    }
 
-    const int nmsgs = (psbt_len_out / PSBT_OUT_CHUNK_SIZE) + 1;
-    uint8_t buf[MAX_OUTPUT_MSG_SIZE];
-    uint8_t* chunk = psbt_bytes_out;
-    for (size_t imsg = 0; imsg < nmsgs; ++imsg) {
-        JADE_ASSERT(chunk < psbt_bytes_out + psbt_len_out);
-        const size_t remaining = psbt_bytes_out + psbt_len_out - chunk;
-        const size_t chunk_len = remaining < PSBT_OUT_CHUNK_SIZE ? remaining : PSBT_OUT_CHUNK_SIZE;
-        const size_t seqnum = imsg + 1;
-        jade_process_reply_to_message_bytes_sequence(process->ctx, seqnum, nmsgs, chunk, chunk_len, buf, sizeof(buf));
-        chunk += chunk_len;
+    JADE_LOGI("Success");
 
-        if (seqnum < nmsgs) {
-            // Await a 'get_extended_data' message
-            jade_process_load_in_message(process, true);
-            if (!IS_CURRENT_MESSAGE(process, "get_extended_data")) {
-                // Protocol error
-                jade_process_reject_message(
-                    process, CBOR_RPC_PROTOCOL_ERROR, "Unexpected message, expecting 'get_extended_data'", NULL);
-                goto cleanup;
-            }
+cleanup:
+    return;
+}
 
-            // Sanity check extended-data payload fields
-            GET_MSG_PARAMS(process);
-            if (!check_extended_data_fields(&params, original_id, "sign_psbt", seqnum + 1, nmsgs)) {
-                // Protocol error
-                jade_process_reject_message(
-                    process, CBOR_RPC_PROTOCOL_ERROR, "Mismatched fields in 'get_extended_data' message", NULL);
-                goto cleanup;
-            }
+// Sign a batch of psbts from the same wallet, after a single consolidated review.
+// The reply is the cbor array of the updated psbts (as bytes) - which is returned as bytes
+// split over N messages if large, as with a single psbt.
+void sign_psbts_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+    char network[MAX_NETWORK_NAME_LEN];
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "sign_psbts");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+    GET_MSG_PARAMS(process);
+
+    // Check network is valid and consistent with prior usage
+    size_t written = 0;
+    rpc_get_string("network", sizeof(network), &params, network, &written);
+    CHECK_NETWORK_CONSISTENT(process, network, written);
+    if (isLiquidNetwork(network)) {
+        jade_process_reject_message(
+            process, CBOR_RPC_BAD_PARAMETERS, "sign_psbts call not appropriate for liquid network", NULL);
+        goto cleanup;
+    }
+
+    // psbts must be sent as an array of bytes
+    CborValue psbts_array;
+    size_t num_psbts = 0;
+    if (!rpc_get_array("psbts", &params, &psbts_array)
+        || cbor_value_get_array_length(&psbts_array, &num_psbts) != CborNoError || !num_psbts
+        || num_psbts > MAX_BATCH_PSBTS) {
+        jade_process_reject_message(
+            process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract valid psbts array from parameters", NULL);
+        goto cleanup;
+    }
+
+    CborValue array_item;
+    CborError cberr = cbor_value_enter_container(&psbts_array, &array_item);
+    JADE_ASSERT(cberr == CborNoError);
+
+    // Parse each psbt to wally structure
+    struct wally_psbt** const psbts = JADE_CALLOC(num_psbts, sizeof(struct wally_psbt*));
+    jade_process_free_on_exit(process, psbts);
+    size_t* const len_estimates = JADE_CALLOC(num_psbts, sizeof(size_t));
+    jade_process_free_on_exit(process, len_estimates);
+    for (size_t i = 0; i < num_psbts; ++i) {
+        JADE_ASSERT(!cbor_value_at_end(&array_item));
+
+        size_t psbt_len_in = 0;
+        const uint8_t* psbt_bytes_in = NULL;
+        rpc_get_raw_bytes_ptr(&array_item, &psbt_bytes_in, &psbt_len_in);
+        if (!psbt_bytes_in || !psbt_len_in || !deserialise_psbt(psbt_bytes_in, psbt_len_in, &psbts[i])) {
+            jade_process_reject_message(
+                process, CBOR_RPC_BAD_PARAMETERS, "Failed to extract psbt from passed bytes", NULL);
+            goto cleanup;
         }
+        jade_process_call_on_exit(process, wally_free_psbt_wrapper, psbts[i]);
+        len_estimates[i] = psbt_signed_length_estimate(psbts[i], psbt_len_in);
+
+        cberr = cbor_value_advance(&array_item);
+        JADE_ASSERT(cberr == CborNoError);
+    }
+
+    // Sign the psbts - parameters updated with any signatures
+    const char* errmsg = NULL;
+    const int errcode = sign_psbt_batch(network, psbts, num_psbts, &errmsg);
+    if (errcode) {
+        jade_process_reject_message(process, errcode, errmsg, NULL);
+        goto cleanup;
+    }
+
+    // Serialise the updated psbts directly into a cbor array of byte-strings.
+    // Each psbt is written after space for the largest cbor header, then moved down to follow the
+    // actual header - the buffer is sized from the estimates, and only grown if a psbt overflows it.
+    size_t reserve = 0;
+    for (size_t i = 0; i < num_psbts; ++i) {
+        reserve += CBOR_HEADER_MAX_LEN + len_estimates[i];
+    }
+    size_t encoded_len = CBOR_HEADER_MAX_LEN + reserve;
+    uint8_t* encoded = JADE_MALLOC_PREFER_SPIRAM(encoded_len);
+    size_t offset = rpc_write_cbor_header(CborArrayType, num_psbts, encoded, encoded_len);
+
+    for (size_t i = 0; i < num_psbts; ++i) {
+        reserve -= CBOR_HEADER_MAX_LEN + len_estimates[i];
+        size_t psbt_len_out = 0;
+        if (!serialise_psbt_into(
+                psbts[i], &encoded, &encoded_len, offset + CBOR_HEADER_MAX_LEN, reserve, &psbt_len_out)) {
+            free(encoded);
+            jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to serialise sign psbt", NULL);
+            goto cleanup;
+        }
+
+        uint8_t header[CBOR_HEADER_MAX_LEN];
+        const size_t header_len = rpc_write_cbor_header(CborByteStringType, psbt_len_out, header, sizeof(header));
+        memmove(encoded + offset + header_len, encoded + offset + CBOR_HEADER_MAX_LEN, psbt_len_out);
+        memcpy(encoded + offset, header, header_len);
+        offset += header_len + psbt_len_out;
+    }
+    jade_process_free_on_exit(process, encoded);
+
+    // Send as cbor message - maybe split over N messages if the result is large
+    if (!reply_with_extended_data(process, "sign_psbts", encoded, offset)) {
+        goto cleanup;
     }
 
     JADE_LOGI("Success");
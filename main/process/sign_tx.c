@@ -5,6 +5,7 @@
 #include "../multisig.h"
 #include "../process.h"
 #include "../sensitive.h"
+#include "../sha_engine.h"
 #include "../ui.h"
 #include "../utils/cbor_rpc.h"
 #include "../utils/event.h"
@@ -199,18 +200,24 @@ bool validate_wallet_outputs(jade_process_t* process, const char* network, const
 }
 
 // Loop to generate and send Anti-Exfil signatures as they are requested.
-void send_ae_signature_replies(jade_process_t* process, signing_data_t* all_signing_data, const uint32_t num_inputs)
+// The progress bar is updated as each signature is sent.
+// NOTE: called at raised signing priority, which is paused while waiting on each host request.
+void send_ae_signature_replies(jade_process_t* process, signing_data_t* all_signing_data, const uint32_t num_inputs,
+    progress_bar_t* progress_bar)
 {
     JADE_ASSERT(process);
     JADE_ASSERT(all_signing_data);
     JADE_ASSERT(num_inputs > 0);
+    JADE_ASSERT(progress_bar);
 
     SENSITIVE_PUSH(all_signing_data, sizeof(all_signing_data));
     for (size_t i = 0; i < num_inputs; ++i) {
         signing_data_t* const sig_data = all_signing_data + i;
 
         // We always need a 'get-signature' exchange even if we are not providing a signature
+        signing_priority_pause();
         jade_process_load_in_message(process, true);
+        signing_priority_resume();
         if (!IS_CURRENT_MESSAGE(process, "get_signature")) {
             // Protocol error
             jade_process_reject_message(
@@ -245,6 +252,7 @@ void send_ae_signature_replies(jade_process_t* process, signing_data_t* all_sign
         // Send signature reply - will be empty for any inputs we are not signing
         const bytes_info_t bytes_info = { .data = sig_data->sig, .size = sig_data->sig_len };
         jade_process_reply_to_message_result(process->ctx, &bytes_info, cbor_result_bytes_cb);
+        update_progress_bar(progress_bar, num_inputs, i + 1);
     }
 
 cleanup:
@@ -253,11 +261,13 @@ cleanup:
 
 // The backward compatible 'send all messages in a batch' method for standard EC signatures.
 // NOTE: should be converted to the same message flow as above, at some point.
-void send_ec_signature_replies(
-    const jade_msg_source_t source, signing_data_t* all_signing_data, const uint32_t num_inputs)
+// The progress bar is updated as each signature is generated.
+void send_ec_signature_replies(const jade_msg_source_t source, signing_data_t* all_signing_data,
+    const uint32_t num_inputs, progress_bar_t* progress_bar)
 {
     JADE_ASSERT(all_signing_data);
     JADE_ASSERT(num_inputs > 0);
+    JADE_ASSERT(progress_bar);
 
     uint8_t msgbuf[256];
     SENSITIVE_PUSH(all_signing_data, sizeof(all_signing_data));
@@ -273,6 +283,7 @@ void send_ec_signature_replies(
             }
             JADE_ASSERT(sig_data->sig_len > 0);
         }
+        update_progress_bar(progress_bar, num_inputs, i + 1);
     }
 
     // Now send all signatures - one per message - in reply to input messages
@@ -388,7 +399,7 @@ void sign_tx_process(void* process_ptr)
     const esp_err_t outputs_ret = sync_await_single_event(JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     sync_await_single_event(
-        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        JADE_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, gui_unattended_ci_timeout());
     const esp_err_t outputs_ret = ESP_OK;
     ev_id = SIGN_TX_ACCEPT_OUTPUTS;
 #endif
@@ -514,7 +525,9 @@ void sign_tx_process(void* process_ptr)
             // Check that txhash of passed input_tx == tx->inputs[index].txhash
             // ie. that the 'input-tx' passed is indeed the correct transaction
             uint8_t txhash[WALLY_TXHASH_LEN];
+            sha_engine_reserve();
             res = wally_tx_get_txid(input_tx, txhash, sizeof(txhash));
+            sha_engine_release();
 
             if (res != WALLY_OK || sodium_memcmp(txhash, tx->inputs[index].txhash, sizeof(txhash)) != 0) {
                 jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS,
@@ -562,8 +575,12 @@ void sign_tx_process(void* process_ptr)
             JADE_ASSERT(sig_data->path_len > 0);
 
             // Generate hash of this input which we will sign later
-            if (!wallet_get_tx_input_hash(tx, index, is_witness, script, script_len, input_satoshi,
-                    sig_data->signature_hash, sizeof(sig_data->signature_hash))) {
+            // (The hw sha engine is reserved for the hashing only, not while waiting on the host or user.)
+            sha_engine_reserve();
+            const bool hashed = wallet_get_tx_input_hash(tx, index, is_witness, script, script_len, input_satoshi,
+                sig_data->signature_hash, sizeof(sig_data->signature_hash));
+            sha_engine_release();
+            if (!hashed) {
                 jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to make tx input hash", NULL);
                 goto cleanup;
             }
@@ -635,7 +652,7 @@ void sign_tx_process(void* process_ptr)
         = gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(final_activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool fee_ret = true;
     ev_id = BTN_ACCEPT_SIGNATURE;
 #endif
@@ -652,7 +669,11 @@ void sign_tx_process(void* process_ptr)
     }
 
     JADE_LOGD("User accepted fee");
-    display_message_activity("Processing...");
+
+    // Generate signatures at raised priority, with the gui throttled to a progress bar
+    progress_bar_t progress_bar = {};
+    signing_priority_begin("Signing inputs", &progress_bar);
+    jade_process_call_on_exit(process, signing_priority_end_cb, NULL);
 
     // Send signature replies.
     // NOTE: currently we have two message flows - the backward compatible version
@@ -661,11 +682,12 @@ void sign_tx_process(void* process_ptr)
     // convert normal EC signatures to use the new/improved message flow.
     if (use_ae_signatures) {
         // Generate and send Anti-Exfil signature replies
-        send_ae_signature_replies(process, all_signing_data, num_inputs);
+        send_ae_signature_replies(process, all_signing_data, num_inputs, &progress_bar);
     } else {
         // Generate and send standard EC signature replies
-        send_ec_signature_replies(source, all_signing_data, num_inputs);
+        send_ec_signature_replies(source, all_signing_data, num_inputs, &progress_bar);
     }
+    signing_priority_end();
     JADE_LOGI("Success");
 
 cleanup:
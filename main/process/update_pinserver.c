@@ -15,6 +15,9 @@
 // Default pinserver public key
 extern const uint8_t server_public_key_start[] asm("_binary_pinserver_public_key_pub_start");
 
+// Pinserver interaction
+void pinclient_reset_oneshot(void);
+
 void show_pinserver_details(void)
 {
     // Load custom pinserver details from storage
@@ -54,7 +57,7 @@ void show_pinserver_details(void)
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
 #endif
         JADE_WALLY_VERIFY(wally_free_string(pubkey_hex));
     }
@@ -77,7 +80,7 @@ void show_pinserver_details(void)
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
 #endif
         JADE_WALLY_VERIFY(wally_free_string(cert_hash_hex));
     }
@@ -172,7 +175,7 @@ int update_pinserver(const CborValue* const params, const char** errmsg)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_PINSERVER_DETAILS_CONFIRM;
 #endif
@@ -226,7 +229,7 @@ int update_pinserver(const CborValue* const params, const char** errmsg)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_PINSERVER_DETAILS_CONFIRM;
 #endif
@@ -266,6 +269,11 @@ int update_pinserver(const CborValue* const params, const char** errmsg)
         }
     }
 
+    if (urlA_len || reset_details) {
+        // Whether the new server supports the single round-trip protocol is not yet known
+        pinclient_reset_oneshot();
+    }
+
     if (set_certificate) {
         JADE_LOGI("Setting user pinserver certificate");
         if (!storage_set_pinserver_cert(cert)) {
@@ -302,6 +310,7 @@ bool reset_pinserver(void)
         JADE_LOGE("Failed to erase pinserver details");
         retval = false;
     }
+    pinclient_reset_oneshot();
     if (!storage_erase_pinserver_cert()) {
         JADE_LOGE("Failed to erase pinserver certificate");
         retval = false;
@@ -0,0 +1,312 @@
+#include "../jade_assert.h"
+#include "../keychain.h"
+#include "../process.h"
+#include "../sensitive.h"
+#include "../storage.h"
+#include "../ui.h"
+#include "../utils/cbor_rpc.h"
+
+#include "process_utils.h"
+
+// Wallet initialisation functions
+void initialise_with_mnemonic(bool temporary_restore, bool force_qr_scan);
+void get_passphrase(char* passphrase, size_t passphrase_len, bool confirm);
+
+typedef struct {
+    char names[NUM_WALLET_SLOTS][NVS_KEY_NAME_MAX_SIZE];
+    size_t num_names;
+    size_t active;
+} wallet_names_t;
+
+static void reply_wallets(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(ctx);
+    const wallet_names_t* wallets = (const wallet_names_t*)ctx;
+    JADE_ASSERT(wallets->active < wallets->num_names);
+
+    CborEncoder map_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &map_encoder, 2);
+    JADE_ASSERT(cberr == CborNoError);
+
+    add_string_to_map(&map_encoder, "active", wallets->names[wallets->active]);
+
+    cberr = cbor_encode_text_stringz(&map_encoder, "wallets");
+    JADE_ASSERT(cberr == CborNoError);
+
+    CborEncoder array_encoder;
+    cberr = cbor_encoder_create_array(&map_encoder, &array_encoder, wallets->num_names);
+    JADE_ASSERT(cberr == CborNoError);
+    for (size_t i = 0; i < wallets->num_names; ++i) {
+        cberr = cbor_encode_text_stringz(&array_encoder, wallets->names[i]);
+        JADE_ASSERT(cberr == CborNoError);
+    }
+    cberr = cbor_encoder_close_container(&map_encoder, &array_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encoder_close_container(container, &map_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+
+// Get a wallet name from the message params, and look up its slot
+static int get_wallet_name_param(const CborValue* params, char* name, const size_t name_len, size_t* slot,
+    bool* exists, const char** errmsg)
+{
+    JADE_ASSERT(params);
+    JADE_ASSERT(name);
+    JADE_ASSERT(name_len == NVS_KEY_NAME_MAX_SIZE);
+    JADE_INIT_OUT_SIZE(slot);
+    JADE_ASSERT(exists);
+    JADE_INIT_OUT_PPTR(errmsg);
+
+    size_t written = 0;
+    rpc_get_string("name", name_len, params, name, &written);
+    if (!written || !storage_key_name_valid(name)) {
+        *errmsg = "Failed to extract valid wallet name from parameters";
+        return CBOR_RPC_BAD_PARAMETERS;
+    }
+
+    *exists = keychain_find_wallet_slot(name, slot);
+    return 0;
+}
+
+// Load the given wallet slot, getting any passphrase the wallet requires, and associate it with this
+// message source.  On failure the device is left locked.
+static bool load_wallet_slot(jade_process_t* process, const size_t slot)
+{
+    JADE_ASSERT(process);
+
+    display_message_activity("Loading wallet...");
+    if (!keychain_select_wallet_slot(slot)) {
+        keychain_clear();
+        return false;
+    }
+
+    if (keychain_requires_passphrase()) {
+        char passphrase[PASSPHRASE_MAX_LEN + 1];
+        SENSITIVE_PUSH(passphrase, sizeof(passphrase));
+        passphrase[0] = '\0';
+
+        const bool confirm_passphrase = false;
+        get_passphrase(passphrase, sizeof(passphrase), confirm_passphrase);
+
+        display_message_activity("Processing...");
+        const bool derived = keychain_complete_derivation_with_passphrase(passphrase);
+        SENSITIVE_POP(passphrase);
+        if (!derived) {
+            keychain_clear();
+            return false;
+        }
+    }
+
+    keychain_set(keychain_get(), process->ctx.source, false);
+    return true;
+}
+
+void get_wallets_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "get_wallets");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+
+    wallet_names_t wallets = { .num_names = 1, .active = 0 };
+    strcpy(wallets.names[0], KEYCHAIN_MAIN_WALLET_NAME);
+
+    const size_t active_slot = keychain_get_wallet_slot();
+    for (size_t slot = 1; slot < NUM_WALLET_SLOTS; ++slot) {
+        size_t written = 0;
+        if (storage_get_wallet_slot_name(slot, wallets.names[wallets.num_names], NVS_KEY_NAME_MAX_SIZE, &written)) {
+            if (slot == active_slot) {
+                wallets.active = wallets.num_names;
+            }
+            ++wallets.num_names;
+        }
+    }
+
+    jade_process_reply_to_message_result(process->ctx, &wallets, reply_wallets);
+    JADE_LOGI("Success");
+}
+
+void select_wallet_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "select_wallet");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+    GET_MSG_PARAMS(process);
+
+    char name[NVS_KEY_NAME_MAX_SIZE];
+    size_t slot = 0;
+    bool exists = false;
+    const char* errmsg = NULL;
+    const int errcode = get_wallet_name_param(&params, name, sizeof(name), &slot, &exists, &errmsg);
+    if (errcode) {
+        jade_process_reject_message(process, errcode, errmsg, NULL);
+        goto cleanup;
+    }
+    if (!exists) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Unknown wallet name", NULL);
+        goto cleanup;
+    }
+
+    if (slot != keychain_get_wallet_slot()) {
+        char message[64];
+        const int ret = snprintf(message, sizeof(message), "Switch to wallet:\n\n  %s", name);
+        JADE_ASSERT(ret > 0 && ret < sizeof(message));
+        if (!await_yesno_activity("Switch Wallet", message, true)) {
+            JADE_LOGW("User declined to switch wallet");
+            jade_process_reject_message(process, CBOR_RPC_USER_CANCELLED, "User declined to switch wallet", NULL);
+            goto cleanup;
+        }
+
+        if (!load_wallet_slot(process, slot)) {
+            JADE_LOGE("Failed to load wallet slot %u", slot);
+            jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to load wallet", NULL);
+            await_error_activity("Failed to load wallet");
+            goto cleanup;
+        }
+    }
+
+    jade_process_reply_to_message_ok(process);
+    JADE_LOGI("Success");
+
+cleanup:
+    return;
+}
+
+void add_wallet_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "add_wallet");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+    GET_MSG_PARAMS(process);
+
+    char name[NVS_KEY_NAME_MAX_SIZE];
+    size_t slot = 0;
+    bool exists = false;
+    const char* errmsg = NULL;
+    const int errcode = get_wallet_name_param(&params, name, sizeof(name), &slot, &exists, &errmsg);
+    if (errcode) {
+        jade_process_reject_message(process, errcode, errmsg, NULL);
+        goto cleanup;
+    }
+    if (exists) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Wallet name already in use", NULL);
+        goto cleanup;
+    }
+
+    // Find a free slot
+    for (slot = 1; slot < NUM_WALLET_SLOTS; ++slot) {
+        char slot_name[NVS_KEY_NAME_MAX_SIZE];
+        size_t written = 0;
+        if (!storage_get_wallet_slot_name(slot, slot_name, sizeof(slot_name), &written)) {
+            break;
+        }
+    }
+    if (slot == NUM_WALLET_SLOTS) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Already have maximum number of wallets", NULL);
+        goto cleanup;
+    }
+
+    char message[64];
+    const int ret = snprintf(message, sizeof(message), "Add a new wallet named:\n\n  %s", name);
+    JADE_ASSERT(ret > 0 && ret < sizeof(message));
+    if (!await_yesno_activity("Add Wallet", message, true)) {
+        JADE_LOGW("User declined to add wallet");
+        jade_process_reject_message(process, CBOR_RPC_USER_CANCELLED, "User declined to add wallet", NULL);
+        goto cleanup;
+    }
+
+    // Enter the recovery phrase as for a temporary wallet, then persist the derived keys into the slot.
+    // If that is abandoned or fails, revert to the wallet we had.
+    const size_t initial_slot = keychain_get_wallet_slot();
+    keychain_clear_keys();
+
+    const bool temporary_restore = true;
+    const bool force_qr_scan = false;
+    initialise_with_mnemonic(temporary_restore, force_qr_scan);
+
+    if (!keychain_get() || !keychain_save_wallet_slot(slot, name)) {
+        const bool entered = keychain_get() != NULL;
+        JADE_LOGW("Wallet %s not added - reverting to wallet slot %u", entered ? "failed to save" : "not entered",
+            initial_slot);
+        if (!load_wallet_slot(process, initial_slot)) {
+            JADE_LOGE("Failed to reload wallet slot %u", initial_slot);
+        }
+        if (entered) {
+            jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to persist wallet", NULL);
+            await_error_activity("Failed to persist wallet");
+        } else {
+            jade_process_reject_message(process, CBOR_RPC_USER_CANCELLED, "No recovery phrase entered", NULL);
+        }
+        goto cleanup;
+    }
+
+    // Confirm the 'source' (ie interface) which we will accept receiving messages from
+    keychain_set(keychain_get(), process->ctx.source, false);
+
+    jade_process_reply_to_message_ok(process);
+    JADE_LOGI("Success");
+
+cleanup:
+    return;
+}
+
+void erase_wallet_process(void* process_ptr)
+{
+    JADE_LOGI("Starting: %lu", xPortGetFreeHeapSize());
+    jade_process_t* process = process_ptr;
+
+    // We expect a current message to be present
+    ASSERT_CURRENT_MESSAGE(process, "erase_wallet");
+    ASSERT_KEYCHAIN_UNLOCKED_BY_MESSAGE_SOURCE(process);
+    GET_MSG_PARAMS(process);
+
+    char name[NVS_KEY_NAME_MAX_SIZE];
+    size_t slot = 0;
+    bool exists = false;
+    const char* errmsg = NULL;
+    const int errcode = get_wallet_name_param(&params, name, sizeof(name), &slot, &exists, &errmsg);
+    if (errcode) {
+        jade_process_reject_message(process, errcode, errmsg, NULL);
+        goto cleanup;
+    }
+    if (!exists) {
+        jade_process_reject_message(process, CBOR_RPC_BAD_PARAMETERS, "Unknown wallet name", NULL);
+        goto cleanup;
+    }
+    if (!slot || slot == keychain_get_wallet_slot()) {
+        jade_process_reject_message(
+            process, CBOR_RPC_BAD_PARAMETERS, "Cannot erase the main wallet or the active wallet", NULL);
+        goto cleanup;
+    }
+
+    char message[96];
+    const int ret = snprintf(message, sizeof(message), "Erase wallet and its\nmultisig and OTP records:\n\n  %s", name);
+    JADE_ASSERT(ret > 0 && ret < sizeof(message));
+    if (!await_yesno_activity("Erase Wallet", message, false)) {
+        JADE_LOGW("User declined to erase wallet");
+        jade_process_reject_message(process, CBOR_RPC_USER_CANCELLED, "User declined to erase wallet", NULL);
+        goto cleanup;
+    }
+
+    if (!keychain_erase_wallet_slot(slot)) {
+        JADE_LOGE("Failed to erase wallet slot %u", slot);
+        jade_process_reject_message(process, CBOR_RPC_INTERNAL_ERROR, "Failed to erase wallet", NULL);
+        await_error_activity("Failed to erase wallet");
+        goto cleanup;
+    }
+
+    jade_process_reply_to_message_ok(process);
+    JADE_LOGI("Success");
+
+cleanup:
+    return;
+}
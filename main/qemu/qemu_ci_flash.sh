@@ -25,7 +25,7 @@ set -eo pipefail
     -machine esp32 \
     -m 4M \
     -drive file=/flash_image.bin,if=mtd,format=raw \
-    -nic user,model=open_eth,id=lo0,hostfwd=tcp:0.0.0.0:30121-:30121 \
+    -nic user,model=open_eth,id=lo0,hostfwd=tcp:0.0.0.0:30121-:30121,hostfwd=tcp:0.0.0.0:30122-:30122 \
     -drive file=/qemu_efuse.bin,if=none,format=raw,id=efuse \
     -global driver=nvram.esp32.efuse,property=drive,value=efuse \
     -serial pty &
@@ -42,11 +42,20 @@ gcc -O2 -DBSDIFF_EXECUTABLE -o ./tools/bsdiff components/esp32_bsdiff/bsdiff.c
 FW_FULL=$(ls build/*_fw.bin)
 python jade_ota.py --log=INFO --skipble --serialport=tcp:localhost:30121 --fwfile=${FW_FULL}
 
+# Flash it again, abandoning and resuming the upload at random points
+python jade_ota.py --log=INFO --skipble --serialport=tcp:localhost:30121 --fwfile=${FW_FULL} --inject-faults=2
+
 # Flash a simple patch-to-self, just to smoke test ota-delta
 ./tools/mkpatch.py ${FW_FULL} ${FW_FULL} build/
 FW_PATCH=$(ls ./build/*_patch.bin)
 cp "${FW_FULL}.hash" "${FW_PATCH}.hash"
 python jade_ota.py --log=INFO --skipble --serialport=tcp:localhost:30121 --fwfile=${FW_PATCH}
 
+# Check the xtensa delta filter round-trips the firmware, and flash a filtered patch-to-self
+python test_mkpatch.py --log=INFO --write-xpatch=build/ ${FW_FULL}
+FW_XPATCH=$(ls ./build/*_xpatch.bin)
+cp "${FW_FULL}.hash" "${FW_XPATCH}.hash"
+python jade_ota.py --log=INFO --skipble --serialport=tcp:localhost:30121 --fwfile=${FW_XPATCH}
+
 # Run the tests - long timeout for bcur-fragment iteration test in 'run_remote_selfcheck()/selfcheck.c'
 python test_jade.py --log=INFO --skipble --qemu --serialport=tcp:localhost:30121 --serialtimeout=300
@@ -6,7 +6,7 @@ pkill -f qemu-system-xtensa
     -machine esp32 \
     -m 4M \
     -drive file=/flash_image.bin,if=mtd,format=raw \
-    -nic user,model=open_eth,id=lo0,hostfwd=tcp:0.0.0.0:30121-:30121 \
+    -nic user,model=open_eth,id=lo0,hostfwd=tcp:0.0.0.0:30121-:30121,hostfwd=tcp:0.0.0.0:30122-:30122 \
     -drive file=/qemu_efuse.bin,if=none,format=raw,id=efuse \
     -global driver=nvram.esp32.efuse,property=drive,value=efuse \
     -serial pty
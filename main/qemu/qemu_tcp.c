@@ -33,74 +33,187 @@ static void* s_eth_glue = NULL;
 static const char* TAG = "jade";
 
 static portMUX_TYPE sockmutex;
-static int qemu_tcp_sock = 0;
-static int qemu_tcp_listen_sock = 0;
+static int qemu_tcp_sock = 0; // data connection
+static int qemu_tcp_log_sock = 0; // optional read-only observer connection
 
+// The data connection carries the usual rpc messages (and device logs).
+// The log connection is read-only - it receives a copy of everything written to the data connection (replies and
+// logs), so a test runner can attach a second observer without disturbing the client.
+// A new connection on either port replaces any existing one, so a client can reconnect immediately.
 #define QEMU_TCP_PORT 30121
+#define QEMU_TCP_LOG_PORT 30122
+
+// Larger than the default, so large messages are not throttled waiting for the reader
+#define QEMU_TCP_RCVBUF_SIZE (16 * 1024)
 
 // esp-event registration context
 esp_event_handler_instance_t ctx_got_ip;
 
-static void qemu_tcp_reader(void* ignore)
+static int qemu_tcp_listen(const uint16_t port)
 {
-    struct sockaddr_in6 dest_addr;
-    struct sockaddr_in* dest_addr_ip4 = (struct sockaddr_in*)&dest_addr;
-    dest_addr_ip4->sin_addr.s_addr = htonl(INADDR_ANY);
-    dest_addr_ip4->sin_family = AF_INET;
-    dest_addr_ip4->sin_port = htons(QEMU_TCP_PORT);
-
-    qemu_tcp_listen_sock = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
-    JADE_ASSERT(qemu_tcp_listen_sock >= 0);
-    int err = bind(qemu_tcp_listen_sock, (struct sockaddr*)&dest_addr, sizeof(dest_addr));
+    struct sockaddr_in addr = { 0 };
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+
+    const int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_IP);
+    JADE_ASSERT(sock >= 0);
+
+    const int reuse = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    int err = bind(sock, (struct sockaddr*)&addr, sizeof(addr));
     JADE_ASSERT(err == 0);
 
-    err = listen(qemu_tcp_listen_sock, 1);
+    err = listen(sock, 2);
     JADE_ASSERT(err == 0);
 
-    struct sockaddr_in6 source_addr;
+    return sock;
+}
+
+static void qemu_tcp_close(int* sock)
+{
+    JADE_ASSERT(sock);
+
+    portENTER_CRITICAL(&sockmutex);
+    const int tmp_sock = *sock;
+    *sock = 0;
+    portEXIT_CRITICAL(&sockmutex);
+
+    if (tmp_sock) {
+        shutdown(tmp_sock, SHUT_RDWR);
+        close(tmp_sock);
+    }
+}
+
+// Accept a new connection, replacing any existing connection
+static bool qemu_tcp_accept(const int listen_sock, int* sock)
+{
+    JADE_ASSERT(sock);
+
+    struct sockaddr_in source_addr;
     socklen_t addr_len = sizeof(source_addr);
+    const int new_sock = accept(listen_sock, (struct sockaddr*)&source_addr, &addr_len);
+    if (new_sock <= 0) {
+        JADE_LOGE("Error accepting tcp connection: errno %d", errno);
+        return false;
+    }
+
+    // Messages are small request/reply exchanges - send immediately rather than waiting to coalesce
+    const int nodelay = 1;
+    setsockopt(new_sock, IPPROTO_TCP, TCP_NODELAY, &nodelay, sizeof(nodelay));
+#ifdef CONFIG_LWIP_SO_RCVBUF
+    const int rcvbuf = QEMU_TCP_RCVBUF_SIZE;
+    setsockopt(new_sock, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+#endif
+
+    qemu_tcp_close(sock);
+    portENTER_CRITICAL(&sockmutex);
+    *sock = new_sock;
+    portEXIT_CRITICAL(&sockmutex);
+    return true;
+}
+
+static void qemu_tcp_reader(void* ignore)
+{
+    const int listen_sock = qemu_tcp_listen(QEMU_TCP_PORT);
+    const int log_listen_sock = qemu_tcp_listen(QEMU_TCP_LOG_PORT);
 
     size_t read = 0;
     uint8_t* const qemu_tcp_data_in = full_qemu_tcp_data_in + 1;
     TickType_t last_processing_time = 0;
 
     while (1) {
-        portENTER_CRITICAL(&sockmutex);
-        // if we are connected we reuse it
-        int tmp_qemu_tcp_sock = qemu_tcp_sock;
-        portEXIT_CRITICAL(&sockmutex);
-
-        if (tmp_qemu_tcp_sock == 0) {
-            // otherwise we wait for a new connection (note: this server supports only one client at the time)
-            tmp_qemu_tcp_sock = accept(qemu_tcp_listen_sock, (struct sockaddr*)&source_addr, &addr_len);
-            JADE_ASSERT(tmp_qemu_tcp_sock > 0);
-            portENTER_CRITICAL(&sockmutex);
-            qemu_tcp_sock = tmp_qemu_tcp_sock;
-            portEXIT_CRITICAL(&sockmutex);
+        // NOTE: only this task changes the sockets, so no need to lock to read them here
+        const int data_sock = qemu_tcp_sock;
+        const int log_sock = qemu_tcp_log_sock;
+
+        fd_set readfds;
+        FD_ZERO(&readfds);
+        FD_SET(listen_sock, &readfds);
+        FD_SET(log_listen_sock, &readfds);
+        int maxfd = listen_sock > log_listen_sock ? listen_sock : log_listen_sock;
+        if (data_sock) {
+            FD_SET(data_sock, &readfds);
+            maxfd = data_sock > maxfd ? data_sock : maxfd;
+        }
+        if (log_sock) {
+            FD_SET(log_sock, &readfds);
+            maxfd = log_sock > maxfd ? log_sock : maxfd;
         }
 
-        // Read incoming data max to fill buffer
-        const int len = recv(tmp_qemu_tcp_sock, qemu_tcp_data_in + read, MAX_INPUT_MSG_SIZE - read, 0);
-
-        if (len <= 0) {
-            // Close socket, pause and retry... will be reopened by above next loop
-            JADE_LOGE("Error reading bytes from tcp stream device: %u", len);
-            portENTER_CRITICAL(&sockmutex);
-            qemu_tcp_sock = 0;
-            portEXIT_CRITICAL(&sockmutex);
-            shutdown(tmp_qemu_tcp_sock, 0);
-            close(tmp_qemu_tcp_sock);
-            read = 0;
+        if (select(maxfd + 1, &readfds, NULL, NULL, NULL) < 0) {
+            JADE_LOGE("Error waiting on tcp sockets: errno %d", errno);
             vTaskDelay(20 / portTICK_PERIOD_MS);
             continue;
         }
 
-        // Pass to common handler
-        JADE_LOGD("Passing %u+%u bytes from tcp stream to common handler", read, len);
-        const bool force_reject_if_no_msg = false;
-        handle_data(
-            full_qemu_tcp_data_in, &read, len, &last_processing_time, force_reject_if_no_msg, qemu_tcp_data_out);
+        if (data_sock && FD_ISSET(data_sock, &readfds)) {
+            // Read incoming data max to fill buffer
+            const int len = recv(data_sock, qemu_tcp_data_in + read, MAX_INPUT_MSG_SIZE - read, 0);
+            if (len <= 0) {
+                // Closed or errored - close our end, and await a new connection
+                JADE_LOGW("tcp data connection closed: %d", len);
+                qemu_tcp_close(&qemu_tcp_sock);
+                read = 0;
+            } else {
+                // Pass to common handler
+                JADE_LOGD("Passing %u+%u bytes from tcp stream to common handler", read, len);
+                const bool force_reject_if_no_msg = false;
+                handle_data(full_qemu_tcp_data_in, &read, len, &last_processing_time, force_reject_if_no_msg,
+                    qemu_tcp_data_out);
+            }
+        }
+
+        if (log_sock && FD_ISSET(log_sock, &readfds)) {
+            // Any input on the read-only log connection is discarded - we only look for it closing
+            uint8_t discard[32];
+            if (recv(log_sock, discard, sizeof(discard), 0) <= 0) {
+                qemu_tcp_close(&qemu_tcp_log_sock);
+            }
+        }
+
+        // Accept new connections after reading, so any data received on a connection being replaced is handled
+        if (FD_ISSET(listen_sock, &readfds) && qemu_tcp_accept(listen_sock, &qemu_tcp_sock)) {
+            JADE_LOGI("Accepted tcp data connection");
+            read = 0;
+
+            // Any larger reply size was negotiated for the previous connection only
+            jade_process_negotiate_max_reply_size(SOURCE_QEMU_TCP, 0);
+        }
+        if (FD_ISSET(log_listen_sock, &readfds) && qemu_tcp_accept(log_listen_sock, &qemu_tcp_log_sock)) {
+            JADE_LOGI("Accepted tcp log connection");
+        }
+    }
+}
+
+static bool qemu_tcp_send(const int sock, const uint8_t* msg, const size_t length, const int flags)
+{
+    size_t written = 0;
+    while (written != length) {
+        const int wrote = send(sock, msg + written, length - written, flags);
+        if (wrote < 0) {
+            return false;
+        }
+        written += wrote;
     }
+    return true;
+}
+
+// Whether the whole of a message can be queued on a socket at once, without blocking.
+// lwIP only reports a socket writable when more than TCP_SNDLOWAT bytes of its send buffer are free, so
+// a message no larger than that can be sent in full - larger messages are never guaranteed to fit.
+static bool qemu_tcp_can_send_whole(const int sock, const size_t length)
+{
+    if (length > TCP_SNDLOWAT) {
+        return false;
+    }
+
+    fd_set writefds;
+    FD_ZERO(&writefds);
+    FD_SET(sock, &writefds);
+    struct timeval timeout = { .tv_sec = 0, .tv_usec = 0 };
+    return select(sock + 1, NULL, &writefds, NULL, &timeout) > 0 && FD_ISSET(sock, &writefds);
 }
 
 static bool write_qemu_tcp(const uint8_t* msg, const size_t length, void* ignore)
@@ -109,19 +222,25 @@ static bool write_qemu_tcp(const uint8_t* msg, const size_t length, void* ignore
     JADE_ASSERT(length);
 
     portENTER_CRITICAL(&sockmutex);
-    const int tmp_qemu_tcp_sock = qemu_tcp_sock;
+    const int data_sock = qemu_tcp_sock;
+    const int log_sock = qemu_tcp_log_sock;
     portEXIT_CRITICAL(&sockmutex);
-    if (tmp_qemu_tcp_sock == 0) {
+
+    // Copy to any observer, without blocking - only if the whole message can be queued at once, otherwise
+    // end its stream without writing any of it (so it never receives a partial message).
+    // NOTE: don't log here, as logs are written here.
+    if (log_sock) {
+        if (!qemu_tcp_can_send_whole(log_sock, length) || !qemu_tcp_send(log_sock, msg, length, MSG_DONTWAIT)) {
+            shutdown(log_sock, SHUT_WR);
+        }
+    }
+
+    if (data_sock == 0) {
         return false;
     }
-    int written = 0;
-    while (written != length) {
-        const int wrote = send(tmp_qemu_tcp_sock, msg + written, length - written, 0);
-        if (written < 0) {
-            JADE_LOGE("Error occurred during sending: errno %d", errno);
-            return false;
-        }
-        written += wrote;
+    if (!qemu_tcp_send(data_sock, msg, length, 0)) {
+        JADE_LOGE("Error occurred during sending: errno %d", errno);
+        return false;
     }
     return true;
 }
@@ -129,7 +248,7 @@ static bool write_qemu_tcp(const uint8_t* msg, const size_t length, void* ignore
 static void qemu_tcp_writer(void* ignore)
 {
     while (1) {
-        vTaskDelay(20 / portTICK_PERIOD_MS);
+        // Write as soon as notified (no initial delay) - reply latency matters more than batching here
         while (jade_process_get_out_message(&write_qemu_tcp, SOURCE_QEMU_TCP, NULL)) {
             // process messages
         }
@@ -240,12 +359,13 @@ bool qemu_tcp_init(TaskHandle_t* qemu_tcp_handle)
     qemu_tcp_data_out = JADE_MALLOC_PREFER_SPIRAM(MAX_OUTPUT_MSG_SIZE);
 
     BaseType_t retval = xTaskCreatePinnedToCore(
-        &qemu_tcp_reader, "qemu_tcp_reader", 2 * 1024, NULL, JADE_TASK_PRIO_READER, NULL, JADE_CORE_SECONDARY);
+        &qemu_tcp_reader, "qemu_tcp_reader", JADE_TASK_STACK_SIZE_READER, NULL, JADE_TASK_PRIO_READER, NULL,
+        JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create qemu_tcp_reader task, xTaskCreatePinnedToCore() returned %d", retval);
 
-    retval = xTaskCreatePinnedToCore(&qemu_tcp_writer, "qemu_tcp_writer", 2 * 1024, NULL, JADE_TASK_PRIO_WRITER,
-        qemu_tcp_handle, JADE_CORE_SECONDARY);
+    retval = xTaskCreatePinnedToCore(&qemu_tcp_writer, "qemu_tcp_writer", JADE_TASK_STACK_SIZE_WRITER, NULL,
+        JADE_TASK_PRIO_WRITER, qemu_tcp_handle, JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create qemu_tcp_writer task, xTaskCreatePinnedToCore() returned %d", retval);
     eth_start();
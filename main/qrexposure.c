@@ -0,0 +1,137 @@
+#include "qrexposure.h"
+#include "jade_assert.h"
+
+#include <string.h>
+
+// Frames are sampled on a grid with this spacing, into a histogram with bins of this width
+#define QR_EXPOSURE_SAMPLE_STEP 4
+#define QR_EXPOSURE_BIN_WIDTH 8
+#define QR_EXPOSURE_NUM_BINS (256 / QR_EXPOSURE_BIN_WIDTH)
+#define QR_EXPOSURE_TAIL_PERCENT 5
+#define QR_EXPOSURE_CLIPPED_LEVEL 250
+
+// Frames captured after a change, before the sensor has settled and the outcome reflects it
+#define QR_EXPOSURE_SETTLE_FRAMES 2
+
+// Consecutive frames not decoded before an adjustment is considered
+#define QR_EXPOSURE_PATIENCE_FRAMES 2
+
+// Targets - highlights not clipped (eg. by glare), the dark modules dark and the light modules bright,
+// and enough difference between them.
+#define QR_EXPOSURE_MAX_CLIPPED_PERCENT 1
+#define QR_EXPOSURE_MAX_LOW 96
+#define QR_EXPOSURE_MIN_HIGH 128
+#define QR_EXPOSURE_MIN_SPREAD 96
+
+void qr_exposure_frame_stats(const size_t width, const size_t height, const uint8_t* data, qr_frame_stats_t* stats)
+{
+    JADE_ASSERT(width);
+    JADE_ASSERT(height);
+    JADE_ASSERT(data);
+    JADE_ASSERT(stats);
+
+    uint16_t histogram[QR_EXPOSURE_NUM_BINS] = { 0 };
+    uint32_t sum = 0;
+    size_t clipped = 0;
+    size_t count = 0;
+    for (size_t y = QR_EXPOSURE_SAMPLE_STEP / 2; y < height; y += QR_EXPOSURE_SAMPLE_STEP) {
+        const uint8_t* const row = data + y * width;
+        for (size_t x = QR_EXPOSURE_SAMPLE_STEP / 2; x < width; x += QR_EXPOSURE_SAMPLE_STEP) {
+            const uint8_t value = row[x];
+            ++histogram[value / QR_EXPOSURE_BIN_WIDTH];
+            sum += value;
+            clipped += value >= QR_EXPOSURE_CLIPPED_LEVEL;
+            ++count;
+        }
+    }
+    JADE_ASSERT(count);
+
+    // Percentiles reported as the centre of the histogram bin they fall in
+    const size_t tail = count * QR_EXPOSURE_TAIL_PERCENT / 100;
+    size_t below = 0;
+    size_t bin = 0;
+    while (below + histogram[bin] <= tail) {
+        below += histogram[bin++];
+    }
+    stats->low = bin * QR_EXPOSURE_BIN_WIDTH + QR_EXPOSURE_BIN_WIDTH / 2;
+
+    size_t above = 0;
+    bin = QR_EXPOSURE_NUM_BINS - 1;
+    while (above + histogram[bin] <= tail) {
+        above += histogram[bin--];
+    }
+    stats->high = bin * QR_EXPOSURE_BIN_WIDTH + QR_EXPOSURE_BIN_WIDTH / 2;
+
+    stats->mean = sum / count;
+    stats->clipped_percent = clipped * 100 / count;
+}
+
+static int8_t qr_exposure_step(const int8_t value, const int8_t delta)
+{
+    const int8_t stepped = value + delta;
+    return stepped < -CAMERA_EXPOSURE_LIMIT ? -CAMERA_EXPOSURE_LIMIT
+        : stepped > CAMERA_EXPOSURE_LIMIT   ? CAMERA_EXPOSURE_LIMIT
+                                            : stepped;
+}
+
+bool qr_exposure_update(qr_exposure_t* exposure, const qr_frame_stats_t* stats, const qr_frame_outcome_t outcome)
+{
+    JADE_ASSERT(exposure);
+    JADE_ASSERT(stats);
+
+    ++exposure->frames;
+    exposure->located += outcome != QR_FRAME_NO_CODE;
+    exposure->decoded += outcome == QR_FRAME_CODE_DECODED;
+
+    // Nothing to do if the camera cannot be adjusted, or if frames are being decoded (keep what works)
+    if (exposure->unsupported || outcome == QR_FRAME_CODE_DECODED) {
+        exposure->failed_frames = 0;
+        return false;
+    }
+
+    // Ignore frames from before the last change had taken effect
+    if (exposure->settle_frames) {
+        --exposure->settle_frames;
+        return false;
+    }
+
+    if (++exposure->failed_frames < QR_EXPOSURE_PATIENCE_FRAMES) {
+        return false;
+    }
+    exposure->failed_frames = 0;
+
+    // Prefer to fix the exposure (clipped highlights first), then raise the contrast if it is low
+    // or if a code is located but its modules cannot be read.
+    camera_exposure_t settings = exposure->settings;
+    if (stats->clipped_percent > QR_EXPOSURE_MAX_CLIPPED_PERCENT || stats->low > QR_EXPOSURE_MAX_LOW) {
+        settings.ae_level = qr_exposure_step(settings.ae_level, -1);
+    } else if (stats->high < QR_EXPOSURE_MIN_HIGH) {
+        settings.ae_level = qr_exposure_step(settings.ae_level, 1);
+    } else if (stats->high - stats->low < QR_EXPOSURE_MIN_SPREAD || outcome == QR_FRAME_CODE_LOCATED) {
+        settings.contrast = qr_exposure_step(settings.contrast, 1);
+    }
+
+    if (!memcmp(&settings, &exposure->settings, sizeof(settings))) {
+        return false;
+    }
+
+    JADE_LOGI("Frame low %u, high %u, mean %u, clipped %u%% - ae_level %d -> %d, contrast %d -> %d", stats->low,
+        stats->high, stats->mean, stats->clipped_percent, exposure->settings.ae_level, settings.ae_level,
+        exposure->settings.contrast, settings.contrast);
+    exposure->settings = settings;
+    exposure->settle_frames = QR_EXPOSURE_SETTLE_FRAMES;
+    ++exposure->adjustments;
+    return true;
+}
+
+void qr_exposure_log_stats(const qr_exposure_t* exposure, const uint32_t elapsed_ms)
+{
+    JADE_ASSERT(exposure);
+
+    const uint32_t elapsed = elapsed_ms ? elapsed_ms : 1;
+    JADE_LOGI("QR scan: %u frames in %lums (%lu fps), code located in %u, decoded in %u (%lu per 10s), "
+              "%u exposure adjustments, final ae_level %d contrast %d",
+        exposure->frames, elapsed_ms, exposure->frames * 1000 / elapsed, exposure->located, exposure->decoded,
+        exposure->decoded * 10000 / elapsed, exposure->adjustments, exposure->settings.ae_level,
+        exposure->settings.contrast);
+}
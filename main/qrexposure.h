@@ -0,0 +1,50 @@
+#ifndef QREXPOSURE_H_
+#define QREXPOSURE_H_
+
+#include "camera.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Closed-loop camera exposure control for qr scanning.
+// The sensor's automatic exposure is tuned for natural scenes rather than for (often glaring) phone
+// screens, so the outcome of each qr decode attempt and the frame's histogram are fed back into
+// adjustments of the sensor's exposure level and contrast.
+
+// What was found in a camera frame
+typedef enum { QR_FRAME_NO_CODE = 0, QR_FRAME_CODE_LOCATED, QR_FRAME_CODE_DECODED } qr_frame_outcome_t;
+
+// Histogram statistics of a camera frame
+typedef struct {
+    uint8_t low; // 5th percentile
+    uint8_t high; // 95th percentile
+    uint8_t mean;
+    uint8_t clipped_percent; // proportion of (near) saturated pixels
+} qr_frame_stats_t;
+
+typedef struct {
+    camera_exposure_t settings;
+    size_t settle_frames;
+    size_t failed_frames;
+    bool unsupported; // the camera cannot apply adjustments - only the statistics are collected
+
+    // Decode statistics for logging
+    size_t frames;
+    size_t located;
+    size_t decoded;
+    size_t adjustments;
+} qr_exposure_t;
+
+// Compute the histogram statistics of a (grayscale) frame
+void qr_exposure_frame_stats(size_t width, size_t height, const uint8_t* data, qr_frame_stats_t* stats);
+
+// Record the outcome of a frame captured with the current settings, and adjust the settings if the
+// frames are not being decoded and the statistics suggest a better exposure.
+// Returns true if the settings were changed (and should be applied to the camera).
+bool qr_exposure_update(qr_exposure_t* exposure, const qr_frame_stats_t* stats, qr_frame_outcome_t outcome);
+
+// Log the decode statistics of a scan which took the given time
+void qr_exposure_log_stats(const qr_exposure_t* exposure, uint32_t elapsed_ms);
+
+#endif /* QREXPOSURE_H_ */
@@ -13,6 +13,7 @@
 #include "process.h"
 #include "qrcode.h"
 #include "sensitive.h"
+#include "stack_usage.h"
 #include "storage.h"
 #include "ui.h"
 #include "utils/address.h"
@@ -56,6 +57,7 @@ int sign_message_file(const char* str, const size_t str_len, uint8_t* sig_output
 // PSBT struct and functions
 struct wally_psbt;
 int sign_psbt(const char* network, struct wally_psbt* psbt, const char** errmsg);
+size_t psbt_signed_length_estimate(const struct wally_psbt* psbt, size_t unsigned_len);
 int wally_psbt_free(struct wally_psbt* psbt);
 
 #define EXPORT_XPUB_PATH_LEN 4
@@ -198,7 +200,7 @@ static bool handle_xpub_options(uint16_t* qr_flags)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_XPUB_EXIT;
 #endif
@@ -247,7 +249,7 @@ void display_xpub_qr(void)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_XPUB_EXIT;
 #endif
@@ -266,13 +268,20 @@ void display_xpub_qr(void)
 }
 
 // Helper to get user to select multisig record to use
-static bool select_multisig_record(char names[][MAX_MULTISIG_NAME_SIZE], const size_t num_names, size_t* selected)
+// Offers the registered records valid for the given script type, loading them one at a time as the user scrolls.
+// Returns false if there are no such records, or if the user cancels.
+static bool select_multisig_record(const size_t* script_type, char* name, const size_t name_len)
 {
-    JADE_ASSERT(names);
-    JADE_ASSERT(num_names);
-    JADE_INIT_OUT_SIZE(selected);
+    JADE_ASSERT(script_type);
+    JADE_ASSERT(name);
+    JADE_ASSERT(name_len >= NVS_KEY_NAME_MAX_SIZE);
+
+    // Start with the first valid record
+    size_t selected = 0;
+    if (!multisig_find_valid_record(script_type, 0, true, &selected, name, name_len)) {
+        return false;
+    }
 
-    // Otherwise offer choice of multisig names
     gui_activity_t* activity = NULL;
     gui_view_node_t* item_text = NULL;
     make_show_label_activity(&activity, "Multisig Address", "Select multisig wallet:", &item_text);
@@ -280,31 +289,40 @@ static bool select_multisig_record(char names[][MAX_MULTISIG_NAME_SIZE], const s
     JADE_ASSERT(item_text);
     gui_set_current_activity(activity);
 
-    const size_t limit = num_names + 1;
+    // Index 'cancel' (one past the last record) represents the '< Cancel >' option
+    const size_t cancel = storage_get_multisig_registration_count();
     while (true) {
-        JADE_ASSERT(*selected < limit);
-        if (*selected < num_names) {
-            gui_update_text(item_text, names[*selected]);
-        } else {
-            gui_update_text(item_text, "< Cancel >");
-        }
+        JADE_ASSERT(selected <= cancel);
+        gui_update_text(item_text, selected < cancel ? name : "< Cancel >");
 
         // wait for a GUI event
         int32_t ev_id = 0;
         gui_activity_wait_event(activity, GUI_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 
+        size_t found = 0;
         switch (ev_id) {
         case GUI_WHEEL_LEFT_EVENT:
-            *selected = (*selected + limit - 1) % limit;
+            // Previous valid record (from 'cancel' that is the last), or from the first record round to 'cancel'
+            if (selected && multisig_find_valid_record(script_type, selected - 1, false, &found, name, name_len)) {
+                selected = found;
+            } else {
+                selected = cancel;
+            }
             break;
 
         case GUI_WHEEL_RIGHT_EVENT:
-            *selected = (*selected + 1) % limit;
+            // Next valid record (from 'cancel' that is the first), or from the last record round to 'cancel'
+            if (multisig_find_valid_record(
+                    script_type, selected == cancel ? 0 : selected + 1, true, &found, name, name_len)) {
+                selected = found;
+            } else {
+                selected = cancel;
+            }
             break;
 
         default:
             if (ev_id == gui_get_click_event()) {
-                return *selected < num_names;
+                return selected < cancel;
             }
         }
     }
@@ -349,26 +367,20 @@ static bool verify_address(const address_data_t* const addr_data)
     // If it is (or might be) multisig, ask the user to select one, and load details
     if (script_type == WALLY_SCRIPT_TYPE_P2SH || script_type == WALLY_SCRIPT_TYPE_P2WSH) {
         // Could be multisig - offer choice of multisig records
-        char names[MAX_MULTISIG_REGISTRATIONS][NVS_KEY_NAME_MAX_SIZE]; // Sufficient
-        const size_t num_names = sizeof(names) / sizeof(names[0]);
-        size_t num_multisigs = 0;
-        multisig_get_valid_record_names(&script_type, names, num_names, &num_multisigs);
-
         // p2sh-wrapped could be multi- or single- sig.  User to select which.
         if (script_type != WALLY_SCRIPT_TYPE_P2SH
             || await_yesno_activity("Multisig Address", "\nIs this a multisig address?", false)) {
             // Must have a multisig record - user to select
-            size_t selected = 0;
-            if (!num_multisigs || !select_multisig_record(names, num_multisigs, &selected)) {
+            char multisig_name[NVS_KEY_NAME_MAX_SIZE];
+            if (!select_multisig_record(&script_type, multisig_name, sizeof(multisig_name))) {
                 JADE_LOGE("No relevant multisig records found/selected for multisig address");
                 await_error_activity("Register multisig record\nbefore attempting to\nverify multisig addresses");
                 return false;
             }
-            JADE_ASSERT(selected < num_multisigs);
 
             const char* errmsg = NULL;
             multisig_data_t multisig_data;
-            if (!multisig_load_from_storage(names[selected], &multisig_data, &errmsg)) {
+            if (!multisig_load_from_storage(multisig_name, &multisig_data, &errmsg)) {
                 await_error_activity("Failed to load multisig record");
                 return false;
             }
@@ -391,7 +403,7 @@ static bool verify_address(const address_data_t* const addr_data)
             }
 
             // Use multisig name as ui label.
-            rc = snprintf(label, sizeof(label), "<%s>/0", names[selected]);
+            rc = snprintf(label, sizeof(label), "<%s>/0", multisig_name);
             JADE_ASSERT(rc > 0 && rc < sizeof(label));
         }
     }
@@ -492,7 +504,7 @@ static bool verify_address(const address_data_t* const addr_data)
                 == ESP_OK;
 #else
             sync_wait_event(GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, event_data, NULL, NULL, NULL,
-                CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+                gui_unattended_ci_timeout());
             const bool ret = index > 4 * num_indexes_to_reconfirm; // let it run for a few batches, then exit
             ev_id = BTN_SCAN_ADDRESS_EXIT;
 #endif
@@ -548,7 +560,7 @@ static bool handle_qr_options(uint16_t* qr_flags)
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_XPUB_EXIT;
 #endif
@@ -633,7 +645,7 @@ static void display_bcur_qr(
         const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
         gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, NULL, NULL,
-            CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+            gui_unattended_ci_timeout());
         const bool ret = true;
         ev_id = BTN_QR_DISPLAY_EXIT;
 #endif
@@ -762,15 +774,18 @@ static bool parse_sign_display_bcur_psbt_qr(const uint8_t* cbor, const size_t cb
     }
 
     // Build BCUR message holding the signed PSBT
+    // (The scanned cbor length bounds the length of the psbt as received.)
     uint8_t* cbor_signed = NULL;
     size_t cbor_signed_len = 0;
-    if (!bcur_build_cbor_crypto_psbt(psbt, &cbor_signed, &cbor_signed_len)) {
+    const size_t len_estimate = psbt_signed_length_estimate(psbt, cbor_len);
+    if (!bcur_build_cbor_crypto_psbt(psbt, len_estimate, &cbor_signed, &cbor_signed_len)) {
         JADE_LOGW("Failed to build bcur/cbor for psbt");
-        return false;
+        goto cleanup;
     }
 
     // Now display bcur QR
     display_bcur_qr("PSBT Export", "Scan using\nwallet app", BCUR_TYPE_CRYPTO_PSBT, cbor_signed, cbor_signed_len);
+    free(cbor_signed);
 
 cleanup:
     JADE_WALLY_VERIFY(wally_psbt_free(psbt));
@@ -957,7 +972,7 @@ void await_single_qr_activity(const char* title, const char* label, const uint8_
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, BTN_QR_DISPLAY_EXIT, NULL, NULL, NULL, 0);
 #else
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, BTN_QR_DISPLAY_EXIT, NULL, NULL, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
 #endif
 }
 
@@ -984,7 +999,7 @@ void await_qr_help_activity(const char* url)
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, BTN_EXIT_QR_HELP, NULL, NULL, NULL, 0);
 #else
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, BTN_EXIT_QR_HELP, NULL, NULL, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
 #endif
 }
 
@@ -1013,7 +1028,7 @@ bool await_qr_yesno_activity(const char* title, const char* label, const char* u
     const bool ret = gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL, 0);
 #else
     gui_activity_wait_event(activity, GUI_BUTTON_EVENT, ESP_EVENT_ANY_ID, NULL, &ev_id, NULL,
-        CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS / portTICK_PERIOD_MS);
+        gui_unattended_ci_timeout());
     const bool ret = true;
     ev_id = BTN_YES;
 #endif
@@ -1092,19 +1107,20 @@ static bool post_auth_msg_request(const jade_msg_source_t source)
     return post_in_message(cbor_buf, cbor_len, source);
 }
 
-// Scan a bcur QR code, and post it into Jade with SOURCE_QR
-static bool scan_qr_post_in_message(const char* title, const char* expected_type)
+// Scan a bcur QR code of the expected type
+// NOTE: the caller takes ownership of 'output' and must free it
+static bool scan_bcur_qr(const char* title, const char* expected_type, uint8_t** output, size_t* output_len)
 {
     JADE_ASSERT(title);
     JADE_ASSERT(expected_type);
+    JADE_INIT_OUT_PPTR(output);
+    JADE_INIT_OUT_SIZE(output_len);
 
     char* output_type = NULL;
-    uint8_t* output = NULL;
-    size_t output_len = 0;
     bool ret = false;
 
     // NOTE: we take ownership of 'output_type' and 'output'
-    if (!bcur_scan_qr(title, "Scan QR on\nwebpage", &output_type, &output, &output_len)) {
+    if (!bcur_scan_qr(title, "Scan QR on\nwebpage", &output_type, output, output_len)) {
         JADE_LOGI("QR scanning failed or abandoned");
         return false;
     }
@@ -1123,29 +1139,128 @@ static bool scan_qr_post_in_message(const char* title, const char* expected_type
         goto cleanup;
     }
 
-    // Post as message into Jade with source-qr prefix
-    ret = post_in_message(output, output_len, SOURCE_QR);
+    ret = true;
 
 cleanup:
-    free(output);
+    if (!ret) {
+        free(*output);
+        *output = NULL;
+        *output_len = 0;
+    }
     free(output_type);
     return ret;
 }
 
+// Scan a bcur QR code, and post it into Jade with SOURCE_QR
+static bool scan_qr_post_in_message(const char* title, const char* expected_type)
+{
+    JADE_ASSERT(title);
+    JADE_ASSERT(expected_type);
+
+    uint8_t* output = NULL;
+    size_t output_len = 0;
+    if (!scan_bcur_qr(title, expected_type, &output, &output_len)) {
+        return false;
+    }
+
+    // Post as message into Jade with source-qr prefix
+    const bool ret = post_in_message(output, output_len, SOURCE_QR);
+    free(output);
+    return ret;
+}
+
+// Scan a compact pinserver reply (binary fields only), and post it into Jade
+// with SOURCE_QR as the 'handshake_complete' message the pinclient is awaiting.
+// If the expected fields are not present the message is posted without parameters,
+// which the pinclient treats as a failure to communicate with the pinserver.
+static bool scan_qr_post_compact_pinserver_reply(const char* title)
+{
+    JADE_ASSERT(title);
+
+    uint8_t* output = NULL;
+    size_t output_len = 0;
+    if (!scan_bcur_qr(title, BCUR_TYPE_JADE_PINREP, &output, &output_len)) {
+        return false;
+    }
+
+    const uint8_t* encrypted_key = NULL;
+    size_t encrypted_key_len = 0;
+    const uint8_t* hmac = NULL;
+    size_t hmac_len = 0;
+
+    CborParser parser;
+    CborValue reply;
+    if (cbor_parser_init(output, output_len, CborValidateBasic, &parser, &reply) == CborNoError
+        && cbor_value_is_map(&reply)) {
+        rpc_get_bytes_ptr("encrypted_key", &reply, &encrypted_key, &encrypted_key_len);
+        rpc_get_bytes_ptr("hmac", &reply, &hmac, &hmac_len);
+    }
+    const bool have_params = encrypted_key && encrypted_key_len && hmac && hmac_len;
+    if (!have_params) {
+        JADE_LOGW("Compact pinserver reply missing expected fields");
+    }
+
+    // Build 'handshake_complete' message with the binary fields as parameters
+    uint8_t cbor_buf[256];
+    CborEncoder root_encoder;
+    cbor_encoder_init(&root_encoder, cbor_buf, sizeof(cbor_buf), 0);
+
+    CborEncoder root_map_encoder; // id, method, params
+    CborError cberr = cbor_encoder_create_map(&root_encoder, &root_map_encoder, have_params ? 3 : 2);
+    JADE_ASSERT(cberr == CborNoError);
+    add_string_to_map(&root_map_encoder, "id", "qrpin");
+    add_string_to_map(&root_map_encoder, "method", "handshake_complete");
+
+    if (have_params) {
+        cberr = cbor_encode_text_stringz(&root_map_encoder, "params");
+        JADE_ASSERT(cberr == CborNoError);
+
+        CborEncoder params_encoder; // encrypted_key, hmac
+        cberr = cbor_encoder_create_map(&root_map_encoder, &params_encoder, 2);
+        JADE_ASSERT(cberr == CborNoError);
+        add_bytes_to_map(&params_encoder, "encrypted_key", encrypted_key, encrypted_key_len);
+        add_bytes_to_map(&params_encoder, "hmac", hmac, hmac_len);
+        cberr = cbor_encoder_close_container(&root_map_encoder, &params_encoder);
+        JADE_ASSERT(cberr == CborNoError);
+    }
+
+    cberr = cbor_encoder_close_container(&root_encoder, &root_map_encoder);
+    free(output);
+
+    if (cberr != CborNoError) {
+        JADE_LOGE("Compact pinserver reply too large");
+        return false;
+    }
+
+    const size_t cbor_len = cbor_encoder_get_buffer_size(&root_encoder, cbor_buf);
+    return post_in_message(cbor_buf, cbor_len, SOURCE_QR);
+}
+
+// Context for the QR-mode pinserver exchanges.
+// Each exchange is two steps - display Jade's request, then scan the server's reply.
+// The number of steps is two for the single round-trip protocol, or four for the
+// two-step handshake (or more if falling back from one to the other).
+typedef struct {
+    uint8_t step;
+    uint8_t num_steps;
+    bool compact; // request displayed in compact form, so compact reply expected
+    bool done; // final result received
+    bool ok;
+} qr_pin_exchange_t;
+
 // NOTE: this 'writer' callback must return true to indicate that it has taken the message
 // (whether valid/expected or not), and it does not want to wait to be presented with another message.
 // ie. the return indicates processing has finished, not that processing was necessarily successful.
 // (That information is returned in the context object.)
-// NOTE: the presence of a 'title' indicates we want to display the message payload as a QR
-static bool handle_pinserver_reply(const char* title, const uint8_t* msg, const size_t len, void* ctx)
+// Any pinserver request is displayed as a QR - either the full http_request message, or the compact form.
+static bool handle_pinserver_reply(const uint8_t* msg, const size_t len, void* ctx)
 {
-    // title is optional
     JADE_ASSERT(msg);
     JADE_ASSERT(len);
     JADE_ASSERT(ctx);
 
-    bool* const ok = (bool*)ctx;
-    *ok = false;
+    qr_pin_exchange_t* const exchange = (qr_pin_exchange_t*)ctx;
+    exchange->ok = false;
 
     // Parse the received message
     CborParser parser;
@@ -1160,23 +1275,53 @@ static bool handle_pinserver_reply(const char* title, const uint8_t* msg, const
     bool bool_result = false;
     if (rpc_get_boolean("result", &message, &bool_result)) {
         JADE_LOGI("PIN QR result: %u", bool_result);
+        exchange->done = true;
+        exchange->ok = bool_result;
         goto cleanup;
     }
 
     CborValue result;
-    CborValue http_request;
-    if (!rpc_get_map("result", &message, &result) || !rpc_get_map("http_request", &result, &http_request)) {
-        JADE_LOGE("Unexpected cbor message - no 'http_request' result payload");
+    if (!rpc_get_map("result", &message, &result)) {
+        JADE_LOGE("Unexpected cbor message - no 'result' payload");
         goto cleanup;
     }
 
-    // Display message as bcur qr if a screen title was passed
-    if (title) {
+    char title[16];
+    CborValue request;
+    if (rpc_get_map("pin_request", &result, &request)) {
+        // Single round-trip request in compact form - this is the final exchange
+        exchange->compact = true;
+        exchange->num_steps = exchange->step + 1;
+        const int rc = snprintf(title, sizeof(title), "Step %u of %u", exchange->step, exchange->num_steps);
+        JADE_ASSERT(rc > 0 && rc < sizeof(title));
+
+        // Display the compact request map itself, as it appears in the message
+        const uint8_t* const request_start = cbor_value_get_next_byte(&request);
+        if (cbor_value_advance(&request) != CborNoError) {
+            JADE_LOGE("Invalid compact pinserver request");
+            goto cleanup;
+        }
+        const size_t request_len = cbor_value_get_next_byte(&request) - request_start;
+        display_bcur_qr(title, "Scan QR with\nwebpage", BCUR_TYPE_JADE_PINREQ, request_start, request_len);
+    } else if (rpc_get_map("http_request", &result, &request)) {
+        // Full http request - a 'start_handshake' (ie. reply to 'handshake_init') implies two exchanges remain
+        const char* on_reply = NULL;
+        size_t on_reply_len = 0;
+        rpc_get_string_ptr("on-reply", &request, &on_reply, &on_reply_len);
+        const bool handshake_init = on_reply_len == strlen("handshake_init")
+            && !strncmp(on_reply, "handshake_init", on_reply_len);
+        exchange->compact = false;
+        exchange->num_steps = exchange->step + (handshake_init ? 3 : 1);
+        const int rc = snprintf(title, sizeof(title), "Step %u of %u", exchange->step, exchange->num_steps);
+        JADE_ASSERT(rc > 0 && rc < sizeof(title));
         display_bcur_qr(title, "Scan QR with\nwebpage", BCUR_TYPE_JADE_PIN, msg, len);
+    } else {
+        JADE_LOGE("Unexpected cbor message - no 'http_request' or 'pin_request' result payload");
+        goto cleanup;
     }
 
     // Message received and QR displayed successfully
-    *ok = true;
+    exchange->ok = true;
 
 cleanup:
     // We return true in all cases to indicate that a message was received
@@ -1185,38 +1330,24 @@ cleanup:
     return true;
 }
 
-static bool handle_first_pinserver_reply(const uint8_t* msg, const size_t len, void* ctx)
+// Scan the pinserver reply as displayed on the webpage and post back to auth_user/pinclient task
+static bool scan_post_pinserver_reply(const qr_pin_exchange_t* exchange)
 {
-    return handle_pinserver_reply("Step 1 of 4", msg, len, ctx);
-}
+    JADE_ASSERT(exchange);
 
-static bool handle_second_pinserver_reply(const uint8_t* msg, const size_t len, void* ctx)
-{
-    return handle_pinserver_reply("Step 3 of 4", msg, len, ctx);
-}
+    char title[16];
+    const int rc = snprintf(title, sizeof(title), "Step %u of %u", exchange->step + 1, exchange->num_steps);
+    JADE_ASSERT(rc > 0 && rc < sizeof(title));
 
-static bool handle_third_pinserver_reply(const uint8_t* msg, const size_t len, void* ctx)
-{
-    // No QR to display with final reply
-    return handle_pinserver_reply(NULL, msg, len, ctx);
-}
-
-static bool get_outbound_reply_show_qr(outbound_message_writer_fn_t handler)
-{
-    JADE_ASSERT(handler);
-
-    // Await message from Jade to pinserver
-    bool ok = false;
-    while (!jade_process_get_out_message(handler, SOURCE_QR, &ok)) {
-        // Await outbound message
-    }
-    return ok;
+    return exchange->compact ? scan_qr_post_compact_pinserver_reply(title)
+                             : scan_qr_post_in_message(title, BCUR_TYPE_JADE_PIN);
 }
 
 // This task is run to act as a client to Jade's normal 'auth-user' processing
 static void auth_qr_client_task(void* unused)
 {
     JADE_LOGI("Starting Auth QR client task: %lu", xPortGetFreeHeapSize());
+    const TickType_t start_time = xTaskGetTickCount();
 
     // Drain any old messages sitting on the QR queue
     while (jade_process_get_out_message(NULL, SOURCE_QR, NULL)) {
@@ -1230,49 +1361,47 @@ static void auth_qr_client_task(void* unused)
         goto cleanup;
     }
 
-    // Wait for message (from synthesized auth_user/pinclient processing)
-    // and display the message payload as bcur QR code on screen.
-    JADE_LOGI("Awaiting auth_user reply data to display as qr");
-    if (!get_outbound_reply_show_qr(handle_first_pinserver_reply)) {
-        // For a temporary wallet this call is expected to 'fail' as we don't need
-        // any pinserver interaction (but still have to 'auth' to some degree).
-        if (keychain_has_temporary()) {
-            JADE_LOGI("Temporary wallet, QR Mode, skipping pinserver interaction");
-        } else {
-            JADE_LOGW("Failed to receive auth_user reply data");
+    qr_pin_exchange_t exchange = { .step = 1, .num_steps = 0, .compact = false, .done = false, .ok = false };
+    while (true) {
+        // Wait for message (from synthesized auth_user/pinclient processing)
+        // and display any pinserver request payload as bcur QR code on screen.
+        JADE_LOGI("Awaiting auth_user/pinclient reply data to display as qr");
+        while (!jade_process_get_out_message(handle_pinserver_reply, SOURCE_QR, &exchange)) {
+            // Await outbound message
         }
-        goto cleanup;
-    }
-
-    // Scan qr code and post back to auth_user/pinclient task
-    // 'start_handshake'
-    JADE_LOGI("Scanning/posting start_handshake data");
-    if (!scan_qr_post_in_message("Step 2 of 4", BCUR_TYPE_JADE_PIN)) {
-        JADE_LOGW("Failed to scan start_handshake message");
-        goto cleanup;
-    }
 
-    // Wait for message from auth_user/pinclient processing
-    // and display as bcur QR code on screen
-    JADE_LOGI("Awaiting start_handshake reply data to display as qr");
-    if (!get_outbound_reply_show_qr(handle_second_pinserver_reply)) {
-        JADE_LOGW("Failed to receive start_handshake reply data");
-        goto cleanup;
-    }
+        if (exchange.done) {
+            // For a temporary wallet no pinserver interaction is required
+            // (but we still have to 'auth' to some degree).
+            if (exchange.step == 1 && keychain_has_temporary()) {
+                JADE_LOGI("Temporary wallet, QR Mode, skipping pinserver interaction");
+            } else if (exchange.ok) {
+                JADE_LOGI("Success - QR PIN exchange complete in %u steps, %lums", exchange.step - 1,
+                    (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS);
+            } else {
+                JADE_LOGW("QR PIN exchange failed");
+            }
+            break;
+        }
 
-    // Scan qr code and post back to auth_user/pinclient task
-    // 'handshake_complete'
-    JADE_LOGI("Scanning/posting handshake_complete data");
-    if (!scan_qr_post_in_message("Step 4 of 4", BCUR_TYPE_JADE_PIN)) {
-        JADE_LOGW("Failed to scan handshake_complete message");
-        goto cleanup;
-    }
+        if (!exchange.ok) {
+            JADE_LOGW("Failed to receive auth_user/pinclient reply data");
+            break;
+        }
+        JADE_LOGI("Step %u of %u complete at %lums", exchange.step, exchange.num_steps,
+            (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS);
 
-    // Process (discard) the final message
-    JADE_LOGI("Awaiting (discarding) handshake_complete reply data");
-    get_outbound_reply_show_qr(handle_third_pinserver_reply);
+        // Scan qr code and post back to auth_user/pinclient task
+        JADE_LOGI("Scanning/posting pinserver reply data");
+        if (!scan_post_pinserver_reply(&exchange)) {
+            JADE_LOGW("Failed to scan pinserver reply message");
+            break;
+        }
+        JADE_LOGI("Step %u of %u complete at %lums", exchange.step + 1, exchange.num_steps,
+            (xTaskGetTickCount() - start_time) * portTICK_PERIOD_MS);
 
-    JADE_LOGI("Success");
+        exchange.step += 2;
+    }
 
 cleanup:
     // Post a cancel message which should ensure the main dashboard task returns
@@ -1281,6 +1410,9 @@ cleanup:
 
     // Log the task stack HWM so we can estimate ideal stack size
     JADE_LOGI("Auth QR client task complete - task stack HWM: %u free", uxTaskGetStackHighWaterMark(NULL));
+#ifdef CONFIG_DEBUG_MODE
+    stack_usage_record_current_task();
+#endif
 
     // Delete this task
     vTaskDelete(NULL);
@@ -1290,8 +1422,8 @@ void handle_qr_auth(void)
 {
     // Start a task to run the qr client side
     TaskHandle_t auth_qr_client_task_handle;
-    const BaseType_t retval = xTaskCreatePinnedToCore(&auth_qr_client_task, "auth_qr_client_task", 4 * 1024, NULL,
-        JADE_TASK_PRIO_GUI, &auth_qr_client_task_handle, JADE_CORE_SECONDARY);
+    const BaseType_t retval = xTaskCreatePinnedToCore(&auth_qr_client_task, "auth_qr_client_task",
+        JADE_TASK_STACK_SIZE_AUTH_QR, NULL, JADE_TASK_PRIO_GUI, &auth_qr_client_task_handle, JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create auth_qr_client_task, xTaskCreatePinnedToCore() returned %d", retval);
 
@@ -1,3 +1,4 @@
+#include <esp_timer.h>
 #include <quirc.h>
 #include <string.h>
 
@@ -7,6 +8,21 @@
 #include "sensitive.h"
 #include "utils/malloc_ext.h"
 
+// When a qr code is located but cannot be decoded (typically a dense code held too far away), the camera is
+// asked to read out a smaller window of its field of view around the code - ie. to zoom in - so each module
+// covers more pixels of the (unchanged size) frame.
+#define QR_ZOOM_CODE_FILL_PERCENT 75 // target proportion of the window height the code should fill
+#define QR_ZOOM_MIN_GAIN_PERCENT 85 // only rezoom if the window shrinks to at most this proportion of the current
+#define QR_ZOOM_MAX_FACTOR 4
+#define QR_ZOOM_LOST_FRAMES 15 // frames without any code seen before restoring the full view
+
+// Windows are 4:3, with a height which is a multiple of this (so the width is whole)
+#define QR_ZOOM_WINDOW_STEP 6
+
+#ifdef CONFIG_DEBUG_MODE
+#define QR_ZOOM_MAX_REPLAY_STEPS 4
+#endif
+
 // Inspect qrcodes and try to extract payload - whether any were seen and any
 // string data extracted are stored in the qr_data struct passed.
 static bool qr_extract_payload(qr_data_t* qr_data)
@@ -60,6 +76,113 @@ static bool qr_extract_payload(qr_data_t* qr_data)
     return false;
 }
 
+static int qr_clamp(const int value, const int low, const int high)
+{
+    return value < low ? low : value > high ? high : value;
+}
+
+// Get the current camera window - ie. the full view if not zoomed
+static void qr_current_window(const qr_zoom_t* zoom, camera_window_t* window)
+{
+    JADE_ASSERT(zoom);
+    JADE_ASSERT(window);
+
+    if (zoom->window.width) {
+        *window = zoom->window;
+    } else {
+        window->x = 0;
+        window->y = 0;
+        window->width = CAMERA_IMAGE_WIDTH;
+        window->height = CAMERA_IMAGE_HEIGHT;
+    }
+}
+
+// Compute the window (in full-view coordinates) in which a code, whose corners are given in the coordinates
+// of a frame captured with the 'current' window, would fill the target proportion of the frame.
+// Returns false if that would not be a worthwhile increase in magnification.
+static bool qr_zoom_window(
+    const camera_window_t* current, const struct quirc_point* corners, camera_window_t* window)
+{
+    JADE_ASSERT(current);
+    JADE_ASSERT(corners);
+    JADE_ASSERT(window);
+
+    // Bounding box of the code in the frame
+    int minx = CAMERA_IMAGE_WIDTH, maxx = 0, miny = CAMERA_IMAGE_HEIGHT, maxy = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        const int x = qr_clamp(corners[i].x, 0, CAMERA_IMAGE_WIDTH - 1);
+        const int y = qr_clamp(corners[i].y, 0, CAMERA_IMAGE_HEIGHT - 1);
+        minx = x < minx ? x : minx;
+        maxx = x > maxx ? x : maxx;
+        miny = y < miny ? y : miny;
+        maxy = y > maxy ? y : maxy;
+    }
+
+    // Centre and size of the code in full-view coordinates
+    const int cx = current->x + (minx + maxx) * current->width / (2 * CAMERA_IMAGE_WIDTH);
+    const int cy = current->y + (miny + maxy) * current->height / (2 * CAMERA_IMAGE_HEIGHT);
+    const int code_width = (maxx - minx) * current->width / CAMERA_IMAGE_WIDTH;
+    const int code_height = (maxy - miny) * current->height / CAMERA_IMAGE_HEIGHT;
+
+    // Height of a 4:3 window the code would fill the target proportion of (in whichever dimension is limiting)
+    const int code_size = code_width * CAMERA_IMAGE_HEIGHT / CAMERA_IMAGE_WIDTH;
+    int height = (code_size > code_height ? code_size : code_height) * 100 / QR_ZOOM_CODE_FILL_PERCENT;
+    height = qr_clamp(height, CAMERA_IMAGE_HEIGHT / QR_ZOOM_MAX_FACTOR, CAMERA_IMAGE_HEIGHT);
+    height -= height % QR_ZOOM_WINDOW_STEP;
+
+    if (height * 100 > current->height * QR_ZOOM_MIN_GAIN_PERCENT) {
+        return false;
+    }
+
+    // Centred on the code, but within the full view
+    const int width = height * CAMERA_IMAGE_WIDTH / CAMERA_IMAGE_HEIGHT;
+    window->x = qr_clamp(cx - width / 2, 0, CAMERA_IMAGE_WIDTH - width);
+    window->y = qr_clamp(cy - height / 2, 0, CAMERA_IMAGE_HEIGHT - height);
+    window->width = width;
+    window->height = height;
+    return true;
+}
+
+// Called when no data was extracted from a frame - zoom in on any qr code located, or restore the
+// full view if zoomed and no code has been seen for some time.
+static void qr_update_zoom(qr_data_t* qr_data)
+{
+    JADE_ASSERT(qr_data);
+    JADE_ASSERT(qr_data->q);
+
+    qr_zoom_t* const zoom = &qr_data->zoom;
+    if (zoom->unsupported) {
+        return;
+    }
+
+    if (quirc_count(qr_data->q) <= 0) {
+        if (zoom->window.width && ++zoom->frames_without_code >= QR_ZOOM_LOST_FRAMES) {
+            JADE_LOGI("No QR code seen in zoomed view - restoring full view");
+            memset(&zoom->window, 0, sizeof(zoom->window));
+            zoom->frames_without_code = 0;
+            zoom->changed = true;
+        }
+        return;
+    }
+    zoom->frames_without_code = 0;
+
+    camera_window_t current;
+    qr_current_window(zoom, &current);
+
+    struct quirc_code code;
+    SENSITIVE_PUSH(&code, sizeof(code));
+    quirc_extract(qr_data->q, 0, &code);
+
+    camera_window_t window;
+    if (qr_zoom_window(&current, code.corners, &window)) {
+        JADE_LOGI("Zooming to %ux%u window at (%u, %u) to resolve QR code", window.width, window.height, window.x,
+            window.y);
+        zoom->window = window;
+        zoom->changed = true;
+    }
+    SENSITIVE_POP(&code);
+}
+
 // Look for qr-codes, and if found extract any string data into the camera_data passed
 static bool qr_recognize(
     const size_t width, const size_t height, const uint8_t* data, const size_t len, void* ctx_qr_data)
@@ -86,8 +209,12 @@ static bool qr_recognize(
     // If no QR data can be recognised/extracted, return false
     if (!qr_extract_payload(qr_data) || !qr_data->len) {
         qr_data->len = 0;
+        qr_data->outcome = quirc_count(qr_data->q) > 0 ? QR_FRAME_CODE_LOCATED : QR_FRAME_NO_CODE;
+        qr_update_zoom(qr_data);
         return false;
     }
+    qr_data->outcome = QR_FRAME_CODE_DECODED;
+    qr_data->zoom.frames_without_code = 0;
 
     // If we have extracted data and we have an additional validation
     // function, run that function now - clear the data and return false
@@ -101,12 +228,93 @@ static bool qr_recognize(
     return true;
 }
 
+#if defined(CONFIG_BOARD_TYPE_JADE) || defined(CONFIG_BOARD_TYPE_JADE_V1_1)
+// Camera frame processing - as above, but also applying any change of zoom or exposure to the camera
+static bool qr_recognize_camera(
+    const size_t width, const size_t height, const uint8_t* data, const size_t len, void* ctx_qr_data)
+{
+    qr_data_t* const qr_data = (qr_data_t*)ctx_qr_data;
+    JADE_ASSERT(qr_data);
+
+    const bool ret = qr_recognize(width, height, data, len, qr_data);
+
+    // Feed the outcome and frame statistics back into the exposure settings
+    qr_frame_stats_t stats;
+    qr_exposure_frame_stats(width, height, data, &stats);
+    if (qr_exposure_update(&qr_data->exposure, &stats, qr_data->outcome)) {
+        if (!jade_camera_set_exposure(&qr_data->exposure.settings)) {
+            JADE_LOGW("Camera does not support exposure adjustments");
+            memset(&qr_data->exposure.settings, 0, sizeof(qr_data->exposure.settings));
+            qr_data->exposure.unsupported = true;
+        }
+    }
+
+    qr_zoom_t* const zoom = &qr_data->zoom;
+    if (zoom->changed && !ret) {
+        if (!jade_camera_set_window(zoom->window.width ? &zoom->window : NULL)) {
+            JADE_LOGW("Camera does not support zoomed readout");
+            memset(&zoom->window, 0, sizeof(zoom->window));
+            zoom->unsupported = true;
+        }
+    }
+    zoom->changed = false;
+
+    return ret;
+}
+#endif // CONFIG_BOARD_TYPE_JADE || CONFIG_BOARD_TYPE_JADE_V1_1
+
 #ifdef CONFIG_DEBUG_MODE
+// Map a frame pixel coordinate through the camera window (offset/extent in full-view coordinates) to a
+// coordinate in a higher resolution recording of the full view
+static inline size_t qr_replay_coord(const size_t offset, const size_t extent, const size_t i,
+    const size_t frame_extent, const size_t recorded_extent)
+{
+    return (offset * frame_extent + i * extent) * recorded_extent / (frame_extent * frame_extent);
+}
+
+// Render the frame the camera would capture with the given window, from a higher resolution recording of
+// the full view - each frame pixel is the average of the recorded pixels it covers.
+static void qr_render_window(const uint8_t* data, const size_t width, const size_t height,
+    const camera_window_t* window, uint8_t* frame)
+{
+    JADE_ASSERT(data);
+    JADE_ASSERT(window);
+    JADE_ASSERT(frame);
+
+    for (size_t y = 0; y < CAMERA_IMAGE_HEIGHT; ++y) {
+        const size_t sy0 = qr_replay_coord(window->y, window->height, y, CAMERA_IMAGE_HEIGHT, height);
+        size_t sy1 = qr_replay_coord(window->y, window->height, y + 1, CAMERA_IMAGE_HEIGHT, height);
+        sy1 = sy1 > sy0 ? sy1 : sy0 + 1;
+
+        for (size_t x = 0; x < CAMERA_IMAGE_WIDTH; ++x) {
+            const size_t sx0 = qr_replay_coord(window->x, window->width, x, CAMERA_IMAGE_WIDTH, width);
+            size_t sx1 = qr_replay_coord(window->x, window->width, x + 1, CAMERA_IMAGE_WIDTH, width);
+            sx1 = sx1 > sx0 ? sx1 : sx0 + 1;
+
+            uint32_t sum = 0;
+            for (size_t sy = sy0; sy < sy1; ++sy) {
+                for (size_t sx = sx0; sx < sx1; ++sx) {
+                    sum += data[sy * width + sx];
+                }
+            }
+            frame[y * CAMERA_IMAGE_WIDTH + x] = sum / ((sy1 - sy0) * (sx1 - sx0));
+        }
+    }
+}
+
 // Function to scan single image - may be useful for testing
 bool scan_qr(const size_t width, const size_t height, const uint8_t* data, const size_t len, qr_data_t* qr_data)
 {
+    JADE_ASSERT(data);
     JADE_ASSERT(qr_data);
     JADE_ASSERT(!qr_data->q);
+    JADE_ASSERT(len == width * height);
+
+    // An image larger than a camera frame is replayed as a recording of the camera's field of view
+    const bool replay = width > CAMERA_IMAGE_WIDTH;
+    if (replay) {
+        JADE_ASSERT(width * CAMERA_IMAGE_HEIGHT == height * CAMERA_IMAGE_WIDTH);
+    }
 
     // Create the quirc structs
     qr_data->q = quirc_new();
@@ -115,11 +323,38 @@ bool scan_qr(const size_t width, const size_t height, const uint8_t* data, const
     JADE_ASSERT(qr_data->ds);
 
     // Also correctly size the internal image buffer
-    const int qret = quirc_resize(qr_data->q, width, height);
+    const int qret = replay ? quirc_resize(qr_data->q, CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT)
+                            : quirc_resize(qr_data->q, width, height);
     JADE_ASSERT(qret == 0);
     qr_data->len = 0;
+    memset(&qr_data->zoom, 0, sizeof(qr_data->zoom));
+    qr_data->outcome = QR_FRAME_NO_CODE;
 
-    const bool ret = qr_recognize(width, height, data, len, qr_data);
+    bool ret = false;
+    if (!replay) {
+        ret = qr_recognize(width, height, data, len, qr_data);
+    } else {
+        // Capture frames as the camera would, following any zoom requested, until decoded or no further
+        // zoom is requested
+        const size_t frame_len = CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT;
+        uint8_t* const frame = JADE_MALLOC_PREFER_SPIRAM(frame_len);
+        SENSITIVE_PUSH(frame, frame_len);
+
+        for (size_t i = 0; !ret && i < QR_ZOOM_MAX_REPLAY_STEPS; ++i) {
+            camera_window_t window;
+            qr_current_window(&qr_data->zoom, &window);
+            qr_render_window(data, width, height, &window, frame);
+
+            qr_data->zoom.changed = false;
+            ret = qr_recognize(CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT, frame, frame_len, qr_data);
+            if (!qr_data->zoom.changed) {
+                break;
+            }
+        }
+
+        SENSITIVE_POP(frame);
+        free(frame);
+    }
 
     // Destroy the quirc structs created above
     quirc_destroy(qr_data->q);
@@ -154,9 +389,15 @@ bool jade_camera_scan_qr(qr_data_t* qr_data, const char* title, const char* text
     const int qret = quirc_resize(qr_data->q, CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT);
     JADE_ASSERT(qret == 0);
     qr_data->len = 0;
+    memset(&qr_data->zoom, 0, sizeof(qr_data->zoom));
+    memset(&qr_data->exposure, 0, sizeof(qr_data->exposure));
 
     // Run the camera task trying to interpet frames as qr-codes
-    jade_camera_process_images(qr_recognize, qr_data, title, text_label, NULL, qr_data->progress_bar);
+    // (zooming the camera in on any qr code seen but which cannot be decoded, and adjusting
+    // the exposure while frames are not being decoded)
+    const int64_t start_time_us = esp_timer_get_time();
+    jade_camera_process_images(qr_recognize_camera, qr_data, title, text_label, NULL, qr_data->progress_bar);
+    qr_exposure_log_stats(&qr_data->exposure, (esp_timer_get_time() - start_time_us) / 1000);
 
     // Destroy the quirc structs created above
     quirc_destroy(qr_data->q);
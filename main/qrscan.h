@@ -1,6 +1,8 @@
 #ifndef QRSCAN_H_
 #define QRSCAN_H_
 
+#include "camera.h"
+#include "qrexposure.h"
 #include <ui.h>
 
 #include <stdbool.h>
@@ -12,6 +14,14 @@
 struct quirc;
 typedef struct _qr_data_t qr_data_t;
 
+// Any camera 'zoom' (readout window) used to resolve a dense qr code
+typedef struct {
+    camera_window_t window; // zero width implies the full view
+    size_t frames_without_code;
+    bool changed;
+    bool unsupported;
+} qr_zoom_t;
+
 // Function to tell whether the extracted qr data is valid for the callers purposes
 typedef bool (*qr_valid_fn_t)(qr_data_t* qr_data);
 
@@ -33,10 +43,20 @@ struct _qr_data_t {
     // Cached internal quirc structs - caller should set to NULL
     struct quirc* q;
     struct datastream* ds;
+
+    // Internal zoom and exposure control state - reset at the start of each scan
+    qr_zoom_t zoom;
+    qr_exposure_t exposure;
+
+    // What was found in the last frame processed
+    qr_frame_outcome_t outcome;
 };
 
 #ifdef CONFIG_DEBUG_MODE
 // Function to scan single image - may be useful for testing
+// An image larger than the camera frame size (but of the same aspect ratio) is treated as a recording of the
+// camera's full field of view at higher resolution, and replayed as the camera would capture it - including
+// any zoomed readout windows requested when a dense qr code is located but cannot be decoded.
 bool scan_qr(const size_t width, const size_t height, const uint8_t* data, const size_t len, qr_data_t* qr_data);
 #endif
 
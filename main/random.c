@@ -9,8 +9,10 @@
 #include <esp_timer.h>
 
 #include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
 #include <freertos/task.h>
 #include <mbedtls/sha512.h>
+#include <sodium/crypto_stream_chacha20.h>
 #include <string.h>
 #include <wally_crypto.h>
 
@@ -21,6 +23,13 @@
 
 #define STRENGTHEN_MILLISECONDS 1000
 
+// The output stage is reseeded from the entropy pool after this much output or time
+#define DRBG_RESEED_INTERVAL_BYTES (16 * 1024)
+#define DRBG_RESEED_INTERVAL_MS (30 * 1000)
+
+// Keystream generated per refill of the output buffer (the first 32 bytes become the next key)
+#define DRBG_BUFFER_LEN 256
+
 // these functions rely on cleanup being available
 #define hasherstart(ctx)                                                                                               \
     do {                                                                                                               \
@@ -42,9 +51,21 @@
         mbedtls_sha512_update(&ctx, (const uint8_t*)_bytes, _len);                                                     \
     } while (false)
 
+// Entropy pool - sha512 over the pool state, sensors, cycle counter, esp_fill_random() and any fed-in entropy
 static uint8_t entropy_state[SHA256_LEN];
 static uint32_t rnd_counter;
-static portMUX_TYPE rndmutex;
+
+// Output stage - chacha20 keystream with 'fast key erasure': each refill of the output buffer also replaces the key,
+// and output bytes are erased as they are consumed, so earlier outputs cannot be recovered from the current state.
+static uint8_t drbg_key[crypto_stream_chacha20_ietf_KEYBYTES];
+static uint8_t drbg_buffer[DRBG_BUFFER_LEN];
+static size_t drbg_buffer_pos;
+static size_t drbg_output_since_reseed;
+static TickType_t drbg_last_reseed;
+
+// Task-level mutex guarding both the pool and the output stage
+// (Generating output is cheap, so this is not held for long - and interrupts are not masked.)
+static SemaphoreHandle_t rnd_mutex;
 
 static uint16_t esp32_get_temperature(void)
 {
@@ -61,76 +82,107 @@ static uint16_t esp32_get_temperature(void)
     return GET_PERI_REG_BITS2(SENS_SAR_SLAVE_ADDR3_REG, SENS_TSENS_OUT, SENS_TSENS_OUT_S);
 }
 
-// returns up to 32 bytes of randomness (optional), takes optionallly extra entropy
-static void get_random_internal(uint8_t* bytes_out, const size_t len, const uint8_t* additional, const size_t addlen)
+// Hash the sensor data, cycle counter and any additional entropy - slow, so done before taking the mutex
+static void pool_start(mbedtls_sha512_context* ctx, const uint8_t* additional, const size_t addlen)
 {
-    JADE_ASSERT(len <= SHA256_LEN);
-    JADE_ASSERT((bytes_out && len) || (!bytes_out && !len));
+    JADE_ASSERT(ctx);
     JADE_ASSERT((additional && addlen) || (!additional && !addlen));
 
-    // in this function we read sensors data to add additional entropy
-    mbedtls_sha512_context ctx;
-    mbedtls_sha512_init(&ctx);
-    uint8_t buf[SHA512_LEN];
-
-    hasherstart(ctx);
+    hasherstart(*ctx);
 
     // now we add some entropy from axp192 sensors data
-    call_uint16_t_func_to_hasher(ctx, power_get_vbat);
-    call_uint16_t_func_to_hasher(ctx, power_get_vusb);
-    call_uint16_t_func_to_hasher(ctx, power_get_iusb);
-    call_uint16_t_func_to_hasher(ctx, power_get_ibat_charge);
-    call_uint16_t_func_to_hasher(ctx, power_get_ibat_discharge);
-    call_uint16_t_func_to_hasher(ctx, power_get_temp);
-    call_uint16_t_func_to_hasher(ctx, esp32_get_temperature);
+    call_uint16_t_func_to_hasher(*ctx, power_get_vbat);
+    call_uint16_t_func_to_hasher(*ctx, power_get_vusb);
+    call_uint16_t_func_to_hasher(*ctx, power_get_iusb);
+    call_uint16_t_func_to_hasher(*ctx, power_get_ibat_charge);
+    call_uint16_t_func_to_hasher(*ctx, power_get_ibat_discharge);
+    call_uint16_t_func_to_hasher(*ctx, power_get_temp);
+    call_uint16_t_func_to_hasher(*ctx, esp32_get_temperature);
     const uint32_t counter = xthal_get_ccount();
 
-    add_bytes_to_hasher(ctx, &counter, sizeof(counter));
+    add_bytes_to_hasher(*ctx, &counter, sizeof(counter));
 
     if (additional && addlen) {
-        add_bytes_to_hasher(ctx, additional, addlen);
+        add_bytes_to_hasher(*ctx, additional, addlen);
     }
+}
 
-    portENTER_CRITICAL(&rndmutex);
+// Complete the pool hash, updating the pool state and reseeding the output stage.
+// Caller must hold rnd_mutex.
+static void pool_finish_and_reseed(mbedtls_sha512_context* ctx)
+{
+    JADE_ASSERT(ctx);
+    uint8_t buf[SHA512_LEN];
 
-    add_bytes_to_hasher(ctx, entropy_state, sizeof(entropy_state));
-    add_bytes_to_hasher(ctx, &rnd_counter, sizeof(rnd_counter));
+    add_bytes_to_hasher(*ctx, entropy_state, sizeof(entropy_state));
+    add_bytes_to_hasher(*ctx, &rnd_counter, sizeof(rnd_counter));
 
     ++rnd_counter;
 
     // add some data from the stack
-    add_bytes_to_hasher(ctx, buf, sizeof(buf));
+    add_bytes_to_hasher(*ctx, buf, sizeof(buf));
 
     // esp_fill_random is considered a prng when
     // RF subsystem (or bootloader_random) aren't enabled
     esp_fill_random(buf, sizeof(buf));
-    add_bytes_to_hasher(ctx, buf, sizeof(buf));
+    add_bytes_to_hasher(*ctx, buf, sizeof(buf));
 
-    hasherfinish(ctx, buf);
+    // Retain any entropy in the current output stage key
+    add_bytes_to_hasher(*ctx, drbg_key, sizeof(drbg_key));
 
-    if (len) {
-        JADE_ASSERT(len <= SHA256_LEN);
-        // If desired, copy (up to) the first 32 bytes of the hash output as output.
-        memcpy(bytes_out, buf, len);
-    }
+    hasherfinish(*ctx, buf);
+
+    // The first 32 bytes of the hash output are the new output stage key - discard any buffered output
+    memcpy(drbg_key, buf, sizeof(drbg_key));
+    JADE_WALLY_VERIFY(wally_bzero(drbg_buffer, sizeof(drbg_buffer)));
+    drbg_buffer_pos = sizeof(drbg_buffer);
+    drbg_output_since_reseed = 0;
+    drbg_last_reseed = xTaskGetTickCount();
 
     // Store the last 32 bytes of the hash output as new RNG state.
     memcpy(entropy_state, buf + SHA256_LEN, SHA256_LEN);
 
-    portEXIT_CRITICAL(&rndmutex);
-    mbedtls_sha512_free(&ctx);
-
     // Since refeeding can be called from any task (including internal rtos tasks),
     // we cannot be sure the 'sensitive_stack' is set up, so use wally_bzero()
     // explicitly in this case.
     JADE_WALLY_VERIFY(wally_bzero(buf, sizeof(buf)));
 }
 
+// Refill the output buffer from the keystream, replacing the key.  Caller must hold rnd_mutex.
+static void drbg_refill(void)
+{
+    // The key is only ever used for one refill, so a fixed nonce is fine
+    static const uint8_t nonce[crypto_stream_chacha20_ietf_NONCEBYTES] = { 0 };
+    JADE_ASSERT(sizeof(drbg_buffer) > sizeof(drbg_key));
+
+    const int ret = crypto_stream_chacha20_ietf(drbg_buffer, sizeof(drbg_buffer), nonce, drbg_key);
+    JADE_ASSERT(ret == 0);
+
+    memcpy(drbg_key, drbg_buffer, sizeof(drbg_key));
+    JADE_WALLY_VERIFY(wally_bzero(drbg_buffer, sizeof(drbg_key)));
+    drbg_buffer_pos = sizeof(drbg_key);
+}
+
+static bool drbg_reseed_due(void)
+{
+    return drbg_output_since_reseed >= DRBG_RESEED_INTERVAL_BYTES
+        || xTaskGetTickCount() - drbg_last_reseed >= DRBG_RESEED_INTERVAL_MS / portTICK_PERIOD_MS;
+}
+
 void refeed_entropy(const uint8_t* additional, const size_t len)
 {
     JADE_ASSERT(additional);
     JADE_ASSERT(len);
-    get_random_internal(NULL, 0, additional, len);
+
+    mbedtls_sha512_context ctx;
+    mbedtls_sha512_init(&ctx);
+    pool_start(&ctx, additional, len);
+
+    xSemaphoreTake(rnd_mutex, portMAX_DELAY);
+    pool_finish_and_reseed(&ctx);
+    xSemaphoreGive(rnd_mutex);
+
+    mbedtls_sha512_free(&ctx);
 }
 
 void get_random(uint8_t* bytes_out, const size_t len)
@@ -138,12 +190,39 @@ void get_random(uint8_t* bytes_out, const size_t len)
     JADE_ASSERT(bytes_out);
     JADE_ASSERT(len);
 
+    // If a reseed is due, gather the slow sensor data before taking the mutex
+    // NOTE: checked again under the mutex, as another task may have reseeded meanwhile
+    mbedtls_sha512_context ctx;
+    mbedtls_sha512_init(&ctx);
+    const bool reseed = drbg_reseed_due();
+    if (reseed) {
+        pool_start(&ctx, NULL, 0);
+    }
+
+    xSemaphoreTake(rnd_mutex, portMAX_DELAY);
+
+    if (reseed && drbg_reseed_due()) {
+        pool_finish_and_reseed(&ctx);
+    }
+
     size_t filled = 0;
     while (filled != len) {
-        const size_t towrite = len - filled > SHA256_LEN ? SHA256_LEN : len - filled;
-        get_random_internal(bytes_out + filled, towrite, NULL, 0);
+        if (drbg_buffer_pos == sizeof(drbg_buffer)) {
+            drbg_refill();
+        }
+
+        const size_t available = sizeof(drbg_buffer) - drbg_buffer_pos;
+        const size_t towrite = len - filled > available ? available : len - filled;
+        memcpy(bytes_out + filled, drbg_buffer + drbg_buffer_pos, towrite);
+        JADE_WALLY_VERIFY(wally_bzero(drbg_buffer + drbg_buffer_pos, towrite));
+        drbg_buffer_pos += towrite;
         filled += towrite;
     }
+    drbg_output_since_reseed += len;
+
+    xSemaphoreGive(rnd_mutex);
+
+    mbedtls_sha512_free(&ctx);
 }
 
 uint8_t get_uniform_random_byte(const uint8_t upper_bound)
@@ -194,6 +273,16 @@ static void random_sanity_check(void)
     /* If this failed, bailed out after too many tries */
     JADE_ASSERT(num_overwritten == sizeof(data));
 
+    // Check successive outputs differ, including across refills of the output buffer
+    uint8_t prev[SHA256_LEN];
+    SENSITIVE_PUSH(prev, sizeof(prev));
+    for (size_t i = 0; i < 2 * DRBG_BUFFER_LEN / sizeof(data); ++i) {
+        memcpy(prev, data, sizeof(prev));
+        get_random(data, sizeof(data));
+        JADE_ASSERT(memcmp(prev, data, sizeof(data)));
+    }
+    SENSITIVE_POP(prev);
+
     // Check that xthal_get_ccount increases at least during a get_random call + 1ms sleep.
     vTaskDelay(1 / portTICK_PERIOD_MS);
     uint64_t stop = xthal_get_ccount();
@@ -257,9 +346,15 @@ void random_start_collecting(void)
 
     bootloader_random_enable();
     esp_fill_random(entropy_state, sizeof(entropy_state));
+    esp_fill_random(drbg_key, sizeof(drbg_key));
     bootloader_random_disable();
 
-    spinlock_initialize(&rndmutex);
+    drbg_buffer_pos = sizeof(drbg_buffer);
+    drbg_output_since_reseed = 0;
+    drbg_last_reseed = xTaskGetTickCount();
+
+    rnd_mutex = xSemaphoreCreateMutex();
+    JADE_ASSERT(rnd_mutex);
 }
 
 void random_full_initialization(void)
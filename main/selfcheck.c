@@ -6,10 +6,17 @@
 
 #include "bcur.h"
 #include "jade_assert.h"
+#include "jade_tasks.h"
 #include "jade_wally_verify.h"
 #include "keychain.h"
+#include "multisig.h"
+#include "qrcode.h"
+#include "qrscan.h"
 #include "random.h"
+#include "sha_engine.h"
 #include "storage.h"
+#include "utils/network.h"
+#include "wallet.h"
 #include <sodium/crypto_verify_64.h>
 #include <sodium/utils.h>
 #include <utils/malloc_ext.h>
@@ -18,6 +25,17 @@
 #include <cencoder.h>
 #include <ctype.h>
 
+#include <esp_timer.h>
+#include <freertos/semphr.h>
+#include <mbedtls/sha256.h>
+#include <wally_anti_exfil.h>
+#include <wally_crypto.h>
+#include <wally_elements.h>
+#include <wally_psbt.h>
+#ifdef CONFIG_IDF_TARGET_ESP32
+#include <sha/sha_parallel_engine.h>
+#endif
+
 void get_bip85_mnemonic(const uint32_t nwords, const uint32_t index, char** new_mnemonic);
 
 static const char TEST_MNEMONIC[] = "fish inner face ginger orchard permit useful method fence kidney chuckle party "
@@ -25,6 +43,10 @@ static const char TEST_MNEMONIC[] = "fish inner face ginger orchard permit usefu
 static const char SERVICE_PATH_HEX[] = "00c9678fbd9d9f6a96bd43221d56733b5aba8f528487602b894e72d0f56e380f7d145b65639db7e"
                                        "e4f528a3fcfb8277b0cbbea00ef64767a531e9a447cacbfbc";
 
+// rfc6979 ecdsa signature of 0x22*32 with private key 0x11*32
+static const char ECDSA_SIG_HEX[] = "cfd18ee918d6729134adbc61212142cf71fcf186dfc3123cfca8f7062e0fad5a"
+                                    "703cc467d9857349ddb6e148bd1663f5050f3f6b9d788d64349c357f14eb4a5f";
+
 // See macros in keychain.c for calculating encrpyted blob lengths below
 // (Payload data is padded to next multiple of 16, and is concatenated between iv and hmac)
 // 16 (iv) + 208 (length of data stored (78 (key) + 64 (ga path) + 64 (blinding key)) padded to next 16x) + 32 (hmac)
@@ -347,6 +369,146 @@ static bool test_storage_with_passphrase(const size_t nwords)
     return true;
 }
 
+// Test additional wallet slots share the PIN of the main wallet, can be loaded at unlock or switched to
+// without a passphrase (unless added with one), have their own otp records and network type restriction, and
+// cannot be erased while active.
+static bool test_wallet_slots(void)
+{
+    uint8_t aeskey[AES_KEY_LEN_256];
+    get_random(aeskey, AES_KEY_LEN_256);
+
+    // Main wallet is passphrase-protected
+    keychain_t main_keydata = { 0 };
+    if (!keychain_derive_from_mnemonic(TEST_MNEMONIC, "test123", &main_keydata)) {
+        FAIL();
+    }
+    keychain_set(&main_keydata, 0, false);
+    keychain_cache_mnemonic_entropy(TEST_MNEMONIC);
+    if (!keychain_store_encrypted(aeskey, sizeof(aeskey))) {
+        FAIL();
+    }
+    if (!keychain_wallet_slots_unlocked() || keychain_get_wallet_slot() != 0) {
+        FAIL();
+    }
+
+    // Persist another wallet into a slot
+    keychain_t slot_keydata = { 0 };
+    if (!keychain_derive_from_mnemonic(TEST_MNEMONIC, NULL, &slot_keydata)) {
+        FAIL();
+    }
+    keychain_set(&slot_keydata, 0, true);
+    if (keychain_save_wallet_slot(1, KEYCHAIN_MAIN_WALLET_NAME)) {
+        FAIL();
+    }
+    if (!keychain_save_wallet_slot(1, "second")) {
+        FAIL();
+    }
+    if (keychain_has_temporary() || keychain_get_wallet_slot() != 1) {
+        FAIL();
+    }
+
+    // Records are held per wallet slot
+    const char otp_name[] = "slottest";
+    const uint8_t otp_uri[] = "otpauth://totp/slottest?secret=JBSWY3DPEHPK3PXP";
+    if (!storage_set_otp_data(otp_name, otp_uri, sizeof(otp_uri)) || !storage_otp_exists(otp_name)) {
+        FAIL();
+    }
+    keychain_clear();
+    if (keychain_wallet_slots_unlocked() || keychain_get_wallet_slot() != 0 || storage_otp_exists(otp_name)) {
+        FAIL();
+    }
+
+    // Unlock straight into the slot - no passphrase required
+    size_t slot = 0;
+    if (!keychain_find_wallet_slot("second", &slot) || slot != 1) {
+        FAIL();
+    }
+    keychain_set_unlock_wallet_slot(slot);
+    if (!keychain_load_cleartext(aeskey, sizeof(aeskey))) {
+        FAIL();
+    }
+    if (keychain_requires_passphrase() || !all_fields_same(&slot_keydata, keychain_get(), false)) {
+        FAIL();
+    }
+    if (keychain_get_wallet_slot() != 1 || !storage_otp_exists(otp_name)) {
+        FAIL();
+    }
+    keychain_set_network_type_restriction(TAG_TESTNET);
+    if (keychain_get_network_type_restriction() != NETWORK_TYPE_TEST) {
+        FAIL();
+    }
+
+    // The active wallet slot cannot be erased
+    if (keychain_erase_wallet_slot(1)) {
+        FAIL();
+    }
+
+    // Switch to the main wallet, which requires the passphrase
+    if (!keychain_select_wallet_slot(0) || !keychain_requires_passphrase()) {
+        FAIL();
+    }
+    if (!keychain_complete_derivation_with_passphrase("test123")
+        || !all_fields_same(&main_keydata, keychain_get(), true)) {
+        FAIL();
+    }
+    if (keychain_get_wallet_slot() != 0 || storage_otp_exists(otp_name)
+        || keychain_get_network_type_restriction() != NETWORK_TYPE_NONE) {
+        FAIL();
+    }
+
+    // And back again
+    if (!keychain_select_wallet_slot(1) || !all_fields_same(&slot_keydata, keychain_get(), false)) {
+        FAIL();
+    }
+    if (keychain_get_network_type_restriction() != NETWORK_TYPE_TEST) {
+        FAIL();
+    }
+
+    // A slot added with a passphrase persists the mnemonic entropy, and requires the passphrase when loaded
+    keychain_t passphrase_keydata = { 0 };
+    if (!keychain_derive_from_mnemonic(TEST_MNEMONIC, "slot456", &passphrase_keydata)) {
+        FAIL();
+    }
+    keychain_set(&passphrase_keydata, 0, true);
+    keychain_cache_mnemonic_entropy(TEST_MNEMONIC);
+    if (!keychain_save_wallet_slot(2, "passphrase")) {
+        FAIL();
+    }
+    if (!keychain_select_wallet_slot(1) || !keychain_select_wallet_slot(2) || !keychain_requires_passphrase()) {
+        FAIL();
+    }
+    if (keychain_get_passphrase_freq() != PASSPHRASE_ALWAYS) {
+        FAIL();
+    }
+    if (!keychain_complete_derivation_with_passphrase("slot456")
+        || !all_fields_same(&passphrase_keydata, keychain_get(), true)) {
+        FAIL();
+    }
+    if (!keychain_select_wallet_slot(1) || !keychain_erase_wallet_slot(2)) {
+        FAIL();
+    }
+
+    // Erase the slot (and its records) from the main wallet
+    if (!keychain_select_wallet_slot(0) || !keychain_complete_derivation_with_passphrase("test123")) {
+        FAIL();
+    }
+    if (!keychain_erase_wallet_slot(1) || keychain_find_wallet_slot("second", &slot)) {
+        FAIL();
+    }
+    if (!keychain_save_wallet_slot(1, "third") || storage_otp_exists(otp_name)
+        || keychain_get_network_type_restriction() != NETWORK_TYPE_NONE) {
+        FAIL();
+    }
+
+    // Erasing the main wallet erases the slots
+    keychain_clear();
+    keychain_erase_encrypted();
+    if (keychain_find_wallet_slot("third", &slot)) {
+        FAIL();
+    }
+    return true;
+}
+
 #define TEST_BIP85_BIP39(nwords, index, expected)                                                                      \
     do {                                                                                                               \
         char* generated = NULL;                                                                                        \
@@ -671,6 +833,33 @@ static bool test_bcur_decode_encode(void)
         }
         FREE_ENCODED_PARTS(parts);
     }
+
+    // 3. Try psbt round-trip
+    {
+        // The psbt should be re-serialised in-place to the identical cbor, whether the passed length
+        // estimate is too small (so the buffer must grow), exact or generous.
+        struct wally_psbt* psbt = NULL;
+        if (!bcur_parse_psbt(payload, payload_len, &psbt)) {
+            FAIL();
+        }
+        const size_t psbt_len = payload_len - 3; // 3-byte cbor bytes header
+        const size_t len_estimates[] = { 0, 1, psbt_len - 1, psbt_len, psbt_len + 1, 4 * psbt_len };
+        for (size_t i = 0; i < sizeof(len_estimates) / sizeof(len_estimates[0]); ++i) {
+            uint8_t* cbor = NULL;
+            size_t cbor_len = 0;
+            if (!bcur_build_cbor_crypto_psbt(psbt, len_estimates[i], &cbor, &cbor_len)) {
+                JADE_WALLY_VERIFY(wally_psbt_free(psbt));
+                FAIL();
+            }
+            const bool matches = cbor_len == payload_len && !memcmp(cbor, payload, payload_len);
+            free(cbor);
+            if (!matches) {
+                JADE_WALLY_VERIFY(wally_psbt_free(psbt));
+                FAIL();
+            }
+        }
+        JADE_WALLY_VERIFY(wally_psbt_free(psbt));
+    }
     return true;
 }
 
@@ -768,6 +957,378 @@ static bool test_bcur_large_payload_many_icons(void)
     return true;
 }
 
+// Check secp256k1's internal hashing (routed via mbedtls) gives the same results whether the
+// hw sha engine is available or is busy (forcing the software fallback).
+// Covers rfc6979 nonces (hmac-sha256) and anti-exfil commitments (midstate tagged hashes).
+static bool test_secp256k1_sha_backends(void)
+{
+    uint8_t privkey[EC_PRIVATE_KEY_LEN];
+    uint8_t msg[EC_MESSAGE_HASH_LEN];
+    uint8_t entropy[WALLY_S2C_DATA_LEN];
+    memset(privkey, 0x11, sizeof(privkey));
+    memset(msg, 0x22, sizeof(msg));
+    memset(entropy, 0x33, sizeof(entropy));
+
+    uint8_t expected_sig[EC_SIGNATURE_LEN];
+    size_t written = 0;
+    if (wally_hex_to_bytes(ECDSA_SIG_HEX, expected_sig, sizeof(expected_sig), &written) != WALLY_OK
+        || written != sizeof(expected_sig)) {
+        FAIL();
+    }
+
+    uint8_t sigs[2][EC_SIGNATURE_LEN];
+    uint8_t ae_sigs[2][EC_SIGNATURE_LEN];
+    for (size_t engine_busy = 0; engine_busy < 2; ++engine_busy) {
+        sha_engine_stats_t stats_before;
+        sha_engine_get_stats(&stats_before);
+
+#ifdef CONFIG_IDF_TARGET_ESP32
+        // Hold the sha256 engine so all hashing below falls back to software
+        if (engine_busy && !esp_sha_try_lock_engine(SHA2_256)) {
+            FAIL();
+        }
+#endif
+        const int ret = wally_ec_sig_from_bytes(
+            privkey, sizeof(privkey), msg, sizeof(msg), EC_FLAG_ECDSA, sigs[engine_busy], EC_SIGNATURE_LEN);
+        const int ae_ret = wally_ae_sig_from_bytes(privkey, sizeof(privkey), msg, sizeof(msg), entropy,
+            sizeof(entropy), EC_FLAG_ECDSA, ae_sigs[engine_busy], EC_SIGNATURE_LEN);
+#ifdef CONFIG_IDF_TARGET_ESP32
+        if (engine_busy) {
+            esp_sha_unlock_engine(SHA2_256);
+        }
+#endif
+        if (ret != WALLY_OK || ae_ret != WALLY_OK) {
+            FAIL();
+        }
+        if (memcmp(sigs[engine_busy], expected_sig, sizeof(expected_sig))) {
+            FAIL();
+        }
+
+#ifdef CONFIG_IDF_TARGET_ESP32
+        // Check the expected engine outcome was recorded
+        sha_engine_stats_t stats_after;
+        sha_engine_get_stats(&stats_after);
+        if (engine_busy ? stats_after.busy == stats_before.busy : stats_after.granted == stats_before.granted) {
+            FAIL();
+        }
+#endif
+    }
+
+    if (memcmp(ae_sigs[0], ae_sigs[1], EC_SIGNATURE_LEN)) {
+        FAIL();
+    }
+    return true;
+}
+
+typedef struct {
+    SemaphoreHandle_t done;
+    uint8_t hash[SHA256_LEN];
+    int ret;
+} sha_test_task_data_t;
+
+static void sha_test_task(void* ctx)
+{
+    sha_test_task_data_t* const data = (sha_test_task_data_t*)ctx;
+    data->ret = mbedtls_sha256((const uint8_t*)TEST_MNEMONIC, sizeof(TEST_MNEMONIC), data->hash, 0);
+    xSemaphoreGive(data->done);
+    vTaskDelete(NULL);
+}
+
+// Check that while this task holds the sha engine reservation, another task's hash
+// is steered to software - and that its result is unaffected.
+static bool test_sha_engine_reservation(void)
+{
+    uint8_t expected[SHA256_LEN];
+    if (mbedtls_sha256((const uint8_t*)TEST_MNEMONIC, sizeof(TEST_MNEMONIC), expected, 0)) {
+        FAIL();
+    }
+
+    // NOTE: static as the task may outlive this function if it gets stuck
+    static sha_test_task_data_t data;
+    data.done = xSemaphoreCreateBinary();
+    data.ret = -1;
+    JADE_ASSERT(data.done);
+
+    sha_engine_stats_t stats_before;
+    sha_engine_get_stats(&stats_before);
+    sha_engine_reserve();
+
+    const BaseType_t retval = xTaskCreatePinnedToCore(
+        &sha_test_task, "sha_test_task", 2 * 1024, &data, tskIDLE_PRIORITY + 1, NULL, JADE_CORE_SECONDARY);
+    JADE_ASSERT_MSG(
+        retval == pdPASS, "Failed to create sha_test_task, xTaskCreatePinnedToCore() returned %d", retval);
+    const bool completed = xSemaphoreTake(data.done, 5000 / portTICK_PERIOD_MS) == pdTRUE;
+
+    sha_engine_release();
+    sha_engine_stats_t stats_after;
+    sha_engine_get_stats(&stats_after);
+
+    if (!completed) {
+        // Leak the semaphore rather than delete it under the stuck task
+        FAIL();
+    }
+    vSemaphoreDelete(data.done);
+
+    if (data.ret || memcmp(data.hash, expected, sizeof(expected))) {
+        FAIL();
+    }
+#ifdef CONFIG_IDF_TARGET_ESP32
+    if (stats_after.deferred == stats_before.deferred) {
+        FAIL();
+    }
+#endif
+    return true;
+}
+
+// Check cached blinding keys match freshly derived ones, and the cache is wiped with the keychain
+static bool test_blinding_key_cache(void)
+{
+    keychain_t keydata = { 0 };
+    if (!keychain_derive_from_mnemonic(TEST_MNEMONIC, NULL, &keydata)) {
+        FAIL();
+    }
+    keychain_clear();
+    keychain_set(&keydata, 0, true);
+
+    const uint8_t script[] = { 0x00, 0x14, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc,
+        0xdd, 0xee, 0xff, 0x00, 0x11, 0x22, 0x33, 0x44 };
+    uint8_t privkey[EC_PRIVATE_KEY_LEN];
+    uint8_t expected_pubkey[EC_PUBLIC_KEY_LEN];
+    JADE_WALLY_VERIFY(wally_asset_blinding_key_to_ec_private_key(keydata.master_unblinding_key,
+        sizeof(keydata.master_unblinding_key), script, sizeof(script), privkey, sizeof(privkey)));
+    JADE_WALLY_VERIFY(
+        wally_ec_public_key_from_private_key(privkey, sizeof(privkey), expected_pubkey, sizeof(expected_pubkey)));
+
+    // Use our own pubkey as the counterparty key
+    const uint8_t* their_pubkey = expected_pubkey;
+    uint8_t expected_nonce[SHA256_LEN];
+    JADE_WALLY_VERIFY(wally_ecdh(
+        their_pubkey, EC_PUBLIC_KEY_LEN, privkey, sizeof(privkey), expected_nonce, sizeof(expected_nonce)));
+    JADE_WALLY_VERIFY(wally_sha256(expected_nonce, sizeof(expected_nonce), expected_nonce, sizeof(expected_nonce)));
+
+    // First call misses, the repeats hit
+    for (size_t i = 0; i < 3; ++i) {
+        uint8_t pubkey[EC_PUBLIC_KEY_LEN];
+        if (!wallet_get_public_blinding_key(keydata.master_unblinding_key, sizeof(keydata.master_unblinding_key),
+                script, sizeof(script), pubkey, sizeof(pubkey))) {
+            FAIL();
+        }
+        if (memcmp(pubkey, expected_pubkey, sizeof(pubkey))) {
+            FAIL();
+        }
+
+        uint8_t nonce[SHA256_LEN];
+        if (!wallet_get_shared_blinding_nonce(keydata.master_unblinding_key, sizeof(keydata.master_unblinding_key),
+                script, sizeof(script), their_pubkey, EC_PUBLIC_KEY_LEN, nonce, sizeof(nonce), pubkey,
+                sizeof(pubkey))) {
+            FAIL();
+        }
+        if (memcmp(nonce, expected_nonce, sizeof(nonce)) || memcmp(pubkey, expected_pubkey, sizeof(pubkey))) {
+            FAIL();
+        }
+    }
+
+    uint32_t hits = 0, misses = 0;
+    wallet_get_blinding_key_cache_stats(&hits, &misses);
+    if (hits != 5 || misses != 1) {
+        FAIL();
+    }
+
+    keychain_clear();
+    wallet_get_blinding_key_cache_stats(&hits, &misses);
+    if (hits || misses) {
+        FAIL();
+    }
+    return true;
+}
+
+// Check cached cosigner keys give the same pubkeys as deriving from the xpubs each time (and time both),
+// for a number of receive and change addresses of an n-signer multisig
+#define MULTISIG_KEY_CACHE_TEST_ADDRESSES 10
+static bool test_multisig_key_cache(const keychain_t* keydata, const size_t threshold, const size_t num_signers)
+{
+    JADE_ASSERT(keydata);
+    JADE_ASSERT(num_signers <= MAX_MULTISIG_SIGNERS);
+
+    // Cosigner xpubs m/48'/1'/i'/2'
+    uint8_t xpubs[MAX_MULTISIG_SIGNERS * BIP32_SERIALIZED_LEN];
+    for (size_t i = 0; i < num_signers; ++i) {
+        const uint32_t path[] = { BIP32_INITIAL_HARDENED_CHILD + 48, BIP32_INITIAL_HARDENED_CHILD + 1,
+            BIP32_INITIAL_HARDENED_CHILD + i, BIP32_INITIAL_HARDENED_CHILD + 2 };
+        struct ext_key hdkey;
+        JADE_WALLY_VERIFY(bip32_key_from_parent_path(
+            &keydata->xpriv, path, sizeof(path) / sizeof(path[0]), BIP32_FLAG_KEY_PRIVATE, &hdkey));
+        JADE_WALLY_VERIFY(bip32_key_serialize(
+            &hdkey, BIP32_FLAG_KEY_PUBLIC, xpubs + (i * BIP32_SERIALIZED_LEN), BIP32_SERIALIZED_LEN));
+    }
+
+    multisig_clear_key_cache();
+
+    int64_t uncached_us = 0;
+    int64_t cached_us = 0;
+    uint8_t expected[MAX_MULTISIG_SIGNERS * EC_PUBLIC_KEY_LEN];
+    uint8_t pubkeys[MAX_MULTISIG_SIGNERS * EC_PUBLIC_KEY_LEN];
+    const size_t pubkeys_len = num_signers * EC_PUBLIC_KEY_LEN;
+    for (size_t addr = 0; addr < MULTISIG_KEY_CACHE_TEST_ADDRESSES; ++addr) {
+        for (uint32_t is_change = 0; is_change < 2; ++is_change) {
+            const uint32_t path[] = { is_change, addr };
+            const size_t path_len = sizeof(path) / sizeof(path[0]);
+
+            int64_t start = esp_timer_get_time();
+            for (size_t i = 0; i < num_signers; ++i) {
+                struct ext_key hdkey;
+                if (!wallet_derive_pubkey(xpubs + (i * BIP32_SERIALIZED_LEN), BIP32_SERIALIZED_LEN, path, path_len,
+                        BIP32_FLAG_SKIP_HASH, &hdkey)) {
+                    FAIL();
+                }
+                memcpy(expected + (i * EC_PUBLIC_KEY_LEN), hdkey.pub_key, EC_PUBLIC_KEY_LEN);
+            }
+            uncached_us += esp_timer_get_time() - start;
+
+            start = esp_timer_get_time();
+            if (!multisig_get_pubkeys_for_path(xpubs, num_signers, path, path_len, pubkeys, pubkeys_len)) {
+                FAIL();
+            }
+            cached_us += esp_timer_get_time() - start;
+
+            if (memcmp(pubkeys, expected, pubkeys_len)) {
+                FAIL();
+            }
+        }
+    }
+
+    // Each cosigner's receive and change branches are derived once
+    uint32_t hits = 0, misses = 0;
+    multisig_get_key_cache_stats(&hits, &misses);
+    if (misses != 2 * num_signers || hits != (2 * MULTISIG_KEY_CACHE_TEST_ADDRESSES - 2) * num_signers) {
+        FAIL();
+    }
+    JADE_LOGI("%u-of-%u multisig, %u scripts: uncached %lldus, cached %lldus", threshold, num_signers,
+        2 * MULTISIG_KEY_CACHE_TEST_ADDRESSES, uncached_us, cached_us);
+
+    keychain_clear();
+    multisig_get_key_cache_stats(&hits, &misses);
+    if (hits || misses) {
+        FAIL();
+    }
+    return true;
+}
+
+#if defined(CONFIG_DEBUG_MODE) && defined(CONFIG_ESP32_SPIRAM_SUPPORT)
+// Synthetic camera frames for the qr exposure control test - a qr code on a phone screen (on a desk),
+// optionally with a glare spot, as captured by a simple model of the sensor's response to the settings.
+#define TEST_QR_SCALE 5
+#define TEST_QR_RADIANCE_DARK 24
+#define TEST_QR_RADIANCE_LIGHT 200
+#define TEST_QR_RADIANCE_BACKGROUND 90
+#define TEST_QR_GLARE_RADIUS 64
+#define TEST_QR_MAX_FRAMES 24
+
+typedef struct {
+    const char* name;
+    uint16_t brightness_percent; // scene brightness relative to a well exposed frame at default settings
+    uint8_t glare; // peak radiance added at the centre of a glare spot over the code
+    uint8_t noise; // maximum sensor noise either way
+    bool decodes_at_defaults;
+} test_qr_scene_t;
+
+static void render_test_qr_frame(const QRCode* qrcode, const test_qr_scene_t* scene, const camera_exposure_t* settings,
+    uint32_t* rng, uint8_t* frame)
+{
+    // Relative gains of the sensor's exposure level and contrast adjustments
+    static const uint16_t ae_gain_percent[] = { 50, 71, 100, 141, 200 };
+    static const uint16_t contrast_gain_percent[] = { 60, 80, 100, 125, 150 };
+    const uint32_t gain = scene->brightness_percent * ae_gain_percent[settings->ae_level + CAMERA_EXPOSURE_LIMIT];
+    const int32_t contrast = contrast_gain_percent[settings->contrast + CAMERA_EXPOSURE_LIMIT];
+
+    const int size = qrcode->size * TEST_QR_SCALE;
+    const int left = (CAMERA_IMAGE_WIDTH - size) / 2;
+    const int top = (CAMERA_IMAGE_HEIGHT - size) / 2;
+    const int glare_x = left + size / 3;
+    const int glare_y = top + size / 3;
+
+    for (int y = 0; y < CAMERA_IMAGE_HEIGHT; ++y) {
+        for (int x = 0; x < CAMERA_IMAGE_WIDTH; ++x) {
+            int32_t radiance = TEST_QR_RADIANCE_BACKGROUND;
+            const int mx = x - left, my = y - top;
+            if (mx >= -4 * TEST_QR_SCALE && my >= -4 * TEST_QR_SCALE && mx < size + 4 * TEST_QR_SCALE
+                && my < size + 4 * TEST_QR_SCALE) {
+                const bool dark = mx >= 0 && my >= 0 && mx < size && my < size
+                    && qrcode_getModule((QRCode*)qrcode, mx / TEST_QR_SCALE, my / TEST_QR_SCALE);
+                radiance = dark ? TEST_QR_RADIANCE_DARK : TEST_QR_RADIANCE_LIGHT;
+            }
+
+            const int dx = x - glare_x, dy = y - glare_y;
+            const int d2 = dx * dx + dy * dy;
+            if (d2 < TEST_QR_GLARE_RADIUS * TEST_QR_GLARE_RADIUS) {
+                radiance += scene->glare * (TEST_QR_GLARE_RADIUS * TEST_QR_GLARE_RADIUS - d2)
+                    / (TEST_QR_GLARE_RADIUS * TEST_QR_GLARE_RADIUS);
+            }
+
+            int32_t value = radiance * gain / 10000;
+            value = 128 + (value - 128) * contrast / 100;
+            *rng = *rng * 1103515245 + 12345;
+            value += (int32_t)((*rng >> 16) % (2 * scene->noise + 1)) - scene->noise;
+            frame[y * CAMERA_IMAGE_WIDTH + x] = value < 0 ? 0 : value > 255 ? 255 : value;
+        }
+    }
+}
+
+// Run the scene through the closed loop of capture, decode and exposure update, until decoded
+static bool test_qr_exposure_scene(const QRCode* qrcode, const test_qr_scene_t* scene, uint8_t* frame)
+{
+    qr_exposure_t exposure = { 0 };
+    uint32_t rng = 1;
+    for (size_t i = 0; i < TEST_QR_MAX_FRAMES; ++i) {
+        render_test_qr_frame(qrcode, scene, &exposure.settings, &rng, frame);
+
+        qr_data_t qr_data = { .len = 0 };
+        const bool decoded = scan_qr(CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT, frame,
+            CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT, &qr_data);
+
+        qr_frame_stats_t stats;
+        qr_exposure_frame_stats(CAMERA_IMAGE_WIDTH, CAMERA_IMAGE_HEIGHT, frame, &stats);
+        qr_exposure_update(&exposure, &stats, qr_data.outcome);
+
+        if (decoded) {
+            JADE_LOGI("Scene '%s' decoded at frame %u, ae_level %d, contrast %d", scene->name, i,
+                exposure.settings.ae_level, exposure.settings.contrast);
+            return i ? !scene->decodes_at_defaults : scene->decodes_at_defaults && !exposure.adjustments;
+        }
+    }
+    JADE_LOGE("Scene '%s' not decoded after %u frames", scene->name, TEST_QR_MAX_FRAMES);
+    return false;
+}
+
+// Test the exposure control brings badly exposed or glaring synthetic frames to a decodable state,
+// and leaves well exposed frames alone.
+static bool test_qr_exposure_control(void)
+{
+    static const test_qr_scene_t scenes[] = {
+        { .name = "well exposed", .brightness_percent = 100, .noise = 4, .decodes_at_defaults = true },
+        { .name = "dark", .brightness_percent = 10, .noise = 8 },
+        { .name = "glare", .brightness_percent = 110, .glare = 160, .noise = 4 },
+        { .name = "strong glare", .brightness_percent = 110, .glare = 200, .noise = 4 },
+    };
+
+    const char* const text = "Closed-loop exposure and gain control driven by QR detection feedback";
+    QRCode qrcode;
+    uint8_t qrbuffer[140]; // opaque work area
+    JADE_ASSERT(qrcode_getBufferSize(4) <= sizeof(qrbuffer));
+    if (qrcode_initText(&qrcode, qrbuffer, 4, ECC_LOW, text) != 0) {
+        FAIL();
+    }
+
+    uint8_t* const frame = JADE_MALLOC_PREFER_SPIRAM(CAMERA_IMAGE_WIDTH * CAMERA_IMAGE_HEIGHT);
+    bool ret = true;
+    for (size_t i = 0; ret && i < sizeof(scenes) / sizeof(scenes[0]); ++i) {
+        ret = test_qr_exposure_scene(&qrcode, &scenes[i], frame);
+    }
+    free(frame);
+    return ret;
+}
+#endif // CONFIG_DEBUG_MODE && CONFIG_ESP32_SPIRAM_SUPPORT
+
 bool debug_selfcheck(void)
 {
     // Test can restore known mnemonic and service path is computed as expected
@@ -797,12 +1358,41 @@ bool debug_selfcheck(void)
         FAIL();
     }
 
+    // Test additional wallets sharing the PIN
+    if (!test_wallet_slots()) {
+        FAIL();
+    }
+
     // Test Bip85 child bip39 mnemonic generation
     if (!test_bip85_mnemonic()) {
         FAIL();
     }
 
-    // Test we can decode a sequence of qrcodes into a psbt and back
+    // Test the blinding key cache returns the expected keys
+    if (!test_blinding_key_cache()) {
+        FAIL();
+    }
+
+    // Test the multisig cosigner key cache returns the expected keys
+    keychain_t keydata = { 0 };
+    if (!keychain_derive_from_mnemonic(TEST_MNEMONIC, NULL, &keydata)) {
+        FAIL();
+    }
+    if (!test_multisig_key_cache(&keydata, 2, 3) || !test_multisig_key_cache(&keydata, 7, 11)) {
+        FAIL();
+    }
+
+    // Test secp256k1 hashing is consistent across hw and sw sha backends
+    if (!test_secp256k1_sha_backends()) {
+        FAIL();
+    }
+
+    // Test the hw sha engine reservation policy
+    if (!test_sha_engine_reservation()) {
+        FAIL();
+    }
+
+    // Test we can decode a sequence of qrcodes into a psbt and back, and re-serialise the psbt
     if (!test_bcur_decode_encode()) {
         FAIL();
     }
@@ -824,6 +1414,13 @@ bool debug_selfcheck(void)
     }
 #endif
 
+#if defined(CONFIG_DEBUG_MODE) && defined(CONFIG_ESP32_SPIRAM_SUPPORT)
+    // Test the qr scanning exposure control against synthetic camera frames
+    if (!test_qr_exposure_control()) {
+        FAIL();
+    }
+#endif
+
     // Iterative check of bcur sizing macro.
     // Run under qemu only as takes too long on esp32 hw.
 #if defined(CONFIG_FREERTOS_UNICORE) && defined(CONFIG_ETH_USE_OPENETH) && defined(CONFIG_DEBUG_MODE)
@@ -121,12 +121,14 @@ bool serial_init(TaskHandle_t* serial_handle)
     }
 
     BaseType_t retval = xTaskCreatePinnedToCore(
-        &serial_reader, "serial_reader", 2 * 1024, NULL, JADE_TASK_PRIO_READER, NULL, JADE_CORE_SECONDARY);
+        &serial_reader, "serial_reader", JADE_TASK_STACK_SIZE_READER, NULL, JADE_TASK_PRIO_READER, NULL,
+        JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create serial_reader task, xTaskCreatePinnedToCore() returned %d", retval);
 
     retval = xTaskCreatePinnedToCore(
-        &serial_writer, "serial_writer", 2 * 1024, NULL, JADE_TASK_PRIO_WRITER, serial_handle, JADE_CORE_SECONDARY);
+        &serial_writer, "serial_writer", JADE_TASK_STACK_SIZE_WRITER, NULL, JADE_TASK_PRIO_WRITER, serial_handle,
+        JADE_CORE_SECONDARY);
     JADE_ASSERT_MSG(
         retval == pdPASS, "Failed to create serial_writer task, xTaskCreatePinnedToCore() returned %d", retval);
 
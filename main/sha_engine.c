@@ -0,0 +1,148 @@
+#include "sha_engine.h"
+#include "jade_assert.h"
+#include "jade_tasks.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <mbedtls/sha256.h>
+#include <sdkconfig.h>
+
+// The original esp32 has one hw sha engine per algorithm, which an mbedtls context
+// 'locks' when it processes its first block and holds until it is finished/freed.
+// Any other context started meanwhile silently falls back to the software implementation.
+// So a long-running gui/camera hash can rob the signing path of the accelerator.
+// We wrap the engine 'try lock' function (see --wrap in main/CMakeLists.txt) to count
+// outcomes, and to steer other tasks to software while the engines are reserved.
+
+static portMUX_TYPE sha_engine_spinlock = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t reserved_by = NULL;
+static uint32_t reserved_depth = 0;
+static sha_engine_stats_t engine_stats = { 0 };
+static sha_engine_stats_t reserved_stats = { 0 };
+
+#ifdef CONFIG_IDF_TARGET_ESP32
+#include <sha/sha_parallel_engine.h>
+
+bool __real_esp_sha_try_lock_engine(esp_sha_type sha_type);
+
+bool __wrap_esp_sha_try_lock_engine(const esp_sha_type sha_type)
+{
+    const TaskHandle_t caller = xTaskGetCurrentTaskHandle();
+
+    taskENTER_CRITICAL(&sha_engine_spinlock);
+    const bool deferred = reserved_by && reserved_by != caller;
+    if (deferred) {
+        ++engine_stats.deferred;
+    }
+    taskEXIT_CRITICAL(&sha_engine_spinlock);
+
+    if (deferred) {
+        return false;
+    }
+
+    const bool locked = __real_esp_sha_try_lock_engine(sha_type);
+
+    taskENTER_CRITICAL(&sha_engine_spinlock);
+    if (locked) {
+        ++engine_stats.granted;
+    } else {
+        ++engine_stats.busy;
+    }
+    taskEXIT_CRITICAL(&sha_engine_spinlock);
+
+    return locked;
+}
+#endif // CONFIG_IDF_TARGET_ESP32
+
+// NOTE: if the engines are already reserved by another task the call is a no-op,
+// as is the matching release.
+void sha_engine_reserve(void)
+{
+    const TaskHandle_t caller = xTaskGetCurrentTaskHandle();
+
+    taskENTER_CRITICAL(&sha_engine_spinlock);
+    if (!reserved_by || reserved_by == caller) {
+        if (!reserved_depth++) {
+            reserved_by = caller;
+            reserved_stats = engine_stats;
+        }
+    }
+    taskEXIT_CRITICAL(&sha_engine_spinlock);
+}
+
+void sha_engine_release(void)
+{
+    const TaskHandle_t caller = xTaskGetCurrentTaskHandle();
+    bool released = false;
+    sha_engine_stats_t stats;
+
+    taskENTER_CRITICAL(&sha_engine_spinlock);
+    if (reserved_by == caller) {
+        if (!--reserved_depth) {
+            reserved_by = NULL;
+            stats.granted = engine_stats.granted - reserved_stats.granted;
+            stats.busy = engine_stats.busy - reserved_stats.busy;
+            stats.deferred = engine_stats.deferred - reserved_stats.deferred;
+            released = true;
+        }
+    }
+    taskEXIT_CRITICAL(&sha_engine_spinlock);
+
+    if (released) {
+        JADE_LOGI("sha engine while reserved - granted: %lu, busy: %lu, deferred: %lu", stats.granted, stats.busy,
+            stats.deferred);
+    }
+}
+
+void sha_engine_release_cb(void* ignored) { sha_engine_release(); }
+
+void sha_engine_get_stats(sha_engine_stats_t* stats)
+{
+    JADE_ASSERT(stats);
+
+    taskENTER_CRITICAL(&sha_engine_spinlock);
+    *stats = engine_stats;
+    taskEXIT_CRITICAL(&sha_engine_spinlock);
+}
+
+#ifdef CONFIG_DEBUG_MODE
+// Competing hash load, as the gui/camera tasks might generate - for benchmarking the reservation policy.
+// The task is created on first use, and blocks while the load is disabled.
+static volatile bool test_load_enabled = false;
+static TaskHandle_t test_load_task_handle = NULL;
+
+static void test_load_task(void* ignored)
+{
+    uint8_t buf[1024] = { 0 };
+    uint8_t hash[32];
+    while (true) {
+        if (!test_load_enabled) {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            continue;
+        }
+
+        // Hash a few blocks at a time, then yield so the other tasks on this core still run
+        for (size_t i = 0; i < 8; ++i) {
+            JADE_ASSERT(!mbedtls_sha256(buf, sizeof(buf), hash, 0));
+            buf[0] = hash[0];
+        }
+        vTaskDelay(1);
+    }
+}
+
+void sha_engine_set_test_load(const bool enabled)
+{
+    test_load_enabled = enabled;
+    if (!enabled) {
+        return;
+    }
+
+    if (!test_load_task_handle) {
+        const BaseType_t retval = xTaskCreatePinnedToCore(&test_load_task, "sha_test_load", 3 * 1024, NULL,
+            JADE_TASK_PRIO_CAMERA, &test_load_task_handle, JADE_CORE_SECONDARY);
+        JADE_ASSERT_MSG(
+            retval == pdPASS, "Failed to create sha_test_load task, xTaskCreatePinnedToCore() returned %d", retval);
+    }
+    xTaskNotifyGive(test_load_task_handle);
+}
+#endif // CONFIG_DEBUG_MODE
@@ -0,0 +1,33 @@
+#ifndef SHA_ENGINE_H_
+#define SHA_ENGINE_H_
+
+#include <sdkconfig.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Outcomes of attempts to use the hardware sha engines
+typedef struct {
+    uint32_t granted; // engine acquired, hashed in hw
+    uint32_t busy; // engine in use by another hash, fell back to software
+    uint32_t deferred; // engine reserved by another task, steered to software
+} sha_engine_stats_t;
+
+// The task performing latency-critical hashing (eg. txid/sighash computation,
+// pbkdf2, ota image hashing) can reserve the hw sha engines for itself.
+// While reserved, hashes started by any other task use software.
+// Reservations nest, and are released by the same task.  (Best-effort: a
+// reserve/release pair made while another task holds the reservation is ignored.)
+void sha_engine_reserve(void);
+void sha_engine_release(void);
+
+// Release as a process 'on exit' function
+void sha_engine_release_cb(void* ignored);
+
+void sha_engine_get_stats(sha_engine_stats_t* stats);
+
+#ifdef CONFIG_DEBUG_MODE
+// Start/stop a task on the secondary core continually hashing at camera priority, to benchmark under contention
+void sha_engine_set_test_load(bool enabled);
+#endif
+
+#endif /* SHA_ENGINE_H_ */
@@ -0,0 +1,229 @@
+#include "stack_usage.h"
+
+#ifdef CONFIG_DEBUG_MODE
+#include "jade_assert.h"
+#include "jade_tasks.h"
+#include "utils/cbor_rpc.h"
+
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+
+#include <string.h>
+
+// The value FreeRTOS fills new task stacks with, and which uxTaskGetStackHighWaterMark() scans for
+#define STACK_FILL_BYTE 0xa5
+
+// When re-filling the main task stack leave untouched a margin below the caller (for memset()'s own frame
+// and any register-window spill), and the very end of the stack (where any overflow canary/watchpoint sits).
+#define FILL_MARGIN_CALLER 512
+#define FILL_MARGIN_END 32
+
+#define MAX_LABEL_LEN 32
+#define MAX_TRACKED_METHODS 64
+
+typedef struct {
+    const char* name;
+    size_t stack_size;
+    bool transient; // transient tasks record themselves on exit, rather than being sampled by the main task
+    bool sampled;
+    size_t min_free;
+    char peak_method[MAX_LABEL_LEN];
+} task_stack_usage_t;
+
+typedef struct {
+    char method[MAX_LABEL_LEN];
+    size_t max_used;
+} method_stack_usage_t;
+
+// NOTE: the main task must be the first entry
+static task_stack_usage_t task_usage[] = {
+    { .name = "main", .stack_size = CONFIG_ESP_MAIN_TASK_STACK_SIZE },
+    { .name = "gui", .stack_size = JADE_TASK_STACK_SIZE_GUI },
+    { .name = "serial_reader", .stack_size = JADE_TASK_STACK_SIZE_READER },
+    { .name = "serial_writer", .stack_size = JADE_TASK_STACK_SIZE_WRITER },
+#ifndef CONFIG_ESP32_NO_BLOBS
+    { .name = "ble_writer", .stack_size = JADE_TASK_STACK_SIZE_WRITER },
+#endif
+#ifdef CONFIG_BT_NIMBLE_ENABLED
+    { .name = "nimble_host", .stack_size = CONFIG_BT_NIMBLE_HOST_TASK_STACK_SIZE },
+#endif
+#ifdef CONFIG_ETH_USE_OPENETH
+    { .name = "qemu_tcp_reader", .stack_size = JADE_TASK_STACK_SIZE_READER },
+    { .name = "qemu_tcp_writer", .stack_size = JADE_TASK_STACK_SIZE_WRITER },
+#endif
+    { .name = "wheel_watcher", .stack_size = JADE_TASK_STACK_SIZE_WHEEL },
+    { .name = "idle_timeout", .stack_size = JADE_TASK_STACK_SIZE_IDLETIMER },
+    { .name = "Tmr Svc", .stack_size = CONFIG_FREERTOS_TIMER_TASK_STACK_DEPTH },
+    { .name = "jade_camera", .stack_size = JADE_TASK_STACK_SIZE_CAMERA, .transient = true },
+    { .name = "auth_qr_client_task", .stack_size = JADE_TASK_STACK_SIZE_AUTH_QR, .transient = true },
+};
+#define NUM_TRACKED_TASKS (sizeof(task_usage) / sizeof(task_usage[0]))
+
+// Per-message peak main task usage - only accessed from the main task
+static method_stack_usage_t method_usage[MAX_TRACKED_METHODS];
+static size_t num_methods = 0;
+
+// The message currently being handled by the main task
+static char current_method[MAX_LABEL_LEN];
+
+static portMUX_TYPE usage_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+static void record_task_usage(task_stack_usage_t* usage, const size_t free_bytes)
+{
+    JADE_ASSERT(usage);
+
+    taskENTER_CRITICAL(&usage_spinlock);
+    if (!usage->sampled || free_bytes < usage->min_free) {
+        usage->min_free = free_bytes;
+        usage->sampled = true;
+        strcpy(usage->peak_method, current_method);
+    }
+    taskEXIT_CRITICAL(&usage_spinlock);
+}
+
+static void record_method_usage(const size_t used)
+{
+    for (size_t i = 0; i < num_methods; ++i) {
+        if (!strcmp(method_usage[i].method, current_method)) {
+            if (used > method_usage[i].max_used) {
+                method_usage[i].max_used = used;
+            }
+            return;
+        }
+    }
+
+    if (num_methods == MAX_TRACKED_METHODS) {
+        JADE_LOGW("Stack usage table full - not tracking %s", current_method);
+        return;
+    }
+    strcpy(method_usage[num_methods].method, current_method);
+    method_usage[num_methods].max_used = used;
+    ++num_methods;
+}
+
+// NOTE: must not be inlined - the stack is re-filled relative to this function's frame
+void __attribute__((noinline)) stack_usage_begin(const char* method, const size_t method_len)
+{
+    JADE_ASSERT(method);
+    JADE_ASSERT(!strcmp(pcTaskGetName(NULL), task_usage[0].name));
+
+    const size_t len = method_len < sizeof(current_method) ? method_len : sizeof(current_method) - 1;
+    memcpy(current_method, method, len);
+    current_method[len] = '\0';
+
+    // Re-fill the unused portion of the main task stack (which grows down, towards the 'start')
+    uint8_t* const fill_from = pxTaskGetStackStart(NULL) + FILL_MARGIN_END;
+    uint8_t* const fill_to = (uint8_t*)__builtin_frame_address(0) - FILL_MARGIN_CALLER;
+    JADE_ASSERT(fill_to > fill_from);
+    memset(fill_from, STACK_FILL_BYTE, fill_to - fill_from);
+}
+
+void stack_usage_end(void)
+{
+    // Main task - the high-water-mark reflects only the message just handled
+    const size_t main_free = uxTaskGetStackHighWaterMark(NULL);
+    JADE_ASSERT(main_free < task_usage[0].stack_size);
+    record_task_usage(&task_usage[0], main_free);
+    record_method_usage(task_usage[0].stack_size - main_free);
+
+    // Other resident tasks - cumulative high-water-marks, attributed to the message being
+    // handled when they are seen to fall
+    for (size_t i = 1; i < NUM_TRACKED_TASKS; ++i) {
+        if (!task_usage[i].transient) {
+            TaskHandle_t handle = xTaskGetHandle(task_usage[i].name);
+            if (handle) {
+                record_task_usage(&task_usage[i], uxTaskGetStackHighWaterMark(handle));
+            }
+        }
+    }
+
+    current_method[0] = '\0';
+}
+
+void stack_usage_record_current_task(void)
+{
+    const char* const name = pcTaskGetName(NULL);
+    for (size_t i = 0; i < NUM_TRACKED_TASKS; ++i) {
+        if (!strcmp(name, task_usage[i].name)) {
+            record_task_usage(&task_usage[i], uxTaskGetStackHighWaterMark(NULL));
+            return;
+        }
+    }
+    JADE_LOGW("Task %s not tracked for stack usage", name);
+}
+
+// {
+//   "tasks": { <name>: { "stack_size": <bytes>, "min_free": <bytes>, "peak_method": <method> }, ... },
+//   "methods": { <method>: <peak main task bytes used>, ... }
+// }
+void stack_usage_encode(const void* ctx, CborEncoder* container)
+{
+    JADE_ASSERT(container);
+
+    // NOTE: transient tasks may update their records concurrently, so fix the set of
+    // tasks reported up-front, and take a consistent copy of each record as it is encoded.
+    bool sampled[NUM_TRACKED_TASKS];
+    size_t num_sampled = 0;
+    taskENTER_CRITICAL(&usage_spinlock);
+    for (size_t i = 0; i < NUM_TRACKED_TASKS; ++i) {
+        sampled[i] = task_usage[i].sampled;
+        num_sampled += sampled[i] ? 1 : 0;
+    }
+    taskEXIT_CRITICAL(&usage_spinlock);
+
+    CborEncoder root_encoder;
+    CborError cberr = cbor_encoder_create_map(container, &root_encoder, 2);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encode_text_stringz(&root_encoder, "tasks");
+    JADE_ASSERT(cberr == CborNoError);
+
+    CborEncoder tasks_encoder;
+    cberr = cbor_encoder_create_map(&root_encoder, &tasks_encoder, num_sampled);
+    JADE_ASSERT(cberr == CborNoError);
+
+    for (size_t i = 0; i < NUM_TRACKED_TASKS; ++i) {
+        if (!sampled[i]) {
+            continue;
+        }
+
+        taskENTER_CRITICAL(&usage_spinlock);
+        const task_stack_usage_t usage = task_usage[i];
+        taskEXIT_CRITICAL(&usage_spinlock);
+
+        cberr = cbor_encode_text_stringz(&tasks_encoder, usage.name);
+        JADE_ASSERT(cberr == CborNoError);
+
+        CborEncoder entry_encoder;
+        cberr = cbor_encoder_create_map(&tasks_encoder, &entry_encoder, 3);
+        JADE_ASSERT(cberr == CborNoError);
+
+        add_uint_to_map(&entry_encoder, "stack_size", usage.stack_size);
+        add_uint_to_map(&entry_encoder, "min_free", usage.min_free);
+        add_string_to_map(&entry_encoder, "peak_method", usage.peak_method);
+
+        cberr = cbor_encoder_close_container(&tasks_encoder, &entry_encoder);
+        JADE_ASSERT(cberr == CborNoError);
+    }
+
+    cberr = cbor_encoder_close_container(&root_encoder, &tasks_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encode_text_stringz(&root_encoder, "methods");
+    JADE_ASSERT(cberr == CborNoError);
+
+    CborEncoder methods_encoder;
+    cberr = cbor_encoder_create_map(&root_encoder, &methods_encoder, num_methods);
+    JADE_ASSERT(cberr == CborNoError);
+
+    for (size_t i = 0; i < num_methods; ++i) {
+        add_uint_to_map(&methods_encoder, method_usage[i].method, method_usage[i].max_used);
+    }
+
+    cberr = cbor_encoder_close_container(&root_encoder, &methods_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+
+    cberr = cbor_encoder_close_container(container, &root_encoder);
+    JADE_ASSERT(cberr == CborNoError);
+}
+#endif // CONFIG_DEBUG_MODE
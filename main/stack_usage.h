@@ -0,0 +1,23 @@
+#ifndef STACK_USAGE_H_
+#define STACK_USAGE_H_
+
+#include <sdkconfig.h>
+
+#ifdef CONFIG_DEBUG_MODE
+#include <cbor.h>
+#include <stddef.h>
+
+// Mark the start/end of handling a message on the main task.
+// The main task stack below the caller is re-filled at the start so the main task's
+// high-water-mark reflects only this message - the other tasks' marks are cumulative.
+void stack_usage_begin(const char* method, size_t method_len);
+void stack_usage_end(void);
+
+// Record the stack high-water-mark of the calling task (eg. a transient task about to exit)
+void stack_usage_record_current_task(void);
+
+// cbor_encoder_fn_t which writes the stack usage report
+void stack_usage_encode(const void* ctx, CborEncoder* container);
+#endif // CONFIG_DEBUG_MODE
+
+#endif /* STACK_USAGE_H_ */
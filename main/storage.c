@@ -5,6 +5,7 @@
 #include <ctype.h>
 #include <esp_system.h>
 #include <nvs_flash.h>
+#include <stdio.h>
 #include <string.h>
 #include <wally_crypto.h>
 
@@ -15,8 +16,10 @@ static const char* NVS_KEYS_PARTITION_LABEL = "nvs_key";
 
 static const char* DEFAULT_NAMESPACE = "PIN";
 static const char* MULTISIG_NAMESPACE = "MULTISIGS";
+static const char* MULTISIG_INDEX_NAMESPACE = "MULTISIGIDX";
 static const char* OTP_NAMESPACE = "OTP";
 static const char* HOTP_COUNTERS_NAMESPACE = "HOTPC";
+static const char* WALLET_SLOTS_NAMESPACE = "WALLETS";
 
 static const char* PIN_PRIVATEKEY_FIELD = "privatekey";
 static const char* PIN_COUNTER_FIELD = "counter";
@@ -28,12 +31,31 @@ static const char* USER_PINSERVER_URL_A = "pinsvrurlA";
 static const char* USER_PINSERVER_URL_B = "pinsvrurlB";
 static const char* USER_PINSERVER_PUBKEY = "pinsvrpubkey";
 static const char* USER_PINSERVER_CERT = "pinsvrcert";
+static const char* USER_PINSERVER_ONESHOT = "pinsvroneshot";
 
 static const char* NETWORK_TYPE_FIELD = "networktype";
 static const char* IDLE_TIMEOUT_FIELD = "idletimeout";
 static const char* CLICK_EVENT_FIELD = "clickevent";
 static const char* BLE_FLAGS_FIELD = "bleflags";
 static const char* QR_FLAGS_FIELD = "qrflags";
+static const char* OTA_CHECKPOINT_FIELD = "otackpt";
+
+static const char* MULTISIG_INDEX_COUNT_FIELD = "count";
+static const char* MULTISIG_INDEX_VERSION_FIELD = "version";
+
+// The format of the multisig index pages - an index of another format is rebuilt
+static const uint8_t MULTISIG_INDEX_VERSION = 1;
+
+static const char* WALLET_SLOT_NAME_PREFIX = "name";
+static const char* WALLET_SLOT_BLOB_PREFIX = "blob";
+
+// Multisig registrations and otp records are held per wallet slot.  The main wallet (slot 0) uses the
+// namespaces above, the other slots the same names suffixed with the slot number.
+static size_t active_wallet_slot = 0;
+static char multisig_namespace[NVS_KEY_NAME_MAX_SIZE];
+static char multisig_index_namespace[NVS_KEY_NAME_MAX_SIZE];
+static char otp_namespace[NVS_KEY_NAME_MAX_SIZE];
+static char hotp_counters_namespace[NVS_KEY_NAME_MAX_SIZE];
 
 // NOTE: esp-idf reserve the final page of nvs entries for internal use (for defrag/consolidation)
 // See: https://github.com/espressif/esp-idf/issues/5247#issuecomment-1048604221
@@ -41,6 +63,11 @@ static const char* QR_FLAGS_FIELD = "qrflags";
 static const size_t NUM_ALL_NVS_ENTRIES = 504;
 static const size_t NUM_ESP_RESERVED_ENTRIES = 126;
 
+// Free nvs entries multisig registrations may not consume, kept for pin/counter updates, settings, otp records etc.
+// NOTE: a 2-of-3 registration takes 11 entries (plus its share of an index page), so with a few otp records this
+// leaves room for around 25-30 such registrations in total (fewer with more signers or additional wallets).
+static const size_t NUM_NON_MULTISIG_RESERVED_ENTRIES = 48;
+
 // Building block macros for the store/read/erase functions.
 // They all close the storage and return false on any error.
 
@@ -221,6 +248,30 @@ static bool erase_key(const char* ns, const char* name)
     return true;
 }
 
+static bool erase_namespace(const char* ns)
+{
+    JADE_ASSERT(ns);
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, ns, NVS_READWRITE);
+    const esp_err_t err = nvs_erase_all(handle);
+    if (err != ESP_OK) {
+        JADE_LOGE("nvs_erase_all() for %s failed: %u", ns, err);
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
+}
+
+// The name of a namespace (or key) as used for the given wallet slot
+static void wallet_slot_name(const char* base, const size_t slot, char* name, const size_t name_len)
+{
+    const int ret = slot ? snprintf(name, name_len, "%s%u", base, slot) : snprintf(name, name_len, "%s", base);
+    JADE_ASSERT(ret > 0 && ret < name_len);
+}
+
 // NOTE: 'namespace' is optional (NULL implies all namespaces)
 size_t get_entry_count(const char* namespace, const nvs_type_t type)
 {
@@ -282,6 +333,278 @@ static bool get_all_key_names(const char* namespace, const nvs_type_t type, char
     return count <= num_names;
 }
 
+// Multisig registration index
+// The registration records are indexed by name and policy fingerprint in fixed-size pages, so they can be
+// listed, paged and searched holding only one page in memory at a time.  Pages are held full and in order,
+// except the last which may be partial - removed entries are replaced by the final entry.
+// NOTE: these helpers do not close the handle on error - the caller must do so.
+static void multisig_index_page_key(const size_t page, char* key, const size_t key_len)
+{
+    const int ret = snprintf(key, key_len, "page%u", page);
+    JADE_ASSERT(ret > 0 && ret < key_len);
+}
+
+static size_t multisig_index_page_entries(const size_t page, const size_t count)
+{
+    const size_t first = page * MULTISIG_INDEX_PAGE_SIZE;
+    JADE_ASSERT(first < count);
+    return count - first < MULTISIG_INDEX_PAGE_SIZE ? count - first : MULTISIG_INDEX_PAGE_SIZE;
+}
+
+static bool multisig_index_read_count(nvs_handle handle, size_t* count)
+{
+    uint16_t value = 0;
+    size_t len = sizeof(value);
+    const esp_err_t err = nvs_get_blob(handle, MULTISIG_INDEX_COUNT_FIELD, &value, &len);
+    if (err != ESP_OK || len != sizeof(value)) {
+        JADE_LOGE("Failed to read multisig index count: %u", err);
+        return false;
+    }
+    *count = value;
+    return true;
+}
+
+static bool multisig_index_write_count(nvs_handle handle, const size_t count)
+{
+    JADE_ASSERT(count <= UINT16_MAX);
+    const uint16_t value = count;
+    const esp_err_t err = nvs_set_blob(handle, MULTISIG_INDEX_COUNT_FIELD, &value, sizeof(value));
+    if (err != ESP_OK) {
+        JADE_LOGE("Failed to write multisig index count: %u", err);
+        return false;
+    }
+    return true;
+}
+
+static bool multisig_index_write_version(nvs_handle handle)
+{
+    const esp_err_t err
+        = nvs_set_blob(handle, MULTISIG_INDEX_VERSION_FIELD, &MULTISIG_INDEX_VERSION, sizeof(MULTISIG_INDEX_VERSION));
+    if (err != ESP_OK) {
+        JADE_LOGE("Failed to write multisig index version: %u", err);
+        return false;
+    }
+    return true;
+}
+
+static bool multisig_index_read_page(nvs_handle handle, const size_t page, const size_t count,
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE], size_t* num_entries)
+{
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    multisig_index_page_key(page, key, sizeof(key));
+
+    const size_t expected = multisig_index_page_entries(page, count);
+    size_t len = expected * sizeof(multisig_index_entry_t);
+    const esp_err_t err = nvs_get_blob(handle, key, entries, &len);
+    if (err != ESP_OK || len != expected * sizeof(multisig_index_entry_t)) {
+        JADE_LOGE("Failed to read multisig index %s: %u", key, err);
+        return false;
+    }
+    *num_entries = expected;
+    return true;
+}
+
+// Writes (or erases, if empty) the given index page
+static bool multisig_index_write_page(nvs_handle handle, const size_t page,
+    const multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE], const size_t num_entries)
+{
+    JADE_ASSERT(num_entries <= MULTISIG_INDEX_PAGE_SIZE);
+
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    multisig_index_page_key(page, key, sizeof(key));
+
+    const esp_err_t err = num_entries ? nvs_set_blob(handle, key, entries, num_entries * sizeof(multisig_index_entry_t))
+                                      : nvs_erase_key(handle, key);
+    if (err != ESP_OK) {
+        JADE_LOGE("Failed to write multisig index %s: %u", key, err);
+        return false;
+    }
+    return true;
+}
+
+// Finds the named entry - on success 'entries' holds its page
+static bool multisig_index_find(nvs_handle handle, const size_t count, const char* name,
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE], size_t* index)
+{
+    for (size_t page = 0; page * MULTISIG_INDEX_PAGE_SIZE < count; ++page) {
+        size_t num_entries = 0;
+        if (!multisig_index_read_page(handle, page, count, entries, &num_entries)) {
+            return false;
+        }
+        for (size_t i = 0; i < num_entries; ++i) {
+            if (!strcmp(entries[i].name, name)) {
+                *index = page * MULTISIG_INDEX_PAGE_SIZE + i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// Adds or updates the named entry
+static bool multisig_index_set(nvs_handle handle, const char* name, const uint8_t* policy_fingerprint)
+{
+    size_t count = 0;
+    if (!multisig_index_read_count(handle, &count)) {
+        return false;
+    }
+
+    size_t index = 0;
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    if (multisig_index_find(handle, count, name, entries, &index)) {
+        multisig_index_entry_t* const entry = entries + (index % MULTISIG_INDEX_PAGE_SIZE);
+        if (!memcmp(entry->policy_fingerprint, policy_fingerprint, sizeof(entry->policy_fingerprint))) {
+            // Unchanged
+            return true;
+        }
+        memcpy(entry->policy_fingerprint, policy_fingerprint, sizeof(entry->policy_fingerprint));
+        const size_t page = index / MULTISIG_INDEX_PAGE_SIZE;
+        return multisig_index_write_page(handle, page, entries, multisig_index_page_entries(page, count));
+    }
+
+    // Append to last page
+    if (count >= UINT16_MAX) {
+        JADE_LOGE("Multisig index full");
+        return false;
+    }
+    const size_t page = count / MULTISIG_INDEX_PAGE_SIZE;
+    const size_t slot = count % MULTISIG_INDEX_PAGE_SIZE;
+    size_t num_entries = 0;
+    if (slot && !multisig_index_read_page(handle, page, count, entries, &num_entries)) {
+        return false;
+    }
+    JADE_ASSERT(num_entries == slot);
+
+    multisig_index_entry_t* const entry = entries + slot;
+    memset(entry, 0, sizeof(multisig_index_entry_t));
+    strcpy(entry->name, name);
+    memcpy(entry->policy_fingerprint, policy_fingerprint, sizeof(entry->policy_fingerprint));
+    return multisig_index_write_page(handle, page, entries, slot + 1) && multisig_index_write_count(handle, count + 1);
+}
+
+// Removes the named entry (if present), moving the final entry into its place
+static bool multisig_index_remove(nvs_handle handle, const char* name)
+{
+    size_t count = 0;
+    if (!multisig_index_read_count(handle, &count)) {
+        return false;
+    }
+
+    size_t index = 0;
+    multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+    if (!multisig_index_find(handle, count, name, entries, &index)) {
+        // Not present
+        return true;
+    }
+
+    const size_t page = index / MULTISIG_INDEX_PAGE_SIZE;
+    const size_t last_page = (count - 1) / MULTISIG_INDEX_PAGE_SIZE;
+    const size_t last_slot = (count - 1) % MULTISIG_INDEX_PAGE_SIZE;
+
+    if (page == last_page) {
+        // Same page - move final entry down within it
+        entries[index % MULTISIG_INDEX_PAGE_SIZE] = entries[last_slot];
+    } else {
+        // Move the final entry into the removed entry's page, then drop it from the last page
+        multisig_index_entry_t last_entries[MULTISIG_INDEX_PAGE_SIZE];
+        size_t num_entries = 0;
+        if (!multisig_index_read_page(handle, last_page, count, last_entries, &num_entries)) {
+            return false;
+        }
+        JADE_ASSERT(num_entries == last_slot + 1);
+        entries[index % MULTISIG_INDEX_PAGE_SIZE] = last_entries[last_slot];
+        if (!multisig_index_write_page(handle, page, entries, MULTISIG_INDEX_PAGE_SIZE)
+            || !multisig_index_write_page(handle, last_page, last_entries, last_slot)) {
+            return false;
+        }
+        return multisig_index_write_count(handle, count - 1);
+    }
+
+    return multisig_index_write_page(handle, last_page, entries, last_slot)
+        && multisig_index_write_count(handle, count - 1);
+}
+
+// Creates the multisig index if not present, from any existing registration records.
+// Policy fingerprints are unknown for existing records, and are learned when first used.
+// An index of another format version is rebuilt, as is one whose count does not match the records - as firmware
+// without the index may have added or removed records.  An index which is current is kept across firmware updates,
+// so learned fingerprints are not lost.
+// NOTE: a record replaced under the same name by firmware without the index keeps its old fingerprint - as that is
+// only a lookup hint, the record is then just not found automatically (eg. for change) until registered again.
+static bool init_multisig_index(void)
+{
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READWRITE);
+
+    uint8_t index_version = 0;
+    size_t len = sizeof(index_version);
+    const bool same_version = nvs_get_blob(handle, MULTISIG_INDEX_VERSION_FIELD, &index_version, &len) == ESP_OK
+        && len == sizeof(index_version) && index_version == MULTISIG_INDEX_VERSION;
+
+    uint16_t index_count = 0;
+    len = sizeof(index_count);
+    if (nvs_get_blob(handle, MULTISIG_INDEX_COUNT_FIELD, &index_count, &len) == ESP_OK) {
+        if (same_version && len == sizeof(index_count)
+            && index_count == get_entry_count(multisig_namespace, NVS_TYPE_BLOB)) {
+            // Index present and current
+            STORAGE_CLOSE(handle);
+            return true;
+        }
+
+        JADE_LOGW("Multisig index stale - rebuilding");
+        const esp_err_t err = nvs_erase_all(handle);
+        if (err != ESP_OK) {
+            JADE_LOGE("nvs_erase_all() for multisig index failed: %u", err);
+            STORAGE_CLOSE(handle);
+            return false;
+        }
+    }
+
+    JADE_LOGI("Building multisig index");
+    size_t count = 0;
+    bool more = true;
+    while (more) {
+        // Collect the next page of record names, restarting the iteration each time as we write in between
+        multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE];
+        size_t num_entries = 0;
+        size_t skip = count;
+        nvs_iterator_t it = NULL;
+        esp_err_t res = nvs_entry_find(NVS_DEFAULT_PART_NAME, multisig_namespace, NVS_TYPE_BLOB, &it);
+        while (res == ESP_OK && it != NULL && num_entries < MULTISIG_INDEX_PAGE_SIZE) {
+            if (skip) {
+                --skip;
+            } else {
+                nvs_entry_info_t info;
+                nvs_entry_info(it, &info);
+                multisig_index_entry_t* const entry = entries + num_entries++;
+                memset(entry, 0, sizeof(multisig_index_entry_t));
+                strcpy(entry->name, info.key);
+            }
+            res = nvs_entry_next(&it);
+        }
+        more = res == ESP_OK && it != NULL;
+        if (it) {
+            nvs_release_iterator(it);
+        }
+
+        if (num_entries && !multisig_index_write_page(handle, count / MULTISIG_INDEX_PAGE_SIZE, entries, num_entries)) {
+            STORAGE_CLOSE(handle);
+            return false;
+        }
+        count += num_entries;
+    }
+
+    if (!multisig_index_write_count(handle, count) || !multisig_index_write_version(handle)) {
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+
+    JADE_LOGI("Multisig index built with %u entries", count);
+    return true;
+}
+
 static esp_err_t init_nvs_flash(void)
 {
     esp_err_t err;
@@ -328,6 +651,11 @@ bool storage_init(void)
     }
 
     esp_log_level_set("nvs", ESP_LOG_ERROR);
+
+    // Ensure any pre-existing multisig registrations (of the main wallet) are indexed
+    if (err == ESP_OK && !storage_set_active_wallet_slot(0)) {
+        JADE_LOGE("Failed to initialise multisig index");
+    }
     return err == ESP_OK;
 }
 
@@ -485,6 +813,9 @@ bool storage_set_pinserver_details(const char* urlA, const char* urlB, const uin
     if (pubkey && pubkey_len > 0) {
         STORAGE_SET_BLOB(handle, USER_PINSERVER_PUBKEY, pubkey, pubkey_len);
     }
+
+    // Whether the (new) server supports the single round-trip protocol is not yet known
+    STORAGE_ERASE(handle, USER_PINSERVER_ONESHOT);
     STORAGE_COMMIT(handle);
     STORAGE_CLOSE(handle);
     return true;
@@ -513,11 +844,24 @@ bool storage_erase_pinserver_details(void)
     STORAGE_ERASE(handle, USER_PINSERVER_URL_A);
     STORAGE_ERASE(handle, USER_PINSERVER_URL_B);
     STORAGE_ERASE(handle, USER_PINSERVER_PUBKEY);
+    STORAGE_ERASE(handle, USER_PINSERVER_ONESHOT);
     STORAGE_COMMIT(handle);
     STORAGE_CLOSE(handle);
     return true;
 }
 
+bool storage_set_pinserver_oneshot(const bool oneshot)
+{
+    const uint8_t flag = oneshot ? 1 : 0;
+    return store_blob(DEFAULT_NAMESPACE, USER_PINSERVER_ONESHOT, &flag, sizeof(flag));
+}
+
+bool storage_get_pinserver_oneshot(void)
+{
+    uint8_t flag = 0;
+    return read_blob_fixed(DEFAULT_NAMESPACE, USER_PINSERVER_ONESHOT, &flag, sizeof(flag)) && flag;
+}
+
 bool storage_set_pinserver_cert(const char* cert) { return store_string(DEFAULT_NAMESPACE, USER_PINSERVER_CERT, cert); }
 
 bool storage_get_pinserver_cert(char* cert, const size_t len, size_t* written)
@@ -527,17 +871,21 @@ bool storage_get_pinserver_cert(char* cert, const size_t len, size_t* written)
 
 bool storage_erase_pinserver_cert(void) { return erase_key(DEFAULT_NAMESPACE, USER_PINSERVER_CERT); }
 
+// The network type restriction is held per wallet slot (the main wallet keeps the existing key)
 bool storage_set_network_type_restriction(network_type_t networktype)
 {
-    return store_blob(DEFAULT_NAMESPACE, NETWORK_TYPE_FIELD, (uint8_t*)&networktype, sizeof(networktype));
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(NETWORK_TYPE_FIELD, active_wallet_slot, key, sizeof(key));
+    return store_blob(DEFAULT_NAMESPACE, key, (uint8_t*)&networktype, sizeof(networktype));
 }
 
 network_type_t storage_get_network_type_restriction(void)
 {
+    char key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(NETWORK_TYPE_FIELD, active_wallet_slot, key, sizeof(key));
     network_type_t networktype = NETWORK_TYPE_NONE;
-    return read_blob_fixed(DEFAULT_NAMESPACE, NETWORK_TYPE_FIELD, (uint8_t*)&networktype, sizeof(networktype))
-        ? networktype
-        : NETWORK_TYPE_NONE;
+    return read_blob_fixed(DEFAULT_NAMESPACE, key, (uint8_t*)&networktype, sizeof(networktype)) ? networktype
+                                                                                                : NETWORK_TYPE_NONE;
 }
 
 bool storage_set_idle_timeout(uint16_t timeout)
@@ -584,6 +932,18 @@ uint16_t storage_get_qr_flags(void)
     return read_blob_fixed(DEFAULT_NAMESPACE, QR_FLAGS_FIELD, (uint8_t*)&flags, sizeof(flags)) ? flags : 0;
 }
 
+bool storage_set_ota_checkpoint(const uint8_t* checkpoint, const size_t checkpoint_len)
+{
+    return store_blob(DEFAULT_NAMESPACE, OTA_CHECKPOINT_FIELD, checkpoint, checkpoint_len);
+}
+
+bool storage_get_ota_checkpoint(uint8_t* checkpoint, const size_t checkpoint_len)
+{
+    return read_blob_fixed(DEFAULT_NAMESPACE, OTA_CHECKPOINT_FIELD, checkpoint, checkpoint_len);
+}
+
+bool storage_erase_ota_checkpoint(void) { return erase_key(DEFAULT_NAMESPACE, OTA_CHECKPOINT_FIELD); }
+
 bool storage_set_key_flags(uint8_t flags)
 {
     return store_blob(DEFAULT_NAMESPACE, KEY_FLAGS_FIELD, &flags, sizeof(flags));
@@ -607,64 +967,278 @@ bool storage_get_wallet_erase_pin(uint8_t* pin, const size_t pin_len)
 
 bool storage_erase_wallet_erase_pin(void) { return erase_key(DEFAULT_NAMESPACE, WALLET_ERASE_PIN); }
 
+// Wallet slots
+// The main wallet (slot 0) is the encrypted blob above - the other slots hold a name and an encrypted blob each.
+bool storage_set_wallet_slot(const size_t slot, const char* name, const uint8_t* encrypted, const size_t encrypted_len)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+    JADE_ASSERT(name);
+    JADE_ASSERT(encrypted);
+
+    char name_key[NVS_KEY_NAME_MAX_SIZE];
+    char blob_key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(WALLET_SLOT_NAME_PREFIX, slot, name_key, sizeof(name_key));
+    wallet_slot_name(WALLET_SLOT_BLOB_PREFIX, slot, blob_key, sizeof(blob_key));
+
+    // Commit both values, or neither
+    nvs_handle handle;
+    STORAGE_OPEN(handle, WALLET_SLOTS_NAMESPACE, NVS_READWRITE);
+    STORAGE_SET_BLOB(handle, blob_key, encrypted, encrypted_len);
+    STORAGE_SET_STRING(handle, name_key, name);
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
+}
+
+bool storage_get_wallet_slot_name(const size_t slot, char* name, const size_t name_len, size_t* written)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+
+    char name_key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(WALLET_SLOT_NAME_PREFIX, slot, name_key, sizeof(name_key));
+    return read_string(WALLET_SLOTS_NAMESPACE, name_key, name, name_len, written);
+}
+
+bool storage_get_wallet_slot_blob(const size_t slot, uint8_t* encrypted, const size_t encrypted_len, size_t* written)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+
+    char blob_key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(WALLET_SLOT_BLOB_PREFIX, slot, blob_key, sizeof(blob_key));
+    return read_blob(WALLET_SLOTS_NAMESPACE, blob_key, encrypted, encrypted_len, written);
+}
+
+// Erases the wallet slot, its multisig and otp records, and its network type restriction
+bool storage_erase_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot > 0 && slot < NUM_WALLET_SLOTS);
+    JADE_ASSERT(slot != active_wallet_slot);
+
+    const char* record_namespaces[]
+        = { MULTISIG_NAMESPACE, MULTISIG_INDEX_NAMESPACE, OTP_NAMESPACE, HOTP_COUNTERS_NAMESPACE };
+    for (size_t i = 0; i < sizeof(record_namespaces) / sizeof(record_namespaces[0]); ++i) {
+        char ns[NVS_KEY_NAME_MAX_SIZE];
+        wallet_slot_name(record_namespaces[i], slot, ns, sizeof(ns));
+        if (get_entry_count(ns, NVS_TYPE_ANY) && !erase_namespace(ns)) {
+            return false;
+        }
+    }
+
+    char network_key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(NETWORK_TYPE_FIELD, slot, network_key, sizeof(network_key));
+    if (!erase_key(DEFAULT_NAMESPACE, network_key)) {
+        return false;
+    }
+
+    char name_key[NVS_KEY_NAME_MAX_SIZE];
+    char blob_key[NVS_KEY_NAME_MAX_SIZE];
+    wallet_slot_name(WALLET_SLOT_NAME_PREFIX, slot, name_key, sizeof(name_key));
+    wallet_slot_name(WALLET_SLOT_BLOB_PREFIX, slot, blob_key, sizeof(blob_key));
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, WALLET_SLOTS_NAMESPACE, NVS_READWRITE);
+    STORAGE_ERASE(handle, blob_key);
+    STORAGE_ERASE(handle, name_key);
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
+}
+
+bool storage_erase_all_wallet_slots(void)
+{
+    JADE_ASSERT(!active_wallet_slot);
+
+    bool ret = true;
+    for (size_t slot = 1; slot < NUM_WALLET_SLOTS; ++slot) {
+        ret = storage_erase_wallet_slot(slot) && ret;
+    }
+    return ret;
+}
+
+// Selects the wallet slot whose multisig and otp records (and network type restriction) are accessed
+bool storage_set_active_wallet_slot(const size_t slot)
+{
+    JADE_ASSERT(slot < NUM_WALLET_SLOTS);
+
+    active_wallet_slot = slot;
+    wallet_slot_name(MULTISIG_NAMESPACE, slot, multisig_namespace, sizeof(multisig_namespace));
+    wallet_slot_name(MULTISIG_INDEX_NAMESPACE, slot, multisig_index_namespace, sizeof(multisig_index_namespace));
+    wallet_slot_name(OTP_NAMESPACE, slot, otp_namespace, sizeof(otp_namespace));
+    wallet_slot_name(HOTP_COUNTERS_NAMESPACE, slot, hotp_counters_namespace, sizeof(hotp_counters_namespace));
+
+    // Ensure the slot's multisig index exists
+    return init_multisig_index();
+}
+
+size_t storage_get_active_wallet_slot(void) { return active_wallet_slot; }
+
 // Generic multisig
-bool storage_set_multisig_registration(const char* name, const uint8_t* registration, const size_t registration_len)
+// The index entry is written before the record, and the record erased before the index entry, so an interruption
+// can leave an index entry without a record (which is skipped when loading fails) but never an unindexed record.
+bool storage_set_multisig_registration(const char* name, const uint8_t* registration, const size_t registration_len,
+    const uint8_t* policy_fingerprint, const size_t policy_fingerprint_len)
+{
+    JADE_ASSERT(name);
+    JADE_ASSERT(policy_fingerprint);
+    JADE_ASSERT(policy_fingerprint_len == MULTISIG_POLICY_FINGERPRINT_LEN);
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READWRITE);
+    if (!multisig_index_set(handle, name, policy_fingerprint)) {
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+
+    return store_blob(multisig_namespace, name, registration, registration_len);
+}
+
+bool storage_set_multisig_policy_fingerprint(
+    const char* name, const uint8_t* policy_fingerprint, const size_t policy_fingerprint_len)
 {
-    return store_blob(MULTISIG_NAMESPACE, name, registration, registration_len);
+    JADE_ASSERT(name);
+    JADE_ASSERT(policy_fingerprint);
+    JADE_ASSERT(policy_fingerprint_len == MULTISIG_POLICY_FINGERPRINT_LEN);
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READWRITE);
+    if (!multisig_index_set(handle, name, policy_fingerprint)) {
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
 }
 
 bool storage_get_multisig_registration(
     const char* name, uint8_t* registration, const size_t registration_len, size_t* written)
 {
-    return read_blob(MULTISIG_NAMESPACE, name, registration, registration_len, written);
+    return read_blob(multisig_namespace, name, registration, registration_len, written);
 }
 
-size_t storage_get_multisig_registration_count(void) { return get_entry_count(MULTISIG_NAMESPACE, NVS_TYPE_BLOB); }
+size_t storage_get_multisig_registration_count(void)
+{
+    uint16_t count = 0;
+    return read_blob_fixed(multisig_index_namespace, MULTISIG_INDEX_COUNT_FIELD, (uint8_t*)&count, sizeof(count))
+        ? count
+        : 0;
+}
 
-bool storage_multisig_name_exists(const char* name) { return key_name_exists(name, MULTISIG_NAMESPACE, NVS_TYPE_BLOB); }
+bool storage_multisig_name_exists(const char* name)
+{
+    return key_name_exists(name, multisig_namespace, NVS_TYPE_BLOB);
+}
 
-bool storage_get_all_multisig_registration_names(
-    char names[][NVS_KEY_NAME_MAX_SIZE], const size_t num_names, size_t* num_written)
+// Check there is space for a new registration record of the given size (and an index page update), while
+// leaving a reserve of free entries for other uses.
+bool storage_multisig_registration_fits(const size_t registration_len)
 {
-    return get_all_key_names(MULTISIG_NAMESPACE, NVS_TYPE_BLOB, names, num_names, num_written);
+    // Blob index entry, and a data entry header plus the data itself in 32-byte entries
+    const size_t record_entries = 2 + (registration_len + 31) / 32;
+    const size_t index_entries = 2 + (MULTISIG_INDEX_PAGE_SIZE * sizeof(multisig_index_entry_t) + 31) / 32;
+
+    size_t entries_used = 0, entries_free = 0;
+    if (!storage_get_stats(&entries_used, &entries_free)) {
+        return false;
+    }
+    return entries_free >= record_entries + index_entries + NUM_NON_MULTISIG_RESERVED_ENTRIES;
 }
 
-bool storage_erase_multisig_registration(const char* name) { return erase_key(MULTISIG_NAMESPACE, name); }
+// Fetch a page of the multisig index.  Writes zero entries if the page is beyond the end of the index.
+bool storage_get_multisig_index_page(const size_t page, multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE],
+    const size_t num_entries, size_t* num_written)
+{
+    JADE_ASSERT(entries);
+    JADE_ASSERT(num_entries >= MULTISIG_INDEX_PAGE_SIZE);
+    JADE_INIT_OUT_SIZE(num_written);
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READONLY);
+
+    size_t count = 0;
+    if (!multisig_index_read_count(handle, &count)
+        || (page * MULTISIG_INDEX_PAGE_SIZE < count
+            && !multisig_index_read_page(handle, page, count, entries, num_written))) {
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_CLOSE(handle);
+    return true;
+}
+
+bool storage_erase_multisig_registration(const char* name)
+{
+    if (!erase_key(multisig_namespace, name)) {
+        return false;
+    }
+
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READWRITE);
+    if (!multisig_index_remove(handle, name)) {
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
+}
+
+bool storage_erase_all_multisig_registrations(void)
+{
+    if (!erase_namespace(multisig_namespace)) {
+        return false;
+    }
+
+    // Reset the index to empty
+    nvs_handle handle;
+    STORAGE_OPEN(handle, multisig_index_namespace, NVS_READWRITE);
+    const esp_err_t err = nvs_erase_all(handle);
+    if (err != ESP_OK || !multisig_index_write_count(handle, 0) || !multisig_index_write_version(handle)) {
+        JADE_LOGE("Failed to reset multisig index: %u", err);
+        STORAGE_CLOSE(handle);
+        return false;
+    }
+    STORAGE_COMMIT(handle);
+    STORAGE_CLOSE(handle);
+    return true;
+}
 
 // HOTP / TOTP
 bool storage_set_otp_data(const char* name, const uint8_t* data, const size_t data_len)
 {
-    return store_blob(OTP_NAMESPACE, name, data, data_len);
+    return store_blob(otp_namespace, name, data, data_len);
 }
 
 bool storage_get_otp_data(const char* name, uint8_t* data, const size_t data_len, size_t* written)
 {
-    return read_blob(OTP_NAMESPACE, name, data, data_len, written);
+    return read_blob(otp_namespace, name, data, data_len, written);
 }
 
 bool storage_set_otp_hotp_counter(const char* name, const uint64_t counter)
 {
-    return store_blob(HOTP_COUNTERS_NAMESPACE, name, (uint8_t*)&counter, sizeof(counter));
+    return store_blob(hotp_counters_namespace, name, (uint8_t*)&counter, sizeof(counter));
 }
 
 uint64_t storage_get_otp_hotp_counter(const char* name)
 {
     uint64_t counter = 0;
-    return read_blob_fixed(HOTP_COUNTERS_NAMESPACE, name, (uint8_t*)&counter, sizeof(counter)) ? counter : 0;
+    return read_blob_fixed(hotp_counters_namespace, name, (uint8_t*)&counter, sizeof(counter)) ? counter : 0;
 }
 
-size_t storage_get_otp_count(void) { return get_entry_count(OTP_NAMESPACE, NVS_TYPE_BLOB); }
+size_t storage_get_otp_count(void) { return get_entry_count(otp_namespace, NVS_TYPE_BLOB); }
 
-bool storage_otp_exists(const char* name) { return key_name_exists(name, OTP_NAMESPACE, NVS_TYPE_BLOB); }
+bool storage_otp_exists(const char* name) { return key_name_exists(name, otp_namespace, NVS_TYPE_BLOB); }
 
 bool storage_get_all_otp_names(char names[][NVS_KEY_NAME_MAX_SIZE], const size_t num_names, size_t* num_written)
 {
-    return get_all_key_names(OTP_NAMESPACE, NVS_TYPE_BLOB, names, num_names, num_written);
+    return get_all_key_names(otp_namespace, NVS_TYPE_BLOB, names, num_names, num_written);
 }
 
 bool storage_erase_otp(const char* name)
 {
     // Erase any hotp counter, then erase the uri record
-    erase_key(HOTP_COUNTERS_NAMESPACE, name);
-    return erase_key(OTP_NAMESPACE, name);
+    erase_key(hotp_counters_namespace, name);
+    return erase_key(otp_namespace, name);
 }
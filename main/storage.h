@@ -43,6 +43,19 @@ bool storage_restore_counter(void);
 uint8_t storage_get_counter(void);
 bool storage_erase_encrypted_blob(void);
 
+// Wallet slots - slot 0 is the main wallet (the encrypted blob above), the others are additional named wallets.
+// Each wallet slot has its own multisig and otp records, those of the active slot being accessed below.
+#define NUM_WALLET_SLOTS 5
+
+bool storage_set_wallet_slot(size_t slot, const char* name, const uint8_t* encrypted, size_t encrypted_len);
+bool storage_get_wallet_slot_name(size_t slot, char* name, size_t name_len, size_t* written);
+bool storage_get_wallet_slot_blob(size_t slot, uint8_t* encrypted, size_t encrypted_len, size_t* written);
+bool storage_erase_wallet_slot(size_t slot);
+bool storage_erase_all_wallet_slots(void);
+
+bool storage_set_active_wallet_slot(size_t slot);
+size_t storage_get_active_wallet_slot(void);
+
 bool storage_set_key_flags(uint8_t flags);
 uint8_t storage_get_key_flags(void);
 
@@ -55,6 +68,8 @@ bool storage_get_pinserver_urlA(char* url, size_t len, size_t* written);
 bool storage_get_pinserver_urlB(char* url, size_t len, size_t* written);
 bool storage_get_pinserver_pubkey(uint8_t* pubkey, size_t pubkey_len);
 bool storage_erase_pinserver_details(void);
+bool storage_set_pinserver_oneshot(bool oneshot);
+bool storage_get_pinserver_oneshot(void);
 
 bool storage_set_pinserver_cert(const char* cert);
 bool storage_get_pinserver_cert(char* cert, size_t len, size_t* written);
@@ -75,17 +90,35 @@ uint8_t storage_get_ble_flags(void);
 bool storage_set_qr_flags(uint16_t flags);
 uint16_t storage_get_qr_flags(void);
 
+bool storage_set_ota_checkpoint(const uint8_t* checkpoint, size_t checkpoint_len);
+bool storage_get_ota_checkpoint(uint8_t* checkpoint, size_t checkpoint_len);
+bool storage_erase_ota_checkpoint(void);
+
 // Generic multisig
-bool storage_set_multisig_registration(const char* name, const uint8_t* registration, size_t registration_len);
+// Registrations are indexed in pages of entries holding the name and 'policy fingerprint' (see multisig.h)
+#define MULTISIG_POLICY_FINGERPRINT_LEN 4
+#define MULTISIG_INDEX_PAGE_SIZE 8
+
+typedef struct {
+    char name[NVS_KEY_NAME_MAX_SIZE];
+    uint8_t policy_fingerprint[MULTISIG_POLICY_FINGERPRINT_LEN];
+} multisig_index_entry_t;
+
+bool storage_set_multisig_registration(const char* name, const uint8_t* registration, size_t registration_len,
+    const uint8_t* policy_fingerprint, size_t policy_fingerprint_len);
+bool storage_set_multisig_policy_fingerprint(
+    const char* name, const uint8_t* policy_fingerprint, size_t policy_fingerprint_len);
 bool storage_get_multisig_registration(
     const char* name, uint8_t* registration, size_t registration_len, size_t* written);
 
 size_t storage_get_multisig_registration_count(void);
 bool storage_multisig_name_exists(const char* multisig_name);
-bool storage_get_all_multisig_registration_names(
-    char names[][NVS_KEY_NAME_MAX_SIZE], size_t num_names, size_t* num_written);
+bool storage_multisig_registration_fits(size_t registration_len);
+bool storage_get_multisig_index_page(
+    size_t page, multisig_index_entry_t entries[MULTISIG_INDEX_PAGE_SIZE], size_t num_entries, size_t* num_written);
 
 bool storage_erase_multisig_registration(const char* name);
+bool storage_erase_all_multisig_registrations(void);
 
 // HOTP / TOTP
 bool storage_set_otp_data(const char* name, const uint8_t* data, size_t data_len);
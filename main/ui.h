@@ -134,5 +134,9 @@ void make_display_elements_output_activity(const char* network, const struct wal
 void make_display_final_confirmation_activity(uint64_t fee, const char* warning_msg, gui_activity_t** activity);
 void make_display_elements_final_confirmation_activity(
     const char* network, uint64_t fee, const char* warning_msg, gui_activity_t** activity);
+void make_display_batch_summary_activity(
+    size_t num_txs, uint64_t total_sent, uint64_t total_fees, const char* warning_msg, gui_activity_t** activity);
+void make_display_batch_item_activity(
+    size_t index, size_t num_txs, uint64_t sent, uint64_t fee, const char* warning_msg, gui_activity_t** activity);
 
 #endif /* UI_H_ */
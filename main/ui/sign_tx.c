@@ -195,6 +195,61 @@ static void make_output_activity(link_activity_t* output_activity, const bool wa
     output_activity->next_button = btns[2].btn;
 }
 
+// Add a row showing a label and an amount (already formatted for display) with its ticker
+static void add_amount_row(gui_view_node_t* parent, const char* label, const char* amount, const char* ticker)
+{
+    JADE_ASSERT(parent);
+    JADE_ASSERT(label);
+    JADE_ASSERT(amount);
+    JADE_ASSERT(ticker);
+
+    gui_view_node_t* hsplit;
+    gui_make_hsplit(&hsplit, GUI_SPLIT_RELATIVE, 2, 20, 80);
+    gui_set_parent(hsplit, parent);
+
+    gui_view_node_t* text_label;
+    gui_make_text(&text_label, label, TFT_WHITE);
+    gui_set_parent(text_label, hsplit);
+    gui_set_align(text_label, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
+    gui_set_borders(text_label, TFT_BLOCKSTREAM_GREEN, 2, GUI_BORDER_BOTTOM);
+
+    gui_view_node_t* text_amount;
+    char amount_str[32];
+    const int ret = snprintf(amount_str, sizeof(amount_str), "%s %s", amount, ticker);
+    JADE_ASSERT(ret > 0 && ret < sizeof(amount_str));
+    gui_make_text(&text_amount, amount_str, TFT_WHITE);
+    gui_set_parent(text_amount, hsplit);
+    gui_set_align(text_amount, GUI_ALIGN_RIGHT, GUI_ALIGN_MIDDLE);
+}
+
+// Add two rows showing any warning message, or two blank rows if none
+static void add_warning_rows(gui_view_node_t* parent, const char* warning_msg)
+{
+    JADE_ASSERT(parent);
+
+    if (warning_msg) {
+        gui_view_node_t* text_title;
+        gui_make_text(&text_title, "Warning:", TFT_RED);
+        gui_set_parent(text_title, parent);
+        gui_set_align(text_title, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
+        gui_set_text_scroll(text_title, TFT_BLACK);
+
+        gui_view_node_t* text_msg;
+        gui_make_text(&text_msg, warning_msg, TFT_RED);
+        gui_set_parent(text_msg, parent);
+        gui_set_align(text_msg, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
+        gui_set_text_scroll(text_msg, TFT_BLACK);
+    } else {
+        gui_view_node_t* row1;
+        gui_make_fill(&row1, TFT_BLACK);
+        gui_set_parent(row1, parent);
+
+        gui_view_node_t* row2;
+        gui_make_fill(&row2, TFT_BLACK);
+        gui_set_parent(row2, parent);
+    }
+}
+
 static void make_final_activity(
     gui_activity_t** activity_ptr, const char* total_fee, const char* ticker, const char* warning_msg)
 {
@@ -209,47 +264,10 @@ static void make_final_activity(
     gui_set_padding(vsplit, GUI_MARGIN_ALL_DIFFERENT, 2, 2, 2, 2);
     gui_set_parent(vsplit, (*activity_ptr)->root_node);
 
-    gui_view_node_t* hsplit1;
-    gui_make_hsplit(&hsplit1, GUI_SPLIT_RELATIVE, 2, 20, 80);
-    gui_set_parent(hsplit1, vsplit);
-
-    gui_view_node_t* text1;
-    gui_make_text(&text1, "Fee", TFT_WHITE);
-    gui_set_parent(text1, hsplit1);
-    gui_set_align(text1, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
-    gui_set_borders(text1, TFT_BLOCKSTREAM_GREEN, 2, GUI_BORDER_BOTTOM);
-
-    gui_view_node_t* text1b;
-    char tx_fees[32];
-    const int ret = snprintf(tx_fees, sizeof(tx_fees), "%s %s", total_fee, ticker);
-    JADE_ASSERT(ret > 0 && ret < sizeof(tx_fees));
-    gui_make_text(&text1b, tx_fees, TFT_WHITE);
-    gui_set_parent(text1b, hsplit1);
-    gui_set_align(text1b, GUI_ALIGN_RIGHT, GUI_ALIGN_MIDDLE);
+    add_amount_row(vsplit, "Fee", total_fee, ticker);
 
     // Show any warning message
-    if (warning_msg) {
-        gui_view_node_t* text2;
-        gui_make_text(&text2, "Warning:", TFT_RED);
-        gui_set_parent(text2, vsplit);
-        gui_set_align(text2, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
-        gui_set_text_scroll(text2, TFT_BLACK);
-
-        gui_view_node_t* text3;
-        gui_make_text(&text3, warning_msg, TFT_RED);
-        gui_set_parent(text3, vsplit);
-        gui_set_align(text3, GUI_ALIGN_LEFT, GUI_ALIGN_MIDDLE);
-        gui_set_text_scroll(text3, TFT_BLACK);
-    } else {
-        // Two blank rows
-        gui_view_node_t* row2;
-        gui_make_fill(&row2, TFT_BLACK);
-        gui_set_parent(row2, vsplit);
-
-        gui_view_node_t* row3;
-        gui_make_fill(&row3, TFT_BLACK);
-        gui_set_parent(row3, vsplit);
-    }
+    add_warning_rows(vsplit, warning_msg);
 
     // Buttons
     btn_data_t btns[] = { { .txt = "X", .font = DEFAULT_FONT, .ev_id = BTN_CANCEL_SIGNATURE },
@@ -510,3 +528,83 @@ void make_display_elements_final_confirmation_activity(
     // final confirmation screen
     make_final_activity(activity, fee_str, ticker, warning_msg);
 }
+
+// Consolidated summary of a batch of transactions - totals sent (ie. excluding validated change) and fees
+void make_display_batch_summary_activity(const size_t num_txs, const uint64_t total_sent, const uint64_t total_fees,
+    const char* warning_msg, gui_activity_t** activity)
+{
+    JADE_ASSERT(num_txs);
+    JADE_ASSERT(activity);
+
+    char header[24];
+    int ret = snprintf(header, sizeof(header), "Sign %u txns", num_txs);
+    JADE_ASSERT(ret > 0 && ret < sizeof(header));
+
+    gui_make_activity(activity, true, header);
+
+    gui_view_node_t* vsplit;
+    gui_make_vsplit(&vsplit, GUI_SPLIT_RELATIVE, 5, 17, 17, 17, 17, 32);
+    gui_set_padding(vsplit, GUI_MARGIN_ALL_DIFFERENT, 2, 2, 2, 2);
+    gui_set_parent(vsplit, (*activity)->root_node);
+
+    char amount[32];
+    ret = snprintf(amount, sizeof(amount), "%.08f", 1.0 * total_sent / 1e8);
+    JADE_ASSERT(ret > 0 && ret < sizeof(amount));
+    add_amount_row(vsplit, "Send", amount, "BTC");
+
+    ret = snprintf(amount, sizeof(amount), "%.08f", 1.0 * total_fees / 1e8);
+    JADE_ASSERT(ret > 0 && ret < sizeof(amount));
+    add_amount_row(vsplit, "Fees", amount, "BTC");
+
+    add_warning_rows(vsplit, warning_msg);
+
+    // Buttons - 'Review' leads to the individual transactions
+    btn_data_t btns[] = { { .txt = "X", .font = DEFAULT_FONT, .ev_id = BTN_CANCEL_SIGNATURE },
+        { .txt = "Review", .font = DEFAULT_FONT, .ev_id = BTN_TX_BATCH_REVIEW },
+        { .txt = "S", .font = VARIOUS_SYMBOLS_FONT, .ev_id = BTN_ACCEPT_SIGNATURE } };
+    add_buttons(vsplit, UI_ROW, btns, 3);
+
+    // Initially select 'Review' if there is a warning, otherwise 'Sign'
+    gui_set_activity_initial_selection(*activity, warning_msg ? btns[1].btn : btns[2].btn);
+}
+
+// One transaction in a batch - amount sent and fee, with buttons to move to the previous/next
+// transaction, to review the transaction's outputs, or to return to the batch summary.
+void make_display_batch_item_activity(const size_t index, const size_t num_txs, const uint64_t sent,
+    const uint64_t fee, const char* warning_msg, gui_activity_t** activity)
+{
+    JADE_ASSERT(index < num_txs);
+    JADE_ASSERT(activity);
+
+    // 1 based index for display purposes
+    char header[24];
+    int ret = snprintf(header, sizeof(header), "Txn %u/%u", index + 1, num_txs);
+    JADE_ASSERT(ret > 0 && ret < sizeof(header));
+
+    gui_make_activity(activity, true, header);
+
+    gui_view_node_t* vsplit;
+    gui_make_vsplit(&vsplit, GUI_SPLIT_RELATIVE, 5, 17, 17, 17, 17, 32);
+    gui_set_padding(vsplit, GUI_MARGIN_ALL_DIFFERENT, 2, 2, 2, 2);
+    gui_set_parent(vsplit, (*activity)->root_node);
+
+    char amount[32];
+    ret = snprintf(amount, sizeof(amount), "%.08f", 1.0 * sent / 1e8);
+    JADE_ASSERT(ret > 0 && ret < sizeof(amount));
+    add_amount_row(vsplit, "Send", amount, "BTC");
+
+    ret = snprintf(amount, sizeof(amount), "%.08f", 1.0 * fee / 1e8);
+    JADE_ASSERT(ret > 0 && ret < sizeof(amount));
+    add_amount_row(vsplit, "Fee", amount, "BTC");
+
+    add_warning_rows(vsplit, warning_msg);
+
+    // Buttons
+    btn_data_t btns[] = { { .txt = "=", .font = JADE_SYMBOLS_16x16_FONT, .ev_id = BTN_TX_BATCH_PREV },
+        { .txt = "Back", .font = DEFAULT_FONT, .ev_id = BTN_TX_BATCH_EXIT },
+        { .txt = "Outputs", .font = DEFAULT_FONT, .ev_id = BTN_TX_BATCH_OUTPUTS },
+        { .txt = ">", .font = JADE_SYMBOLS_16x16_FONT, .ev_id = BTN_TX_BATCH_NEXT } };
+    add_buttons(vsplit, UI_ROW, btns, 4);
+
+    gui_set_activity_initial_selection(*activity, btns[2].btn);
+}
@@ -658,3 +658,36 @@ void add_boolean_to_map(CborEncoder* container, const char* name, const bool val
     cberr = cbor_encode_boolean(container, value);
     JADE_ASSERT(cberr == CborNoError);
 }
+
+size_t rpc_write_cbor_header(const CborType type, const uint64_t value, uint8_t* buf, const size_t buf_len)
+{
+    JADE_ASSERT(type == CborByteStringType || type == CborTextStringType || type == CborArrayType
+        || type == CborMapType);
+    JADE_ASSERT(buf);
+    JADE_ASSERT(buf_len >= CBOR_HEADER_MAX_LEN);
+
+    // Small values are held in the initial byte, larger values follow it (big-endian) in 1, 2, 4 or 8 bytes
+    if (value < 24) {
+        buf[0] = type | value;
+        return 1;
+    }
+
+    size_t value_len = 8;
+    uint8_t additional = 27;
+    if (value <= UINT8_MAX) {
+        value_len = 1;
+        additional = 24;
+    } else if (value <= UINT16_MAX) {
+        value_len = 2;
+        additional = 25;
+    } else if (value <= UINT32_MAX) {
+        value_len = 4;
+        additional = 26;
+    }
+
+    buf[0] = type | additional;
+    for (size_t i = 0; i < value_len; ++i) {
+        buf[1 + i] = (value >> (8 * (value_len - 1 - i))) & 0xFF;
+    }
+    return 1 + value_len;
+}
@@ -24,6 +24,9 @@
 #define CBOR_RPC_TAG_PARAMS "params"
 #define MAXLEN_ID 16
 
+// Max length of a cbor item header (ie. initial byte + 64bit length/value)
+#define CBOR_HEADER_MAX_LEN 9
+
 // Maximum expected/supported bip32 path length
 // Plenty for green wallets, bip44 etc. with plenty to spare.
 #define MAX_PATH_LEN 16
@@ -70,4 +73,7 @@ void add_string_sized_to_map(CborEncoder* container, const char* name, const cha
 void add_string_array_to_map(CborEncoder* container, const char* name, const char** texts, size_t len);
 void add_bytes_to_map(CborEncoder* container, const char* name, const uint8_t* value, size_t len);
 void add_boolean_to_map(CborEncoder* container, const char* name, bool value);
+
+// Write just the header of a cbor item (eg. a byte-string or array) - the content can then be written in-place
+size_t rpc_write_cbor_header(CborType type, uint64_t value, uint8_t* buf, size_t buf_len);
 #endif /* UTILS_CBOR_RPC_H_ */
@@ -19,7 +19,9 @@
 #include <wally_script.h>
 #include <wally_transaction.h>
 
+#include <freertos/FreeRTOS.h>
 #include <mbedtls/base64.h>
+#include <mbedtls/sha256.h>
 #include <sodium/utils.h>
 
 // Restrictions on GA BIP32 path elements
@@ -1056,26 +1058,143 @@ bool wallet_hmac_with_master_key(const uint8_t* data, const size_t data_len, uin
         == WALLY_OK;
 }
 
-// Return script blinding privkey given master blinding key (slip-0077)
-static bool wallet_get_blinding_privkey(const uint8_t* master_blinding_key, const size_t master_blinding_key_len,
-    const uint8_t* script, const size_t script_len, uint8_t* output, const size_t output_len)
+// Session cache of derived slip-0077 script blinding keys, as the same script's keys
+// are requested several times while building/signing a single transaction.
+// Entries are keyed by sha256(master_blinding_key || script) as multisig registrations
+// carry their own master blinding key.  Wiped by keychain_clear().
+#define BLINDING_KEY_CACHE_SIZE 16
+
+typedef struct {
+    uint8_t id[SHA256_LEN];
+    uint8_t privkey[EC_PRIVATE_KEY_LEN];
+    uint8_t pubkey[EC_PUBLIC_KEY_LEN];
+    bool has_pubkey;
+    uint32_t last_used; // 0 implies slot unused
+} blinding_key_cache_entry_t;
+
+static blinding_key_cache_entry_t blinding_key_cache[BLINDING_KEY_CACHE_SIZE];
+static uint32_t blinding_key_cache_clock = 0;
+static uint32_t blinding_key_cache_hits = 0;
+static uint32_t blinding_key_cache_misses = 0;
+static portMUX_TYPE blinding_key_cache_spinlock = portMUX_INITIALIZER_UNLOCKED;
+
+void wallet_clear_blinding_key_cache(void)
+{
+    taskENTER_CRITICAL(&blinding_key_cache_spinlock);
+    const uint32_t hits = blinding_key_cache_hits;
+    const uint32_t misses = blinding_key_cache_misses;
+    wally_bzero(blinding_key_cache, sizeof(blinding_key_cache));
+    blinding_key_cache_clock = 0;
+    blinding_key_cache_hits = 0;
+    blinding_key_cache_misses = 0;
+    taskEXIT_CRITICAL(&blinding_key_cache_spinlock);
+
+    if (hits || misses) {
+        JADE_LOGI("Blinding key cache cleared - hits: %lu, misses: %lu", hits, misses);
+    }
+}
+
+void wallet_get_blinding_key_cache_stats(uint32_t* hits, uint32_t* misses)
+{
+    JADE_ASSERT(hits);
+    JADE_ASSERT(misses);
+
+    taskENTER_CRITICAL(&blinding_key_cache_spinlock);
+    *hits = blinding_key_cache_hits;
+    *misses = blinding_key_cache_misses;
+    taskEXIT_CRITICAL(&blinding_key_cache_spinlock);
+}
+
+// Fetch the script blinding privkey and (optionally) pubkey from the cache, deriving and
+// caching them if not present.  Either output may be NULL.
+static bool wallet_get_blinding_keys(const uint8_t* master_blinding_key, const size_t master_blinding_key_len,
+    const uint8_t* script, const size_t script_len, uint8_t* privkey, uint8_t* pubkey)
 {
     JADE_ASSERT(master_blinding_key);
     JADE_ASSERT(master_blinding_key_len == HMAC_SHA512_LEN);
     JADE_ASSERT(script);
     JADE_ASSERT(script_len);
-    JADE_ASSERT(output);
-    JADE_ASSERT(output_len == EC_PRIVATE_KEY_LEN);
+    JADE_ASSERT(privkey || pubkey);
+
+    uint8_t id[SHA256_LEN];
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+    mbedtls_sha256_starts(&ctx, 0);
+    mbedtls_sha256_update(&ctx, master_blinding_key, master_blinding_key_len);
+    mbedtls_sha256_update(&ctx, script, script_len);
+    mbedtls_sha256_finish(&ctx, id);
+    mbedtls_sha256_free(&ctx);
+
+    blinding_key_cache_entry_t entry = { 0 };
+    SENSITIVE_PUSH(&entry, sizeof(entry));
+    bool found = false;
 
-    // NOTE: 'master_unblinding_key' passed here as the full output of hmac512, when according to slip-0077
-    // the master unblinding key is only the second half of that - ie. 256 bits
-    // 'wally_asset_blinding_key_to_ec_private_key()' takes this into account...
-    const int wret = wally_asset_blinding_key_to_ec_private_key(
-        master_blinding_key, master_blinding_key_len, script, script_len, output, output_len);
-    if (wret != WALLY_OK) {
-        JADE_LOGE("Error building asset blinding key for script: %d", wret);
-        return false;
+    taskENTER_CRITICAL(&blinding_key_cache_spinlock);
+    for (size_t i = 0; i < BLINDING_KEY_CACHE_SIZE; ++i) {
+        blinding_key_cache_entry_t* const slot = blinding_key_cache + i;
+        if (slot->last_used && !memcmp(slot->id, id, sizeof(id)) && (slot->has_pubkey || !pubkey)) {
+            slot->last_used = ++blinding_key_cache_clock;
+            memcpy(&entry, slot, sizeof(entry));
+            ++blinding_key_cache_hits;
+            found = true;
+            break;
+        }
+    }
+    if (!found) {
+        ++blinding_key_cache_misses;
     }
+    taskEXIT_CRITICAL(&blinding_key_cache_spinlock);
+
+    if (!found) {
+        // NOTE: 'master_unblinding_key' passed here as the full output of hmac512, when according to slip-0077
+        // the master unblinding key is only the second half of that - ie. 256 bits
+        // 'wally_asset_blinding_key_to_ec_private_key()' takes this into account...
+        const int wret = wally_asset_blinding_key_to_ec_private_key(
+            master_blinding_key, master_blinding_key_len, script, script_len, entry.privkey, sizeof(entry.privkey));
+        if (wret != WALLY_OK) {
+            JADE_LOGE("Error building asset blinding key for script: %d", wret);
+            SENSITIVE_POP(&entry);
+            return false;
+        }
+
+        // The pubkey is only computed when first asked for
+        entry.has_pubkey = pubkey != NULL;
+        if (entry.has_pubkey) {
+            JADE_WALLY_VERIFY(wally_ec_public_key_from_private_key(
+                entry.privkey, sizeof(entry.privkey), entry.pubkey, sizeof(entry.pubkey)));
+        }
+        memcpy(entry.id, id, sizeof(id));
+
+        // Store in the matching slot if present (ie. privkey-only entry), else the least recently used
+        taskENTER_CRITICAL(&blinding_key_cache_spinlock);
+        blinding_key_cache_entry_t* slot = blinding_key_cache;
+        for (size_t i = 0; i < BLINDING_KEY_CACHE_SIZE; ++i) {
+            blinding_key_cache_entry_t* const candidate = blinding_key_cache + i;
+            if (candidate->last_used && !memcmp(candidate->id, id, sizeof(id))) {
+                slot = candidate;
+                break;
+            }
+            if (candidate->last_used < slot->last_used) {
+                slot = candidate;
+            }
+        }
+        // Keep any pubkey already cached for this script (if we only computed the privkey)
+        if (!entry.has_pubkey && slot->last_used && !memcmp(slot->id, id, sizeof(id)) && slot->has_pubkey) {
+            memcpy(entry.pubkey, slot->pubkey, sizeof(entry.pubkey));
+            entry.has_pubkey = true;
+        }
+        entry.last_used = ++blinding_key_cache_clock;
+        memcpy(slot, &entry, sizeof(entry));
+        taskEXIT_CRITICAL(&blinding_key_cache_spinlock);
+    }
+
+    if (privkey) {
+        memcpy(privkey, entry.privkey, sizeof(entry.privkey));
+    }
+    if (pubkey) {
+        memcpy(pubkey, entry.pubkey, sizeof(entry.pubkey));
+    }
+    SENSITIVE_POP(&entry);
     return true;
 }
 
@@ -1087,15 +1206,7 @@ bool wallet_get_public_blinding_key(const uint8_t* master_blinding_key, const si
         return false;
     }
 
-    uint8_t privkey[EC_PRIVATE_KEY_LEN];
-    SENSITIVE_PUSH(privkey, sizeof(privkey));
-    const bool ret = wallet_get_blinding_privkey(
-        master_blinding_key, master_blinding_key_len, script, script_len, privkey, sizeof(privkey));
-    if (ret) {
-        JADE_WALLY_VERIFY(wally_ec_public_key_from_private_key(privkey, sizeof(privkey), output, output_len));
-    }
-    SENSITIVE_POP(privkey);
-    return ret;
+    return wallet_get_blinding_keys(master_blinding_key, master_blinding_key_len, script, script_len, NULL, output);
 }
 
 bool wallet_get_blinding_factor(const uint8_t* master_blinding_key, const size_t master_blinding_key_len,
@@ -1134,8 +1245,8 @@ bool wallet_get_shared_blinding_nonce(const uint8_t* master_blinding_key, const
     uint8_t ecdh_output[SHA256_LEN];
     uint8_t privkey[EC_PRIVATE_KEY_LEN];
     SENSITIVE_PUSH(privkey, sizeof(privkey));
-    if (!wallet_get_blinding_privkey(
-            master_blinding_key, master_blinding_key_len, script, script_len, privkey, sizeof(privkey))) {
+    if (!wallet_get_blinding_keys(
+            master_blinding_key, master_blinding_key_len, script, script_len, privkey, output_pubkey)) {
         SENSITIVE_POP(privkey);
         return false;
     }
@@ -1151,12 +1262,6 @@ bool wallet_get_shared_blinding_nonce(const uint8_t* master_blinding_key, const
     // Shared blinding nonce is the hash of this ecdh result
     JADE_WALLY_VERIFY(wally_sha256(ecdh_output, sizeof(ecdh_output), output_nonce, output_nonce_len));
 
-    // Caller may also want our public blinding key
-    if (output_pubkey) {
-        JADE_WALLY_VERIFY(
-            wally_ec_public_key_from_private_key(privkey, sizeof(privkey), output_pubkey, output_pubkey_len));
-    }
-
     SENSITIVE_POP(privkey);
     return true;
 }
@@ -80,6 +80,8 @@ bool wallet_sign_tx_input_hash(const uint8_t* signature_hash, size_t signature_h
     size_t* written);
 
 bool wallet_hmac_with_master_key(const uint8_t* data, size_t data_len, uint8_t* output, size_t output_len);
+void wallet_clear_blinding_key_cache(void);
+void wallet_get_blinding_key_cache_stats(uint32_t* hits, uint32_t* misses);
 bool wallet_get_public_blinding_key(const uint8_t* master_blinding_key, size_t master_blinding_key_len,
     const uint8_t* script, size_t script_len, uint8_t* output, size_t output_len);
 bool wallet_get_shared_blinding_nonce(const uint8_t* master_blinding_key, size_t master_blinding_key_len,
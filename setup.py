@@ -12,8 +12,7 @@ setup(
     ],
     extras_require={
         'ble': [
-            'bleak==0.13.0',
-            'aioitertools==0.8.0'
+            'bleak==0.13.0'
         ],
         'requests': [
             'requests>=2.26.0,<3.0.0'
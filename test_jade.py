@@ -6,6 +6,7 @@ import copy
 import json
 import base64
 import random
+import socket
 import logging
 import argparse
 import subprocess
@@ -14,6 +15,7 @@ import _thread
 
 from pinserver.server import PINServerECDH
 from pinserver.pindb import PINDb
+from local_pinserver import LocalPinServer
 import wallycore as wally
 from jadepy.jade import JadeAPI, JadeError
 
@@ -154,7 +156,7 @@ PINSERVER_DEFAULT_URL = "https://jadepin.blockstream.com"
 PINSERVER_DEFAULT_ONION = "http://mrrxtq6tjpbnbm7vh5jt6mpjctn7ggyfy5wegvbeff3x7jrznqawlmid.onion"
 
 # The number of values expected back in version info
-NUM_VALUES_VERINFO = 19
+NUM_VALUES_VERINFO = 20
 
 TEST_MNEMONIC = 'fish inner face ginger orchard permit useful method fence \
 kidney chuckle party favorite sunset draw limb science crane oval letter \
@@ -389,12 +391,14 @@ SIGN_MSG_TESTS = "msg_*.json"
 SIGN_MSG_FILE_TESTS = "msgfile_*.json"
 SIGN_IDENTITY_TESTS = "identity_*.json"
 SIGN_TXN_TESTS = "txn_*.json"
+SIGN_TXN_LARGE_INPUTS_TEST = "txn_large.json"
 SIGN_TXN_FAIL_CASES = "badtxn_*.json"
 SIGN_LIQUID_TXN_TESTS = "liquid_txn_*.json"
 SIGN_TXN_SINGLE_SIG_TESTS = "singlesig_txn*.json"
 SIGN_LIQUID_TXN_SINGLE_SIG_TESTS = "singlesig_liquid_txn*.json"
 SIGN_PSBT_TESTS = "psbt_tm_*.json"
 SIGN_PSBT_SS_TESTS = "psbt_ss_*.json"
+SIGN_PSBT_LARGE_TESTS = "psbt_tm_multisig_segwit_many_inputs*.json"
 
 TEST_SCRIPT = h2b('76a9145f4fcd4a757c2abf6a0691f59dffae18852bbd7388ac')
 
@@ -611,6 +615,25 @@ def test_random_bytes(jade):
     assert reply['result'] is True
 
 
+# Log the host-to-device upload throughput of the interface, timing round trips of
+# large (but unknown-method) messages, which are only rejected once fully received.
+def test_upload_throughput(jade, isble, count=4):
+    payload = os.urandom(12 * 1024)  # fits a non-psram input buffer
+    total_len = 0
+    start = time.monotonic()
+    for i in range(count):
+        msgid = 'upload{}'.format(i)
+        request = jade.build_request(msgid, 'upload', {'data': payload})
+        total_len += len(cbor.dumps(request))
+        reply = jade.make_rpc_call(request)
+        assert reply['id'] == msgid
+        assert reply['error']['code'] == JadeError.UNKNOWN_METHOD
+    elapsed = time.monotonic() - start
+
+    logger.info("Upload throughput ({}) - {} bytes in {:.2f}s - {:.1f} kB/s".format(
+        'ble' if isble else 'serial', total_len, elapsed, total_len / elapsed / 1024))
+
+
 def test_too_much_input(jade, has_psram):
     noise = 'long'.encode()   # 4b
     cacophony = noise * 4096  # 16k
@@ -681,6 +704,44 @@ def test_too_much_input(jade, has_psram):
     assert reply['result'] is True
 
 
+def test_qemu_tcp_transport(jade, iterations=50):
+    # Round-trip latency of small rpcs - dominated by the transport
+    timings = []
+    for i in range(iterations):
+        start = time.monotonic()
+        reply = jade.make_rpc_call(jade.build_request(f'lat{i}', 'add_entropy',
+                                                      {'entropy': 'noise'.encode()}))
+        timings.append(time.monotonic() - start)
+        assert reply['result'] is True
+    logger.info('qemu tcp small rpc round-trip: min {:.1f}ms, mean {:.1f}ms, max {:.1f}ms'
+                .format(min(timings) * 1000, sum(timings) * 1000 / len(timings),
+                        max(timings) * 1000))
+
+    # The log port receives a copy of everything written to the data connection
+    host, port = jade.impl.device[len('tcp:'):].split(':')
+    with socket.create_connection((host, int(port) + 1), timeout=10) as logsock:
+        time.sleep(0.5)  # let the device accept the connection
+        reply = jade.make_rpc_call(jade.build_request('observed', 'add_entropy',
+                                                      {'entropy': 'noise'.encode()}))
+        assert reply['result'] is True
+
+        stream = logsock.makefile('rb')
+        while True:
+            message = cbor.load(stream)
+            if message.get('id') == 'observed':
+                assert message['result'] is True
+                break
+
+    # Reconnect immediately, and time the first rpc on the new connection
+    start = time.monotonic()
+    jade.disconnect()
+    jade.connect()
+    reply = jade.make_rpc_call(jade.build_request('reconnect', 'add_entropy',
+                                                  {'entropy': 'noise'.encode()}))
+    assert reply['result'] is True
+    logger.info('qemu tcp reconnect and rpc: {:.1f}ms'.format((time.monotonic() - start) * 1000))
+
+
 def test_split_message(jade):
     # Simulate transport stream being v.slow
     msg = cbor.dumps({'method': 'get_version_info', 'id': '24680'})
@@ -829,6 +890,16 @@ epTxUQUB5kM5nxkEtr2SNic6PJLPubcGMR6S2fmDZTzL9dHpU7ka",
                    'valid epoch value'),
                   (('badauth7', 'auth_user', {'network': 'testnet', 'epoch': 12345.6789}),
                    'valid epoch value'),
+                  (('badauth8', 'auth_user', {'network': 'testnet', 'wallet': 'notawallet'}),
+                   'valid wallet name'),
+                  (('badauth9', 'auth_user', {'network': 'testnet', 'wallet': 'bad name'}),
+                   'valid wallet name'),
+
+                  # Wallet management requires the hw be unlocked with the PIN, not 'set_mnemonic'
+                  (('badwallet1', 'get_wallets'), 'unlocked with the PIN'),
+                  (('badwallet2', 'select_wallet', {'name': 'main'}), 'unlocked with the PIN'),
+                  (('badwallet3', 'add_wallet', {'name': 'second'}), 'unlocked with the PIN'),
+                  (('badwallet4', 'erase_wallet', {'name': 'second'}), 'unlocked with the PIN'),
 
                   (('badpin1', 'update_pinserver'), 'Expecting parameters map'),
                   (('badpin2', 'update_pinserver',
@@ -1776,7 +1847,8 @@ def test_scan_qr(jadeapi):
         with open('./test_data/' + image_filename, 'rb') as f:
             image_data = f.read()
 
-        rslt = jadeapi.scan_qr(image_data)
+        # Higher resolution images are replayed as the camera would capture them (incl. any zoom)
+        rslt = jadeapi.scan_qr(image_data, qr_data['input'].get('width'))
         assert rslt
 
         if expected.get("text") is not None:
@@ -1940,6 +2012,111 @@ def test_handshake(jade):
     assert reply2['result'] is True
 
 
+# Single round-trip pinserver protocol test - again coupled to the test handler
+# in main/process/debug_handshake.c (which runs 'set pin' then 'get pin').
+# Uses the local reference pinserver, which advertises the single round-trip
+# variant in its 'start_handshake' reply.
+def test_handshake_oneshot(jade):
+    TEST_URL = 'https://this.is.a.test.url.com'
+    TEST_ONION = 'http://we.dont.know.our.onion.but.this.string.is.about.the.right.size'
+    with open(PINSERVER_TEST_PUBKEY_FILE, 'rb') as f:
+        pubkey = f.read()
+
+    # Updating the pinserver details resets whether it is known to support the
+    # single round-trip protocol - so the first interaction is the usual handshake
+    msg = jade.build_request('dbg_pnsvr1', 'update_pinserver',
+                             {'urlA': TEST_URL, 'urlB': TEST_ONION, 'pubkey': pubkey})
+    reply = jade.make_rpc_call(msg)
+    assert reply['result'] is True
+
+    def _get_http_request(reply, expected_on_reply, expected_document):
+        result = reply['result']
+        assert list(result.keys()) == ['http_request'], result.keys()
+        http_request = result['http_request']
+        assert http_request['on-reply'] == expected_on_reply, http_request['on-reply']
+        urls = http_request['params']['urls']
+        assert urls == [TEST_URL + '/' + expected_document, TEST_ONION + '/' + expected_document]
+        return http_request['params']['data']
+
+    def _post_to_server(server, msgid, method, document, data):
+        params = server.handle(document, data)
+        msg = jade.build_request(msgid, method, params)
+        return jade.make_rpc_call(msg)
+
+    # A: two-step 'set pin' - server advertises the single round-trip protocol
+    server = LocalPinServer()
+    reply = jade.make_rpc_call(jade.build_request('oneshotA1', 'debug_handshake'))
+    _get_http_request(reply, 'handshake_init', 'start_handshake')
+
+    reply = _post_to_server(server, 'oneshotA2', 'handshake_init', 'start_handshake', None)
+    data = _get_http_request(reply, 'handshake_complete', 'set_pin')
+    assert 'ske' in data
+
+    reply = _post_to_server(server, 'oneshotA3', 'handshake_complete', 'set_pin', data)
+    assert reply['result'] is True
+
+    # B: 'get pin' now uses the single round-trip protocol - no handshake_init
+    reply = jade.make_rpc_call(jade.build_request('oneshotB1', 'debug_handshake'))
+    data = _get_http_request(reply, 'handshake_complete', 'get_pin_oneshot')
+    assert sorted(data.keys()) == ['cke', 'encrypted_data', 'hmac_encrypted_data'], data.keys()
+
+    reply = _post_to_server(server, 'oneshotB2', 'handshake_complete', 'get_pin_oneshot', data)
+    assert reply['result'] is True  # hw test handler checks the keys match
+
+    # Server rejects replayed requests
+    try:
+        server.handle('get_pin_oneshot', data)
+        assert False, 'Expected replayed request to be rejected'
+    except ValueError:
+        pass
+
+    # C: server stops supporting the single round-trip protocol - the client
+    # falls back to the two-step handshake, and stops trying the single round-trip
+    legacy_server = LocalPinServer(offer_oneshot=False)
+    reply = jade.make_rpc_call(jade.build_request('oneshotC1', 'debug_handshake'))
+    _get_http_request(reply, 'handshake_complete', 'set_pin_oneshot')
+
+    # No parameters - ie. the server does not have the endpoint (http 404/405)
+    reply = jade.make_rpc_call(jade.build_request('oneshotC2', 'handshake_complete'))
+    _get_http_request(reply, 'handshake_init', 'start_handshake')
+
+    reply = _post_to_server(legacy_server, 'oneshotC3', 'handshake_init', 'start_handshake', None)
+    data = _get_http_request(reply, 'handshake_complete', 'set_pin')
+
+    reply = _post_to_server(legacy_server, 'oneshotC4', 'handshake_complete', 'set_pin', data)
+    assert reply['result'] is True
+
+    # D: 'get pin' uses the two-step handshake again
+    reply = jade.make_rpc_call(jade.build_request('oneshotD1', 'debug_handshake'))
+    _get_http_request(reply, 'handshake_init', 'start_handshake')
+
+    reply = _post_to_server(legacy_server, 'oneshotD2', 'handshake_init', 'start_handshake', None)
+    data = _get_http_request(reply, 'handshake_complete', 'get_pin')
+
+    reply = _post_to_server(legacy_server, 'oneshotD3', 'handshake_complete', 'get_pin', data)
+    assert reply['result'] is True
+
+    # E: single round-trip request processed by the server, but the reply is bad - the
+    # pin attempt may have been counted, so the client must not repeat it via the handshake
+    reply = jade.make_rpc_call(jade.build_request('oneshotE1', 'debug_handshake'))
+    _get_http_request(reply, 'handshake_init', 'start_handshake')
+
+    reply = _post_to_server(server, 'oneshotE2', 'handshake_init', 'start_handshake', None)
+    data = _get_http_request(reply, 'handshake_complete', 'set_pin')
+
+    reply = _post_to_server(server, 'oneshotE3', 'handshake_complete', 'set_pin', data)
+    assert reply['result'] is True
+
+    reply = jade.make_rpc_call(jade.build_request('oneshotE4', 'debug_handshake'))
+    data = _get_http_request(reply, 'handshake_complete', 'get_pin_oneshot')
+
+    params = server.handle('get_pin_oneshot', data)
+    params['hmac'] = ('0' if params['hmac'][0] != '0' else '1') + params['hmac'][1:]
+    reply = jade.make_rpc_call(jade.build_request('oneshotE5', 'handshake_complete', params))
+    assert 'result' not in reply
+    assert reply['error']['code'] == JadeError.BAD_PARAMETERS
+
+
 # Pinserver handshake test - set the hww back to the default/production
 # authentication data - this should then fail with 'bad-sig' when we sign
 # with the test pinserver details.
@@ -2004,6 +2181,38 @@ def check_mem_stats(startinfo, endinfo, check_frag=True, strict=True):
         assert not strict
 
 
+# Log the per-task and per-message stack usage measured by the hw, and check
+# every task has retained some headroom.  See also jade_tasks.h stack sizes.
+def check_stack_usage(jadeapi, min_headroom=512):
+    usage = jadeapi.get_stack_usage()
+
+    breaches = []
+    for task, info in sorted(usage['tasks'].items()):
+        used = info['stack_size'] - info['min_free']
+        msg = "{} stack - {} of {} used ({} free) peak at '{}'".format(
+            task, used, info['stack_size'], info['min_free'], info['peak_method'])
+        if info['min_free'] < min_headroom:
+            logger.warning(msg + " BREACH")
+            breaches.append(task)
+        else:
+            logger.info(msg)
+
+    for method, used in sorted(usage['methods'].items(), key=lambda item: -item[1]):
+        logger.info("main stack used by {} - {}".format(method, used))
+
+    if breaches:
+        logger.error("Stack headroom breaches: {}".format(breaches))
+        assert False
+
+
+# Log the confirmation-to-last-signature latency measured by the hw.
+def check_signing_latency(jadeapi):
+    latency = jadeapi.get_signing_latency()
+    logger.info("Signing latency - last {}ms, max {}ms over {} signings".format(
+        latency['last_ms'], latency['max_ms'], latency['count']))
+    assert latency['last_ms'] <= latency['max_ms']
+
+
 # Helper to verify a signature - handles checking an Anti-Exfil signature
 # contains the entropy that was passed in by the host.
 def _verify_signature(jadeapi, network, msghash, path, host_entropy, signer_commitment, signature):
@@ -2223,6 +2432,42 @@ def test_sign_tx_error_cases(jadeapi, pattern):
             logger.debug(jadeapi.jade.read_response())
 
 
+def test_sign_tx_large_input_txs_timing(jadeapi, iterations=5):
+    # Time signing a txn whose inputs carry large prior transactions - dominated by
+    # prior-txid hashing, sighash computation and signing (rfc6979) - ie. the paths
+    # which reserve the hw sha engine.  Runs idle, and again with a competing hash load
+    # on the hw's other core.  Device logs the sha engine stats for each reservation.
+    txn_data = next(_get_test_cases(SIGN_TXN_LARGE_INPUTS_TEST))
+    inputdata = txn_data['input']
+    input_txs_len = sum(len(txinput.get('input_tx', b'')) for txinput in inputdata['inputs'])
+
+    def _time_sign_tx(load):
+        timings = []
+        for _ in range(iterations):
+            start = time.monotonic()
+            rslt = jadeapi.sign_tx(inputdata['network'],
+                                   inputdata['txn'],
+                                   inputdata['inputs'],
+                                   inputdata['change'],
+                                   inputdata.get('use_ae_signatures'))
+            timings.append(time.monotonic() - start)
+            _check_tx_signatures(jadeapi, txn_data, rslt)
+
+        mean = sum(timings) / len(timings)
+        logger.info('sign_tx with {} inputs ({} bytes prior txns), {}: '
+                    'min {:.3f}s, mean {:.3f}s, max {:.3f}s'
+                    .format(len(inputdata['inputs']), input_txs_len, load,
+                            min(timings), mean, max(timings)))
+
+    _time_sign_tx('idle')
+
+    assert jadeapi.set_sha_load(True) is True
+    try:
+        _time_sign_tx('competing hash load')
+    finally:
+        assert jadeapi.set_sha_load(False) is True
+
+
 def test_liquid_blinding_keys(jadeapi):
     # Get Liquid master blinding key
     rslt = jadeapi.get_master_blinding_key()
@@ -2332,6 +2577,111 @@ def test_sign_psbt(jadeapi, cases):
             assert txn == expected_txn, wally.hex_from_bytes(txn)
 
 
+# Sign the largest psbts with the default, and then with a negotiated larger, max reply size.
+# Logs the time taken and number of reply messages needed for each.
+def test_sign_psbt_reply_size(jadeapi, max_reply_size=256 * 1024):
+    info = jadeapi.get_version_info()
+    has_psram = info['JADE_FREE_SPIRAM'] > 0
+
+    # Count the reply messages read
+    nreplies = 0
+    read_response = jadeapi.jade.read_response
+
+    def _counting_read_response(*args, **kwargs):
+        nonlocal nreplies
+        nreplies += 1
+        return read_response(*args, **kwargs)
+
+    default_size = jadeapi.set_max_reply_size(0)
+    assert default_size > 0
+
+    jadeapi.jade.read_response = _counting_read_response
+    try:
+        results = {}
+        for requested in [0, max_reply_size]:
+            granted = jadeapi.set_max_reply_size(requested)
+            assert granted == default_size if not requested or not has_psram else \
+                default_size < granted <= requested
+
+            nreplies = 0
+            start_time = time.monotonic()
+            for txn_data in _get_test_cases(SIGN_PSBT_LARGE_TESTS):
+                rslt = jadeapi.sign_psbt(txn_data['input']['network'], txn_data['input']['psbt'])
+                assert rslt == txn_data['expected_output']['psbt']
+            elapsed = time.monotonic() - start_time
+            results[granted] = nreplies
+            logger.info('sign_psbt with max reply size {}: {} replies in {:.3f}s'.format(
+                granted, results[granted], elapsed))
+
+        # Any larger reply size is only for the logged-in session - reset on logout
+        assert jadeapi.logout() is True
+        assert jadeapi.set_mnemonic(TEST_MNEMONIC) is True
+        nreplies = 0
+        for txn_data in _get_test_cases(SIGN_PSBT_LARGE_TESTS):
+            rslt = jadeapi.sign_psbt(txn_data['input']['network'], txn_data['input']['psbt'])
+            assert rslt == txn_data['expected_output']['psbt']
+        assert nreplies == results[default_size]
+    finally:
+        jadeapi.jade.read_response = read_response
+        jadeapi.set_max_reply_size(0)
+
+    # A larger reply size should need fewer replies
+    if has_psram:
+        assert results[max(results)] < results[default_size]
+
+
+# Sign the psbts one at a time, and then in batches (per network, bounded by the max message
+# size), checking the results match and logging the throughput of each.
+def test_sign_psbts_batch(jadeapi, cases):
+    info = jadeapi.get_version_info()
+    max_batch_bytes = (256 * 1024) if info['JADE_FREE_SPIRAM'] > 0 else (15 * 1024)
+    max_batch_psbts = 32
+
+    txns = list(_get_test_cases(cases))
+    assert txns
+
+    # One at a time
+    start_time = time.monotonic()
+    for txn_data in txns:
+        rslt = jadeapi.sign_psbt(txn_data['input']['network'], txn_data['input']['psbt'])
+        assert rslt == txn_data['expected_output']['psbt']
+    single_elapsed = time.monotonic() - start_time
+
+    # Batched per network
+    batches = []
+    for network in sorted(set(txn_data['input']['network'] for txn_data in txns)):
+        batch, batch_bytes = [], 0
+        for txn_data in (t for t in txns if t['input']['network'] == network):
+            psbt_len = len(txn_data['input']['psbt'])
+            full = len(batch) == max_batch_psbts or batch_bytes + psbt_len > max_batch_bytes
+            if batch and full:
+                batches.append((network, batch))
+                batch, batch_bytes = [], 0
+            batch.append(txn_data)
+            batch_bytes += psbt_len
+        if batch:
+            batches.append((network, batch))
+
+    start_time = time.monotonic()
+    for network, batch in batches:
+        rslt = jadeapi.sign_psbts(network, [txn_data['input']['psbt'] for txn_data in batch])
+        assert rslt == [txn_data['expected_output']['psbt'] for txn_data in batch]
+    batch_elapsed = time.monotonic() - start_time
+
+    logger.info('sign_psbt: {} psbts in {:.3f}s ({:.1f}/min)'.format(
+        len(txns), single_elapsed, 60 * len(txns) / single_elapsed))
+    logger.info('sign_psbts: {} psbts in {} batches in {:.3f}s ({:.1f}/min)'.format(
+        len(txns), len(batches), batch_elapsed, 60 * len(txns) / batch_elapsed))
+
+    # Bad batches
+    for psbts in [[], [b'not a psbt'], [b'psbt'] * (max_batch_psbts + 1)]:
+        try:
+            jadeapi.sign_psbts(txns[0]['input']['network'], psbts)
+            assert False, "Expected sign_psbts to fail"
+        except JadeError as e:
+            assert e.code == JadeError.BAD_PARAMETERS
+
+
 # Helper to check a multisig registration
 def _check_multisig_registration(jadeapi, multisig_data):
     # Register the multisig
@@ -2407,6 +2757,59 @@ def test_generic_multisig_registration(jadeapi):
         _check_multisig_registration(jadeapi, multisig_data)
 
 
+def test_multisig_registration_paging(jadeapi):
+    # Register more multisigs than fit in the first pages/unpaged reply - enough to guarantee the
+    # index has more pages than the unpaged reply, whatever was registered before.
+    PAGE_SIZE, UNPAGED_PAGES = 8, 2
+    existing = set(jadeapi.get_registered_multisigs().keys())
+    num_to_register = 4
+    unpaged_max = UNPAGED_PAGES * PAGE_SIZE
+    while len(existing | {f'paging_{i}' for i in range(num_to_register)}) <= unpaged_max:
+        num_to_register += 1
+
+    testcase = json.load(open('./test_data/multisig_reg_1of1.json'))
+    multisig_data = testcase['input']
+    descriptor = multisig_data['descriptor']
+    for i in range(num_to_register):
+        rslt = jadeapi.register_multisig(multisig_data['network'], f'paging_{i}',
+                                         descriptor['variant'], descriptor['sorted'],
+                                         descriptor['threshold'], descriptor['signers'])
+        assert rslt is True
+
+    # Paged listing (as used by get_registered_multisigs()) returns them all
+    all_multisigs = jadeapi.get_registered_multisigs()
+    assert all(f'paging_{i}' in all_multisigs for i in range(num_to_register))
+
+    first_page = jadeapi.get_registered_multisigs_page(0)
+    assert first_page['page'] == 0
+    num_pages = first_page['num_pages']
+    assert num_pages > UNPAGED_PAGES
+
+    multisigs = {}
+    for page in range(num_pages):
+        rslt = jadeapi.get_registered_multisigs_page(page)
+        assert rslt['page'] == page and rslt['num_pages'] == num_pages
+        assert not multisigs.keys() & rslt['multisigs'].keys()
+        multisigs.update(rslt['multisigs'])
+    assert multisigs == all_multisigs
+
+    # Pages beyond the end are empty
+    rslt = jadeapi.get_registered_multisigs_page(num_pages)
+    assert rslt['multisigs'] == {}
+
+    # Unpaged request returns up to the first 16 only
+    rslt = jadeapi._jadeRpc('get_registered_multisigs')
+    assert len(rslt) <= 16
+    assert rslt.items() <= all_multisigs.items()
+
+    # Registered multisigs still usable (ie. found via the index)
+    address_test = testcase['address_tests'][0]
+    for i in range(num_to_register):
+        rslt = jadeapi.get_receive_address(multisig_data['network'], address_test['paths'],
+                                           multisig_name=f'paging_{i}')
+        assert rslt == address_test['expected_address']
+
+
 def test_generic_multisig_files(jadeapi):
     # Check these multisig files load ok
     for multisig_file_test in _get_test_cases(MULTI_REG_FILE_TESTS):
@@ -2775,6 +3178,216 @@ NBVGY3TQOJQGEZDGNBVGY3TQOJQGEZDGNA&digits=8&algorithm=SHA512'
         assert rslt == expected
 
 
+def test_selfcheck(jadeapi, qemu):
+    # Sanity check selfcheck time on Jade hw (skip for qemu)
+    # May need updating if more tests added to selfcheck.c
+    time_ms = jadeapi.run_remote_selfcheck()
+    logger.info('selfcheck time: ' + str(time_ms) + 'ms')
+    assert qemu or time_ms < 82500
+
+
+def _too_much_input(jadeapi):
+    has_psram = jadeapi.get_version_info()['JADE_FREE_SPIRAM'] > 0
+    logger.info("Buffer overflow test - PSRAM: {}".format(has_psram))
+    test_too_much_input(jadeapi.jade, has_psram)
+
+
+def _logout(jadeapi):
+    assert jadeapi.get_version_info()['JADE_STATE'] == 'READY'
+    jadeapi.logout()
+    assert jadeapi.get_version_info()['JADE_STATE'] in ['LOCKED', 'UNINIT']
+    assert jadeapi.set_mnemonic(TEST_MNEMONIC) is True
+    assert jadeapi.get_version_info()['JADE_STATE'] == 'READY'
+
+
+def _set_mnemonic(mnemonic):
+    def _fn(jadeapi):
+        assert jadeapi.set_mnemonic(mnemonic) is True
+    return _fn
+
+
+def _set_seed(seed):
+    def _fn(jadeapi):
+        assert jadeapi.set_seed(bytes.fromhex(seed)) is True
+    return _fn
+
+
+def _iface(test):
+    # Low-level tests take the JadeInterface rather than the JadeAPI
+    return lambda jadeapi: test(jadeapi.jade)
+
+
+def _iram_benchmark(jadeapi):
+    # Time the candidate IRAM placement routines with warm and cold flash cache
+    iram_bench = jadeapi.run_iram_benchmark()
+    logger.info('iram benchmark')
+    for name, result in iram_bench.items():
+        assert result['warm_cycles'] > 0 and result['cold_cycles'] > 0
+        logger.info(f'  {name}: warm {result["warm_cycles"]}, cold {result["cold_cycles"]}')
+
+
+def _qemu_tcp_transport(jadeapi):
+    # Transport latency, log observer and reconnect - only when connected to qemu over tcp
+    if getattr(jadeapi.jade.impl, 'device', '').startswith('tcp:'):
+        test_qemu_tcp_transport(jadeapi.jade)
+
+
+def _scan_qr(jadeapi):
+    # QR scan/camera tests only on proper Jade hw
+    if jadeapi.get_version_info()['BOARD_TYPE'] in ['JADE', 'JADE_V1.1']:
+        test_scan_qr(jadeapi)
+
+
+# The tests are registered as (groups, test name, function taking a JadeAPI), in the order they are
+# run over one connection (see run_tests()) - where a test may rely on state left by earlier ones.
+# Each test is tagged with the group(s) it belongs to.  A group starts from a device unlocked with
+# TEST_MNEMONIC and only depends on state set up within the group (eg. multisig registrations), so
+# the groups can also be run independently (eg. by test_jade_parallel.py, see get_test_groups()).
+# Steps which set up state (eg. setting a seed) are tagged with every group which relies on them.
+# Tests specific to the device or transport (eg. qr scan, qemu tcp) have no group, so are only run
+# over the one connection.
+def interface_tests(qemu, isble, smoke=True, negative=True, iram_benchmark=False):
+    tests = []
+    if smoke:
+        tests.append((('selfcheck',), 'selfcheck', lambda j: test_selfcheck(j, qemu)))
+        if iram_benchmark:
+            tests.append(((), 'iram_benchmark', _iram_benchmark))
+        if qemu:
+            tests.append(((), 'qemu_tcp_transport', _qemu_tcp_transport))
+
+        # Test good pinserver handshake, and also 'bad sig' pinserver
+        tests += [
+            (('handshake',), 'handshake', _iface(test_handshake)),
+            (('handshake',), 'handshake_oneshot', _iface(test_handshake_oneshot)),
+            (('handshake',), 'handshake_bad_sig', _iface(test_handshake_bad_sig))
+        ]
+
+        # Test importing mnemonic words eg. from qr scan, and mnemonic-with-passphrase
+        tests += [
+            (('mnemonic_import',), 'mnemonic_import', _iface(test_mnemonic_import)),
+            (('mnemonic_import',), 'mnemonic_import_bad', _iface(test_mnemonic_import_bad)),
+            (('mnemonic_import',), 'passphrase', _iface(test_passphrase))
+        ]
+
+        # Only run QR scan/camera tests a) over serial, and b) on proper Jade hw
+        if not qemu and not isble:
+            tests.append(((), 'scan_qr', _scan_qr))
+
+    tests.append(((), 'upload_throughput', lambda j: test_upload_throughput(j.jade, isble)))
+
+    # Too much input test - sends a lot of data so only run
+    # if not running over BLE (as would take a long time)
+    if not isble:
+        tests.append((('too_much_input',), 'too_much_input', _too_much_input))
+
+    if negative:
+        tests += [(('negative',), name, _iface(test)) for name, test in [
+            ('random_bytes', test_random_bytes),
+            ('very_bad_message', test_very_bad_message),
+            ('bad_message', test_bad_message),
+            ('split_message', test_split_message),
+            ('concatenated_messages', test_concatenated_messages),
+            ('unknown_method', test_unknown_method),
+            ('unexpected_method', test_unexpected_method),
+            ('bad_params', test_bad_params),
+            ('bad_params_liquid', test_bad_params_liquid)
+        ]]
+    return tests
+
+
+def api_tests():
+    return [
+        # Logout, update pinserver details, get (receive) green-addresses, get-xpub,
+        # and sign-message
+        (('basic',), 'logout', _logout),
+        (('basic',), 'set_pinserver', test_set_pinserver),
+        (('basic',), 'get_greenaddress_receive_address', test_get_greenaddress_receive_address),
+        (('basic',), 'get_xpubs', test_get_xpubs),
+        (('basic',), 'sign_message', test_sign_message),
+        (('basic',), 'sign_message_file', test_sign_message_file),
+
+        # Sign Tx - includes some failure cases
+        (('sign_tx',), 'sign_tx', lambda j: test_sign_tx(j, SIGN_TXN_TESTS)),
+        (('sign_tx',), 'sign_tx_error_cases',
+         lambda j: test_sign_tx_error_cases(j, SIGN_TXN_FAIL_CASES)),
+        (('sign_tx',), 'sign_tx_large_input_txs', test_sign_tx_large_input_txs_timing),
+
+        # Test liuid blinding keys/nonce, blinded commitments and sign-tx
+        (('liquid',), 'liquid_blinding_keys', test_liquid_blinding_keys),
+        (('liquid',), 'liquid_blinded_commitments', test_liquid_blinded_commitments),
+        (('liquid',), 'sign_liquid_tx', lambda j: test_sign_liquid_tx(j, SIGN_LIQUID_TXN_TESTS)),
+
+        # Test sign psbts (app-generated cases)
+        (('sign_psbt',), 'sign_psbt', lambda j: test_sign_psbt(j, SIGN_PSBT_TESTS)),
+        (('sign_psbt',), 'sign_psbt_reply_size', test_sign_psbt_reply_size),
+        (('sign_psbt',), 'sign_psbts_batch', lambda j: test_sign_psbts_batch(j, SIGN_PSBT_TESTS)),
+
+        # Test generic multisig
+        (('multisig',), 'generic_multisig_registration', test_generic_multisig_registration),
+        (('multisig',), 'generic_multisig_matches_ga_addresses',
+         test_generic_multisig_matches_ga_addresses),
+        (('multisig',), 'generic_multisig_matches_ga_signatures',
+         test_generic_multisig_matches_ga_signatures),
+        (('multisig',), 'generic_multisig_matches_ga_signatures_liquid',
+         test_generic_multisig_matches_ga_signatures_liquid),
+        (('multisig',), 'generic_multisig_files', test_generic_multisig_files),
+        (('multisig',), 'multisig_registration_paging', test_multisig_registration_paging),
+
+        # Short sanity-test of 12-word mnemonic
+        (('basic',), '12word_mnemonic', test_12word_mnemonic),
+
+        # Sign single sig (and psbts - HWI-generated cases)
+        # Single sig requires a different seed for the tests
+        (('single_sig', 'multisig'), 'set_seed_single_sig', _set_seed(TEST_SEED_SINGLE_SIG)),
+        (('single_sig',), 'get_singlesig_receive_address', test_get_singlesig_receive_address),
+        (('single_sig',), 'sign_tx_single_sig',
+         lambda j: test_sign_tx(j, SIGN_TXN_SINGLE_SIG_TESTS)),
+        (('single_sig',), 'sign_liquid_tx_single_sig',
+         lambda j: test_sign_liquid_tx(j, SIGN_LIQUID_TXN_SINGLE_SIG_TESTS)),
+        (('single_sig',), 'sign_psbt_single_sig', lambda j: test_sign_psbt(j, SIGN_PSBT_SS_TESTS)),
+
+        # Test the generic multisigs again, using a second signer
+        # NOTE: these tests assume 'test_generic_multisig_registration()' test
+        # has already been run, to register the multisigs for the test mnemonic signer
+        (('multisig',), 'generic_multisig_ss_signer', test_generic_multisig_ss_signer),
+
+        # Sign identity (ssh & gpg) tests require a specific mnemonic
+        (('identity_otp',), 'set_mnemonic_identity', _set_mnemonic(TEST_MNEMONIC_12_IDENTITY)),
+        (('identity_otp',), 'sign_identity', test_sign_identity),
+
+        # Test OTP (hotp and totp)
+        # (These don't depend on the wallet/mnemonic, just that the hw is unlocked)
+        (('identity_otp',), 'hotp', test_hotp),
+        (('identity_otp',), 'totp', test_totp),
+        (('identity_otp',), 'totp_ex', test_totp_ex)
+    ]
+
+
+# The independent groups of (test name, function taking a JadeAPI) derived from the registered
+# tests, each in the order the tests are run over one connection.
+def get_test_groups(tests):
+    groups = {}
+    for test_groups, name, test in tests:
+        for group in test_groups:
+            groups.setdefault(group, []).append((name, test))
+    return groups
+
+
+def interface_test_groups(qemu, isble, smoke=True, negative=True):
+    return get_test_groups(interface_tests(qemu, isble, smoke=smoke, negative=negative))
+
+
+def api_test_groups():
+    return get_test_groups(api_tests())
+
+
+# Run the registered tests in order over one connection
+def run_tests(jadeapi, tests):
+    for _, name, test in tests:
+        logger.info(f'Test: {name}')
+        test(jadeapi)
+
+
 def run_api_tests(jadeapi, isble, qemu, authuser=False):
 
     rslt = jadeapi.clean_reset()
@@ -2810,72 +3423,7 @@ def run_api_tests(jadeapi, isble, qemu, authuser=False):
     has_psram = startinfo['JADE_FREE_SPIRAM'] > 0
     has_ble = startinfo['JADE_CONFIG'] == 'BLE'
 
-    # Test logout
-    assert startinfo['JADE_STATE'] == 'READY'
-    jadeapi.logout()
-    assert jadeapi.get_version_info()['JADE_STATE'] in ['LOCKED', 'UNINIT']
-    rslt = jadeapi.set_mnemonic(TEST_MNEMONIC)
-    assert jadeapi.get_version_info()['JADE_STATE'] == "READY"
-
-    # Test update pinserver details
-    test_set_pinserver(jadeapi)
-
-    # Get (receive) green-addresses, get-xpub, and sign-message
-    test_get_greenaddress_receive_address(jadeapi)
-    test_get_xpubs(jadeapi)
-    test_sign_message(jadeapi)
-    test_sign_message_file(jadeapi)
-
-    # Sign Tx - includes some failure cases
-    test_sign_tx(jadeapi, SIGN_TXN_TESTS)
-    test_sign_tx_error_cases(jadeapi, SIGN_TXN_FAIL_CASES)
-
-    # Test liuid blinding keys/nonce, blinded commitments and sign-tx
-    test_liquid_blinding_keys(jadeapi)
-    test_liquid_blinded_commitments(jadeapi)
-    test_sign_liquid_tx(jadeapi, SIGN_LIQUID_TXN_TESTS)
-
-    # Test sign psbts (app-generated cases)
-    test_sign_psbt(jadeapi, SIGN_PSBT_TESTS)
-
-    # Test generic multisig
-    test_generic_multisig_registration(jadeapi)
-    test_generic_multisig_matches_ga_addresses(jadeapi)
-    test_generic_multisig_matches_ga_signatures(jadeapi)
-    test_generic_multisig_matches_ga_signatures_liquid(jadeapi)
-    test_generic_multisig_files(jadeapi)
-
-    # Short sanity-test of 12-word mnemonic
-    test_12word_mnemonic(jadeapi)
-
-    # Sign single sig
-    # Single sig requires a different seed for the tests
-    rslt = jadeapi.set_seed(bytes.fromhex(TEST_SEED_SINGLE_SIG))
-    assert rslt is True
-
-    test_get_singlesig_receive_address(jadeapi)
-    test_sign_tx(jadeapi, SIGN_TXN_SINGLE_SIG_TESTS)
-    test_sign_liquid_tx(jadeapi, SIGN_LIQUID_TXN_SINGLE_SIG_TESTS)
-
-    # Test sign psbts (HWI-generated cases)
-    test_sign_psbt(jadeapi, SIGN_PSBT_SS_TESTS)
-
-    # Test the generic multisigs again, using a second signer
-    # NOTE: some of these tests assume 'test_generic_multisig_registration()' test
-    # has already been run, to register the multisigs for the test mnemonic signer
-    test_generic_multisig_ss_signer(jadeapi)
-
-    # Sign identity (ssh & gpg) tests require a specific mnemonic
-    rslt = jadeapi.set_mnemonic(TEST_MNEMONIC_12_IDENTITY)
-    assert rslt is True
-
-    test_sign_identity(jadeapi)
-
-    # Test OTP (hotp and totp)
-    # (These don't depend on the wallet/mnemonic, just that the hw is unlocked)
-    test_hotp(jadeapi)
-    test_totp(jadeapi)
-    test_totp_ex(jadeapi)
+    run_tests(jadeapi, api_tests())
 
     # restore the mnemonic
     rslt = jadeapi.set_mnemonic(TEST_MNEMONIC)
@@ -2889,6 +3437,8 @@ def run_api_tests(jadeapi, isble, qemu, authuser=False):
     # Also skip for no-psram (qemu) devices.
     check_frag = has_psram and not has_ble
     check_mem_stats(startinfo, endinfo, check_frag=check_frag)
+    check_stack_usage(jadeapi)
+    check_signing_latency(jadeapi)
 
 
 # Run tests using passed interface
@@ -2897,7 +3447,8 @@ def run_interface_tests(jadeapi,
                         qemu,
                         authuser=False,
                         smoke=True,
-                        negative=True):
+                        negative=True,
+                        iram_benchmark=False):
     assert jadeapi is not None
 
     rslt = jadeapi.clean_reset()
@@ -2911,49 +3462,8 @@ def run_interface_tests(jadeapi,
     has_psram = startinfo['JADE_FREE_SPIRAM'] > 0
     has_ble = startinfo['JADE_CONFIG'] == 'BLE'
 
-    # Smoke tests
-    if smoke:
-        logger.info("Smoke tests")
-
-        # Sanity check selfcheck time on Jade hw (skip for qemu)
-        # May need updating if more tests added to selfcheck.c
-        time_ms = jadeapi.run_remote_selfcheck()
-        logger.info('selfcheck time: ' + str(time_ms) + 'ms')
-        assert qemu or time_ms < 82500
-
-        # Test good pinserver handshake, and also 'bad sig' pinserver
-        test_handshake(jadeapi.jade)
-        test_handshake_bad_sig(jadeapi.jade)
-
-        # Test importing mnemonic words eg. from qr scan
-        test_mnemonic_import(jadeapi.jade)
-        test_mnemonic_import_bad(jadeapi.jade)
-
-        # Test mnemonic-with-passphrase
-        test_passphrase(jadeapi.jade)
-
-        # Only run QR scan/camera tests a) over serial, and b) on proper Jade hw
-        if not qemu and not isble and startinfo['BOARD_TYPE'] in ['JADE', 'JADE_V1.1']:
-            test_scan_qr(jadeapi)
-
-    # Too much input test - sends a lot of data so only run
-    # if not running over BLE (as would take a long time)
-    if not isble:
-        logger.info("Buffer overflow test - PSRAM: {}".format(has_psram))
-        test_too_much_input(jadeapi.jade, has_psram)
-
-    # Negative tests
-    if negative:
-        logger.info("Negative tests")
-        test_random_bytes(jadeapi.jade)
-        test_very_bad_message(jadeapi.jade)
-        test_bad_message(jadeapi.jade)
-        test_split_message(jadeapi.jade)
-        test_concatenated_messages(jadeapi.jade)
-        test_unknown_method(jadeapi.jade)
-        test_unexpected_method(jadeapi.jade)
-        test_bad_params(jadeapi.jade)
-        test_bad_params_liquid(jadeapi.jade)
+    run_tests(jadeapi, interface_tests(qemu, isble, smoke=smoke, negative=negative,
+                                       iram_benchmark=iram_benchmark))
 
     time.sleep(5)  # Lets idle tasks clean up
     endinfo = jadeapi.get_version_info()
@@ -2963,6 +3473,8 @@ def run_interface_tests(jadeapi,
     # Also skip for no-psram (qemu) devices.
     check_frag = has_psram and not has_ble
     check_mem_stats(startinfo, endinfo, check_frag=check_frag)
+    check_stack_usage(jadeapi)
+    check_signing_latency(jadeapi)
 
 
 # Run all selected tests over a passed JadeAPI instance.
@@ -2971,7 +3483,8 @@ def run_jade_tests(jadeapi, args, isble):
 
     # Low-level JadeInterface tests
     if not args.skiplow:
-        run_interface_tests(jadeapi, isble, args.qemu, authuser=args.authuser)
+        run_interface_tests(jadeapi, isble, args.qemu, authuser=args.authuser,
+                            iram_benchmark=args.iram_benchmark)
 
     # High-level JadeAPI tests
     if not args.skiphigh:
@@ -3195,6 +3708,11 @@ if __name__ == '__main__':
                         dest="qemu",
                         help="Skip tests which appear problematic on qemu hw emulator",
                         default=False)
+    parser.add_argument("--iram-benchmark",
+                        action="store_true",
+                        dest="iram_benchmark",
+                        help="Run the (slow) IRAM placement benchmark and log its timings",
+                        default=False)
     parser.add_argument("--log",
                         action="store",
                         dest="loglevel",
@@ -0,0 +1,290 @@
+#!/usr/bin/env python
+
+import os
+import sys
+import json
+import time
+import queue
+import shutil
+import logging
+import argparse
+import traceback
+import subprocess
+import multiprocessing
+
+import test_jade as tj
+from jadepy.jade import JadeAPI
+
+# Runs the test_jade.py tests across several qemu instances in parallel.
+#
+# The tests are sharded into groups which are independent of each other - each group starts
+# from a clean-reset device with the test mnemonic set, and contains any tests which depend on
+# state left by earlier tests (eg. multisig registrations).  Each qemu instance runs from its own
+# copy of the flash image, and exposes its tcp serial on its own port.
+#
+# In 'fast ui' mode (the default) the automatic confirmations of an unattended-ci build are given
+# after one tick rather than after CONFIG_DEBUG_UNATTENDED_CI_TIMEOUT_MS, so timings reflect the
+# work done rather than ui delays.
+#
+# Group and per-test timings can be written to a json report, and compared against a baseline
+# report to use the run as a performance regression gate.
+#
+# Run after building the qemu firmware and flash image (see main/qemu/docker_test.sh), eg:
+#   python test_jade_parallel.py --instances=4 --report=timings.json
+#   python test_jade_parallel.py --instances=4 --baseline=timings.json --max-slowdown=1.25
+
+logger = logging.getLogger('jade-parallel')
+
+QEMU_GUEST_PORT = 30121
+DEFAULT_BASE_PORT = 30200
+DEFAULT_QEMU = '/opt/bin/qemu-system-xtensa'
+DEFAULT_FLASH_IMAGE = '/flash_image.bin'
+DEFAULT_EFUSE = '/qemu_efuse.bin'
+DEFAULT_WORKDIR = 'build/qemu_parallel'
+STARTUP_TIMEOUT = 120  # seconds
+
+# Per-test slowdowns below this many seconds are ignored, as just noise
+REGRESSION_MIN_DELTA = 0.5
+
+
+# Independent groups of (test name, function taking a JadeAPI), in the order they are run if there
+# is no baseline - taken from test_jade.py's own registry, as run on qemu over tcp serial.
+TEST_GROUPS = {**tj.interface_test_groups(qemu=True, isble=False), **tj.api_test_groups()}
+
+
+# A qemu instance running from its own copy of the flash image, serial exposed on its own port
+class QemuInstance:
+    def __init__(self, index, args):
+        self.index = index
+        self.args = args
+        self.port = args.baseport + index
+        self.serialport = f'tcp:localhost:{self.port}'
+        self.workdir = os.path.join(args.workdir, f'jade{index}')
+        self.process = None
+
+    def start(self):
+        os.makedirs(self.workdir, exist_ok=True)
+        flash_image = os.path.join(self.workdir, 'flash_image.bin')
+        efuse = os.path.join(self.workdir, 'qemu_efuse.bin')
+        shutil.copyfile(self.args.flash_image, flash_image)
+        shutil.copyfile(self.args.efuse, efuse)
+
+        command = [self.args.qemu, '-nographic',
+                   '-machine', 'esp32',
+                   '-m', '4M',
+                   '-drive', f'file={flash_image},if=mtd,format=raw',
+                   '-nic', f'user,model=open_eth,id=lo0,'
+                           f'hostfwd=tcp:127.0.0.1:{self.port}-:{QEMU_GUEST_PORT}',
+                   '-drive', f'file={efuse},if=none,format=raw,id=efuse',
+                   '-global', 'driver=nvram.esp32.efuse,property=drive,value=efuse',
+                   '-serial', f'file:{os.path.join(self.workdir, "serial.log")}']
+        logger.info(f'Starting qemu instance {self.index} on port {self.port}')
+        self.process = subprocess.Popen(command, stdin=subprocess.DEVNULL,
+                                        stdout=subprocess.DEVNULL, stderr=subprocess.STDOUT)
+
+        # Wait for the firmware to boot and accept connections
+        deadline = time.monotonic() + STARTUP_TIMEOUT
+        while True:
+            try:
+                with JadeAPI.create_serial(self.serialport, timeout=5) as jadeapi:
+                    jadeapi.get_version_info()
+                    return
+            except Exception as e:
+                if self.process.poll() is not None or time.monotonic() > deadline:
+                    raise RuntimeError(f'qemu instance {self.index} failed to start') from e
+                time.sleep(1)
+
+    def stop(self):
+        if self.process:
+            self.process.terminate()
+            try:
+                self.process.wait(timeout=10)
+            except subprocess.TimeoutExpired:
+                self.process.kill()
+                self.process.wait()
+            self.process = None
+
+    def restart(self):
+        self.stop()
+        self.start()
+
+
+# Run the named group on a connected instance, returning its result summary
+def run_group(jadeapi, group, fast_ui):
+    result = {'passed': False, 'duration': 0, 'tests': {}, 'error': None}
+    start = time.perf_counter()
+    try:
+        # Each group starts from a clean, unlocked device
+        assert jadeapi.clean_reset() is True
+        if fast_ui:
+            assert jadeapi.set_fast_ui(True) is True
+        assert jadeapi.add_entropy(os.urandom(64)) is True
+        assert jadeapi.set_epoch(int(time.time())) is True
+        assert jadeapi.set_mnemonic(tj.TEST_MNEMONIC) is True
+
+        for name, test in TEST_GROUPS[group]:
+            test_start = time.perf_counter()
+            test(jadeapi)
+            result['tests'][name] = time.perf_counter() - test_start
+
+        result['passed'] = True
+    except Exception as e:
+        logger.error(f'Group {group} failed: {e}')
+        result['error'] = traceback.format_exc()
+
+    result['duration'] = time.perf_counter() - start
+    return result
+
+
+# Worker process owning one qemu instance - runs groups from the queue until empty
+def worker(index, args, groups, results):
+    instance = QemuInstance(index, args)
+    try:
+        instance.start()
+        while True:
+            try:
+                group = groups.get_nowait()
+            except queue.Empty:
+                break
+
+            logger.info(f'Instance {index} running group {group}')
+            with JadeAPI.create_serial(instance.serialport, timeout=args.serialtimeout) as jadeapi:
+                result = run_group(jadeapi, group, not args.no_fast_ui)
+            result['instance'] = index
+            results.put((group, result))
+
+            # After a failure the device may be in any state - start again from a fresh image
+            if not result['passed']:
+                instance.restart()
+    except Exception as e:
+        logger.error(f'Instance {index} failed: {e}')
+    finally:
+        instance.stop()
+
+
+# Returns the list of per-test regressions against the baseline report
+def check_regressions(report, baseline, max_slowdown):
+    regressions = []
+    for group, result in report['groups'].items():
+        base_result = baseline['groups'].get(group)
+        if not result['passed'] or not base_result or not base_result['passed']:
+            continue
+        for test, duration in result['tests'].items():
+            base_duration = base_result['tests'].get(test)
+            if base_duration is not None and duration > base_duration * max_slowdown \
+                    and duration - base_duration > REGRESSION_MIN_DELTA:
+                regressions.append((group, test, base_duration, duration))
+    return regressions
+
+
+def main(args):
+    groups = args.groups or list(TEST_GROUPS)
+    unknown = [group for group in groups if group not in TEST_GROUPS]
+    if unknown:
+        logger.error(f'Unknown test groups: {unknown}')
+        return 1
+
+    baseline = None
+    if args.baseline:
+        with open(args.baseline, 'r') as f:
+            baseline = json.load(f)
+
+        # Hand out the longest groups first, so the last to finish are the shortest
+        def _baseline_duration(group):
+            return baseline['groups'].get(group, {}).get('duration', float('inf'))
+        groups.sort(key=_baseline_duration, reverse=True)
+
+    group_queue = multiprocessing.Queue()
+    for group in groups:
+        group_queue.put(group)
+    results_queue = multiprocessing.Queue()
+
+    start = time.perf_counter()
+    ninstances = min(args.instances, len(groups))
+    workers = [multiprocessing.Process(target=worker, args=(i, args, group_queue, results_queue))
+               for i in range(ninstances)]
+    for process in workers:
+        process.start()
+
+    # Collect results as they arrive (draining the queue before joining the workers)
+    results = {}
+    while len(results) < len(groups) and any(process.is_alive() for process in workers):
+        try:
+            group, result = results_queue.get(timeout=1)
+            results[group] = result
+        except queue.Empty:
+            pass
+    for process in workers:
+        process.join()
+    while not results_queue.empty():
+        group, result = results_queue.get()
+        results[group] = result
+    wall_time = time.perf_counter() - start
+
+    report = {'instances': ninstances, 'fast_ui': not args.no_fast_ui,
+              'wall_time': wall_time, 'groups': results}
+
+    # Summary of groups and per-test timings
+    logger.info(f'{"Group / test":48} {"Instance":>8} {"Seconds":>9}  Result')
+    for group in groups:
+        result = results.get(group)
+        if not result:
+            logger.info(f'{group:48} {"-":>8} {"-":>9}  NOT RUN')
+            continue
+        status = 'ok' if result['passed'] else 'FAILED'
+        logger.info(f'{group:48} {result["instance"]:8} {result["duration"]:9.2f}  {status}')
+        for test, duration in result['tests'].items():
+            logger.info(f'  {test:46} {"":8} {duration:9.2f}')
+        if result['error']:
+            logger.error(result['error'])
+
+    total = sum(result['duration'] for result in results.values())
+    logger.info(f'Wall time {wall_time:.2f}s for {total:.2f}s of tests on {ninstances} instances')
+
+    if args.report:
+        with open(args.report, 'w') as f:
+            json.dump(report, f, indent=2)
+
+    failed = [group for group in groups if not results.get(group, {}).get('passed')]
+    if failed:
+        logger.error(f'Failed or not run: {failed}')
+
+    regressions = check_regressions(report, baseline, args.max_slowdown) if baseline else []
+    for group, test, base_duration, duration in regressions:
+        logger.error(f'Regression: {group}/{test} {base_duration:.2f}s -> {duration:.2f}s')
+
+    return 1 if failed or regressions else 0
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Run the Jade tests on parallel qemu instances')
+    parser.add_argument('--instances', type=int, default=os.cpu_count(),
+                        help='Number of qemu instances to run')
+    parser.add_argument('--groups', nargs='+', choices=list(TEST_GROUPS),
+                        help='Test groups to run (default all)')
+    parser.add_argument('--qemu', default=DEFAULT_QEMU, help='qemu-system-xtensa executable')
+    parser.add_argument('--flash-image', dest='flash_image', default=DEFAULT_FLASH_IMAGE,
+                        help='Initial flash image (copied for each instance)')
+    parser.add_argument('--efuse', default=DEFAULT_EFUSE, help='qemu efuse file')
+    parser.add_argument('--baseport', type=int, default=DEFAULT_BASE_PORT,
+                        help='Host tcp port for the first instance (then consecutive)')
+    parser.add_argument('--workdir', default=DEFAULT_WORKDIR,
+                        help='Directory for per-instance flash images and serial logs')
+    parser.add_argument('--serialtimeout', type=int, default=300,
+                        help='Serial timeout (long for some selfcheck iterations)')
+    parser.add_argument('--no-fast-ui', dest='no_fast_ui', action='store_true',
+                        help='Keep the usual automatic-confirmation delays')
+    parser.add_argument('--report', help='Write group and per-test timings to this json file')
+    parser.add_argument('--baseline', help='Compare per-test timings to this json report')
+    parser.add_argument('--max-slowdown', dest='max_slowdown', type=float, default=1.25,
+                        help='Per-test slowdown ratio (vs baseline) treated as a regression')
+    parser.add_argument('--log', dest='loglevel', default='INFO',
+                        choices=['DEBUG', 'INFO', 'WARN', 'ERROR', 'CRITICAL'],
+                        help='Logging level')
+    args = parser.parse_args()
+
+    tj.jadehandler.setLevel(getattr(logging, args.loglevel))
+    logger.setLevel(logging.DEBUG)
+    logger.addHandler(tj.jadehandler)
+
+    sys.exit(main(args))
@@ -0,0 +1,133 @@
+#!/usr/bin/env python
+
+import os
+import sys
+import logging
+import argparse
+import tempfile
+import subprocess
+
+from tools import fwtools, xtensa_filter
+
+# Enable jade logging
+jadehandler = logging.StreamHandler()
+
+logger = logging.getLogger('jade')
+logger.setLevel(logging.INFO)
+logger.addHandler(jadehandler)
+
+BSDIFF = os.path.join(os.path.dirname(os.path.realpath(__file__)), 'tools', 'bsdiff')
+
+
+# Read an 8-byte sign-magnitude integer, as written by bsdiff
+def _offtin(data, offset):
+    value = int.from_bytes(data[offset:offset + 8], 'little')
+    return -(value & ~(1 << 63)) if value & (1 << 63) else value
+
+
+# Apply a (raw, uncompressed) bsdiff patch, as Jade does
+def bspatch(base, patch, newsize):
+    new = bytearray()
+    pos, oldpos = 0, 0
+    while len(new) < newsize:
+        difflen, extralen, seek = (_offtin(patch, pos + i) for i in range(0, 24, 8))
+        pos += 24
+
+        diff = patch[pos:pos + difflen]
+        pos += difflen
+        new += bytes((d + b) & 0xFF for d, b in zip(diff, base[oldpos:oldpos + difflen]))
+        oldpos += difflen
+
+        new += patch[pos:pos + extralen]
+        pos += extralen
+        oldpos += seek
+
+    assert len(new) == newsize and pos == len(patch)
+    return bytes(new)
+
+
+# Create the raw bsdiff patch between two images
+def bsdiff(base, target):
+    with tempfile.TemporaryDirectory() as tmpdir:
+        paths = [os.path.join(tmpdir, name) for name in ['base', 'target', 'patch']]
+        fwtools.write(base, paths[0])
+        fwtools.write(target, paths[1])
+        rslt = subprocess.run([BSDIFF] + paths)
+        assert rslt.returncode == 0
+        return fwtools.read(paths[2])
+
+
+def test_filter_roundtrip(image):
+    filtered = xtensa_filter.encode(image)
+    assert len(filtered) == len(image)
+    assert xtensa_filter.decode(filtered) == image
+
+    changed = sum(a != b for a, b in zip(image, filtered))
+    logger.info(f'Filter changed {changed} of {len(image)} bytes')
+
+
+# Returns the compressed sizes of the plain and filtered patches between the images
+def test_patch_sizes(base, target):
+    plain = bsdiff(base, target)
+    assert bspatch(base, plain, len(target)) == target
+
+    # The filtered patch is applied to the filtered running firmware,
+    # and the output is un-filtered to give the final image
+    xbase = xtensa_filter.encode(base)
+    xpatch = bsdiff(xbase, xtensa_filter.encode(target))
+    assert xtensa_filter.decode(bspatch(xbase, xpatch, len(target))) == target
+
+    return xpatch, len(fwtools.compress(plain)), len(fwtools.compress(xpatch))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('fwfiles',
+                        nargs='+',
+                        help='Compressed full firmware files - patches are created between each '
+                             'consecutive pair (or to self if only one file is passed)')
+    parser.add_argument('--write-xpatch',
+                        action='store',
+                        dest='xpatchdir',
+                        help='Directory to write the compressed filtered patches to',
+                        default=None)
+    parser.add_argument('--log',
+                        action='store',
+                        dest='loglevel',
+                        help='Jade logging level',
+                        choices=['DEBUG', 'INFO', 'WARN', 'ERROR', 'CRITICAL'],
+                        default='ERROR')
+    args = parser.parse_args()
+    jadehandler.setLevel(getattr(logging, args.loglevel))
+
+    assert os.path.isfile(BSDIFF), f'{BSDIFF} not found - see tools/mkpatch.py'
+
+    images = []
+    for fwfile in args.fwfiles:
+        fwtype, fwinfo, _ = fwtools.parse_compressed_filename(fwfile)
+        assert fwtype == fwtools.FWFILE_TYPE_FULL, f'Not a full firmware file: {fwfile}'
+        image = fwtools.decompress(fwtools.read(fwfile))
+        assert len(image) == fwinfo.fwsize
+
+        test_filter_roundtrip(image)
+        images.append((fwinfo, image))
+
+    pairs = list(zip(images, images[1:])) if len(images) > 1 else [(images[0], images[0])]
+
+    results = []
+    for (frominfo, base), (toinfo, target) in pairs:
+        xpatch, plainsize, filteredsize = test_patch_sizes(base, target)
+        results.append((f'{frominfo.version} -> {toinfo.version}', plainsize, filteredsize))
+
+        if args.xpatchdir:
+            xpatchpath = fwtools.get_patch_compressed_filepath(xpatch, frominfo, toinfo,
+                                                               args.xpatchdir,
+                                                               fwtools.FWFILE_TYPE_XPATCH)
+            fwtools.write(fwtools.compress(xpatch), xpatchpath)
+
+    width = max(len(label) for label, _, _ in results) + 2
+    print('Patch'.ljust(width), 'plain'.rjust(10), 'filtered'.rjust(10), 'saving'.rjust(8))
+    for label, plainsize, filteredsize in results:
+        saving = 100 * (plainsize - filteredsize) / plainsize
+        print(label.ljust(width), str(plainsize).rjust(10), str(filteredsize).rjust(10),
+              f'{saving:.1f}%'.rjust(8))
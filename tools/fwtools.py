@@ -9,6 +9,10 @@ FwInfo = namedtuple('FwInfo', 'version config fwsize')
 FWFILE_TYPE_FULL = 'fw.bin'
 FWFILE_TYPE_HASH = 'fw.bin.hash'
 FWFILE_TYPE_PATCH = 'patch.bin'
+FWFILE_TYPE_XPATCH = 'xpatch.bin'  # patch between 'xtensa' filtered images - see xtensa_filter.py
+
+# The 'patchfilter' to pass to Jade with each type of patch
+PATCH_FILTERS = {FWFILE_TYPE_PATCH: None, FWFILE_TYPE_XPATCH: 'xtensa'}
 
 logger = logging.getLogger('jade')
 
@@ -48,12 +52,14 @@ def get_firmware_compressed_filepath(firmware, outputdir):
 # Generate path filename based on versions and ble-configs of from/to fws, the uncompressed
 # size of the final destination firmware, and the uncompressed size of this patch
 # See also 'parse_compressed_filename()' below
-def get_patch_compressed_filepath(patch, frominfo, toinfo, outputdir):
+def get_patch_compressed_filepath(patch, frominfo, toinfo, outputdir,
+                                  patchtype=FWFILE_TYPE_PATCH):
     # Full file path is:
     # <dir>/<tover>_<toconfig>_from_<fromver>_<fromcfg>_sizes_<uncompressed-fwsize>_<uncompressed-patchsize>_patch.bin
+    # (or _xpatch.bin if the patch is between filtered images)
     filename = toinfo.version + '_' + toinfo.config + '_from_' + \
                frominfo.version + '_' + frominfo.config + '_sizes_' + \
-               str(toinfo.fwsize) + '_' + str(len(patch)) + '_' + FWFILE_TYPE_PATCH
+               str(toinfo.fwsize) + '_' + str(len(patch)) + '_' + patchtype
 
     filepath = prefix_dir(outputdir, filename)
     logger.info(f'Deduced compressed patch filepath: {filepath}')
@@ -73,7 +79,7 @@ def parse_compressed_filename(filepath):
         fwinfo = FwInfo(parts[0], parts[1], int(parts[2]))
         return (parts[-1], fwinfo, None)
 
-    elif len(parts) == 9 and parts[-1] == FWFILE_TYPE_PATCH:
+    elif len(parts) == 9 and parts[-1] in PATCH_FILTERS:
         # File name is:
         # <tover>_<otconfig>_from_<fromver>_<fromcfg>_sizes_<uncompressed-fwsize>_<uncompressed-patchsize>_patch.bin
         logger.info(f'Filename suggests firmware patch: {filename}')
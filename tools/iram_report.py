@@ -0,0 +1,130 @@
+#!/usr/bin/env python
+
+import re
+import argparse
+
+# Reports IRAM usage from a linker map file and, if given an IRAM placement linker fragment
+# (eg. when evaluating candidate placements), where each function named in it actually ended up:
+#   IRAM     - placed in IRAM (size in bytes shown)
+#   flash    - present, but placed in flash (eg. the profile is not enabled)
+#   inlined  - no section of its own (inlined into its callers, or not linked)
+#
+# Run automatically after each build, or by hand with eg:
+#   python tools/iram_report.py build/jade.map [candidate_placements.lf]
+
+IRAM_SEGMENT = 'iram0_0_seg'
+
+# Input section lines in the map, which may be wrapped if the section name is long:
+#   ' .text.rs_multiply 0x400812a4 0x1c esp-idf/main/libmain.a(qrcode.c.obj)'
+#   ' .text.secp256k1_fe_mul_inner\n        0x400812c0 0x3a0 esp-idf/...'
+INPUT_SECTION_RE = re.compile(r'^ \.(?:text|literal|iram1)\.(\S+)(.*)$')
+ADDR_RE = re.compile(r'^\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)\s+\S*\((\w+)\.\w+\.obj\)')
+OUTPUT_SECTION_RE = re.compile(r'^(\.\S+)\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)')
+MEMORY_RE = re.compile(r'^(\S+)\s+(0x[0-9a-f]+)\s+(0x[0-9a-f]+)\s+\S*$')
+
+LF_MAPPING_RE = re.compile(r'^\[mapping:(\S+)\]')
+LF_ENTRY_RE = re.compile(r'^\s*(\w+):(\w+)\s+\(noflash\)')
+
+
+# Returns the list of (archive mapping name, object, symbol) entries in the profile
+def load_profile(path):
+    entries = []
+    mapping = None
+    with open(path, 'r') as f:
+        for line in f:
+            m = LF_MAPPING_RE.match(line)
+            if m:
+                mapping = m.group(1)
+                continue
+            m = LF_ENTRY_RE.match(line)
+            if m:
+                entries.append((mapping, m.group(1), m.group(2)))
+    return entries
+
+
+# Returns the iram segment (origin, length), the output sections and the input function
+# sections (as (object, symbol) -> list of (address, size)) found in the map file
+def load_map(path):
+    segment = None
+    output_sections = []
+    functions = {}
+
+    with open(path, 'r') as f:
+        lines = f.read().splitlines()
+
+    pending = None
+    for line in lines:
+        if segment is None:
+            m = MEMORY_RE.match(line)
+            if m and m.group(1) == IRAM_SEGMENT:
+                segment = (int(m.group(2), 16), int(m.group(3), 16))
+            continue
+
+        if pending:
+            m = ADDR_RE.match(line)
+            if m:
+                key = (m.group(3), pending)
+                functions.setdefault(key, []).append((int(m.group(1), 16), int(m.group(2), 16)))
+            pending = None
+            continue
+
+        m = OUTPUT_SECTION_RE.match(line)
+        if m:
+            output_sections.append((m.group(1), int(m.group(2), 16), int(m.group(3), 16)))
+            continue
+
+        m = INPUT_SECTION_RE.match(line)
+        if m:
+            # Address, size and object either follow on the same line, or on the next
+            pending = m.group(1)
+            if m.group(2).strip():
+                line = m.group(2)
+            else:
+                continue
+
+            m = ADDR_RE.match(line)
+            if m:
+                key = (m.group(3), pending)
+                functions.setdefault(key, []).append((int(m.group(1), 16), int(m.group(2), 16)))
+            pending = None
+
+    assert segment, f'{IRAM_SEGMENT} not found in {path}'
+    return segment, output_sections, functions
+
+
+def report(map_file, profile_file):
+    (origin, length), output_sections, functions = load_map(map_file)
+
+    def in_iram(addr):
+        return origin <= addr < origin + length
+
+    used = sum(size for _, addr, size in output_sections if in_iram(addr) and size)
+    print(f'IRAM ({IRAM_SEGMENT}): {used} of {length} bytes used, {length - used} remaining')
+    if not profile_file:
+        return
+
+    total = 0
+    print(f'{"Profile entry":56} {"Placement":9} {"Bytes":>6}')
+    for mapping, obj, symbol in load_profile(profile_file):
+        # Literal pools are placed with their function, so count them too
+        placements = [p for p in functions.get((obj, symbol), []) if p[1]]
+        if not placements:
+            placement, size = 'inlined', 0
+        elif all(in_iram(addr) for addr, _ in placements):
+            placement, size = 'IRAM', sum(size for _, size in placements)
+            total += size
+        else:
+            placement, size = 'flash', sum(size for _, size in placements)
+        print(f'{obj + ":" + symbol:56} {placement:9} {size:6}')
+
+    print(f'Profile total: {total} bytes in IRAM')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='Report IRAM usage and profile placement')
+    parser.add_argument('map', help='Linker map file (eg. build/jade.map)')
+    parser.add_argument('profile', nargs='?',
+                        help='Linker fragment file naming functions placed in IRAM')
+    args = parser.parse_args()
+
+    report(args.map, args.profile)
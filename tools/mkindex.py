@@ -38,11 +38,13 @@ def process_fw_filename(fwname, fwhashes):
 
     if fwtype == fwtools.FWFILE_TYPE_FULL:
         assert info2 is None
-    elif fwtype == fwtools.FWFILE_TYPE_PATCH:
+    elif fwtype in fwtools.PATCH_FILTERS:
         assert info2 is not None
         desc['from_version'] = info2.version
         desc['from_config'] = info2.config
         desc['patch_size'] = info2.fwsize
+        if fwtools.PATCH_FILTERS[fwtype]:
+            desc['patch_filter'] = fwtools.PATCH_FILTERS[fwtype]
     else:
         # Skip unknown file
         logger.warning('Unknown file type: {fwname}')
@@ -6,6 +6,7 @@ import subprocess
 import os
 
 import fwtools
+import xtensa_filter
 
 # Enable logging
 logger = logging.getLogger('jade')
@@ -39,26 +40,52 @@ def write_decompressed(compressedpath, uncompressedpath):
     return fwtools.write(uncompressed, uncompressedpath)
 
 
-def create_patch(frominfo, frompath, toinfo, topath, outputdir):
-
+# Create the binary diff between uncompressed fw files using bsdiff
+# (expected to be in same directory as this script)
+# Returns the uncompressed patch data
+def create_diff(frompath, topath, outputdir):
     tmppathpatch = _tmpfilepath(outputdir, 'patch')
     try:
-        # Create the binary diff between uncompressed fw files using bsdiff
-        # (expected to be in same directory as this script)
-        bsdiff = _bsdiff_cmd()
-        rslt = subprocess.run([bsdiff, frompath, topath, tmppathpatch])
+        rslt = subprocess.run([_bsdiff_cmd(), frompath, topath, tmppathpatch])
         assert rslt.returncode == 0
-
-        # Read the uncompressed patch data, and write zlib compressed
-        # with the standard expected filename
-        patch = fwtools.read(tmppathpatch)
-        patchpath = fwtools.get_patch_compressed_filepath(patch, frominfo, toinfo, outputdir)
-        compressed = fwtools.compress(patch)
-        fwtools.write(compressed, patchpath)
+        return fwtools.read(tmppathpatch)
     finally:
         _remove(tmppathpatch)
 
 
+# Helper to read a file, apply the xtensa filter, and write the filtered image
+def write_filtered(uncompressedpath, filteredpath):
+    image = fwtools.read(uncompressedpath)
+    return fwtools.write(xtensa_filter.encode(image), filteredpath)
+
+
+def create_patch(frominfo, frompath, toinfo, topath, outputdir):
+
+    # Create the plain patch, which any Jade can apply - write zlib compressed
+    # with the standard expected filename
+    patch = create_diff(frompath, topath, outputdir)
+    patchpath = fwtools.get_patch_compressed_filepath(patch, frominfo, toinfo, outputdir)
+    compressed = fwtools.compress(patch)
+    fwtools.write(compressed, patchpath)
+
+    # Create the patch between the filtered images, and also write that if it is smaller
+    tmppathfrom, tmppathto = _tmpfilepath(outputdir, 'xfrom'), _tmpfilepath(outputdir, 'xto')
+    try:
+        write_filtered(frompath, tmppathfrom)
+        write_filtered(topath, tmppathto)
+        xpatch = create_diff(tmppathfrom, tmppathto, outputdir)
+    finally:
+        _remove(tmppathfrom)
+        _remove(tmppathto)
+
+    xcompressed = fwtools.compress(xpatch)
+    logger.info(f'Compressed patch sizes - plain: {len(compressed)}, filtered: {len(xcompressed)}')
+    if len(xcompressed) < len(compressed):
+        xpatchpath = fwtools.get_patch_compressed_filepath(xpatch, frominfo, toinfo, outputdir,
+                                                           fwtools.FWFILE_TYPE_XPATCH)
+        fwtools.write(xcompressed, xpatchpath)
+
+
 def create_patches(fwpathA, fwpathB, outputdir):
 
     logger.info(f'Patching between {fwpathA} and {fwpathB}')
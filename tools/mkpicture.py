@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+
+import re
+import os
+import ast
+import argparse
+
+# Converts RGB565 'GIMP C-Source image dumps' into the compact palette+RLE
+# Picture encoding decoded line-by-line by TFT_picture() (see components/tft).
+#
+# Encoded data layout:
+#   [palette size - 1]                      1 byte
+#   [palette entries]                       2 bytes each, little-endian rgb565
+#   [run length token][palette index] ...   until width * height pixels
+#
+# Run length token: 0lllllll              - run of (l + 1) pixels (1 - 128)
+#                   1hhhhhhh llllllll     - run of (hl + 129) pixels (129 - 32896)
+#
+# Runs may span lines - the decoder holds its state across lines.
+
+PICTURE_ENCODING_PALETTE_RLE = 'PICTURE_ENCODING_PALETTE_RLE'
+MAX_PALETTE_SIZE = 256
+MAX_SHORT_RUN = 128
+MAX_LONG_RUN = MAX_SHORT_RUN + 0x7fff + 1
+
+
+# Parse a GIMP-style rgb565 C-source dump, or a file previously written by this script.
+# Returns the name, width, height and the pixels as a list of rgb565 values.
+def load_picture(path):
+    with open(path, 'r') as f:
+        source = f.read()
+
+    m = re.search(r'static const Picture (\w+) = \{\s*(\d+),\s*(\d+),\s*(\d+),\s*\{(.*?)\}\s*,',
+                  source, re.S)
+    assert m, f'No Picture found in {path}'
+    name, width, height, bpp = m.group(1), int(m.group(2)), int(m.group(3)), int(m.group(4))
+    assert bpp == 2, f'Only rgb565 pictures supported, {path} has {bpp} bytes per pixel'
+
+    if PICTURE_ENCODING_PALETTE_RLE in source[m.start():]:
+        m = re.search(r'static const uint8_t \w+\[\] = \{(.*?)\};', source, re.S)
+        assert m, f'No encoded data found in {path}'
+        encoded = bytes(int(b, 16) for b in re.findall(r'0x([0-9a-fA-F]{2})', m.group(1)))
+        return name, width, height, decode(encoded, width * height)
+
+    strings = re.findall(r'"((?:[^"\\]|\\.)*)"', m.group(5))
+    data = b''.join(ast.literal_eval('b"' + s + '"') for s in strings)
+    assert len(data) >= width * height * 2, f'Truncated pixel data in {path}'
+    pixels = [data[i] | (data[i + 1] << 8) for i in range(0, width * height * 2, 2)]
+    return name, width, height, pixels
+
+
+def encode(pixels):
+    palette = sorted(set(pixels))
+    assert len(palette) <= MAX_PALETTE_SIZE, f'Too many colours for palette: {len(palette)}'
+    lookup = {colour: index for index, colour in enumerate(palette)}
+
+    encoded = bytearray([len(palette) - 1])
+    for colour in palette:
+        encoded += colour.to_bytes(2, 'little')
+
+    i = 0
+    while i < len(pixels):
+        run = 1
+        while i + run < len(pixels) and pixels[i + run] == pixels[i] and run < MAX_LONG_RUN:
+            run += 1
+
+        if run <= MAX_SHORT_RUN:
+            encoded.append(run - 1)
+        else:
+            extra = run - MAX_SHORT_RUN - 1
+            encoded += bytes([0x80 | (extra >> 8), extra & 0xff])
+        encoded.append(lookup[pixels[i]])
+        i += run
+
+    return bytes(encoded)
+
+
+def decode(encoded, npixels):
+    npalette = encoded[0] + 1
+    palette = [encoded[1 + 2 * i] | (encoded[2 + 2 * i] << 8) for i in range(npalette)]
+
+    pixels = []
+    pos = 1 + 2 * npalette
+    while len(pixels) < npixels:
+        token = encoded[pos]
+        pos += 1
+        if token & 0x80:
+            run = (((token & 0x7f) << 8) | encoded[pos]) + MAX_SHORT_RUN + 1
+            pos += 1
+        else:
+            run = token + 1
+        pixels += [palette[encoded[pos]]] * run
+        pos += 1
+
+    assert len(pixels) == npixels and pos == len(encoded), 'Bad encoded data'
+    return pixels
+
+
+def write_picture(path, name, width, height, encoded):
+    lines = [f'/* Palette+RLE encoded rgb565 picture ({os.path.basename(path)}) */',
+             '/* Generated by tools/mkpicture.py - do not edit */',
+             '',
+             '#include "tft.h"',
+             '',
+             f'static const uint8_t {name}_data[] = {{']
+    for i in range(0, len(encoded), 16):
+        lines.append('  ' + ', '.join(f'0x{b:02x}' for b in encoded[i:i + 16]) + ',')
+    lines += ['};',
+              '',
+              f'static const Picture {name} = {{',
+              f'  {width}, {height}, 2, {{ .data_8 = (uint8_t*){name}_data }},',
+              f'  {PICTURE_ENCODING_PALETTE_RLE}, sizeof({name}_data),',
+              '};',
+              '']
+
+    with open(path, 'w') as f:
+        f.write('\n'.join(lines))
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(
+        description='Encode rgb565 C-source picture dumps as palette+RLE')
+    parser.add_argument('--report', action='store_true',
+                        help='Only report raw and encoded sizes, do not rewrite files')
+    parser.add_argument('files', nargs='+', help='Picture C-source files, rewritten in place')
+    args = parser.parse_args()
+
+    total_raw, total_encoded = 0, 0
+    for path in args.files:
+        name, width, height, pixels = load_picture(path)
+        encoded = encode(pixels)
+        assert decode(encoded, len(pixels)) == pixels, f'Round-trip failed for {path}'
+
+        raw_len = width * height * 2
+        total_raw += raw_len
+        total_encoded += len(encoded)
+        print(f'{path}: {name} {width}x{height}, {len(set(pixels))} colours, '
+              f'{raw_len} -> {len(encoded)} bytes')
+
+        if not args.report:
+            write_picture(path, name, width, height, encoded)
+
+    print(f'Total: {total_raw} -> {total_encoded} bytes')
@@ -0,0 +1,125 @@
+import struct
+import logging
+
+# The 'xtensa' firmware delta filter.
+# A reversible transform of the code segments of an esp image, applied to both firmware images
+# before they are diffed, so code which has only moved produces similar bytes (and so a smaller
+# patch).  Jade applies the same transform to its running firmware as the patch is applied, and
+# reverses it on the patched output - see main/process/ota_filter.c, which this must match.
+#
+# Each code segment is filtered in blocks of BLOCK_SIZE bytes from the start of its data, so any
+# block can be (un)filtered independently.  In each block:
+# - 32-bit literal-pool words which hold a code address are made relative to their own address
+#   (rotated within the code address range, so the transform is a bijection)
+# - the pc-relative targets of CALL0/4/8/12 instructions are made absolute
+logger = logging.getLogger('jade')
+
+ESP_IMAGE_HEADER_MAGIC = 0xE9
+ESP_IMAGE_MAX_SEGMENTS = 16
+IMAGE_HEADER_LEN = 24
+SEGMENT_HEADER_LEN = 8
+
+BLOCK_SIZE = 4096
+
+# Instruction address range (iram, rtc fast and irom)
+CODE_LOW = 0x40070000
+CODE_HIGH = 0x40400000
+CODE_RANGE = CODE_HIGH - CODE_LOW
+
+# CALLn: op0 (low nibble of the first byte) is 5, with an 18-bit word offset in the top 18 bits
+CALL_OP0_MASK = 0x0F
+CALL_OP0 = 0x05
+CALL_OFFSET_MASK = 0x3FFFF
+
+
+def is_code(load_addr):
+    return CODE_LOW <= load_addr < CODE_HIGH
+
+
+# Returns the (offset, length, load-address) of the data of each segment of the image
+def _segments(image):
+    assert image[0] == ESP_IMAGE_HEADER_MAGIC, 'Not an esp image'
+    count = image[1]
+    assert count <= ESP_IMAGE_MAX_SEGMENTS, f'Unexpected image segment count {count}'
+
+    segments = []
+    offset = IMAGE_HEADER_LEN
+    for _ in range(count):
+        load_addr, length = struct.unpack_from('<II', image, offset)
+        offset += SEGMENT_HEADER_LEN
+        assert offset + length <= len(image), 'Truncated image segment'
+        segments.append((offset, length, load_addr))
+        offset += length
+    return segments
+
+
+def _get_call_offset(block, i):
+    return (block[i] >> 6) | (block[i + 1] << 2) | (block[i + 2] << 10)
+
+
+def _set_call_offset(block, i, offset):
+    block[i] = (block[i] & 0x3F) | ((offset & 0x03) << 6)
+    block[i + 1] = (offset >> 2) & 0xFF
+    block[i + 2] = (offset >> 10) & 0xFF
+
+
+# Apply the transform to the passed block (bytearray) of code at 'addr'
+# NOTE: the call scan skips the operand bytes of each call matched, but matches only on bits the
+# transform does not change - so un-filtering matches the same positions.
+def encode_block(block, addr):
+    for i in range(0, len(block) - 3, 4):
+        value = int.from_bytes(block[i:i + 4], 'little')
+        if is_code(value):
+            value = CODE_LOW + (value - (addr + i)) % CODE_RANGE
+            block[i:i + 4] = value.to_bytes(4, 'little')
+
+    i = 0
+    while i + 3 <= len(block):
+        if block[i] & CALL_OP0_MASK == CALL_OP0:
+            target = _get_call_offset(block, i) + ((addr + i) >> 2) + 1
+            _set_call_offset(block, i, target & CALL_OFFSET_MASK)
+            i += 3
+        else:
+            i += 1
+
+
+# Reverse the transform of the passed block (bytearray) of code at 'addr'
+def decode_block(block, addr):
+    i = 0
+    while i + 3 <= len(block):
+        if block[i] & CALL_OP0_MASK == CALL_OP0:
+            offset = _get_call_offset(block, i) - ((addr + i) >> 2) - 1
+            _set_call_offset(block, i, offset & CALL_OFFSET_MASK)
+            i += 3
+        else:
+            i += 1
+
+    for i in range(0, len(block) - 3, 4):
+        value = int.from_bytes(block[i:i + 4], 'little')
+        if is_code(value):
+            value = CODE_LOW + (value + (addr + i) - 2 * CODE_LOW) % CODE_RANGE
+            block[i:i + 4] = value.to_bytes(4, 'little')
+
+
+def _filter(image, block_fn):
+    filtered = bytearray(image)
+    for offset, length, load_addr in _segments(image):
+        if is_code(load_addr):
+            for start in range(0, length, BLOCK_SIZE):
+                end = min(start + BLOCK_SIZE, length)
+                block = filtered[offset + start:offset + end]
+                block_fn(block, load_addr + start)
+                filtered[offset + start:offset + end] = block
+    return bytes(filtered)
+
+
+# Returns the filtered image
+def encode(image):
+    logger.info(f'Filtering {len(image)} byte image')
+    return _filter(image, encode_block)
+
+
+# Returns the original image from the filtered image
+def decode(filtered):
+    logger.info(f'Un-filtering {len(filtered)} byte image')
+    return _filter(filtered, decode_block)
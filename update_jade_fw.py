@@ -35,7 +35,12 @@ def get_fw_metadata(verinfo, release_data):
 
     def _delta_appropriate(fw):
         return fw['from_version'] == verinfo['JADE_VERSION'] and \
-               fw['from_config'].lower() == verinfo['JADE_CONFIG'].lower()
+               fw['from_config'].lower() == verinfo['JADE_CONFIG'].lower() and \
+               _filter_supported(fw.get('patch_filter'))
+
+    def _filter_supported(patchfilter):
+        return patchfilter is None or \
+            patchfilter in verinfo.get('JADE_OTA_DELTA_FILTERS', '').split(',')
 
     print(f'Current Jade fw: {verinfo["JADE_VERSION"]} - {verinfo["JADE_CONFIG"].lower()}')
     print('-')
@@ -114,7 +119,7 @@ def download_file(verinfo, release):
             fwtools.write(fwhash, os.path.basename(fwname) + ".hash", text=True)
 
     # Return
-    return fwdata['fwsize'], fwdata.get('patch_size'), fwhash, fwcmp
+    return fwdata['fwsize'], fwdata.get('patch_size'), fwdata.get('patch_filter'), fwhash, fwcmp
 
 
 # Use a local (previously downloaded) firmware file.
@@ -136,16 +141,17 @@ def get_local_fwfile(fwfilename):
     # Use fwtools to parse the filename and deduce whether this is
     # a full firmware file or a firmware delta/patch.
     fwtype, fwinfo, fwinfo2 = fwtools.parse_compressed_filename(fwfilename)
-    assert (fwtype == fwtools.FWFILE_TYPE_PATCH) == (fwinfo2 is not None)
+    assert (fwtype in fwtools.PATCH_FILTERS) == (fwinfo2 is not None)
+    patchfilter = fwtools.PATCH_FILTERS.get(fwtype)
 
-    return fwinfo.fwsize, fwinfo2.fwsize if fwinfo2 else None, fwhash, fwcmp
+    return fwinfo.fwsize, fwinfo2.fwsize if fwinfo2 else None, patchfilter, fwhash, fwcmp
 
 
 # Takes the compressed firmware data to upload, the expected length of the
 # final (uncompressed) firmware, the length of the uncompressed diff/patch
-# (if this is a patch to apply to the current running firmware), and whether
-# to apply the test mnemonic rather than using normal pinserver authentication.
-def ota(jade, verinfo, fwcompressed, fwlength, fwhash, patchlen=None):
+# (if this is a patch to apply to the current running firmware), and the
+# filter the patch was created with (if any).
+def ota(jade, verinfo, fwcompressed, fwlength, fwhash, patchlen=None, patchfilter=None):
     logger.info(f'Running OTA on: {verinfo}')
     chunksize = int(verinfo['JADE_OTA_MAX_CHUNK'])
     assert chunksize > 0
@@ -184,7 +190,7 @@ def ota(jade, verinfo, fwcompressed, fwlength, fwhash, patchlen=None):
     print('Please approve the firmware update on the Jade device')
     try:
         result = jade.ota_update(fwcompressed, fwlength, chunksize, fwhash,
-                                 patchlen=patchlen, cb=_log_progress)
+                                 patchlen=patchlen, patchfilter=patchfilter, cb=_log_progress)
         assert result is True
         print(f'Total OTA time: {time.time() - start_time}s')
     except JadeError as err:
@@ -236,12 +242,12 @@ if __name__ == '__main__':
         # Can't check that local file is appropriate for connected hw
         # OTA should reject/fail if not appropriate.
         # File must have the name unchanged from download.
-        fwlen, patchlen, fwhash, fwcmp = get_local_fwfile(args.fwfile)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = get_local_fwfile(args.fwfile)
     else:
         # File download should only offer appropriate fw
         # OTA should reject/fail if not appropriate.
         release = args.release or 'stable'  # defaults to latest/stable
-        fwlen, patchlen, fwhash, fwcmp = download_file(verinfo, release)
+        fwlen, patchlen, patchfilter, fwhash, fwcmp = download_file(verinfo, release)
 
     if fwcmp is None:
         print('No firmware available')
@@ -259,6 +265,6 @@ if __name__ == '__main__':
     if upload == 'y' or upload == 'Y' or upload == '':
         logger.info('Jade OTA over serial')
         with JadeAPI.create_serial(device=args.serialport) as jade:
-            ota(jade, verinfo, fwcmp, fwlen, fwhash, patchlen)
+            ota(jade, verinfo, fwcmp, fwlen, fwhash, patchlen, patchfilter)
     else:
         logger.info('Skipping upload')